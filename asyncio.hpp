@@ -0,0 +1,1731 @@
+/// \file asyncio.hpp.
+/// \author Лошкарев Дмитрий.
+/// \date 14.10.2026.
+///
+/// \brief Содержит асинхронный ввод-вывод на сопрограммах C++20 и
+/// асинхронные загрузку и сохранение снимков хеш-таблиц.
+///
+/// \namespaces
+/// • DataStructures
+/// \classes
+/// • Task
+/// • AsyncFile
+/// • IoRequest
+/// • AsyncIo
+/// • AsyncSnapshot
+
+#ifndef CPPPROJECT_ASYNCIO_H
+#define CPPPROJECT_ASYNCIO_H
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#ifdef _WIN32
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #include <windows.h>
+#else
+    #include <cerrno>
+    #include <fcntl.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+// io_uring используется через системные вызовы напрямую, liburing не нужна.
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+    #define ASYNCIO_HAS_IO_URING 1
+    #include <linux/io_uring.h>
+    #include <sys/mman.h>
+    #include <sys/syscall.h>
+    #include <sys/uio.h>
+#endif
+
+#include "orderhashtable.hpp"
+#include "snapshot.hpp"
+
+namespace DataStructures {
+// Объявление перечислений.
+
+    /// \enum Перечисление IoBackend описывает способ выполнения
+    /// асинхронных операций.
+    ///
+    /// \n • THREADS - операции выполняют рабочие потоки AsyncIo
+    /// обычными pread / pwrite;
+    /// \n • IO_URING - операции отправляются в очередь io_uring ядра Linux
+    /// и не занимают потоков.
+    enum class IoBackend {
+        THREADS,
+        IO_URING
+    };
+
+    /// \enum Перечисление FileAccess описывает режим открытия файла.
+    ///
+    /// \n • READ - чтение существующего файла;
+    /// \n • WRITE - запись, файл создается или обрезается.
+    enum class FileAccess {
+        READ,
+        WRITE
+    };
+
+    /// \enum Перечисление IoOperation описывает вид асинхронной операции.
+    ///
+    /// \n • READ - чтение с указанного смещения;
+    /// \n • WRITE - запись с указанного смещения;
+    /// \n • SYNC - сброс записанных данных файла на диск (fsync).
+    enum class IoOperation {
+        READ,
+        WRITE,
+        SYNC
+    };
+
+// Объявление классов.
+
+    class AsyncIo;
+
+    template <class T = void>
+    class Task;
+
+    /// \class Класс TaskResult хранит результат или исключение
+    /// сопрограммы Task.
+    ///
+    /// \tparam T Тип результата.
+    template <class T>
+    class TaskResult {
+        private:
+            std::optional<T> value_;
+            std::exception_ptr error_;
+        public:
+            template <class Value>
+            void return_value(Value&&);
+            void unhandled_exception() noexcept;
+            [[nodiscard]]
+            T take();
+    };
+
+    /// \class Специализация TaskResult для сопрограмм без результата.
+    template <>
+    class TaskResult<void> {
+        private:
+            std::exception_ptr error_;
+        public:
+            void return_void() noexcept;
+            void unhandled_exception() noexcept;
+            void take();
+    };
+
+    /// \class Класс Task предоставляет ленивую сопрограмму с результатом.
+    ///
+    /// Сопрограмма начинает выполняться, только когда ее ожидают через
+    /// co_await или запускают методом AsyncIo::run. По завершении
+    /// управление сразу передается ожидавшей сопрограмме (symmetric
+    /// transfer), поэтому длинные цепочки co_await не растят стек.
+    /// Исключение сопрограммы возбуждается в ожидающей ее стороне.
+    ///
+    /// Публичные методы:
+    /// \n • bool await_ready() const noexcept;
+    /// \n • std::coroutine_handle<> await_suspend(
+    /// std::coroutine_handle<> waiter) noexcept;
+    /// \n • T await_resume().
+    ///
+    /// \tparam T Тип результата или void.
+    template <class T>
+    class Task {
+        public:
+            class promise_type;
+        private:
+            using Handle = std::coroutine_handle<promise_type>;
+
+            /// \class Структура FinalAwaiter передает управление
+            /// ожидающей сопрограмме после завершения.
+            struct FinalAwaiter {
+                [[nodiscard]]
+                bool await_ready() const noexcept;
+                [[nodiscard]]
+                std::coroutine_handle<> await_suspend(Handle) const noexcept;
+                void await_resume() const noexcept;
+            };
+
+            Handle handle_;
+
+            explicit Task(Handle) noexcept;
+
+            friend class AsyncIo;
+        public:
+            /// \class Класс promise_type описывает состояние сопрограммы.
+            class promise_type : public TaskResult<T> {
+                private:
+                    std::coroutine_handle<> waiter_;  ///< \brief Ожидающая сопрограмма.
+
+                    friend class Task;
+                public:
+                    [[nodiscard]]
+                    Task get_return_object() noexcept;
+                    [[nodiscard]]
+                    std::suspend_always initial_suspend() const noexcept;
+                    [[nodiscard]]
+                    FinalAwaiter final_suspend() const noexcept;
+            };
+
+            Task(const Task&) = delete;
+            Task(Task&&) noexcept;
+            Task& operator = (const Task&) = delete;
+            Task& operator = (Task&&) noexcept;
+            ~Task();
+
+            [[nodiscard]]
+            bool await_ready() const noexcept;
+            [[nodiscard]]
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<>) noexcept;
+            T await_resume();
+    };
+
+    /// \class Класс AsyncFile предоставляет файл для позиционного чтения и
+    /// записи.
+    ///
+    /// Публичные методы:
+    /// \n • uint64_t size() const
+    /// \n • int64_t read_at(void* buffer, const size_t& length,
+    /// const uint64_t& offset) const noexcept
+    /// \n • int64_t write_at(const void* buffer, const size_t& length,
+    /// const uint64_t& offset) const noexcept
+    /// \n • int64_t sync() const noexcept
+    class AsyncFile {
+        private:
+#ifdef _WIN32
+            HANDLE handle_;
+#else
+            int descriptor_;
+#endif
+            std::filesystem::path path_;
+
+            void release() noexcept;
+
+            friend class AsyncIo;
+        public:
+            explicit AsyncFile(const std::filesystem::path&,
+                               const FileAccess& access = FileAccess::READ);
+            AsyncFile(const AsyncFile&) = delete;
+            AsyncFile& operator = (const AsyncFile&) = delete;
+            ~AsyncFile();
+
+            [[nodiscard]]
+            uint64_t size() const;
+            [[nodiscard]]
+            int64_t read_at(void*, const size_t&, const uint64_t&) const noexcept;
+            [[nodiscard]]
+            int64_t write_at(const void*, const size_t&, const uint64_t&) const noexcept;
+            [[nodiscard]]
+            int64_t sync() const noexcept;
+            [[nodiscard]] [[maybe_unused]]
+            inline const std::filesystem::path& path() const noexcept;
+    };
+
+    /// \class Класс IoRequest предоставляет одну асинхронную операцию
+    /// чтения, записи или сброса на диск, которую можно ожидать через
+    /// co_await.
+    ///
+    /// Операция отправляется при создании и выполняется, пока
+    /// сопрограмма занята другой работой: так чтение следующего блока
+    /// перекрывается с разбором текущего. co_await возвращает число
+    /// прочитанных или записанных байтов, которое может быть меньше
+    /// запрошенного. Буфер и файл должны жить до завершения операции;
+    /// незавершенная операция при уничтожении дожидается завершения.
+    ///
+    /// Публичные методы:
+    /// \n • Awaiter operator co_await () noexcept.
+    class IoRequest {
+        private:
+            /// \class Структура Awaiter приостанавливает сопрограмму до
+            /// завершения операции. Ожидание идет через ссылку, сама
+            /// операция не копируется и не перемещается.
+            struct Awaiter {
+                IoRequest& request_;
+
+                [[nodiscard]]
+                inline bool await_ready() const noexcept;
+                inline void await_suspend(std::coroutine_handle<>) const noexcept;
+                [[nodiscard]]
+                size_t await_resume() const;
+            };
+
+            AsyncIo* io_;
+            const AsyncFile* file_;
+            void* buffer_;
+            size_t length_;
+            uint64_t offset_;
+            IoOperation operation_;
+            bool done_;
+            int64_t result_;  ///< \brief Число байтов или -errno.
+            std::coroutine_handle<> waiter_;
+#ifdef ASYNCIO_HAS_IO_URING
+            iovec vector_;    ///< \brief Буфер операции для io_uring.
+#endif
+
+            friend class AsyncIo;
+        public:
+            explicit IoRequest(AsyncIo&, const AsyncFile&, std::span<std::byte>,
+                               const uint64_t&);
+            explicit IoRequest(AsyncIo&, const AsyncFile&, std::span<const std::byte>,
+                               const uint64_t&);
+            explicit IoRequest(AsyncIo&, const AsyncFile&);
+            IoRequest(const IoRequest&) = delete;
+            IoRequest& operator = (const IoRequest&) = delete;
+            ~IoRequest();
+
+            [[nodiscard]]
+            inline Awaiter operator co_await () noexcept;
+    };
+
+    /// \class Класс AsyncIo предоставляет цикл событий асинхронного
+    /// ввода-вывода, в котором выполняются сопрограммы Task.
+    ///
+    /// Все сопрограммы выполняются в потоке, вызвавшем run, и
+    /// возобновляются по завершении своих операций, поэтому разбор и
+    /// вставка в таблицы не требуют синхронизации, а чтение многих файлов
+    /// идет одновременно без отдельного потока на файл. Операции,
+    /// отправленные между опросами, уходят в ядро одним системным
+    /// вызовом.
+    ///
+    /// На Linux операции выполняет io_uring; если ядро его не
+    /// поддерживает или запрещает, AsyncIo переходит на рабочие потоки
+    /// с pread / pwrite. Узнать выбранный способ можно методом backend().
+    /// Методы класса вызываются из одного потока.
+    ///
+    /// Публичные методы:
+    /// \n • IoBackend backend() const noexcept;
+    /// \n • IoRequest read(const AsyncFile& file, std::span<std::byte> buffer,
+    /// const uint64_t& offset);
+    /// \n • IoRequest write(const AsyncFile& file,
+    /// std::span<const std::byte> buffer, const uint64_t& offset);
+    /// \n • IoRequest sync(const AsyncFile& file);
+    /// \n • T run(Task<T> task);
+    /// \n • static Task<void> when_all(std::vector<Task<void>> tasks).
+    class AsyncIo {
+        private:
+            // Статические константы класса.
+            static inline constexpr unsigned DEFAULT_QUEUE_DEPTH{ 64 };   ///< \brief Глубина очереди io_uring.
+            static inline constexpr size_t DEFAULT_THREAD_COUNT{ 4 };     ///< \brief Рабочих потоков без io_uring.
+            static inline constexpr size_t MAX_REQUEST_LENGTH{ 1 << 30 }; ///< \brief Байтов за одну операцию.
+
+            /// \class Структура JoinState описывает общее состояние
+            /// сопрограмм when_all.
+            struct JoinState {
+                size_t remaining_;                ///< \brief Незавершенных сопрограмм + 1.
+                std::coroutine_handle<> parent_;
+                std::exception_ptr error_;        ///< \brief Первое исключение.
+            };
+
+            /// \class Структура JoinAwaiter запускает сопрограммы when_all
+            /// и приостанавливает ожидающую, пока они не завершатся.
+            struct JoinAwaiter {
+                std::vector<Task<void>>& tasks_;
+                JoinState& state_;
+
+                [[nodiscard]]
+                bool await_ready() const noexcept;
+                [[nodiscard]]
+                bool await_suspend(std::coroutine_handle<>);
+                void await_resume() const noexcept;
+            };
+
+            /// \class Структура Detached описывает сопрограмму, которая
+            /// начинается сразу и сама освобождает свой кадр.
+            struct Detached {
+                struct promise_type {
+                    [[nodiscard]]
+                    Detached get_return_object() const noexcept;
+                    [[nodiscard]]
+                    std::suspend_never initial_suspend() const noexcept;
+                    [[nodiscard]]
+                    std::suspend_never final_suspend() const noexcept;
+                    void return_void() const noexcept;
+                    void unhandled_exception() const noexcept;
+                };
+            };
+
+#ifdef ASYNCIO_HAS_IO_URING
+            /// \class Структура Ring описывает отображенные очереди
+            /// io_uring.
+            struct Ring {
+                int descriptor_{ -1 };
+                void* sq_ring_{ nullptr };
+                size_t sq_ring_size_{};
+                void* cq_ring_{ nullptr };
+                size_t cq_ring_size_{};
+                io_uring_sqe* sqes_{ nullptr };
+                size_t sqes_size_{};
+                unsigned* sq_tail_{ nullptr };
+                unsigned* sq_mask_{ nullptr };
+                unsigned* sq_array_{ nullptr };
+                unsigned* cq_head_{ nullptr };
+                unsigned* cq_tail_{ nullptr };
+                unsigned* cq_mask_{ nullptr };
+                io_uring_cqe* cqes_{ nullptr };
+                unsigned entries_{};           ///< \brief Емкость очереди отправки.
+                unsigned queued_{};            ///< \brief Добавлено, но не отправлено в ядро.
+                unsigned in_flight_{};         ///< \brief Добавлено и не завершено.
+            };
+
+            Ring ring_;
+            std::deque<IoRequest*> backlog_;  ///< \brief Операции, не уместившиеся в очередь.
+#endif
+            IoBackend backend_;
+            size_t pending_;                  ///< \brief Отправленных и не завершенных операций.
+
+            // Рабочие потоки для IoBackend::THREADS.
+            std::vector<std::thread> workers_;
+            std::mutex mutex_;
+            std::condition_variable work_;        ///< \brief Уведомляет рабочих о новой операции.
+            std::condition_variable completed_;   ///< \brief Уведомляет цикл о завершении.
+            std::deque<IoRequest*> queue_;
+            std::vector<std::pair<IoRequest*, int64_t>> completions_;
+            bool stopping_;
+
+#ifdef ASYNCIO_HAS_IO_URING
+            [[nodiscard]]
+            bool setup_ring(const unsigned&) noexcept;
+            void release_ring() noexcept;
+            void push_ring(IoRequest&) noexcept;
+            void poll_ring(std::vector<std::pair<IoRequest*, int64_t>>&);
+#endif
+            void work();
+            void submit(IoRequest&);
+            void poll();
+            void wait(IoRequest&);
+            static Detached join(Task<void>&, JoinState&);
+
+            friend class IoRequest;
+        public:
+            explicit AsyncIo(const IoBackend& backend = IoBackend::IO_URING,
+                             const unsigned& queue_depth = DEFAULT_QUEUE_DEPTH,
+                             const size_t& thread_count = DEFAULT_THREAD_COUNT);
+            AsyncIo(const AsyncIo&) = delete;
+            AsyncIo& operator = (const AsyncIo&) = delete;
+            ~AsyncIo();
+
+            [[nodiscard]] [[maybe_unused]]
+            inline IoBackend backend() const noexcept;
+            [[nodiscard]]
+            IoRequest read(const AsyncFile& file, std::span<std::byte> buffer,
+                           const uint64_t& offset);
+            [[nodiscard]]
+            IoRequest write(const AsyncFile& file, std::span<const std::byte> buffer,
+                            const uint64_t& offset);
+            [[nodiscard]]
+            IoRequest sync(const AsyncFile& file);
+            template <class T>
+            T run(Task<T> task);
+            [[nodiscard]]
+            static Task<void> when_all(std::vector<Task<void>> tasks);
+    };
+
+    /// \class Класс AsyncSnapshot предоставляет асинхронные загрузку и
+    /// сохранение хеш-таблицы в формате снимка MappedOrderedHashTable.
+    ///
+    /// Загрузка читает файл блоками по два буфера: пока разбирается и
+    /// вставляется в таблицу один блок, ядро уже читает следующий.
+    /// Сохранение пишет индекс снимка и кучу строк одновременно, а кучу
+    /// собирает в блок, пока предыдущий блок пишется. Сопрограммы многих
+    /// таблиц выполняются одновременно в одном AsyncIo (см.
+    /// AsyncIo::when_all). Таблица должна жить до завершения сопрограммы и
+    /// не изменяться другими потоками во время нее.
+    ///
+    /// Публичные методы:
+    /// \n • static Task<void> load(AsyncIo& io, OrderedHashTable<HashType,
+    /// StoragePolicy, Hasher, Allocator>& table, std::filesystem::path path,
+    /// size_t block_size);
+    /// \n • static Task<void> flush(AsyncIo& io, const OrderedHashTable<
+    /// HashType, StoragePolicy, Hasher, Allocator>& table,
+    /// std::filesystem::path path, size_t block_size).
+    ///
+    /// \tparam HashType Тип значений: trivially copyable тип или
+    /// std::string.
+    /// \tparam Hasher Функция хеширования ключей.
+    template <class HashType, class Hasher = WyHasher>
+    class AsyncSnapshot {
+        private:
+            using Snapshot = MappedOrderedHashTable<HashType, Hasher>;
+            using Header = typename Snapshot::Header;
+            using Slot = typename Snapshot::Slot;
+            using Entry = typename Snapshot::Entry;
+            using StringRef = typename Snapshot::StringRef;
+
+            /// \class Класс Decoder разбирает записи и кучу снимка по мере
+            /// чтения блоков и вставляет записи в таблицу.
+            class Decoder {
+                private:
+                    const Header& header_;
+                    std::vector<Entry> entries_;
+                    std::string pending_;  ///< \brief Прочитанные байты записи на границе блоков.
+                    uint64_t cursor_;      ///< \brief Смещение в куче начала записи next_.
+                    size_t next_;          ///< \brief Первая не вставленная запись.
+
+                    [[nodiscard]]
+                    uint64_t record_end(const Entry&) const;
+                    template <class Table>
+                    void insert(Table&, const Entry&, const char*) const;
+                public:
+                    explicit Decoder(const Header&);
+
+                    template <class Table>
+                    void feed(Table&, uint64_t, std::span<const std::byte>);
+                    template <class Table>
+                    void finish(Table&);
+            };
+
+            [[nodiscard]]
+            static Task<void> write_all(AsyncIo&, const AsyncFile&,
+                                        std::span<const std::byte>, uint64_t);
+            template <class Table>
+            [[nodiscard]]
+            static Task<void> write_heap(AsyncIo&, const AsyncFile&, const Table&,
+                                         uint64_t, size_t);
+        public:
+            // Статические константы класса.
+            static inline constexpr size_t DEFAULT_BLOCK_SIZE{ 1 << 20 };  ///< \brief Размер блока в байтах.
+
+            template <class StoragePolicy, class Allocator>
+            [[nodiscard]] [[maybe_unused]]
+            static Task<void> load(AsyncIo& io,
+                                   OrderedHashTable<HashType, StoragePolicy, Hasher,
+                                                    Allocator>& table,
+                                   std::filesystem::path path,
+                                   size_t block_size = DEFAULT_BLOCK_SIZE);
+            template <class StoragePolicy, class Allocator>
+            [[nodiscard]] [[maybe_unused]]
+            static Task<void> flush(AsyncIo& io,
+                                    const OrderedHashTable<HashType, StoragePolicy,
+                                                           Hasher, Allocator>& table,
+                                    std::filesystem::path path,
+                                    size_t block_size = DEFAULT_BLOCK_SIZE);
+    };
+
+    /// \brief Асинхронно загружает снимок в таблицу
+    /// (см. AsyncSnapshot::load).
+    template <class T, class S, class H, class A>
+    [[nodiscard]] [[maybe_unused]]
+    Task<void> load_async(AsyncIo& io, OrderedHashTable<T, S, H, A>& table,
+                          std::filesystem::path path,
+                          size_t block_size = AsyncSnapshot<T, H>::DEFAULT_BLOCK_SIZE) {
+        return AsyncSnapshot<T, H>::load(io, table, std::move(path), block_size);
+    }
+
+    /// \brief Асинхронно сохраняет снимок таблицы
+    /// (см. AsyncSnapshot::flush).
+    template <class T, class S, class H, class A>
+    [[nodiscard]] [[maybe_unused]]
+    Task<void> flush_async(AsyncIo& io, const OrderedHashTable<T, S, H, A>& table,
+                           std::filesystem::path path,
+                           size_t block_size = AsyncSnapshot<T, H>::DEFAULT_BLOCK_SIZE) {
+        return AsyncSnapshot<T, H>::flush(io, table, std::move(path), block_size);
+    }
+
+// Определения методов классов.
+/* =============================== TaskResult =============================== */
+// PUBLIC
+
+    /// \brief Сохраняет результат сопрограммы.
+    ///
+    /// \param value Результат.
+    template <class T>
+    template <class Value>
+    void TaskResult<T>::return_value(Value&& value) {
+        this->value_.emplace(std::forward<Value>(value));
+    }
+
+    // Сохраняет исключение сопрограммы.
+    template <class T>
+    void TaskResult<T>::unhandled_exception() noexcept {
+        this->error_ = std::current_exception();
+    }
+
+    /// \brief Забирает результат сопрограммы.
+    ///
+    /// \return Результат.
+    ///
+    /// \throw Исключение, возбужденное сопрограммой.
+    template <class T>
+    [[nodiscard]]
+    T TaskResult<T>::take() {
+        if (this->error_)
+            std::rethrow_exception(this->error_);
+        return std::move(*this->value_);
+    }
+
+    // Отмечает завершение сопрограммы без результата.
+    inline void TaskResult<void>::return_void() noexcept { }
+
+    // Сохраняет исключение сопрограммы.
+    inline void TaskResult<void>::unhandled_exception() noexcept {
+        this->error_ = std::current_exception();
+    }
+
+    /// \brief Проверяет, что сопрограмма завершилась без исключения.
+    ///
+    /// \throw Исключение, возбужденное сопрограммой.
+    inline void TaskResult<void>::take() {
+        if (this->error_)
+            std::rethrow_exception(this->error_);
+    }
+
+/* ========================== Task::FinalAwaiter ========================== */
+// PUBLIC
+
+    // Завершившаяся сопрограмма всегда приостанавливается.
+    template <class T>
+    [[nodiscard]]
+    bool Task<T>::FinalAwaiter::await_ready() const noexcept {
+        return false;
+    }
+
+    /// \brief Передает управление ожидающей сопрограмме.
+    ///
+    /// \param handle Завершившаяся сопрограмма.
+    ///
+    /// \return Ожидающую сопрограмму или пустую, если сопрограмму
+    /// запустил AsyncIo::run.
+    template <class T>
+    [[nodiscard]]
+    std::coroutine_handle<> Task<T>::FinalAwaiter::await_suspend(Handle handle)
+    const noexcept {
+        std::coroutine_handle<> waiter{ handle.promise().waiter_ };
+        return waiter ? waiter : std::noop_coroutine();
+    }
+
+    template <class T>
+    void Task<T>::FinalAwaiter::await_resume() const noexcept { }
+
+/* ========================== Task::promise_type ========================== */
+// PUBLIC
+
+    /// \brief Создает объект сопрограммы.
+    ///
+    /// \return Объект Task.
+    template <class T>
+    [[nodiscard]]
+    Task<T> Task<T>::promise_type::get_return_object() noexcept {
+        return Task(Handle::from_promise(*this));
+    }
+
+    // Сопрограмма не начинается до первого ожидания.
+    template <class T>
+    [[nodiscard]]
+    std::suspend_always Task<T>::promise_type::initial_suspend() const noexcept {
+        return {};
+    }
+
+    template <class T>
+    [[nodiscard]]
+    Task<T>::FinalAwaiter Task<T>::promise_type::final_suspend() const noexcept {
+        return {};
+    }
+
+/* ================================== Task ================================== */
+// PRIVATE
+
+    /// \brief Конструктор экземпляра класса Task по кадру сопрограммы.
+    ///
+    /// \param handle Кадр сопрограммы.
+    template <class T>
+    Task<T>::Task(Handle handle) noexcept : handle_(handle) { }
+
+// PUBLIC
+
+    /// \brief Конструктор перемещения экземпляра класса Task.
+    ///
+    /// \param other Перемещаемая сопрограмма.
+    template <class T>
+    Task<T>::Task(Task&& other) noexcept : handle_(std::exchange(other.handle_, nullptr)) { }
+
+    /// \brief Оператор присваивания перемещением.
+    ///
+    /// \param other Перемещаемая сопрограмма.
+    ///
+    /// \return Ссылку на текущий экземпляр.
+    template <class T>
+    Task<T>& Task<T>::operator = (Task&& other) noexcept {
+        if (this != &other) {
+            if (this->handle_)
+                this->handle_.destroy();
+            this->handle_ = std::exchange(other.handle_, nullptr);
+        }
+        return *this;
+    }
+
+    // Стандартный деструктор экземпляра.
+    template <class T>
+    Task<T>::~Task() {
+        if (this->handle_)
+            this->handle_.destroy();
+    }
+
+    // Сопрограмма запускается только при ожидании.
+    template <class T>
+    [[nodiscard]]
+    bool Task<T>::await_ready() const noexcept {
+        return false;
+    }
+
+    /// \brief Запускает сопрограмму, запоминая ожидающую.
+    ///
+    /// \param waiter Ожидающая сопрограмма.
+    ///
+    /// \return Сопрограмму, которой передается управление.
+    template <class T>
+    [[nodiscard]]
+    std::coroutine_handle<> Task<T>::await_suspend(std::coroutine_handle<> waiter) noexcept {
+        this->handle_.promise().waiter_ = waiter;
+        return this->handle_;
+    }
+
+    /// \brief Забирает результат завершившейся сопрограммы.
+    ///
+    /// \return Результат.
+    ///
+    /// \throw Исключение, возбужденное сопрограммой.
+    template <class T>
+    T Task<T>::await_resume() {
+        return this->handle_.promise().take();
+    }
+
+/* =============================== AsyncFile =============================== */
+// PRIVATE
+
+    // Закрывает файл.
+    inline void AsyncFile::release() noexcept {
+#ifdef _WIN32
+        if (this->handle_ != INVALID_HANDLE_VALUE)
+            CloseHandle(this->handle_);
+        this->handle_ = INVALID_HANDLE_VALUE;
+#else
+        if (this->descriptor_ >= 0)
+            close(this->descriptor_);
+        this->descriptor_ = -1;
+#endif
+    }
+
+// PUBLIC
+
+    /// \brief Стандартный конструктор экземпляра класса AsyncFile.
+    ///
+    /// \param path Путь к файлу.
+    /// \param access Режим открытия.
+    ///
+    /// \throw std::runtime_error Исключение возбуждается, если файл не
+    /// удалось открыть.
+    inline AsyncFile::AsyncFile(const std::filesystem::path& path,
+                                const FileAccess& access) :
+#ifdef _WIN32
+            handle_(INVALID_HANDLE_VALUE),
+#else
+            descriptor_(-1),
+#endif
+            path_(path) {
+        const bool write{ access == FileAccess::WRITE };
+#ifdef _WIN32
+        this->handle_ = CreateFileW(path.c_str(), write ? GENERIC_WRITE : GENERIC_READ,
+                                    FILE_SHARE_READ, nullptr,
+                                    write ? CREATE_ALWAYS : OPEN_EXISTING,
+                                    FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (this->handle_ == INVALID_HANDLE_VALUE)
+#else
+        this->descriptor_ = write ? open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644)
+                                  : open(path.c_str(), O_RDONLY);
+        if (this->descriptor_ < 0)
+#endif
+            throw std::runtime_error("Cannot open file \"" + path.string() + "\".");
+    }
+
+    // Стандартный деструктор экземпляра.
+    inline AsyncFile::~AsyncFile() {
+        this->release();
+    }
+
+    /// \brief Позволяет получить размер файла.
+    ///
+    /// \return Размер в байтах.
+    ///
+    /// \throw std::runtime_error Исключение возбуждается, если размер не
+    /// удалось узнать.
+    [[nodiscard]]
+    inline uint64_t AsyncFile::size() const {
+#ifdef _WIN32
+        LARGE_INTEGER size;
+        if (GetFileSizeEx(this->handle_, &size))
+            return static_cast<uint64_t>(size.QuadPart);
+#else
+        struct stat status{};
+        if (fstat(this->descriptor_, &status) == 0)
+            return static_cast<uint64_t>(status.st_size);
+#endif
+        throw std::runtime_error("Cannot stat file \"" + this->path_.string() + "\".");
+    }
+
+    /// \brief Синхронно читает байты с указанного смещения.
+    ///
+    /// \param buffer Буфер.
+    /// \param length Размер буфера.
+    /// \param offset Смещение в файле.
+    ///
+    /// \return Число прочитанных байтов или -errno.
+    [[nodiscard]]
+    inline int64_t AsyncFile::read_at(void* buffer, const size_t& length,
+                                      const uint64_t& offset) const noexcept {
+#ifdef _WIN32
+        OVERLAPPED position{};
+        position.Offset = static_cast<DWORD>(offset);
+        position.OffsetHigh = static_cast<DWORD>(offset >> 32);
+        DWORD count{};
+        if (!ReadFile(this->handle_, buffer, static_cast<DWORD>(length), &count, &position))
+            return (GetLastError() == ERROR_HANDLE_EOF) ? 0 : -EIO;
+        return count;
+#else
+        ssize_t count;
+        do
+            count = pread(this->descriptor_, buffer, length, static_cast<off_t>(offset));
+        while (count < 0 && errno == EINTR);
+        return (count < 0) ? -errno : count;
+#endif
+    }
+
+    /// \brief Синхронно пишет байты с указанного смещения.
+    ///
+    /// \param buffer Буфер.
+    /// \param length Размер буфера.
+    /// \param offset Смещение в файле.
+    ///
+    /// \return Число записанных байтов или -errno.
+    [[nodiscard]]
+    inline int64_t AsyncFile::write_at(const void* buffer, const size_t& length,
+                                       const uint64_t& offset) const noexcept {
+#ifdef _WIN32
+        OVERLAPPED position{};
+        position.Offset = static_cast<DWORD>(offset);
+        position.OffsetHigh = static_cast<DWORD>(offset >> 32);
+        DWORD count{};
+        if (!WriteFile(this->handle_, buffer, static_cast<DWORD>(length), &count, &position))
+            return -EIO;
+        return count;
+#else
+        ssize_t count;
+        do
+            count = pwrite(this->descriptor_, buffer, length, static_cast<off_t>(offset));
+        while (count < 0 && errno == EINTR);
+        return (count < 0) ? -errno : count;
+#endif
+    }
+
+    /// \brief Синхронно сбрасывает записанные данные файла на диск.
+    ///
+    /// \return 0 или -errno.
+    [[nodiscard]]
+    inline int64_t AsyncFile::sync() const noexcept {
+#ifdef _WIN32
+        return FlushFileBuffers(this->handle_) ? 0 : -EIO;
+#else
+        int result;
+        do
+            result = fsync(this->descriptor_);
+        while (result < 0 && errno == EINTR);
+        return (result < 0) ? -errno : 0;
+#endif
+    }
+
+    /// \brief Предоставляет доступ к пути файла.
+    ///
+    /// \return Путь.
+    [[nodiscard]] [[maybe_unused]]
+    inline const std::filesystem::path& AsyncFile::path() const noexcept {
+        return this->path_;
+    }
+
+/* =========================== IoRequest::Awaiter =========================== */
+// PUBLIC
+
+    /// \brief Проверяет, завершилась ли операция.
+    ///
+    /// \return true, если ожидание не нужно.
+    [[nodiscard]]
+    inline bool IoRequest::Awaiter::await_ready() const noexcept {
+        return this->request_.done_;
+    }
+
+    /// \brief Запоминает сопрограмму, возобновляемую по завершении.
+    ///
+    /// \param waiter Ожидающая сопрограмма.
+    inline void IoRequest::Awaiter::await_suspend(std::coroutine_handle<> waiter)
+    const noexcept {
+        this->request_.waiter_ = waiter;
+    }
+
+    /// \brief Позволяет получить итог операции.
+    ///
+    /// \return Число прочитанных или записанных байтов (0 для сброса на диск).
+    ///
+    /// \throw std::system_error Исключение возбуждается, если операция
+    /// завершилась ошибкой.
+    [[nodiscard]]
+    inline size_t IoRequest::Awaiter::await_resume() const {
+        const IoRequest& request{ this->request_ };
+        if (request.result_ < 0)
+            throw std::system_error(static_cast<int>(-request.result_), std::generic_category(),
+                                    "Asynchronous I/O on \"" + request.file_->path().string() +
+                                    "\" failed");
+        return static_cast<size_t>(request.result_);
+    }
+
+/* =============================== IoRequest =============================== */
+// PUBLIC
+
+    /// \brief Конструктор операции чтения.
+    ///
+    /// \param io Цикл событий.
+    /// \param file Файл.
+    /// \param buffer Буфер для данных.
+    /// \param offset Смещение в файле.
+    inline IoRequest::IoRequest(AsyncIo& io, const AsyncFile& file,
+                                std::span<std::byte> buffer, const uint64_t& offset) :
+            io_(&io), file_(&file), buffer_(buffer.data()),
+            length_(std::min(buffer.size(), AsyncIo::MAX_REQUEST_LENGTH)),
+            offset_(offset), operation_(IoOperation::READ), done_(false), result_(0),
+            waiter_() {
+        io.submit(*this);
+    }
+
+    /// \brief Конструктор операции записи.
+    ///
+    /// \param io Цикл событий.
+    /// \param file Файл.
+    /// \param buffer Записываемые данные.
+    /// \param offset Смещение в файле.
+    inline IoRequest::IoRequest(AsyncIo& io, const AsyncFile& file,
+                                std::span<const std::byte> buffer, const uint64_t& offset) :
+            io_(&io), file_(&file), buffer_(const_cast<std::byte*>(buffer.data())),
+            length_(std::min(buffer.size(), AsyncIo::MAX_REQUEST_LENGTH)),
+            offset_(offset), operation_(IoOperation::WRITE), done_(false), result_(0),
+            waiter_() {
+        io.submit(*this);
+    }
+
+    /// \brief Конструктор операции сброса файла на диск.
+    ///
+    /// \param io Цикл событий.
+    /// \param file Файл.
+    inline IoRequest::IoRequest(AsyncIo& io, const AsyncFile& file) :
+            io_(&io), file_(&file), buffer_(nullptr), length_(0), offset_(0),
+            operation_(IoOperation::SYNC), done_(false), result_(0), waiter_() {
+        io.submit(*this);
+    }
+
+    // Стандартный деструктор экземпляра: дожидается незавершенной операции.
+    inline IoRequest::~IoRequest() {
+        if (!this->done_) {
+            this->waiter_ = nullptr;
+            this->io_->wait(*this);
+        }
+    }
+
+    /// \brief Позволяет ожидать операцию через co_await.
+    ///
+    /// \return Объект ожидания.
+    [[nodiscard]]
+    inline IoRequest::Awaiter IoRequest::operator co_await () noexcept {
+        return Awaiter{ *this };
+    }
+
+/* ======================== AsyncIo::JoinAwaiter ======================== */
+// PUBLIC
+
+    [[nodiscard]]
+    inline bool AsyncIo::JoinAwaiter::await_ready() const noexcept {
+        return false;
+    }
+
+    /// \brief Запускает все сопрограммы.
+    ///
+    /// \param parent Ожидающая сопрограмма.
+    ///
+    /// \return false, если все сопрограммы уже завершились.
+    [[nodiscard]]
+    inline bool AsyncIo::JoinAwaiter::await_suspend(std::coroutine_handle<> parent) {
+        this->state_.parent_ = parent;
+        for (Task<void>& task : this->tasks_)
+            join(task, this->state_);
+        return --this->state_.remaining_ != 0;
+    }
+
+    inline void AsyncIo::JoinAwaiter::await_resume() const noexcept { }
+
+/* ===================== AsyncIo::Detached::promise_type ===================== */
+// PUBLIC
+
+    /// \brief Создает объект сопрограммы.
+    ///
+    /// \return Объект Detached.
+    [[nodiscard]]
+    inline AsyncIo::Detached AsyncIo::Detached::promise_type::get_return_object()
+    const noexcept {
+        return {};
+    }
+
+    // Сопрограмма начинается сразу.
+    [[nodiscard]]
+    inline std::suspend_never AsyncIo::Detached::promise_type::initial_suspend()
+    const noexcept {
+        return {};
+    }
+
+    // Кадр освобождается сразу после завершения.
+    [[nodiscard]]
+    inline std::suspend_never AsyncIo::Detached::promise_type::final_suspend()
+    const noexcept {
+        return {};
+    }
+
+    inline void AsyncIo::Detached::promise_type::return_void() const noexcept { }
+
+    // Исключения перехватывает сама сопрограмма join, поэтому сюда
+    // они не доходят.
+    inline void AsyncIo::Detached::promise_type::unhandled_exception() const noexcept {
+        std::terminate();
+    }
+
+/* ================================ AsyncIo ================================ */
+// PRIVATE
+
+#ifdef ASYNCIO_HAS_IO_URING
+    /// \brief Создает и отображает очереди io_uring.
+    ///
+    /// \param queue_depth Желаемая емкость очереди отправки.
+    ///
+    /// \return false, если io_uring недоступен.
+    [[nodiscard]]
+    inline bool AsyncIo::setup_ring(const unsigned& queue_depth) noexcept {
+        io_uring_params params{};
+        const long descriptor{ syscall(__NR_io_uring_setup, queue_depth, &params) };
+        if (descriptor < 0)
+            return false;
+        Ring& ring{ this->ring_ };
+        ring.descriptor_ = static_cast<int>(descriptor);
+
+        ring.sq_ring_size_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        ring.cq_ring_size_ = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        const bool single_mmap{ (params.features & IORING_FEAT_SINGLE_MMAP) != 0 };
+        if (single_mmap)
+            ring.sq_ring_size_ = ring.cq_ring_size_ =
+                    std::max(ring.sq_ring_size_, ring.cq_ring_size_);
+        void* sq_ring{ mmap(nullptr, ring.sq_ring_size_, PROT_READ | PROT_WRITE,
+                            MAP_SHARED | MAP_POPULATE, ring.descriptor_, IORING_OFF_SQ_RING) };
+        if (sq_ring == MAP_FAILED) {
+            this->release_ring();
+            return false;
+        }
+        ring.sq_ring_ = sq_ring;
+        if (single_mmap)
+            ring.cq_ring_ = sq_ring;
+        else {
+            void* cq_ring{ mmap(nullptr, ring.cq_ring_size_, PROT_READ | PROT_WRITE,
+                                MAP_SHARED | MAP_POPULATE, ring.descriptor_,
+                                IORING_OFF_CQ_RING) };
+            if (cq_ring == MAP_FAILED) {
+                this->release_ring();
+                return false;
+            }
+            ring.cq_ring_ = cq_ring;
+        }
+        ring.sqes_size_ = params.sq_entries * sizeof(io_uring_sqe);
+        void* sqes{ mmap(nullptr, ring.sqes_size_, PROT_READ | PROT_WRITE,
+                         MAP_SHARED | MAP_POPULATE, ring.descriptor_, IORING_OFF_SQES) };
+        if (sqes == MAP_FAILED) {
+            this->release_ring();
+            return false;
+        }
+        ring.sqes_ = static_cast<io_uring_sqe*>(sqes);
+
+        auto* sq_base{ static_cast<unsigned char*>(ring.sq_ring_) };
+        auto* cq_base{ static_cast<unsigned char*>(ring.cq_ring_) };
+        ring.sq_tail_ = reinterpret_cast<unsigned*>(sq_base + params.sq_off.tail);
+        ring.sq_mask_ = reinterpret_cast<unsigned*>(sq_base + params.sq_off.ring_mask);
+        ring.sq_array_ = reinterpret_cast<unsigned*>(sq_base + params.sq_off.array);
+        ring.cq_head_ = reinterpret_cast<unsigned*>(cq_base + params.cq_off.head);
+        ring.cq_tail_ = reinterpret_cast<unsigned*>(cq_base + params.cq_off.tail);
+        ring.cq_mask_ = reinterpret_cast<unsigned*>(cq_base + params.cq_off.ring_mask);
+        ring.cqes_ = reinterpret_cast<io_uring_cqe*>(cq_base + params.cq_off.cqes);
+        ring.entries_ = params.sq_entries;
+        return true;
+    }
+
+    // Снимает отображение очередей и закрывает io_uring.
+    inline void AsyncIo::release_ring() noexcept {
+        Ring& ring{ this->ring_ };
+        if (ring.sqes_ != nullptr)
+            munmap(ring.sqes_, ring.sqes_size_);
+        if (ring.cq_ring_ != nullptr && ring.cq_ring_ != ring.sq_ring_)
+            munmap(ring.cq_ring_, ring.cq_ring_size_);
+        if (ring.sq_ring_ != nullptr)
+            munmap(ring.sq_ring_, ring.sq_ring_size_);
+        if (ring.descriptor_ >= 0)
+            close(ring.descriptor_);
+        ring = Ring{};
+    }
+
+    /// \brief Добавляет операцию в очередь отправки io_uring.
+    ///
+    /// В очереди должно быть свободное место. Операция уходит в ядро при
+    /// следующем опросе.
+    ///
+    /// \param request Операция.
+    inline void AsyncIo::push_ring(IoRequest& request) noexcept {
+        Ring& ring{ this->ring_ };
+        const unsigned tail{ *ring.sq_tail_ };
+        const unsigned index{ tail & *ring.sq_mask_ };
+        request.vector_ = { request.buffer_, request.length_ };
+
+        io_uring_sqe& sqe{ ring.sqes_[index] };
+        std::memset(&sqe, 0, sizeof(sqe));
+        sqe.fd = request.file_->descriptor_;
+        if (request.operation_ == IoOperation::SYNC)
+            sqe.opcode = IORING_OP_FSYNC;
+        else {
+            sqe.opcode = (request.operation_ == IoOperation::WRITE) ? IORING_OP_WRITEV
+                                                                     : IORING_OP_READV;
+            sqe.addr = reinterpret_cast<uintptr_t>(&request.vector_);
+            sqe.len = 1;
+            sqe.off = request.offset_;
+        }
+        sqe.user_data = reinterpret_cast<uintptr_t>(&request);
+        ring.sq_array_[index] = index;
+        std::atomic_ref<unsigned>{ *ring.sq_tail_ }.store(tail + 1, std::memory_order_release);
+        ring.queued_++;
+        ring.in_flight_++;
+    }
+
+    /// \brief Отправляет добавленные операции и ждет хотя бы одного
+    /// завершения.
+    ///
+    /// \param done Список, в который добавляются завершенные операции.
+    ///
+    /// \throw std::system_error Исключение возбуждается при ошибке
+    /// io_uring_enter.
+    inline void AsyncIo::poll_ring(std::vector<std::pair<IoRequest*, int64_t>>& done) {
+        Ring& ring{ this->ring_ };
+        while (!this->backlog_.empty() && ring.in_flight_ < ring.entries_) {
+            this->push_ring(*this->backlog_.front());
+            this->backlog_.pop_front();
+        }
+        while (true) {
+            const long submitted{ syscall(__NR_io_uring_enter, ring.descriptor_, ring.queued_,
+                                          1, IORING_ENTER_GETEVENTS, nullptr, 0) };
+            if (submitted >= 0) {
+                ring.queued_ -= static_cast<unsigned>(submitted);
+                break;
+            }
+            if (errno != EINTR)
+                throw std::system_error(errno, std::generic_category(), "io_uring_enter failed");
+        }
+
+        unsigned head{ *ring.cq_head_ };
+        const unsigned tail{ std::atomic_ref<unsigned>{ *ring.cq_tail_ }.load(
+                std::memory_order_acquire) };
+        for (; head != tail; head++) {
+            const io_uring_cqe& cqe{ ring.cqes_[head & *ring.cq_mask_] };
+            done.emplace_back(reinterpret_cast<IoRequest*>(static_cast<uintptr_t>(cqe.user_data)),
+                              cqe.res);
+            ring.in_flight_--;
+        }
+        std::atomic_ref<unsigned>{ *ring.cq_head_ }.store(head, std::memory_order_release);
+    }
+#endif
+
+    // Цикл рабочего потока: разбор очереди операций.
+    inline void AsyncIo::work() {
+        while (true) {
+            IoRequest* request;
+            {
+                std::unique_lock lock{ this->mutex_ };
+                this->work_.wait(lock, [this] {
+                    return this->stopping_ || !this->queue_.empty();
+                });
+                if (this->queue_.empty())
+                    return;
+                request = this->queue_.front();
+                this->queue_.pop_front();
+            }
+            int64_t result;
+            switch (request->operation_) {
+                case IoOperation::WRITE:
+                    result = request->file_->write_at(request->buffer_, request->length_,
+                                                      request->offset_);
+                    break;
+                case IoOperation::SYNC:
+                    result = request->file_->sync();
+                    break;
+                default:
+                    result = request->file_->read_at(request->buffer_, request->length_,
+                                                     request->offset_);
+            }
+            {
+                std::lock_guard lock{ this->mutex_ };
+                this->completions_.emplace_back(request, result);
+            }
+            this->completed_.notify_one();
+        }
+    }
+
+    /// \brief Отправляет операцию выбранным способом.
+    ///
+    /// \param request Операция.
+    inline void AsyncIo::submit(IoRequest& request) {
+        this->pending_++;
+#ifdef ASYNCIO_HAS_IO_URING
+        if (this->backend_ == IoBackend::IO_URING) {
+            if (this->ring_.in_flight_ < this->ring_.entries_)
+                this->push_ring(request);
+            else
+                this->backlog_.push_back(&request);
+            return;
+        }
+#endif
+        {
+            std::lock_guard lock{ this->mutex_ };
+            this->queue_.push_back(&request);
+        }
+        this->work_.notify_one();
+    }
+
+    /// \brief Ждет завершения хотя бы одной операции и возобновляет
+    /// ожидавшие их сопрограммы.
+    ///
+    /// Сначала отмечаются все завершенные операции, и только затем
+    /// возобновляются сопрограммы: возобновленная сопрограмма может
+    /// уничтожить другую завершенную операцию.
+    ///
+    /// \throw std::logic_error Исключение возбуждается, если ждать нечего.
+    inline void AsyncIo::poll() {
+        if (this->pending_ == 0)
+            throw std::logic_error("AsyncIo has no pending operations to wait for.");
+        std::vector<std::pair<IoRequest*, int64_t>> done;
+#ifdef ASYNCIO_HAS_IO_URING
+        if (this->backend_ == IoBackend::IO_URING)
+            this->poll_ring(done);
+        else
+#endif
+        {
+            std::unique_lock lock{ this->mutex_ };
+            this->completed_.wait(lock, [this] { return !this->completions_.empty(); });
+            done.swap(this->completions_);
+        }
+
+        std::vector<std::coroutine_handle<>> waiters;
+        waiters.reserve(done.size());
+        for (auto& [request, result] : done) {
+            request->result_ = result;
+            request->done_ = true;
+            if (request->waiter_)
+                waiters.push_back(std::exchange(request->waiter_, nullptr));
+        }
+        this->pending_ -= done.size();
+        for (std::coroutine_handle<> waiter : waiters)
+            waiter.resume();
+    }
+
+    /// \brief Выполняет цикл событий до завершения операции.
+    ///
+    /// \param request Операция.
+    inline void AsyncIo::wait(IoRequest& request) {
+        while (!request.done_)
+            this->poll();
+    }
+
+    /// \brief Выполняет одну сопрограмму when_all и отчитывается о ее
+    /// завершении.
+    ///
+    /// \param task Сопрограмма.
+    /// \param state Общее состояние when_all.
+    inline AsyncIo::Detached AsyncIo::join(Task<void>& task, JoinState& state) {
+        try {
+            co_await task;
+        }
+        catch (...) {
+            if (!state.error_)
+                state.error_ = std::current_exception();
+        }
+        if (--state.remaining_ == 0)
+            state.parent_.resume();
+    }
+
+// PUBLIC
+
+    /// \brief Стандартный конструктор экземпляра класса AsyncIo.
+    ///
+    /// \param backend Желаемый способ выполнения операций; без io_uring
+    /// используются рабочие потоки.
+    /// \param queue_depth Емкость очереди io_uring; операции сверх нее
+    /// ждут своей очереди.
+    /// \param thread_count Число рабочих потоков без io_uring (не меньше 1).
+    ///
+    /// \throw std::system_error Исключение возбуждается, если не удалось
+    /// создать рабочие потоки.
+    inline AsyncIo::AsyncIo(const IoBackend& backend, const unsigned& queue_depth,
+                            const size_t& thread_count) :
+            backend_(IoBackend::THREADS), pending_(0), stopping_(false) {
+#ifdef ASYNCIO_HAS_IO_URING
+        if (backend == IoBackend::IO_URING && this->setup_ring(std::max(queue_depth, 1U))) {
+            this->backend_ = IoBackend::IO_URING;
+            return;
+        }
+#else
+        static_cast<void>(backend);
+        static_cast<void>(queue_depth);
+#endif
+        for (size_t worker{}; worker < std::max(thread_count, size_t{ 1 }); worker++)
+            this->workers_.emplace_back(&AsyncIo::work, this);
+    }
+
+    // Стандартный деструктор экземпляра.
+    inline AsyncIo::~AsyncIo() {
+        {
+            std::lock_guard lock{ this->mutex_ };
+            this->stopping_ = true;
+        }
+        this->work_.notify_all();
+        for (std::thread& worker : this->workers_)
+            worker.join();
+#ifdef ASYNCIO_HAS_IO_URING
+        this->release_ring();
+#endif
+    }
+
+    /// \brief Предоставляет доступ к способу выполнения операций.
+    ///
+    /// \return Выбранный способ.
+    [[nodiscard]] [[maybe_unused]]
+    inline IoBackend AsyncIo::backend() const noexcept {
+        return this->backend_;
+    }
+
+    /// \brief Отправляет операцию чтения.
+    ///
+    /// \param file Файл.
+    /// \param buffer Буфер для данных.
+    /// \param offset Смещение в файле.
+    ///
+    /// \return Операцию, которую можно ожидать.
+    [[nodiscard]]
+    inline IoRequest AsyncIo::read(const AsyncFile& file, std::span<std::byte> buffer,
+                                   const uint64_t& offset) {
+        return IoRequest(*this, file, buffer, offset);
+    }
+
+    /// \brief Отправляет операцию записи.
+    ///
+    /// \param file Файл.
+    /// \param buffer Записываемые данные.
+    /// \param offset Смещение в файле.
+    ///
+    /// \return Операцию, которую можно ожидать.
+    [[nodiscard]]
+    inline IoRequest AsyncIo::write(const AsyncFile& file, std::span<const std::byte> buffer,
+                                    const uint64_t& offset) {
+        return IoRequest(*this, file, buffer, offset);
+    }
+
+    /// \brief Отправляет операцию сброса файла на диск.
+    ///
+    /// Сбрасываются записи, завершившиеся до отправки операции.
+    ///
+    /// \param file Файл.
+    ///
+    /// \return Операцию, которую можно ожидать.
+    [[nodiscard]]
+    inline IoRequest AsyncIo::sync(const AsyncFile& file) {
+        return IoRequest(*this, file);
+    }
+
+    /// \brief Выполняет сопрограмму до завершения в текущем потоке.
+    ///
+    /// \param task Сопрограмма.
+    ///
+    /// \return Результат сопрограммы.
+    ///
+    /// \throw Исключение, возбужденное сопрограммой.
+    template <class T>
+    T AsyncIo::run(Task<T> task) {
+        task.handle_.resume();
+        while (!task.handle_.done())
+            this->poll();
+        return task.handle_.promise().take();
+    }
+
+    /// \brief Выполняет сопрограммы одновременно и ждет завершения всех.
+    ///
+    /// \param tasks Сопрограммы.
+    ///
+    /// \throw Первое исключение, возбужденное сопрограммами, после
+    /// завершения всех.
+    [[nodiscard]]
+    inline Task<void> AsyncIo::when_all(std::vector<Task<void>> tasks) {
+        JoinState state{ tasks.size() + 1, nullptr, nullptr };
+        co_await JoinAwaiter{ tasks, state };
+        if (state.error_)
+            std::rethrow_exception(state.error_);
+    }
+
+/* ========================= AsyncSnapshot::Decoder ========================= */
+// PRIVATE
+
+    /// \brief Вычисляет конец строк записи в куче.
+    ///
+    /// Строки записей лежат в куче подряд в порядке записей.
+    ///
+    /// \param entry Запись next_.
+    ///
+    /// \return Смещение в куче после последней строки записи.
+    ///
+    /// \throw std::runtime_error Исключение возбуждается, если строки
+    /// записи не начинаются с cursor_.
+    template <class T, class H>
+    [[nodiscard]]
+    uint64_t AsyncSnapshot<T, H>::Decoder::record_end(const Entry& entry) const {
+        uint64_t end{ entry.key_.offset_ + entry.key_.length_ };
+        if constexpr (Snapshot::IS_STRING_VALUE) {
+            if (entry.value_.offset_ != end)
+                throw std::runtime_error("Snapshot file is corrupted.");
+            end += entry.value_.length_;
+        }
+        if (entry.key_.offset_ != this->cursor_ || end < this->cursor_ ||
+            end > this->header_.heap_size_)
+            throw std::runtime_error("Snapshot file is corrupted.");
+        return end;
+    }
+
+    /// \brief Вставляет запись в таблицу.
+    ///
+    /// \param table Заполняемая таблица.
+    /// \param entry Запись.
+    /// \param bytes Строки записи.
+    template <class T, class H>
+    template <class Table>
+    void AsyncSnapshot<T, H>::Decoder::insert(Table& table, const Entry& entry,
+                                              const char* bytes) const {
+        const std::string_view key{ bytes, static_cast<size_t>(entry.key_.length_) };
+        if constexpr (Snapshot::IS_STRING_VALUE)
+            table.insert(key, std::string(bytes + key.size(),
+                                          static_cast<size_t>(entry.value_.length_)));
+        else
+            table.insert(key, entry.value_);
+    }
+
+// PUBLIC
+
+    /// \brief Стандартный конструктор экземпляра класса
+    /// AsyncSnapshot::Decoder.
+    ///
+    /// \param header Проверенный заголовок снимка.
+    template <class T, class H>
+    AsyncSnapshot<T, H>::Decoder::Decoder(const Header& header) :
+            header_(header), entries_(static_cast<size_t>(header.record_count_)),
+            pending_(), cursor_(0), next_(0) { }
+
+    /// \brief Разбирает прочитанный блок файла.
+    ///
+    /// Блоки должны идти подряд с начала массива записей. Записи
+    /// вставляются прямо из блока; копируется только запись на границе
+    /// блоков.
+    ///
+    /// \param table Заполняемая таблица.
+    /// \param position Смещение блока в файле.
+    /// \param data Байты блока.
+    ///
+    /// \throw std::runtime_error Исключение возбуждается, если строки
+    /// записей не идут по куче подряд.
+    template <class T, class H>
+    template <class Table>
+    void AsyncSnapshot<T, H>::Decoder::feed(Table& table, uint64_t position,
+                                            std::span<const std::byte> data) {
+        const Header& header{ this->header_ };
+        const uint64_t entries_end{ header.records_offset_ +
+                                    header.record_count_ * sizeof(Entry) };
+        if (position < entries_end) {
+            const auto count{ static_cast<size_t>(
+                    std::min<uint64_t>(data.size(), entries_end - position)) };
+            std::memcpy(reinterpret_cast<std::byte*>(this->entries_.data()) +
+                        (position - header.records_offset_), data.data(), count);
+            data = data.subspan(count);
+            position += count;
+        }
+        if (position < header.heap_offset_) {
+            const auto count{ static_cast<size_t>(
+                    std::min<uint64_t>(data.size(), header.heap_offset_ - position)) };
+            data = data.subspan(count);
+        }
+        if (this->next_ == this->entries_.size())
+            return;
+
+        std::string_view bytes{ reinterpret_cast<const char*>(data.data()), data.size() };
+        if (!this->pending_.empty()) {
+            const Entry& entry{ this->entries_[this->next_] };
+            const uint64_t end{ this->record_end(entry) };
+            const auto need{ static_cast<size_t>(end - this->cursor_) - this->pending_.size() };
+            this->pending_.append(bytes.substr(0, need));
+            if (bytes.size() < need)
+                return;
+            this->insert(table, entry, this->pending_.data());
+            this->pending_.clear();
+            bytes.remove_prefix(need);
+            this->cursor_ = end;
+            this->next_++;
+        }
+        for (; this->next_ < this->entries_.size(); this->next_++) {
+            const Entry& entry{ this->entries_[this->next_] };
+            const uint64_t end{ this->record_end(entry) };
+            const auto length{ static_cast<size_t>(end - this->cursor_) };
+            if (length > bytes.size()) {
+                this->pending_.assign(bytes);
+                return;
+            }
+            this->insert(table, entry, bytes.data());
+            bytes.remove_prefix(length);
+            this->cursor_ = end;
+        }
+    }
+
+    /// \brief Вставляет оставшиеся записи без строк и проверяет, что все
+    /// записи вставлены.
+    ///
+    /// \param table Заполняемая таблица.
+    ///
+    /// \throw std::runtime_error Исключение возбуждается, если куча
+    /// кончилась раньше записей.
+    template <class T, class H>
+    template <class Table>
+    void AsyncSnapshot<T, H>::Decoder::finish(Table& table) {
+        this->feed(table, this->header_.heap_offset_ + this->header_.heap_size_, {});
+        if (this->next_ != this->entries_.size())
+            throw std::runtime_error("Snapshot file is truncated or corrupted.");
+    }
+
+/* ============================= AsyncSnapshot ============================= */
+// PRIVATE
+
+    /// \brief Пишет данные целиком, повторяя неполные записи.
+    ///
+    /// \param io Цикл событий.
+    /// \param file Файл.
+    /// \param data Данные.
+    /// \param offset Смещение в файле.
+    ///
+    /// \throw std::runtime_error Исключение возбуждается при ошибке записи.
+    template <class T, class H>
+    [[nodiscard]]
+    Task<void> AsyncSnapshot<T, H>::write_all(AsyncIo& io, const AsyncFile& file,
+                                              std::span<const std::byte> data,
+                                              uint64_t offset) {
+        while (!data.empty()) {
+            const size_t written{ co_await io.write(file, data, offset) };
+            if (written == 0)
+                throw std::runtime_error("Cannot write snapshot \"" +
+                                         file.path().string() + "\".");
+            data = data.subspan(written);
+            offset += written;
+        }
+    }
+
+    /// \brief Пишет кучу строк снимка блоками по два буфера.
+    ///
+    /// Пока пишется один блок, следующий собирается из записей таблицы.
+    ///
+    /// \param io Цикл событий.
+    /// \param file Файл.
+    /// \param table Хеш-таблица.
+    /// \param offset Смещение кучи в файле.
+    /// \param block_size Размер блока в байтах.
+    ///
+    /// \throw std::runtime_error Исключение возбуждается при ошибке записи.
+    template <class T, class H>
+    template <class Table>
+    [[nodiscard]]
+    Task<void> AsyncSnapshot<T, H>::write_heap(AsyncIo& io, const AsyncFile& file,
+                                               const Table& table, uint64_t offset,
+                                               size_t block_size) {
+        std::array<std::vector<std::byte>, 2> buffers;
+        std::array<std::optional<IoRequest>, 2> writes;
+        std::array<uint64_t, 2> offsets{};
+        auto append{ [](std::vector<std::byte>& buffer, std::string_view bytes) {
+            const auto* data{ reinterpret_cast<const std::byte*>(bytes.data()) };
+            buffer.insert(buffer.end(), data, data + bytes.size());
+        } };
+
+        size_t position{ table.order_front_ };
+        for (size_t current{}; ; current ^= 1) {
+            std::vector<std::byte>& buffer{ buffers[current] };
+            if (writes[current]) {
+                const size_t written{ co_await *writes[current] };
+                writes[current].reset();
+                if (written < buffer.size())
+                    co_await write_all(io, file, std::span<const std::byte>(buffer).subspan(written),
+                                       offsets[current] + written);
+            }
+            if (position == table.order_.size())
+                break;
+
+            buffer.clear();
+            for (; position < table.order_.size() && buffer.size() < block_size; position++) {
+                const auto* record{ table.order_[position] };
+                if (record == nullptr)
+                    continue;
+                append(buffer, record->key_);
+                if constexpr (Snapshot::IS_STRING_VALUE)
+                    append(buffer, record->value_);
+            }
+            offsets[current] = offset;
+            offset += buffer.size();
+            if (!buffer.empty())
+                writes[current].emplace(io, file, std::span<const std::byte>(buffer),
+                                        offsets[current]);
+        }
+        // Ждет блок, начатый перед последним переключением буфера.
+        for (size_t current{}; current < writes.size(); current++) {
+            if (!writes[current])
+                continue;
+            const size_t written{ co_await *writes[current] };
+            if (written < buffers[current].size())
+                co_await write_all(io, file,
+                                   std::span<const std::byte>(buffers[current]).subspan(written),
+                                   offsets[current] + written);
+        }
+    }
+
+// PUBLIC
+
+    /// \brief Асинхронно загружает снимок в таблицу.
+    ///
+    /// Записи снимка добавляются в таблицу в порядке добавления; значения
+    /// по уже существующим ключам заменяются. Разбор и хеширование блока
+    /// идут, пока читается следующий.
+    ///
+    /// \param io Цикл событий.
+    /// \param table Заполняемая таблица.
+    /// \param path Путь к файлу снимка.
+    /// \param block_size Размер читаемого блока в байтах.
+    ///
+    /// \throw std::runtime_error Исключение возбуждается, если файл не
+    /// удалось прочитать или он не является снимком таблицы с такими же
+    /// типами.
+    template <class T, class H>
+    template <class S, class A>
+    [[nodiscard]] [[maybe_unused]]
+    Task<void> AsyncSnapshot<T, H>::load(AsyncIo& io, OrderedHashTable<T, S, H, A>& table,
+                                         std::filesystem::path path, size_t block_size) {
+        const AsyncFile file{ path, FileAccess::READ };
+        const uint64_t size{ file.size() };
+        Header header{};
+        const size_t header_size{ (size < sizeof(Header)) ? 0 :
+                co_await io.read(file, std::as_writable_bytes(std::span(&header, 1)), 0) };
+        if (header_size != sizeof(Header))
+            throw std::runtime_error("Snapshot file is truncated.");
+        Snapshot::check_header(header, size);
+        table.reserve(table.length() + static_cast<size_t>(header.record_count_));
+
+        block_size = std::max(block_size, size_t{ 4096 });
+        std::array<std::vector<std::byte>, 2> buffers{ std::vector<std::byte>(block_size),
+                                                       std::vector<std::byte>(block_size) };
+        std::array<std::optional<IoRequest>, 2> reads;
+        auto block{ [&buffers, &block_size](const size_t& current, const uint64_t& remaining) {
+            return std::span(buffers[current]).first(
+                    static_cast<size_t>(std::min<uint64_t>(block_size, remaining)));
+        } };
+
+        Decoder decoder{ header };
+        const uint64_t end{ header.heap_offset_ + header.heap_size_ };
+        uint64_t offset{ header.records_offset_ };
+        if (offset < end)
+            reads[0].emplace(io, file, block(0, end - offset), offset);
+        for (size_t current{}; offset < end; current ^= 1) {
+            const size_t length{ co_await *reads[current] };
+            if (length == 0)
+                throw std::runtime_error("Snapshot file is truncated.");
+            const uint64_t next{ offset + length };
+            if (next < end)
+                reads[current ^ 1].emplace(io, file, block(current ^ 1, end - next), next);
+            decoder.feed(table, offset, std::span<const std::byte>(buffers[current]).first(length));
+            offset = next;
+        }
+        decoder.finish(table);
+    }
+
+    /// \brief Асинхронно сохраняет снимок таблицы.
+    ///
+    /// Формат совпадает с MappedOrderedHashTable::save: снимок можно
+    /// открыть open_mapped. Файл сначала пишется рядом с расширением
+    /// ".tmp", после всех записей асинхронно сбрасывается на диск и только
+    /// затем заменяет прежний; после переименования сбрасывается каталог.
+    ///
+    /// \param io Цикл событий.
+    /// \param table Хеш-таблица.
+    /// \param path Путь к файлу снимка.
+    /// \param block_size Размер записываемого блока кучи в байтах.
+    ///
+    /// \throw std::runtime_error Исключение возбуждается при ошибке записи.
+    template <class T, class H>
+    template <class S, class A>
+    [[nodiscard]] [[maybe_unused]]
+    Task<void> AsyncSnapshot<T, H>::flush(AsyncIo& io,
+                                          const OrderedHashTable<T, S, H, A>& table,
+                                          std::filesystem::path path, size_t block_size) {
+        Header header{};
+        std::vector<Slot> slots;
+        std::vector<Entry> entries;
+        Snapshot::build_index(table, header, slots, entries);
+
+        std::filesystem::path temp_path{ path };
+        temp_path += ".tmp";
+        {
+            const AsyncFile file{ temp_path, FileAccess::WRITE };
+            const uint64_t slots_end{ sizeof(Header) + slots.size() * sizeof(Slot) };
+            const std::array<std::byte, alignof(Entry)> zeros{};
+            std::vector<Task<void>> writes;
+            writes.push_back(write_all(io, file, std::as_bytes(std::span(&header, 1)), 0));
+            writes.push_back(write_all(io, file, std::as_bytes(std::span(slots)),
+                                       sizeof(Header)));
+            writes.push_back(write_all(io, file, std::span(zeros).first(
+                    static_cast<size_t>(header.records_offset_ - slots_end)), slots_end));
+            writes.push_back(write_all(io, file, std::as_bytes(std::span(entries)),
+                                       header.records_offset_));
+            writes.push_back(write_heap(io, file, table, header.heap_offset_,
+                                        std::max(block_size, size_t{ 4096 })));
+            co_await AsyncIo::when_all(std::move(writes));
+            // Без сброса после сбоя переименованный снимок мог бы
+            // оказаться пустым или недописанным.
+            co_await io.sync(file);
+        }
+        std::filesystem::rename(temp_path, path);
+        flush_directory(path.parent_path());
+    }
+}
+
+#endif
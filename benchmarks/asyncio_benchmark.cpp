@@ -0,0 +1,122 @@
+/// \file asyncio_benchmark.cpp.
+/// \author Лошкарев Дмитрий.
+/// \date 14.10.2026.
+///
+/// \brief Сравнивает последовательную загрузку нескольких снимков
+/// (open_mapped и вставка записей) и сохранение save с асинхронными
+/// load_async / flush_async всех таблиц сразу через io_uring и через
+/// рабочие потоки.
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "asyncio.hpp"
+
+using DataStructures::AsyncIo;
+using DataStructures::IoBackend;
+using DataStructures::MappedOrderedHashTable;
+using DataStructures::OrderedHashTable;
+using DataStructures::Task;
+
+namespace {
+    constexpr int TABLE_COUNT{ 8 };
+    constexpr int64_t ROWS_PER_TABLE{ 100000 };
+
+    std::filesystem::path table_path(const int& table) {
+        return std::filesystem::temp_directory_path() /
+               ("asyncio_benchmark_" + std::to_string(table) + ".snap");
+    }
+
+    OrderedHashTable<int64_t> make_table(const int& table) {
+        OrderedHashTable<int64_t> result;
+        for (int64_t row{}; row < ROWS_PER_TABLE; row++)
+            result.insert("table:" + std::to_string(table) + ":row:" + std::to_string(row),
+                          row);
+        return result;
+    }
+
+    // Снимки создаются один раз и переиспользуются всеми бенчмарками.
+    const std::vector<OrderedHashTable<int64_t>>& tables() {
+        static const std::vector<OrderedHashTable<int64_t>> result{ [] {
+            std::vector<OrderedHashTable<int64_t>> tables;
+            for (int table{}; table < TABLE_COUNT; table++) {
+                tables.push_back(make_table(table));
+                MappedOrderedHashTable<int64_t>::save(tables.back(), table_path(table));
+            }
+            return tables;
+        }() };
+        return result;
+    }
+}
+
+static void BM_SequentialLoad(benchmark::State& state) {
+    static_cast<void>(tables());
+    for (auto _ : state) {
+        std::vector<OrderedHashTable<int64_t>> loaded(TABLE_COUNT);
+        for (int table{}; table < TABLE_COUNT; table++) {
+            const auto mapped{ MappedOrderedHashTable<int64_t>::open_mapped(table_path(table)) };
+            loaded[table].reserve(mapped.length());
+            for (auto it{ mapped.begin() }; it != mapped.end(); ++it)
+                loaded[table].insert((*it).first, (*it).second);
+        }
+        benchmark::DoNotOptimize(loaded);
+    }
+    state.SetItemsProcessed(state.iterations() * TABLE_COUNT * ROWS_PER_TABLE);
+}
+BENCHMARK(BM_SequentialLoad)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+// Аргумент - IoBackend.
+static void BM_AsyncLoad(benchmark::State& state) {
+    static_cast<void>(tables());
+    AsyncIo io{ static_cast<IoBackend>(state.range(0)) };
+    if (io.backend() != static_cast<IoBackend>(state.range(0))) {
+        state.SkipWithError("io_uring is not available.");
+        return;
+    }
+    for (auto _ : state) {
+        std::vector<OrderedHashTable<int64_t>> loaded(TABLE_COUNT);
+        std::vector<Task<void>> loads;
+        for (int table{}; table < TABLE_COUNT; table++)
+            loads.push_back(load_async(io, loaded[table], table_path(table)));
+        io.run(AsyncIo::when_all(std::move(loads)));
+        benchmark::DoNotOptimize(loaded);
+    }
+    state.SetItemsProcessed(state.iterations() * TABLE_COUNT * ROWS_PER_TABLE);
+}
+BENCHMARK(BM_AsyncLoad)->Arg(static_cast<int>(IoBackend::THREADS))
+                       ->Arg(static_cast<int>(IoBackend::IO_URING))
+                       ->Unit(benchmark::kMillisecond)->UseRealTime();
+
+static void BM_SequentialSave(benchmark::State& state) {
+    for (auto _ : state) {
+        for (int table{}; table < TABLE_COUNT; table++)
+            MappedOrderedHashTable<int64_t>::save(tables()[table], table_path(table));
+    }
+    state.SetItemsProcessed(state.iterations() * TABLE_COUNT * ROWS_PER_TABLE);
+}
+BENCHMARK(BM_SequentialSave)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+// Аргумент - IoBackend.
+static void BM_AsyncFlush(benchmark::State& state) {
+    AsyncIo io{ static_cast<IoBackend>(state.range(0)) };
+    if (io.backend() != static_cast<IoBackend>(state.range(0))) {
+        state.SkipWithError("io_uring is not available.");
+        return;
+    }
+    for (auto _ : state) {
+        std::vector<Task<void>> flushes;
+        for (int table{}; table < TABLE_COUNT; table++)
+            flushes.push_back(flush_async(io, tables()[table], table_path(table)));
+        io.run(AsyncIo::when_all(std::move(flushes)));
+    }
+    state.SetItemsProcessed(state.iterations() * TABLE_COUNT * ROWS_PER_TABLE);
+}
+BENCHMARK(BM_AsyncFlush)->Arg(static_cast<int>(IoBackend::THREADS))
+                        ->Arg(static_cast<int>(IoBackend::IO_URING))
+                        ->Unit(benchmark::kMillisecond)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,119 @@
+/// \file cache_benchmark.cpp.
+/// \author Лошкарев Дмитрий.
+/// \date 15.10.2026.
+///
+/// \brief Сравнивает кеш BoundedOrderedHashTable с LRU и CLOCK против
+/// ручного вытеснения через erase() первого ключа из keys(), а также
+/// сегментированный кеш под нагрузкой из нескольких потоков.
+///
+/// Ключи запросов распределены неравномерно: примерно 80% запросов
+/// приходятся на 20% ключей, в кеш помещается четверть ключей.
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "boundedhashtable.hpp"
+#include "orderhashtable.hpp"
+
+using DataStructures::BoundedOrderedHashTable;
+using DataStructures::CacheOptions;
+using DataStructures::ConcurrentBoundedOrderedHashTable;
+using DataStructures::EvictionPolicy;
+using DataStructures::OrderedHashTable;
+
+namespace {
+    constexpr size_t KEY_COUNT{ 1 << 16 };
+    constexpr size_t CAPACITY{ KEY_COUNT / 4 };
+    constexpr size_t REQUEST_COUNT{ 1 << 20 };
+
+    const std::vector<std::string>& request_keys() {
+        static const std::vector<std::string> keys{ [] {
+            std::mt19937_64 random{ 42 };
+            std::uniform_int_distribution<size_t> hot(0, KEY_COUNT / 5 - 1);
+            std::uniform_int_distribution<size_t> any(0, KEY_COUNT - 1);
+            std::bernoulli_distribution is_hot(0.8);
+            std::vector<std::string> result;
+            result.reserve(REQUEST_COUNT);
+            for (size_t item{}; item < REQUEST_COUNT; item++)
+                result.push_back("key:" + std::to_string(is_hot(random) ? hot(random)
+                                                                        : any(random)));
+            return result;
+        }() };
+        return keys;
+    }
+
+    template <EvictionPolicy Policy>
+    void run_bounded(benchmark::State& state) {
+        const auto& keys{ request_keys() };
+        BoundedOrderedHashTable<int64_t> cache{ { .max_entries_ = CAPACITY,
+                                                  .policy_ = Policy } };
+        size_t item{};
+        for (auto _ : state) {
+            const std::string& key{ keys[item++ % keys.size()] };
+            if (cache.find(key) == nullptr)
+                cache.insert(key, static_cast<int64_t>(item));
+        }
+        state.SetItemsProcessed(state.iterations());
+        state.counters["hit_ratio"] = cache.stats().hit_ratio();
+    }
+}
+
+// Вытеснение вручную: самый старый ключ берется из keys() и удаляется
+// через erase(), обращения порядок не меняют.
+static void BM_ManualEviction(benchmark::State& state) {
+    const auto& keys{ request_keys() };
+    OrderedHashTable<int64_t> table;
+    size_t item{}, hits{};
+    for (auto _ : state) {
+        const std::string& key{ keys[item++ % keys.size()] };
+        if (table.get(key) != 0) {
+            hits++;
+            continue;
+        }
+        if (table.length() == CAPACITY)
+            table.erase(*table.keys()->begin());
+        table.insert(key, static_cast<int64_t>(item));
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.counters["hit_ratio"] = static_cast<double>(hits) /
+                                  static_cast<double>(state.iterations());
+}
+BENCHMARK(BM_ManualEviction);
+
+static void BM_BoundedLru(benchmark::State& state) {
+    run_bounded<EvictionPolicy::LRU>(state);
+}
+BENCHMARK(BM_BoundedLru);
+
+static void BM_BoundedClock(benchmark::State& state) {
+    run_bounded<EvictionPolicy::CLOCK>(state);
+}
+BENCHMARK(BM_BoundedClock);
+
+// Общий сегментированный кеш: каждый поток читает свой участок запросов.
+static void BM_ConcurrentBoundedLru(benchmark::State& state) {
+    static ConcurrentBoundedOrderedHashTable<int64_t>* cache{ nullptr };
+    if (state.thread_index() == 0)
+        cache = new ConcurrentBoundedOrderedHashTable<int64_t>(
+                { .max_entries_ = CAPACITY }, 64);
+    const auto& keys{ request_keys() };
+    size_t item{ static_cast<size_t>(state.thread_index()) * (REQUEST_COUNT / 8) };
+    for (auto _ : state) {
+        const std::string& key{ keys[item++ % keys.size()] };
+        if (!cache->visit(key, [](int64_t& value) { benchmark::DoNotOptimize(value); }))
+            cache->insert(key, static_cast<int64_t>(item));
+    }
+    state.SetItemsProcessed(state.iterations());
+    if (state.thread_index() == 0) {
+        delete cache;
+        cache = nullptr;
+    }
+}
+BENCHMARK(BM_ConcurrentBoundedLru)->ThreadRange(1, 8)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,122 @@
+/// \file columnar_benchmark.cpp.
+/// \author Лошкарев Дмитрий.
+/// \date 14.10.2026.
+///
+/// \brief Сравнивает строки-хеш-таблицы OrderedHashTable<OrderedHashTable<int>>
+/// (как в main.cpp) с ColumnarTable: построение таблицы, выборку поля
+/// строки по ключу и агрегирующий проход по полю.
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include <benchmark/benchmark.h>
+
+#include "columnartable.hpp"
+#include "orderhashtable.hpp"
+
+using DataStructures::ColumnarTable;
+using DataStructures::OrderedHashTable;
+using DataStructures::TableSchema;
+
+namespace {
+    constexpr std::array<std::string_view, 8> FIELDS{
+            "Count", "WinRate", "Test", "Sun", "Moon", "House", "Town", "Window" };
+
+    using NestedTable = OrderedHashTable<OrderedHashTable<int>>;
+
+    std::string row_key(const int64_t& row) {
+        return "row:" + std::to_string(row);
+    }
+
+    int field_value(const int64_t& row, const size_t& field) {
+        return static_cast<int>((row * 31 + static_cast<int64_t>(field)) % 1000);
+    }
+
+    NestedTable make_nested(const int64_t& rows) {
+        NestedTable table;
+        for (int64_t row{}; row < rows; row++) {
+            OrderedHashTable<int> fields;
+            for (size_t field{}; field < FIELDS.size(); field++)
+                fields.insert(FIELDS[field], field_value(row, field));
+            table.insert(row_key(row), std::move(fields));
+        }
+        return table;
+    }
+
+    ColumnarTable<int> make_columnar(const int64_t& rows) {
+        ColumnarTable<int> table{ std::make_shared<const TableSchema>(FIELDS) };
+        table.reserve(static_cast<size_t>(rows));
+        std::array<int, FIELDS.size()> values{};
+        for (int64_t row{}; row < rows; row++) {
+            for (size_t field{}; field < FIELDS.size(); field++)
+                values[field] = field_value(row, field);
+            table.insert(row_key(row), values);
+        }
+        return table;
+    }
+}
+
+static void BM_NestedBuild(benchmark::State& state) {
+    for (auto _ : state)
+        benchmark::DoNotOptimize(make_nested(state.range(0)).length());
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_NestedBuild)->RangeMultiplier(10)->Range(1000, 100000)
+        ->Unit(benchmark::kMillisecond);
+
+static void BM_ColumnarBuild(benchmark::State& state) {
+    for (auto _ : state)
+        benchmark::DoNotOptimize(make_columnar(state.range(0)).length());
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ColumnarBuild)->RangeMultiplier(10)->Range(1000, 100000)
+        ->Unit(benchmark::kMillisecond);
+
+// Поле строки по ключу строки и имени поля.
+static void BM_NestedLookup(benchmark::State& state) {
+    NestedTable table{ make_nested(state.range(0)) };
+    int64_t row{};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(table[row_key(row)]["Sun"]);
+        row = (row + 7919) % state.range(0);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_NestedLookup)->RangeMultiplier(10)->Range(1000, 100000);
+
+static void BM_ColumnarLookup(benchmark::State& state) {
+    ColumnarTable<int> table{ make_columnar(state.range(0)) };
+    int64_t row{};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(table[row_key(row)]["Sun"]);
+        row = (row + 7919) % state.range(0);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ColumnarLookup)->RangeMultiplier(10)->Range(1000, 100000);
+
+// Сумма одного поля по всем строкам.
+static void BM_NestedSum(benchmark::State& state) {
+    NestedTable table{ make_nested(state.range(0)) };
+    for (auto _ : state) {
+        int64_t total{};
+        for (auto it{ table.keys()->begin() }; it != table.keys()->end(); ++it)
+            total += table[*it]["Sun"];
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_NestedSum)->RangeMultiplier(10)->Range(1000, 100000);
+
+static void BM_ColumnarSum(benchmark::State& state) {
+    ColumnarTable<int> table{ make_columnar(state.range(0)) };
+    for (auto _ : state)
+        benchmark::DoNotOptimize(table.sum<int64_t>("Sun"));
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ColumnarSum)->RangeMultiplier(10)->Range(1000, 100000);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,144 @@
+/// \file concurrent_benchmark.cpp.
+/// \author Лошкарев Дмитрий.
+/// \date 14.10.2026.
+///
+/// \brief Сравнивает пропускную способность ConcurrentOrderedHashTable и
+/// OrderedHashTable под одной глобальной блокировкой при работе от 1 до 64
+/// потоков, а также чтение без блокировок из RcuOrderedHashTable.
+
+#include <mutex>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "concurrenthashtable.hpp"
+#include "rcuhashtable.hpp"
+
+using DataStructures::ConcurrentOrderedHashTable;
+using DataStructures::OrderedHashTable;
+using DataStructures::RcuOrderedHashTable;
+
+namespace {
+    constexpr size_t KEY_COUNT{ 1 << 16 };
+    constexpr uint32_t WRITE_PERCENT{ 10 };
+    constexpr uint32_t READ_MOSTLY_WRITE_PERCENT{ 1 };
+
+    // Составные ключи вида "user:<id>:field", как в остальных бенчмарках.
+    const std::vector<std::string>& keys() {
+        static const std::vector<std::string> keys{ [] {
+            std::vector<std::string> result(KEY_COUNT);
+            for (size_t i{}; i < KEY_COUNT; i++)
+                result[i] = "user:" + std::to_string(i) + ":field";
+            return result;
+        }() };
+        return keys;
+    }
+
+    // Исходный подход: одна таблица под одним мьютексом.
+    class LockedTable {
+        private:
+            std::mutex mutex_;
+            OrderedHashTable<int> table_;
+        public:
+            void insert(const std::string& key, const int& value) {
+                std::lock_guard lock{ this->mutex_ };
+                this->table_.insert(key, value);
+            }
+
+            int get(const std::string& key) {
+                std::lock_guard lock{ this->mutex_ };
+                return this->table_.get(key);
+            }
+    };
+
+    ConcurrentOrderedHashTable<int>* concurrent_table{ nullptr };
+    LockedTable* locked_table{ nullptr };
+
+    // Таблица RCU живет до конца программы: читатели освобождают свои
+    // ячейки уже после выхода из цикла замера.
+    RcuOrderedHashTable<int>& rcu_table() {
+        static RcuOrderedHashTable<int>* table{ [] {
+            auto* result{ new RcuOrderedHashTable<int>() };
+            for (size_t i{}; i < KEY_COUNT; i++)
+                result->insert(keys()[i], static_cast<int>(i));
+            return result;
+        }() };
+        return *table;
+    }
+}
+
+// Смешанная нагрузка: WRITE_PERCENT% вставок, остальное - чтение.
+template <class Table>
+static void run_mixed(benchmark::State& state, Table*& table) {
+    if (state.thread_index() == 0) {
+        table = new Table();
+        for (size_t i{}; i < KEY_COUNT; i++)
+            table->insert(keys()[i], static_cast<int>(i));
+    }
+    std::mt19937 rng{ static_cast<uint32_t>(state.thread_index()) };
+    for (auto _ : state) {
+        const std::string& key{ keys()[rng() % KEY_COUNT] };
+        if (rng() % 100 < WRITE_PERCENT)
+            table->insert(key, 1);
+        else
+            benchmark::DoNotOptimize(table->get(key));
+    }
+    state.SetItemsProcessed(state.iterations());
+    if (state.thread_index() == 0) {
+        delete table;
+        table = nullptr;
+    }
+}
+
+static void BM_LockedTableMixed(benchmark::State& state) {
+    run_mixed(state, locked_table);
+}
+BENCHMARK(BM_LockedTableMixed)->ThreadRange(1, 64)->UseRealTime();
+
+static void BM_ConcurrentTableMixed(benchmark::State& state) {
+    run_mixed(state, concurrent_table);
+}
+BENCHMARK(BM_ConcurrentTableMixed)->ThreadRange(1, 64)->UseRealTime();
+
+// Нагрузка "почти только чтение": READ_MOSTLY_WRITE_PERCENT% вставок.
+static void BM_ConcurrentTableReadMostly(benchmark::State& state) {
+    if (state.thread_index() == 0) {
+        concurrent_table = new ConcurrentOrderedHashTable<int>();
+        for (size_t i{}; i < KEY_COUNT; i++)
+            concurrent_table->insert(keys()[i], static_cast<int>(i));
+    }
+    std::mt19937 rng{ static_cast<uint32_t>(state.thread_index()) };
+    for (auto _ : state) {
+        const std::string& key{ keys()[rng() % KEY_COUNT] };
+        if (rng() % 100 < READ_MOSTLY_WRITE_PERCENT)
+            concurrent_table->insert(key, 1);
+        else
+            benchmark::DoNotOptimize(concurrent_table->get(key));
+    }
+    state.SetItemsProcessed(state.iterations());
+    if (state.thread_index() == 0) {
+        delete concurrent_table;
+        concurrent_table = nullptr;
+    }
+}
+BENCHMARK(BM_ConcurrentTableReadMostly)->ThreadRange(1, 64)->UseRealTime();
+
+// Та же нагрузка, читатели не берут блокировок.
+static void BM_RcuTableReadMostly(benchmark::State& state) {
+    RcuOrderedHashTable<int>& table{ rcu_table() };
+    auto reader{ table.reader() };
+    std::mt19937 rng{ static_cast<uint32_t>(state.thread_index()) };
+    for (auto _ : state) {
+        const std::string& key{ keys()[rng() % KEY_COUNT] };
+        if (rng() % 100 < READ_MOSTLY_WRITE_PERCENT)
+            table.insert(key, 1);
+        else
+            benchmark::DoNotOptimize(reader.get(key));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_RcuTableReadMostly)->ThreadRange(1, 64)->UseRealTime();
+
+BENCHMARK_MAIN();
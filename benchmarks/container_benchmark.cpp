@@ -0,0 +1,568 @@
+/// \file container_benchmark.cpp.
+/// \author Лошкарев Дмитрий.
+/// \date 14.10.2026.
+///
+/// \brief Сравнивает OrderedHashTable с std::unordered_map и
+/// absl::flat_hash_map (если Abseil найден), а List - с std::list и
+/// std::deque на количествах ключей от 1e3 до CONTAINER_BENCHMARK_MAX_KEYS.
+///
+/// Хеш-таблицы измеряются на ключах uint64 (для OrderedHashTable - через
+/// KeyedOrderedHashTable, ключи хранятся в записи) и на строковых ключах
+/// вида "user:<id>:field". Каждая операция, кроме построения, измеряется
+/// на заранее заполненном контейнере; время пересчитано на один элемент.
+///
+/// Бенчмарки BM_BytesPerRecord и BM_NestedBytesPerField сообщают счетчик
+/// bytes_per_record - прирост занятой кучи (по mallinfo2, только glibc) на
+/// запись для ключей std::string и CompactKey.
+
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <list>
+#include <memory>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#ifdef CONTAINER_BENCHMARK_HAS_ABSL
+    #include <absl/container/flat_hash_map.h>
+#endif
+#if defined(__GLIBC__)
+    #include <malloc.h>
+#endif
+
+#include "list.hpp"
+#include "orderhashtable.hpp"
+
+using DataStructures::ArenaMode;
+using DataStructures::CompactKey;
+using DataStructures::KeyArena;
+using DataStructures::KeyedOrderedHashTable;
+using DataStructures::List;
+using DataStructures::OrderedHashTable;
+
+#ifndef CONTAINER_BENCHMARK_MAX_KEYS
+    #define CONTAINER_BENCHMARK_MAX_KEYS 100000000
+#endif
+
+namespace {
+    constexpr int64_t MIN_KEYS{ 1000 };
+    constexpr int64_t MAX_KEYS{ CONTAINER_BENCHMARK_MAX_KEYS };
+    constexpr int64_t MAX_STRING_KEYS{ std::min<int64_t>(MAX_KEYS, 10000000) };
+    constexpr size_t LOOKUPS_PER_ITERATION{ 1 << 12 };
+
+    // Ключи i-го элемента: перемешанные числа, чтобы соседние ключи не
+    // попадали в соседние ячейки, и строки "user:<i>:field".
+    uint64_t mix_key(uint64_t value) noexcept {
+        value += 0x9E3779B97F4A7C15;
+        value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9;
+        value = (value ^ (value >> 27)) * 0x94D049BB133111EB;
+        return value ^ (value >> 31);
+    }
+
+    template <class Key>
+    Key make_key(const uint64_t& item) {
+        if constexpr (std::is_same_v<Key, std::string>)
+            return "user:" + std::to_string(item) + ":field";
+        else
+            return mix_key(item);
+    }
+
+    // Ключи элементов с номерами [first, first + count). Ключи с номерами
+    // не меньше размера таблицы в ней отсутствуют.
+    template <class Key>
+    std::vector<Key> make_keys(const size_t& first, const size_t& count) {
+        std::vector<Key> keys;
+        keys.reserve(count);
+        for (size_t item{ first }; item < first + count; item++)
+            keys.push_back(make_key<Key>(item));
+        return keys;
+    }
+
+    // Случайная выборка уже добавленных ключей для поиска.
+    template <class Key>
+    std::vector<Key> sample_keys(const std::vector<Key>& keys) {
+        std::mt19937_64 rng{ 42 };
+        std::vector<Key> sample(LOOKUPS_PER_ITERATION);
+        for (auto& key : sample)
+            key = keys[rng() % keys.size()];
+        return sample;
+    }
+
+    // Вклад ключа в контрольную сумму перебора: без нее компилятор мог бы
+    // выбросить цикл.
+    template <class Key>
+    size_t key_weight(const Key& key) noexcept {
+        if constexpr (std::is_same_v<Key, std::string>)
+            return key.size();
+        else
+            return static_cast<size_t>(key);
+    }
+
+    // Единый интерфейс хеш-таблиц для шаблонных бенчмарков.
+    template <class Key>
+    class OrderedTable {
+        private:
+            KeyedOrderedHashTable<Key, uint64_t> table_;
+        public:
+            void insert(const Key& key, const uint64_t& value) {
+                this->table_.insert(key, value);
+            }
+
+            [[nodiscard]]
+            uint64_t get(const Key& key) {
+                return this->table_.get(key);
+            }
+
+            void erase(const Key& key) {
+                this->table_.erase(key);
+            }
+
+            uint64_t pop() {
+                return this->table_.pop();
+            }
+
+            void reserve(const size_t& count) {
+                this->table_.reserve(count);
+            }
+
+            [[nodiscard]]
+            size_t length() const {
+                return this->table_.length();
+            }
+
+            // Перебор в порядке добавления.
+            [[nodiscard]]
+            size_t scan() const {
+                size_t total{};
+                for (const auto& key : *this->table_.keys())
+                    total += key_weight(key);
+                return total;
+            }
+    };
+
+    template <class Map>
+    class StdTable {
+        private:
+            Map table_;
+        public:
+            using Key = typename Map::key_type;
+
+            void insert(const Key& key, const uint64_t& value) {
+                this->table_.insert_or_assign(key, value);
+            }
+
+            [[nodiscard]]
+            uint64_t get(const Key& key) const {
+                auto it{ this->table_.find(key) };
+                return (it != this->table_.end()) ? it->second : 0;
+            }
+
+            void erase(const Key& key) {
+                this->table_.erase(key);
+            }
+
+            // Порядка добавления нет: извлекается первый элемент перебора.
+            uint64_t pop() {
+                auto it{ this->table_.begin() };
+                uint64_t value{ it->second };
+                this->table_.erase(it);
+                return value;
+            }
+
+            void reserve(const size_t& count) {
+                this->table_.reserve(count);
+            }
+
+            [[nodiscard]]
+            size_t length() const {
+                return this->table_.size();
+            }
+
+            [[nodiscard]]
+            size_t scan() const {
+                size_t total{};
+                for (const auto& [key, value] : this->table_)
+                    total += key_weight(key);
+                return total;
+            }
+    };
+
+    template <class Key>
+    using UnorderedMap = StdTable<std::unordered_map<Key, uint64_t>>;
+#ifdef CONTAINER_BENCHMARK_HAS_ABSL
+    template <class Key>
+    using FlatHashMap = StdTable<absl::flat_hash_map<Key, uint64_t>>;
+#endif
+
+    template <template <class> class Table, class Key>
+    Table<Key> make_table(const std::vector<Key>& keys) {
+        Table<Key> table;
+        for (size_t item{}; item < keys.size(); item++)
+            table.insert(keys[item], item);
+        return table;
+    }
+}
+
+/* ============================== Хеш-таблицы ============================== */
+
+// Построение таблицы из count ключей вставками по одной.
+template <template <class> class Table, class Key>
+static void BM_Insert(benchmark::State& state) {
+    auto keys{ make_keys<Key>(0, state.range(0)) };
+    for (auto _ : state) {
+        auto table{ make_table<Table>(keys) };
+        benchmark::DoNotOptimize(table.length());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Поиск существующих ключей.
+template <template <class> class Table, class Key>
+static void BM_HitLookup(benchmark::State& state) {
+    auto keys{ make_keys<Key>(0, state.range(0)) };
+    auto table{ make_table<Table>(keys) };
+    auto sample{ sample_keys(keys) };
+    for (auto _ : state) {
+        for (const auto& key : sample)
+            benchmark::DoNotOptimize(table.get(key));
+    }
+    state.SetItemsProcessed(state.iterations() * sample.size());
+}
+
+// Поиск отсутствующих ключей.
+template <template <class> class Table, class Key>
+static void BM_MissLookup(benchmark::State& state) {
+    auto keys{ make_keys<Key>(0, state.range(0)) };
+    auto table{ make_table<Table>(keys) };
+    auto missing{ make_keys<Key>(keys.size(), LOOKUPS_PER_ITERATION) };
+    for (auto _ : state) {
+        for (const auto& key : missing)
+            benchmark::DoNotOptimize(table.get(key));
+    }
+    state.SetItemsProcessed(state.iterations() * missing.size());
+}
+
+// Удаление всех ключей в случайном порядке.
+template <template <class> class Table, class Key>
+static void BM_Erase(benchmark::State& state) {
+    auto keys{ make_keys<Key>(0, state.range(0)) };
+    auto order{ keys };
+    std::shuffle(order.begin(), order.end(), std::mt19937_64{ 7 });
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto table{ make_table<Table>(keys) };
+        state.ResumeTiming();
+        for (const auto& key : order)
+            table.erase(key);
+        benchmark::DoNotOptimize(table.length());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Извлечение всех элементов через pop.
+template <template <class> class Table, class Key>
+static void BM_Pop(benchmark::State& state) {
+    auto keys{ make_keys<Key>(0, state.range(0)) };
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto table{ make_table<Table>(keys) };
+        state.ResumeTiming();
+        while (table.length() != 0)
+            benchmark::DoNotOptimize(table.pop());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Перехеширование заполненной таблицы под вчетверо большее количество
+// ключей: та же перестройка хранилища, что выполняет expand().
+template <template <class> class Table, class Key>
+static void BM_Expand(benchmark::State& state) {
+    auto keys{ make_keys<Key>(0, state.range(0)) };
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto table{ make_table<Table>(keys) };
+        state.ResumeTiming();
+        table.reserve(keys.size() * 4);
+        benchmark::DoNotOptimize(table.length());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Перебор всех элементов.
+template <template <class> class Table, class Key>
+static void BM_Iterate(benchmark::State& state) {
+    auto keys{ make_keys<Key>(0, state.range(0)) };
+    auto table{ make_table<Table>(keys) };
+    for (auto _ : state)
+        benchmark::DoNotOptimize(table.scan());
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+#define TABLE_BENCHMARK(NAME, TABLE, KEY, MAX)                                  \
+    BENCHMARK(NAME<TABLE, KEY>)->RangeMultiplier(10)->Range(MIN_KEYS, MAX)      \
+            ->Unit(benchmark::kMicrosecond)
+
+#ifdef CONTAINER_BENCHMARK_HAS_ABSL
+    #define TABLE_BENCHMARKS(NAME, KEY, MAX)                                    \
+        TABLE_BENCHMARK(NAME, OrderedTable, KEY, MAX);                          \
+        TABLE_BENCHMARK(NAME, UnorderedMap, KEY, MAX);                          \
+        TABLE_BENCHMARK(NAME, FlatHashMap, KEY, MAX)
+#else
+    #define TABLE_BENCHMARKS(NAME, KEY, MAX)                                    \
+        TABLE_BENCHMARK(NAME, OrderedTable, KEY, MAX);                          \
+        TABLE_BENCHMARK(NAME, UnorderedMap, KEY, MAX)
+#endif
+
+TABLE_BENCHMARKS(BM_Insert, uint64_t, MAX_KEYS);
+TABLE_BENCHMARKS(BM_HitLookup, uint64_t, MAX_KEYS);
+TABLE_BENCHMARKS(BM_MissLookup, uint64_t, MAX_KEYS);
+TABLE_BENCHMARKS(BM_Erase, uint64_t, MAX_KEYS);
+TABLE_BENCHMARKS(BM_Pop, uint64_t, MAX_KEYS);
+TABLE_BENCHMARKS(BM_Expand, uint64_t, MAX_KEYS);
+TABLE_BENCHMARKS(BM_Iterate, uint64_t, MAX_KEYS);
+
+TABLE_BENCHMARKS(BM_Insert, std::string, MAX_STRING_KEYS);
+TABLE_BENCHMARKS(BM_HitLookup, std::string, MAX_STRING_KEYS);
+TABLE_BENCHMARKS(BM_MissLookup, std::string, MAX_STRING_KEYS);
+TABLE_BENCHMARKS(BM_Erase, std::string, MAX_STRING_KEYS);
+
+/* =========================== Память на запись =========================== */
+
+namespace {
+    constexpr size_t MEMORY_RECORDS{ 100000 };
+    constexpr size_t NESTED_FIELDS{ 8 };
+
+    // Занятая куча процесса в байтах; 0, если mallinfo2 недоступна.
+    size_t heap_bytes() noexcept {
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || __GLIBC_MINOR__ >= 33)
+        const auto info{ mallinfo2() };
+        return info.uordblks + info.hblkhd;
+#else
+        return 0;
+#endif
+    }
+
+    // Ключ из номера элемента, дополненный слева до length символов.
+    std::string sized_key(const size_t& item, const size_t& length) {
+        std::string key{ std::to_string(item) };
+        key.insert(0, length - std::min(length, key.size()), 'k');
+        return key;
+    }
+
+    // Имена полей вложенных таблиц, одинаковые у всех строк и длиннее
+    // CompactKey::INLINE_CAPACITY.
+    std::string field_name(const size_t& field) {
+        return "customer_attribute_" + std::to_string(field);
+    }
+
+    template <class Key>
+    using StringKeyTable = KeyedOrderedHashTable<Key, uint64_t>;
+
+    // OrderedHashTable с size(), как у std::unordered_map.
+    template <class Key>
+    class MemoryTable : public StringKeyTable<Key> {
+        public:
+            [[nodiscard]]
+            size_t size() const noexcept {
+                return this->length();
+            }
+    };
+
+    using StringMap = std::unordered_map<std::string, uint64_t>;
+}
+
+// Память таблицы на запись (аргумент - длина ключа в байтах).
+template <class Table>
+static void BM_BytesPerRecord(benchmark::State& state) {
+    std::vector<std::string> keys(MEMORY_RECORDS);
+    for (size_t item{}; item < keys.size(); item++)
+        keys[item] = sized_key(item, static_cast<size_t>(state.range(0)));
+    double bytes{};
+    for (auto _ : state) {
+        const size_t before{ heap_bytes() };
+        Table table;
+        for (size_t item{}; item < keys.size(); item++)
+            table.insert_or_assign(keys[item], item);
+        bytes = static_cast<double>(heap_bytes() - before) /
+                static_cast<double>(keys.size());
+        benchmark::DoNotOptimize(table.size());
+    }
+    state.counters["bytes_per_record"] = bytes;
+}
+
+// Строки из NESTED_FIELDS полей с одинаковыми длинными именами; для
+// CompactKey с INTERN все вложенные таблицы разделяют одну арену.
+template <class Key, ArenaMode MODE>
+static void BM_NestedBytesPerField(benchmark::State& state) {
+    using Inner = StringKeyTable<Key>;
+    std::vector<std::string> fields(NESTED_FIELDS);
+    for (size_t field{}; field < fields.size(); field++)
+        fields[field] = field_name(field);
+    const auto rows{ static_cast<size_t>(state.range(0)) };
+    double bytes{};
+    for (auto _ : state) {
+        const size_t before{ heap_bytes() };
+        std::shared_ptr<KeyArena> arena;
+        if constexpr (std::is_same_v<Key, CompactKey>) {
+            if (MODE == ArenaMode::INTERN)
+                arena = std::make_shared<KeyArena>(MODE);
+        }
+        OrderedHashTable<Inner> table;
+        for (size_t row{}; row < rows; row++) {
+            Inner inner{ [&arena] {
+                if constexpr (std::is_same_v<Key, CompactKey>)
+                    return Inner(arena);
+                else
+                    return Inner();
+            }() };
+            for (size_t field{}; field < fields.size(); field++)
+                inner.insert(fields[field], field);
+            table.insert("row:" + std::to_string(row), std::move(inner));
+        }
+        bytes = static_cast<double>(heap_bytes() - before) /
+                static_cast<double>(rows * fields.size());
+        benchmark::DoNotOptimize(table.length());
+    }
+    state.counters["bytes_per_record"] = bytes;
+}
+
+#define MEMORY_BENCHMARK(TABLE)                                                 \
+    BENCHMARK(BM_BytesPerRecord<TABLE>)->Arg(12)->Arg(32)->Iterations(1)        \
+            ->Unit(benchmark::kMillisecond)
+
+MEMORY_BENCHMARK(MemoryTable<std::string>);
+MEMORY_BENCHMARK(MemoryTable<CompactKey>);
+MEMORY_BENCHMARK(StringMap);
+BENCHMARK(BM_NestedBytesPerField<std::string, ArenaMode::APPEND>)
+        ->Arg(10000)->Iterations(1)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_NestedBytesPerField<CompactKey, ArenaMode::APPEND>)
+        ->Arg(10000)->Iterations(1)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_NestedBytesPerField<CompactKey, ArenaMode::INTERN>)
+        ->Arg(10000)->Iterations(1)->Unit(benchmark::kMillisecond);
+
+/* ================================ Списки ================================ */
+
+namespace {
+    template <class Sequence>
+    Sequence make_sequence(const size_t& count) {
+        Sequence sequence;
+        for (size_t item{}; item < count; item++)
+            sequence.push_back(item);
+        return sequence;
+    }
+
+    // Доступ по индексу: у List - operator [], у std::list - std::next.
+    template <class Sequence>
+    uint64_t element_at(Sequence& sequence, const size_t& index) {
+        if constexpr (std::is_same_v<Sequence, std::list<uint64_t>>)
+            return *std::next(sequence.begin(), static_cast<std::ptrdiff_t>(index));
+        else
+            return sequence[index];
+    }
+}
+
+template <class Sequence>
+static void BM_SequencePush(benchmark::State& state) {
+    for (auto _ : state) {
+        auto sequence{ make_sequence<Sequence>(state.range(0)) };
+        benchmark::DoNotOptimize(sequence.size());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class Sequence>
+static void BM_SequencePop(benchmark::State& state) {
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto sequence{ make_sequence<Sequence>(state.range(0)) };
+        state.ResumeTiming();
+        // Элементы извлекаются с обоих концов поочередно.
+        for (bool front{ true }; !sequence.empty(); front = !front) {
+            if (front) {
+                benchmark::DoNotOptimize(sequence.front());
+                sequence.pop_front();
+            }
+            else {
+                benchmark::DoNotOptimize(sequence.back());
+                sequence.pop_back();
+            }
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Доступ по случайному индексу: для списков - O(n) на вызов.
+template <class Sequence>
+static void BM_SequenceAt(benchmark::State& state) {
+    auto sequence{ make_sequence<Sequence>(state.range(0)) };
+    std::mt19937_64 rng{ 42 };
+    for (auto _ : state)
+        benchmark::DoNotOptimize(element_at(sequence, rng() % state.range(0)));
+    state.SetItemsProcessed(state.iterations());
+}
+
+template <class Sequence>
+static void BM_SequenceIterate(benchmark::State& state) {
+    auto sequence{ make_sequence<Sequence>(state.range(0)) };
+    for (auto _ : state) {
+        uint64_t total{};
+        for (const auto& value : sequence)
+            total += value;
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// List не предоставляет size()/empty()/front()/back() в стиле std:
+// обертка приводит интерфейс к общему.
+namespace {
+    class ListSequence : public List<uint64_t> {
+        public:
+            [[nodiscard]]
+            size_t size() const noexcept {
+                return this->length();
+            }
+
+            [[nodiscard]]
+            bool empty() const noexcept {
+                return this->length() == 0;
+            }
+
+            [[nodiscard]]
+            uint64_t front() const {
+                return *this->begin();
+            }
+
+            [[nodiscard]]
+            uint64_t back() const {
+                return *this->rbegin();
+            }
+
+            void pop_front() {
+                static_cast<void>(List<uint64_t>::pop_front());
+            }
+
+            void pop_back() {
+                static_cast<void>(List<uint64_t>::pop_back());
+            }
+    };
+}
+
+#define SEQUENCE_BENCHMARKS(NAME, MAX)                                          \
+    BENCHMARK(NAME<ListSequence>)->RangeMultiplier(10)->Range(MIN_KEYS, MAX)    \
+            ->Unit(benchmark::kMicrosecond);                                    \
+    BENCHMARK(NAME<std::list<uint64_t>>)->RangeMultiplier(10)                   \
+            ->Range(MIN_KEYS, MAX)->Unit(benchmark::kMicrosecond);              \
+    BENCHMARK(NAME<std::deque<uint64_t>>)->RangeMultiplier(10)                  \
+            ->Range(MIN_KEYS, MAX)->Unit(benchmark::kMicrosecond)
+
+SEQUENCE_BENCHMARKS(BM_SequencePush, MAX_KEYS);
+SEQUENCE_BENCHMARKS(BM_SequencePop, MAX_KEYS);
+SEQUENCE_BENCHMARKS(BM_SequenceAt, MAX_KEYS);
+SEQUENCE_BENCHMARKS(BM_SequenceIterate, MAX_KEYS);
+
+BENCHMARK_MAIN();
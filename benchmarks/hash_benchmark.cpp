@@ -0,0 +1,422 @@
+/// \file hash_benchmark.cpp.
+/// \author Лошкарев Дмитрий.
+/// \date 14.10.2026.
+///
+/// \brief Сравнивает исходную схему хеширования (DJB2 + fmod/ceil на
+/// макросах HASH_CONST_*) с функциями хеширования из hasher.hpp.
+
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "indexedlist.hpp"
+#include "orderhashtable.hpp"
+#include "snapshot.hpp"
+
+using DataStructures::bucket_index;
+using DataStructures::Djb2Hasher;
+using DataStructures::IndexedList;
+using DataStructures::KeyedOrderedHashTable;
+using DataStructures::List;
+using DataStructures::MappedOrderedHashTable;
+using DataStructures::OpenAddressingStorage;
+using DataStructures::OrderedHashTable;
+using DataStructures::ThreadPool;
+using DataStructures::WyHasher;
+
+namespace {
+    constexpr size_t TABLE_SIZE{ 1 << 16 };
+
+    // Исходная схема: 32-битный DJB2 и мультипликативный метод в double.
+    uint64_t legacy_index(const std::string& key, const size_t& size) {
+        uint32_t key_int{ HASH_CONST_I };
+        for (const char& i : key)
+            key_int = HASH_CONST_I_2 * key_int + static_cast<unsigned char>(i);
+        return static_cast<uint64_t>(ceil(static_cast<double>(size) *
+                                          fmod((key_int * HASH_CONST_D), 1)) - 1);
+    }
+
+    std::vector<std::string> make_keys(const size_t& count,
+                                       const size_t& length) {
+        std::mt19937_64 rng{ 42 };
+        std::vector<std::string> keys(count);
+        for (auto& key : keys) {
+            key.resize(length);
+            for (auto& symbol : key)
+                symbol = static_cast<char>('a' + rng() % 26);
+        }
+        return keys;
+    }
+
+    // Составные ключи вида "user:<id>:field": так выглядят ключи в СУБД.
+    std::vector<std::string> make_sequential_keys(const size_t& count) {
+        std::vector<std::string> keys(count);
+        for (size_t i{}; i < count; i++)
+            keys[i] = "user:" + std::to_string(i) + ":field";
+        return keys;
+    }
+}
+
+// Вычисление индекса ячейки для ключей разной длины.
+static void BM_LegacyIndex(benchmark::State& state) {
+    auto keys{ make_keys(1024, state.range(0)) };
+    size_t item{};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(legacy_index(keys[item++ & 1023], TABLE_SIZE));
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_LegacyIndex)->RangeMultiplier(4)->Range(4, 1024);
+
+template <class Hasher>
+static void BM_HasherIndex(benchmark::State& state) {
+    auto keys{ make_keys(1024, state.range(0)) };
+    Hasher hasher;
+    size_t item{};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(bucket_index(hasher(keys[item++ & 1023]),
+                                              TABLE_SIZE));
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_HasherIndex<Djb2Hasher>)->RangeMultiplier(4)->Range(4, 1024);
+BENCHMARK(BM_HasherIndex<WyHasher>)->RangeMultiplier(4)->Range(4, 1024);
+
+// Количество совпадений полных хешей среди различных ключей.
+static void BM_LegacyCollisions(benchmark::State& state) {
+    auto keys{ make_keys(state.range(0), 16) };
+    std::vector<uint32_t> hashes(keys.size());
+    size_t collisions{};
+    for (auto _ : state) {
+        for (size_t i{}; i < keys.size(); i++) {
+            uint32_t key_int{ HASH_CONST_I };
+            for (const char& symbol : keys[i])
+                key_int = HASH_CONST_I_2 * key_int +
+                          static_cast<unsigned char>(symbol);
+            hashes[i] = key_int;
+        }
+        std::sort(hashes.begin(), hashes.end());
+        collisions = keys.size() - static_cast<size_t>(
+                std::unique(hashes.begin(), hashes.end()) - hashes.begin());
+    }
+    state.counters["collisions"] = static_cast<double>(collisions);
+}
+BENCHMARK(BM_LegacyCollisions)->RangeMultiplier(16)->Range(1 << 16, 1 << 24)
+        ->Unit(benchmark::kMillisecond);
+
+template <class Hasher>
+static void BM_HasherCollisions(benchmark::State& state) {
+    auto keys{ make_keys(state.range(0), 16) };
+    std::vector<uint64_t> hashes(keys.size());
+    Hasher hasher;
+    size_t collisions{};
+    for (auto _ : state) {
+        for (size_t i{}; i < keys.size(); i++)
+            hashes[i] = hasher(keys[i]);
+        std::sort(hashes.begin(), hashes.end());
+        collisions = keys.size() - static_cast<size_t>(
+                std::unique(hashes.begin(), hashes.end()) - hashes.begin());
+    }
+    state.counters["collisions"] = static_cast<double>(collisions);
+}
+BENCHMARK(BM_HasherCollisions<WyHasher>)->RangeMultiplier(16)
+        ->Range(1 << 16, 1 << 24)->Unit(benchmark::kMillisecond);
+
+// Поиск существующих ключей в хеш-таблице.
+template <class Storage, class Hasher>
+static void BM_TableGet(benchmark::State& state) {
+    auto keys{ make_sequential_keys(state.range(0)) };
+    OrderedHashTable<int, Storage, Hasher> table;
+    for (size_t i{}; i < keys.size(); i++)
+        table.insert(keys[i], static_cast<int>(i));
+    size_t item{};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(table.get(keys[item]));
+        item = (item + 1 == keys.size()) ? 0 : item + 1;
+    }
+}
+BENCHMARK(BM_TableGet<DataStructures::ChainedStorage, Djb2Hasher>)
+        ->RangeMultiplier(16)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_TableGet<DataStructures::ChainedStorage, WyHasher>)
+        ->RangeMultiplier(16)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_TableGet<DataStructures::ChunkedChainedStorage, WyHasher>)
+        ->RangeMultiplier(16)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_TableGet<OpenAddressingStorage, Djb2Hasher>)
+        ->RangeMultiplier(16)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_TableGet<OpenAddressingStorage, WyHasher>)
+        ->RangeMultiplier(16)->Range(1 << 10, 1 << 20);
+
+// Поиск пакета ключей в случайном порядке: по одному и через get_batch.
+template <class Storage>
+static void BM_TableGetLoop(benchmark::State& state) {
+    auto keys{ make_keys(state.range(0), 16) };
+    OrderedHashTable<int, Storage> table;
+    for (size_t i{}; i < keys.size(); i++)
+        table.insert(keys[i], static_cast<int>(i));
+    std::shuffle(keys.begin(), keys.end(), std::mt19937_64{ 7 });
+    for (auto _ : state) {
+        for (const auto& key : keys)
+            benchmark::DoNotOptimize(table.get(key));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_TableGetLoop<DataStructures::ChainedStorage>)
+        ->RangeMultiplier(16)->Range(1 << 12, 1 << 22);
+BENCHMARK(BM_TableGetLoop<DataStructures::ChunkedChainedStorage>)
+        ->RangeMultiplier(16)->Range(1 << 12, 1 << 22);
+BENCHMARK(BM_TableGetLoop<OpenAddressingStorage>)
+        ->RangeMultiplier(16)->Range(1 << 12, 1 << 22);
+
+template <class Storage>
+static void BM_TableGetBatch(benchmark::State& state) {
+    auto keys{ make_keys(state.range(0), 16) };
+    OrderedHashTable<int, Storage> table;
+    for (size_t i{}; i < keys.size(); i++)
+        table.insert(keys[i], static_cast<int>(i));
+    std::shuffle(keys.begin(), keys.end(), std::mt19937_64{ 7 });
+    std::vector<int*> out(keys.size());
+    for (auto _ : state) {
+        table.get_batch(keys, out);
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_TableGetBatch<DataStructures::ChainedStorage>)
+        ->RangeMultiplier(16)->Range(1 << 12, 1 << 22);
+BENCHMARK(BM_TableGetBatch<OpenAddressingStorage>)
+        ->RangeMultiplier(16)->Range(1 << 12, 1 << 22);
+
+// Загрузка пакета пар в пустую таблицу: по одной и через insert_batch.
+template <class Storage>
+static void BM_TableInsertLoop(benchmark::State& state) {
+    auto keys{ make_keys(state.range(0), 16) };
+    for (auto _ : state) {
+        OrderedHashTable<int, Storage> table;
+        for (size_t i{}; i < keys.size(); i++)
+            table.insert(keys[i], static_cast<int>(i));
+        benchmark::DoNotOptimize(table.length());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_TableInsertLoop<DataStructures::ChainedStorage>)
+        ->RangeMultiplier(16)->Range(1 << 12, 1 << 20)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_TableInsertLoop<OpenAddressingStorage>)
+        ->RangeMultiplier(16)->Range(1 << 12, 1 << 20)
+        ->Unit(benchmark::kMillisecond);
+
+template <class Storage>
+static void BM_TableInsertBatch(benchmark::State& state) {
+    auto keys{ make_keys(state.range(0), 16) };
+    std::vector<std::pair<std::string, int>> items(keys.size());
+    for (size_t i{}; i < keys.size(); i++)
+        items[i] = { keys[i], static_cast<int>(i) };
+    for (auto _ : state) {
+        OrderedHashTable<int, Storage> table;
+        table.insert_batch(items);
+        benchmark::DoNotOptimize(table.length());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_TableInsertBatch<DataStructures::ChainedStorage>)
+        ->RangeMultiplier(16)->Range(1 << 12, 1 << 20)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_TableInsertBatch<OpenAddressingStorage>)
+        ->RangeMultiplier(16)->Range(1 << 12, 1 << 20)
+        ->Unit(benchmark::kMillisecond);
+
+// Построение таблицы из пакета пар пулом потоков (аргумент - число потоков).
+template <class Storage>
+static void BM_TableBulkBuild(benchmark::State& state) {
+    auto keys{ make_keys(1 << 20, 16) };
+    std::vector<std::pair<std::string, int>> items(keys.size());
+    for (size_t i{}; i < keys.size(); i++)
+        items[i] = { keys[i], static_cast<int>(i) };
+    ThreadPool pool(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        auto table{ OrderedHashTable<int, Storage>::bulk_build(items, pool) };
+        benchmark::DoNotOptimize(table.length());
+    }
+    state.SetItemsProcessed(state.iterations() * keys.size());
+}
+BENCHMARK(BM_TableBulkBuild<DataStructures::ChainedStorage>)
+        ->RangeMultiplier(2)->Range(1, 32)->UseRealTime()
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_TableBulkBuild<OpenAddressingStorage>)
+        ->RangeMultiplier(2)->Range(1, 32)->UseRealTime()
+        ->Unit(benchmark::kMillisecond);
+
+// Вставка по одной с расширением таблицы пулом потоков.
+template <class Storage>
+static void BM_TableParallelExpand(benchmark::State& state) {
+    auto keys{ make_keys(1 << 20, 16) };
+    ThreadPool pool(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        OrderedHashTable<int, Storage> table;
+        table.set_thread_pool(&pool);
+        for (size_t i{}; i < keys.size(); i++)
+            table.insert(keys[i], static_cast<int>(i));
+        benchmark::DoNotOptimize(table.length());
+    }
+    state.SetItemsProcessed(state.iterations() * keys.size());
+}
+BENCHMARK(BM_TableParallelExpand<DataStructures::ChainedStorage>)
+        ->RangeMultiplier(2)->Range(1, 32)->UseRealTime()
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_TableParallelExpand<OpenAddressingStorage>)
+        ->RangeMultiplier(2)->Range(1, 32)->UseRealTime()
+        ->Unit(benchmark::kMillisecond);
+
+// Доступ по случайному индексу: List идет от ближнего конца за O(n),
+// IndexedList спускается по уровням за O(log n).
+template <class ListType>
+static void BM_ListIndex(benchmark::State& state) {
+    ListType list;
+    auto length{ static_cast<size_t>(state.range(0)) };
+    for (size_t i{}; i < length; i++)
+        list.push_back(static_cast<int>(i));
+    std::mt19937 rng{ 42 };
+    for (auto _ : state)
+        benchmark::DoNotOptimize(list[rng() % length]);
+}
+BENCHMARK(BM_ListIndex<List<int>>)->RangeMultiplier(8)->Range(64, 1 << 15);
+BENCHMARK(BM_ListIndex<IndexedList<int>>)->RangeMultiplier(8)
+        ->Range(64, 1 << 15);
+
+// Перебор ключей с префиксом: полный обход keys() против
+// упорядоченного индекса.
+static void BM_TablePrefixScan(benchmark::State& state) {
+    auto keys{ make_sequential_keys(1 << 20) };
+    OrderedHashTable<int> table;
+    for (size_t i{}; i < keys.size(); i++)
+        table.insert(keys[i], static_cast<int>(i));
+    for (auto _ : state) {
+        size_t count{};
+        for (const std::string& key : *table.keys())
+            count += key.starts_with("user:12345");
+        benchmark::DoNotOptimize(count);
+    }
+}
+BENCHMARK(BM_TablePrefixScan)->Unit(benchmark::kMicrosecond);
+
+static void BM_TablePrefixIndex(benchmark::State& state) {
+    auto keys{ make_sequential_keys(1 << 20) };
+    OrderedHashTable<int> table;
+    table.enable_sorted_index();
+    for (size_t i{}; i < keys.size(); i++)
+        table.insert(keys[i], static_cast<int>(i));
+    for (auto _ : state) {
+        size_t count{};
+        for (auto [key, value] : table.prefix("user:12345"))
+            count += static_cast<size_t>(value != 0);
+        benchmark::DoNotOptimize(count);
+    }
+}
+BENCHMARK(BM_TablePrefixIndex)->Unit(benchmark::kMicrosecond);
+
+// Полный обход в порядке добавления: перебор keys() с поиском каждого
+// ключа против items(). Каждый второй ключ удален, чтобы обход прошел и
+// по пустым ячейкам массива порядка.
+namespace {
+    OrderedHashTable<int> make_sparse_table(const size_t& count) {
+        auto keys{ make_sequential_keys(count) };
+        OrderedHashTable<int> table;
+        for (size_t i{}; i < keys.size(); i++)
+            table.insert(keys[i], static_cast<int>(i));
+        for (size_t i{}; i < keys.size(); i += 2)
+            table.erase(keys[i]);
+        return table;
+    }
+}
+
+static void BM_OrderedScanKeys(benchmark::State& state) {
+    auto table{ make_sparse_table(static_cast<size_t>(state.range(0))) };
+    for (auto _ : state) {
+        int64_t sum{};
+        for (const std::string& key : *table.keys())
+            sum += table[key];
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * table.length());
+}
+BENCHMARK(BM_OrderedScanKeys)->RangeMultiplier(16)->Range(1 << 12, 1 << 20);
+
+static void BM_OrderedScanItems(benchmark::State& state) {
+    auto table{ make_sparse_table(static_cast<size_t>(state.range(0))) };
+    for (auto _ : state) {
+        int64_t sum{};
+        for (auto [key, value] : table.items())
+            sum += value;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * table.length());
+}
+BENCHMARK(BM_OrderedScanItems)->RangeMultiplier(16)->Range(1 << 12, 1 << 20);
+
+// Снимок таблицы из 1M ключей: открытие отображением файла и поиск
+// прямо в нем.
+namespace {
+    const std::filesystem::path& snapshot_path() {
+        static const std::filesystem::path path{ [] {
+            auto keys{ make_sequential_keys(1 << 20) };
+            OrderedHashTable<int> table;
+            for (size_t i{}; i < keys.size(); i++)
+                table.insert(keys[i], static_cast<int>(i));
+            auto result{ std::filesystem::temp_directory_path() /
+                         "hash_benchmark.snap" };
+            MappedOrderedHashTable<int>::save(table, result);
+            return result;
+        }() };
+        return path;
+    }
+}
+
+static void BM_SnapshotOpen(benchmark::State& state) {
+    const auto& path{ snapshot_path() };
+    for (auto _ : state) {
+        auto snapshot{ MappedOrderedHashTable<int>::open_mapped(path) };
+        benchmark::DoNotOptimize(snapshot.get("user:12345:field"));
+    }
+}
+BENCHMARK(BM_SnapshotOpen)->Unit(benchmark::kMicrosecond);
+
+static void BM_SnapshotGet(benchmark::State& state) {
+    auto keys{ make_sequential_keys(1 << 20) };
+    auto snapshot{ MappedOrderedHashTable<int>::open_mapped(snapshot_path()) };
+    std::mt19937 rng{ 42 };
+    for (auto _ : state)
+        benchmark::DoNotOptimize(snapshot.get(keys[rng() % keys.size()]));
+}
+BENCHMARK(BM_SnapshotGet);
+
+// Таблица с ключами uint64: числа проходят через std::to_string перед
+// каждым вызовом или хранятся в записи как есть.
+static void BM_IdKeyStringified(benchmark::State& state) {
+    const auto count{ static_cast<uint64_t>(state.range(0)) };
+    OrderedHashTable<int> table;
+    for (uint64_t id{}; id < count; id++)
+        table.insert(std::to_string(id * 7919), static_cast<int>(id));
+    std::mt19937_64 rng{ 42 };
+    for (auto _ : state)
+        benchmark::DoNotOptimize(table.get(std::to_string(rng() % count * 7919)));
+}
+BENCHMARK(BM_IdKeyStringified)->RangeMultiplier(16)->Range(1 << 12, 1 << 20);
+
+static void BM_IdKeyInline(benchmark::State& state) {
+    const auto count{ static_cast<uint64_t>(state.range(0)) };
+    KeyedOrderedHashTable<uint64_t, int> table;
+    for (uint64_t id{}; id < count; id++)
+        table.insert(id * 7919, static_cast<int>(id));
+    std::mt19937_64 rng{ 42 };
+    for (auto _ : state)
+        benchmark::DoNotOptimize(table.get(rng() % count * 7919));
+}
+BENCHMARK(BM_IdKeyInline)->RangeMultiplier(16)->Range(1 << 12, 1 << 20);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,104 @@
+/// \file import_benchmark.cpp.
+/// \author Лошкарев Дмитрий.
+/// \date 14.10.2026.
+///
+/// \brief Измеряет пропускную способность (байт/с) потокового импорта
+/// CSV в OrderedHashTable по сравнению с построчным чтением через
+/// std::getline.
+
+#include <charconv>
+#include <filesystem>
+#include <fstream>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include <benchmark/benchmark.h>
+
+#include "csvimport.hpp"
+#include "orderhashtable.hpp"
+
+using DataStructures::CsvImporter;
+using DataStructures::OrderedHashTable;
+
+namespace {
+    constexpr size_t ROW_COUNT{ 1 << 21 };
+
+    // Файл вида "user:<id>:field,<id>" создается один раз на запуск.
+    const std::filesystem::path& csv_path() {
+        static const std::filesystem::path path{ [] {
+            auto result{ std::filesystem::temp_directory_path() /
+                         "import_benchmark.csv" };
+            std::ofstream out{ result, std::ios::binary };
+            for (size_t i{}; i < ROW_COUNT; i++)
+                out << "user:" << i << ":field," << i << '\n';
+            return result;
+        }() };
+        return path;
+    }
+
+    // Таблица-заглушка: измеряется только чтение и разбор.
+    class NullTable {
+        private:
+            size_t length_{};
+        public:
+            void insert_batch(std::span<const std::pair<std::string_view, int>> items) {
+                this->length_ += items.size();
+            }
+
+            [[nodiscard]]
+            size_t length() const noexcept {
+                return this->length_;
+            }
+    };
+}
+
+// Исходный подход: std::getline, копии полей и вставка по одной.
+static void BM_GetlineImport(benchmark::State& state) {
+    const auto& path{ csv_path() };
+    for (auto _ : state) {
+        OrderedHashTable<int> table;
+        std::ifstream in{ path };
+        std::string line;
+        while (std::getline(in, line)) {
+            size_t comma{ line.find(',') };
+            int value{};
+            std::from_chars(line.data() + comma + 1, line.data() + line.size(),
+                            value);
+            table.insert(line.substr(0, comma), value);
+        }
+        benchmark::DoNotOptimize(table.length());
+    }
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<int64_t>(std::filesystem::file_size(path)));
+}
+BENCHMARK(BM_GetlineImport)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+// Конвейер чтения и разбора блоками с пакетной вставкой.
+static void BM_CsvImport(benchmark::State& state) {
+    const auto& path{ csv_path() };
+    for (auto _ : state) {
+        OrderedHashTable<int> table;
+        auto result{ CsvImporter<int>().import_file(table, path) };
+        benchmark::DoNotOptimize(result.rows_);
+    }
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<int64_t>(std::filesystem::file_size(path)));
+}
+BENCHMARK(BM_CsvImport)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+// Только чтение и разбор, без вставки в таблицу.
+static void BM_CsvParse(benchmark::State& state) {
+    const auto& path{ csv_path() };
+    for (auto _ : state) {
+        NullTable table;
+        auto result{ CsvImporter<int>().import_file(table, path) };
+        benchmark::DoNotOptimize(result.rows_);
+    }
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<int64_t>(std::filesystem::file_size(path)));
+}
+BENCHMARK(BM_CsvParse)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
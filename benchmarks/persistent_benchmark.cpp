@@ -0,0 +1,120 @@
+/// \file persistent_benchmark.cpp.
+/// \author Лошкарев Дмитрий.
+/// \date 14.10.2026.
+///
+/// \brief Сравнивает снимок PersistentOrderedHashTable с полной копией
+/// OrderedHashTable, которую приходится делать для замороженного вида
+/// таблицы, а также стоимость вставки в обе таблицы и вставки вложенной
+/// таблицы, как в main.cpp.
+
+#include <cstdint>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include "orderhashtable.hpp"
+#include "persistenthashtable.hpp"
+
+using DataStructures::OrderedHashTable;
+using DataStructures::PersistentOrderedHashTable;
+
+namespace {
+    std::string row_key(const int64_t& row) {
+        return "row:" + std::to_string(row);
+    }
+
+    template <class Table>
+    Table make_table(const int64_t& rows) {
+        Table table;
+        for (int64_t row{}; row < rows; row++)
+            table.insert(row_key(row), static_cast<int>(row));
+        return table;
+    }
+}
+
+static void BM_OrderedCopy(benchmark::State& state) {
+    const auto table{ make_table<OrderedHashTable<int>>(state.range(0)) };
+    for (auto _ : state) {
+        OrderedHashTable<int> copy{ table };
+        benchmark::DoNotOptimize(copy);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_OrderedCopy)->RangeMultiplier(10)->Range(1000, 100000);
+
+static void BM_PersistentSnapshot(benchmark::State& state) {
+    const auto table{ make_table<PersistentOrderedHashTable<int>>(state.range(0)) };
+    for (auto _ : state)
+        benchmark::DoNotOptimize(table.snapshot());
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_PersistentSnapshot)->RangeMultiplier(10)->Range(1000, 100000);
+
+static void BM_OrderedInsert(benchmark::State& state) {
+    for (auto _ : state)
+        benchmark::DoNotOptimize(make_table<OrderedHashTable<int>>(state.range(0)));
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_OrderedInsert)->RangeMultiplier(10)->Range(1000, 100000);
+
+static void BM_PersistentInsert(benchmark::State& state) {
+    for (auto _ : state)
+        benchmark::DoNotOptimize(make_table<PersistentOrderedHashTable<int>>(state.range(0)));
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_PersistentInsert)->RangeMultiplier(10)->Range(1000, 100000);
+
+// Вставка, пока читатель держит снимок: каждая вставка копирует путь.
+static void BM_PersistentInsertWithSnapshot(benchmark::State& state) {
+    auto table{ make_table<PersistentOrderedHashTable<int>>(state.range(0)) };
+    const auto snapshot{ table.snapshot() };
+    int64_t row{};
+    for (auto _ : state) {
+        table.insert(row_key(row % state.range(0)), static_cast<int>(row));
+        row++;
+    }
+    benchmark::DoNotOptimize(snapshot.length());
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_PersistentInsertWithSnapshot)->RangeMultiplier(10)->Range(1000, 100000);
+
+// Вставка вложенной таблицы: OrderedHashTable копирует все записи
+// значения, PersistentOrderedHashTable - только корни.
+static void BM_OrderedNestedInsert(benchmark::State& state) {
+    const auto inner{ make_table<OrderedHashTable<int>>(state.range(0)) };
+    OrderedHashTable<OrderedHashTable<int>> table;
+    for (auto _ : state)
+        table.insert("Test", inner);
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_OrderedNestedInsert)->RangeMultiplier(10)->Range(10, 10000);
+
+static void BM_PersistentNestedInsert(benchmark::State& state) {
+    const auto inner{ make_table<PersistentOrderedHashTable<int>>(state.range(0)) };
+    PersistentOrderedHashTable<PersistentOrderedHashTable<int>> table;
+    for (auto _ : state)
+        table.insert("Test", inner);
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_PersistentNestedInsert)->RangeMultiplier(10)->Range(10, 10000);
+
+static void BM_OrderedGet(benchmark::State& state) {
+    auto table{ make_table<OrderedHashTable<int>>(state.range(0)) };
+    int64_t row{};
+    for (auto _ : state)
+        benchmark::DoNotOptimize(table.get(row_key(row++ % state.range(0))));
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_OrderedGet)->RangeMultiplier(10)->Range(1000, 100000);
+
+static void BM_PersistentSnapshotGet(benchmark::State& state) {
+    const auto snapshot{
+            make_table<PersistentOrderedHashTable<int>>(state.range(0)).snapshot() };
+    int64_t row{};
+    for (auto _ : state)
+        benchmark::DoNotOptimize(snapshot.find(row_key(row++ % state.range(0))));
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_PersistentSnapshotGet)->RangeMultiplier(10)->Range(1000, 100000);
+
+BENCHMARK_MAIN();
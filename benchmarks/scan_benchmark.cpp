@@ -0,0 +1,111 @@
+/// \file scan_benchmark.cpp.
+/// \author Лошкарев Дмитрий.
+/// \date 14.10.2026.
+///
+/// \brief Сравнивает запрос "count/sum/min/max поля Sun, где Moon в
+/// диапазоне" обходом ключей OrderedHashTable<OrderedHashTable<int>> с
+/// ScanEngine над столбцами ColumnarTable: обычным циклом, векторными
+/// ядрами и пулом потоков.
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include <benchmark/benchmark.h>
+
+#include "columnartable.hpp"
+#include "orderhashtable.hpp"
+#include "scanengine.hpp"
+#include "threadpool.hpp"
+
+using DataStructures::ColumnarTable;
+using DataStructures::Compare;
+using DataStructures::OrderedHashTable;
+using DataStructures::ScanEngine;
+using DataStructures::ScanPredicate;
+using DataStructures::SimdLevel;
+using DataStructures::TableSchema;
+using DataStructures::ThreadPool;
+
+namespace {
+    constexpr std::array<std::string_view, 2> FIELDS{ "Sun", "Moon" };
+    // Отбирает примерно четверть строк.
+    constexpr ScanPredicate<int32_t> PREDICATE{ Compare::BETWEEN, 250, 499 };
+
+    int32_t field_value(const int64_t& row, const size_t& field) {
+        return static_cast<int32_t>((row * 7919 + static_cast<int64_t>(field) * 31) % 1000);
+    }
+
+    ColumnarTable<int32_t> make_columnar(const int64_t& rows) {
+        ColumnarTable<int32_t> table{ std::make_shared<const TableSchema>(FIELDS) };
+        table.reserve(static_cast<size_t>(rows));
+        for (int64_t row{}; row < rows; row++)
+            table.insert("row:" + std::to_string(row),
+                         { field_value(row, 0), field_value(row, 1) });
+        return table;
+    }
+
+    void run_query(benchmark::State& state, const ScanEngine& engine) {
+        const ColumnarTable<int32_t> table{ make_columnar(state.range(0)) };
+        for (auto _ : state)
+            benchmark::DoNotOptimize(engine.query(table, "Sun", "Moon", PREDICATE));
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+        state.SetLabel(engine.level() == SimdLevel::SCALAR ? "scalar" : "simd");
+    }
+}
+
+// Обход ключей и поиск полей каждой строки по имени.
+static void BM_NestedQuery(benchmark::State& state) {
+    OrderedHashTable<OrderedHashTable<int32_t>> table;
+    for (int64_t row{}; row < state.range(0); row++) {
+        OrderedHashTable<int32_t> fields;
+        for (size_t field{}; field < FIELDS.size(); field++)
+            fields.insert(FIELDS[field], field_value(row, field));
+        table.insert("row:" + std::to_string(row), std::move(fields));
+    }
+    for (auto _ : state) {
+        int64_t count{}, sum{};
+        int32_t min{ std::numeric_limits<int32_t>::max() };
+        int32_t max{ std::numeric_limits<int32_t>::lowest() };
+        for (auto it{ table.keys()->begin() }; it != table.keys()->end(); ++it) {
+            auto& fields{ table[*it] };
+            if (!PREDICATE.test(fields["Moon"]))
+                continue;
+            const int32_t value{ fields["Sun"] };
+            count++;
+            sum += value;
+            min = std::min(min, value);
+            max = std::max(max, value);
+        }
+        benchmark::DoNotOptimize(count + sum + min + max);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_NestedQuery)->RangeMultiplier(10)->Range(10000, 100000)
+        ->Unit(benchmark::kMillisecond);
+
+static void BM_ScalarQuery(benchmark::State& state) {
+    run_query(state, ScanEngine{ SimdLevel::SCALAR });
+}
+BENCHMARK(BM_ScalarQuery)->RangeMultiplier(10)->Range(10000, 10000000)
+        ->Unit(benchmark::kMicrosecond);
+
+// Лучший набор инструкций процессора (AVX2 или NEON).
+static void BM_SimdQuery(benchmark::State& state) {
+    run_query(state, ScanEngine{});
+}
+BENCHMARK(BM_SimdQuery)->RangeMultiplier(10)->Range(10000, 10000000)
+        ->Unit(benchmark::kMicrosecond);
+
+// Векторные ядра и пул потоков (второй аргумент - число потоков).
+static void BM_ParallelQuery(benchmark::State& state) {
+    ThreadPool pool(static_cast<size_t>(state.range(1)));
+    run_query(state, ScanEngine{ &pool });
+}
+BENCHMARK(BM_ParallelQuery)->ArgsProduct({ { 1000000, 10000000 }, { 1, 2, 4, 8 } })
+        ->UseRealTime()->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,108 @@
+/// \file wal_benchmark.cpp.
+/// \author Лошкарев Дмитрий.
+/// \date 14.10.2026.
+///
+/// \brief Измеряет пропускную способность DurableOrderedHashTable с
+/// групповой фиксацией по сравнению с fsync после каждого изменения и
+/// выводит квантили задержки фиксации.
+
+#include <cstdio>
+#include <filesystem>
+#include <memory>
+#include <string>
+
+#ifdef _WIN32
+    #include <io.h>
+#else
+    #include <unistd.h>
+#endif
+
+#include <benchmark/benchmark.h>
+
+#include "wal.hpp"
+
+using DataStructures::DurableOrderedHashTable;
+using DataStructures::WalOptions;
+
+namespace {
+    const std::filesystem::path& wal_directory() {
+        static const std::filesystem::path path{
+                std::filesystem::temp_directory_path() / "wal_benchmark" };
+        return path;
+    }
+
+    // Общая для потоков бенчмарка таблица: создается первым потоком.
+    std::unique_ptr<DurableOrderedHashTable<int>> shared_table;
+}
+
+// Исходный подход: запись и fsync на каждое изменение.
+static void BM_FsyncPerInsert(benchmark::State& state) {
+    const auto path{ std::filesystem::temp_directory_path() / "wal_benchmark.log" };
+    std::FILE* file{ std::fopen(path.string().c_str(), "wb") };
+    int i{};
+    for (auto _ : state) {
+        const std::string key{ "user:" + std::to_string(i++) };
+        std::fwrite(key.data(), 1, key.size(), file);
+        std::fflush(file);
+#ifdef _WIN32
+        _commit(_fileno(file));
+#else
+        fsync(fileno(file));
+#endif
+    }
+    std::fclose(file);
+    std::filesystem::remove(path);
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_FsyncPerInsert)->UseRealTime();
+
+// Групповая фиксация: каждый insert ждет своего fsync; аргумент - интервал
+// сброса в микросекундах.
+static void BM_WalInsert(benchmark::State& state) {
+    if (state.thread_index() == 0) {
+        std::filesystem::remove_all(wal_directory());
+        WalOptions options;
+        options.flush_interval_ = std::chrono::microseconds(state.range(0));
+        options.compact_bytes_ = size_t{ 1 } << 30;
+        shared_table = std::make_unique<DurableOrderedHashTable<int>>(wal_directory(),
+                                                                      options);
+    }
+    const std::string prefix{ "user:" + std::to_string(state.thread_index()) + ":" };
+    int i{};
+    for (auto _ : state) {
+        shared_table->insert(prefix + std::to_string(i), i);
+        i++;
+    }
+    state.SetItemsProcessed(state.iterations());
+
+    if (state.thread_index() == 0) {
+        auto latency{ shared_table->commit_latency() };
+        state.counters["p50_us"] = static_cast<double>(latency.percentile(0.5));
+        state.counters["p99_us"] = static_cast<double>(latency.percentile(0.99));
+        shared_table.reset();
+        std::filesystem::remove_all(wal_directory());
+    }
+}
+BENCHMARK(BM_WalInsert)->Arg(200)->Arg(2000)->ThreadRange(1, 16)->UseRealTime();
+
+// Без ожидания фиксации: изменения копятся и сбрасываются в фоне.
+static void BM_WalInsertAsync(benchmark::State& state) {
+    std::filesystem::remove_all(wal_directory());
+    WalOptions options;
+    options.wait_durable_ = false;
+    options.compact_bytes_ = size_t{ 1 } << 30;
+    {
+        DurableOrderedHashTable<int> table{ wal_directory(), options };
+        int i{};
+        for (auto _ : state) {
+            table.insert("user:" + std::to_string(i), i);
+            i++;
+        }
+        table.sync();
+        state.SetItemsProcessed(state.iterations());
+    }
+    std::filesystem::remove_all(wal_directory());
+}
+BENCHMARK(BM_WalInsertAsync)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,900 @@
+/// \file boundedhashtable.hpp.
+/// \author Лошкарев Дмитрий.
+/// \date 15.10.2026.
+///
+/// \brief Содержит хеш-таблицу с ограниченной емкостью для работы в
+/// качестве кеша перед медленным хранилищем и ее потокобезопасный вариант,
+/// разделенный на сегменты.
+///
+/// \namespaces
+/// • DataStructures
+/// \classes
+/// • CacheOptions
+/// • CacheStats
+/// • BoundedOrderedHashTable
+/// • ConcurrentBoundedOrderedHashTable
+
+#ifndef CPPPROJECT_BOUNDEDHASHTABLE_H
+#define CPPPROJECT_BOUNDEDHASHTABLE_H
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include "orderhashtable.hpp"
+
+namespace DataStructures {
+// Объявление перечислений.
+
+    /// \enum Перечисление EvictionPolicy описывает выбор вытесняемой
+    /// записи при переполнении кеша.
+    ///
+    /// \n • LRU - вытесняется запись, к которой дольше всего не
+    /// обращались: при каждом попадании запись переносится в конец
+    /// порядка;
+    /// \n • CLOCK - при попадании у записи только ставится отметка
+    /// обращения; при вытеснении отмеченные записи получают второй шанс
+    /// и переносятся в конец порядка, а первая неотмеченная вытесняется.
+    enum class EvictionPolicy : uint8_t {
+        LRU,
+        CLOCK
+    };
+
+// Объявление классов.
+
+    /// \class Структура CacheOptions описывает ограничения емкости кеша и
+    /// способ вытеснения.
+    ///
+    /// Нулевое ограничение не действует, но хотя бы одно ограничение
+    /// должно быть задано.
+    struct CacheOptions {
+        size_t max_entries_{ 0 };                 ///< \brief Наибольшее количество записей.
+        size_t max_bytes_{ 0 };                   ///< \brief Наибольший суммарный объем записей
+                                                  ///< в байтах.
+        EvictionPolicy policy_{ EvictionPolicy::LRU };
+    };
+
+    /// \class Структура CacheStats описывает снимок счетчиков кеша.
+    ///
+    /// Публичные методы:
+    /// \n • double hit_ratio() const noexcept.
+    struct CacheStats {
+        uint64_t hits_{};       ///< \brief Поиски, нашедшие ключ.
+        uint64_t misses_{};     ///< \brief Поиски, не нашедшие ключ.
+        uint64_t evictions_{};  ///< \brief Записи, вытесненные из-за переполнения.
+        size_t length_{};       ///< \brief Количество записей.
+        size_t bytes_{};        ///< \brief Суммарный объем записей в байтах.
+
+        [[nodiscard]] [[maybe_unused]]
+        inline double hit_ratio() const noexcept;
+    };
+
+    template <class HashType, class StoragePolicy, class Hasher>
+    class ConcurrentBoundedOrderedHashTable;
+
+    /// \class Класс BoundedOrderedHashTable предоставляет хеш-таблицу с
+    /// ограниченной емкостью, которая сама вытесняет записи при
+    /// переполнении.
+    ///
+    /// Записи хранятся в OrderedHashTable, и ее массив порядка добавления
+    /// служит очередью вытеснения: в начале массива лежит кандидат на
+    /// вытеснение, в конце - последняя использованная запись. Перенос
+    /// записи в конец и вытеснение первой записи выполняются за O(1), без
+    /// поиска по списку ключей.
+    ///
+    /// Объем записи - размер записи таблицы, длина ключа и, для строковых
+    /// значений, длина значения. Объем измеряется при вставке: изменения
+    /// значения через operator [] его не меняют.
+    ///
+    /// Публичные методы:
+    /// \n • bool insert(std::string_view key, const HashType& value);
+    /// \n • bool insert(std::string_view key, HashType&& value);
+    /// \n • HashType* find(std::string_view key);
+    /// \n • const HashType& get(std::string_view key);
+    /// \n • HashType& operator [] (std::string_view key);
+    /// \n • bool contains(std::string_view key) const;
+    /// \n • bool erase(std::string_view key);
+    /// \n • size_t length() const noexcept;
+    /// \n • size_t bytes() const noexcept;
+    /// \n • const CacheOptions& options() const noexcept;
+    /// \n • CacheStats stats() const noexcept;
+    /// \n • void reset_stats() noexcept.
+    ///
+    /// \tparam HashType Тип значений кеша.
+    /// \tparam StoragePolicy Политика хранения записей таблицы.
+    /// \tparam Hasher Функция хеширования ключей.
+    template <class HashType, class StoragePolicy = ChainedStorage,
+              class Hasher = WyHasher>
+    class BoundedOrderedHashTable {
+        private:
+            static inline constexpr bool IS_STRING_VALUE{
+                    std::is_same_v<HashType, std::string> };
+
+            /// \class Структура Entry описывает значение записи вместе с ее
+            /// объемом и отметкой обращения для CLOCK.
+            struct Entry {
+                HashType value_;
+                size_t bytes_;     ///< \brief Объем записи в байтах.
+                bool referenced_;  ///< \brief Было ли обращение с последнего
+                                   ///< прохода стрелки CLOCK.
+
+                Entry() = default;
+                template <class Value>
+                Entry(Value&&, const size_t&);
+            };
+
+            using Table = OrderedHashTable<Entry, StoragePolicy, Hasher>;
+            using Record = typename Table::Record;
+
+            Table table_;
+            CacheOptions options_;
+            size_t bytes_;       ///< \brief Суммарный объем записей.
+            uint64_t hits_;
+            uint64_t misses_;
+            uint64_t evictions_;
+
+            [[nodiscard]]
+            static size_t entry_bytes(std::string_view, const HashType&) noexcept;
+            [[nodiscard]]
+            inline bool overflows(const size_t&, const size_t&) const noexcept;
+            [[nodiscard]]
+            HashType* lookup(std::string_view, const uint64_t&);
+            [[nodiscard]]
+            inline bool contains(std::string_view, const uint64_t&) const noexcept;
+            template <class Value>
+            bool assign(std::string_view, const uint64_t&, Value&&);
+            bool remove(std::string_view, const uint64_t&);
+            void evict();
+
+            template <class, class, class>
+            friend class ConcurrentBoundedOrderedHashTable;
+        public:
+            explicit BoundedOrderedHashTable(const CacheOptions& options);
+
+            [[maybe_unused]]
+            bool insert(std::string_view key, const HashType& value);
+            [[maybe_unused]]
+            bool insert(std::string_view key, HashType&& value);
+            [[nodiscard]] [[maybe_unused]]
+            HashType* find(std::string_view key);
+            [[maybe_unused]]
+            const HashType& get(std::string_view key);
+            HashType& operator [] (std::string_view key);
+            [[nodiscard]] [[maybe_unused]]
+            bool contains(std::string_view key) const;
+            [[maybe_unused]]
+            bool erase(std::string_view key);
+
+            [[nodiscard]] [[maybe_unused]]
+            inline size_t length() const noexcept;
+            [[nodiscard]] [[maybe_unused]]
+            inline size_t bytes() const noexcept;
+            [[nodiscard]] [[maybe_unused]]
+            inline const CacheOptions& options() const noexcept;
+            [[nodiscard]] [[maybe_unused]]
+            CacheStats stats() const noexcept;
+            [[maybe_unused]]
+            void reset_stats() noexcept;
+    };
+
+    /// \class Класс ConcurrentBoundedOrderedHashTable предоставляет кеш
+    /// BoundedOrderedHashTable, с которым одновременно работают несколько
+    /// потоков.
+    ///
+    /// Ключи распределяются по хешу между N сегментами, как в
+    /// ConcurrentOrderedHashTable. Каждый сегмент - BoundedOrderedHashTable
+    /// со своим std::mutex и своей долей ограничений емкости. Поиск
+    /// переносит запись в конец порядка, т.е. изменяет сегмент, поэтому
+    /// блокировка всегда монопольная. Вытеснение идет внутри сегмента:
+    /// порядок LRU соблюдается для каждого сегмента, а для кеша в целом -
+    /// приближенно.
+    ///
+    /// Публичные методы:
+    /// \n • bool insert(std::string_view key, const HashType& value);
+    /// \n • bool insert(std::string_view key, HashType&& value);
+    /// \n • HashType get(std::string_view key);
+    /// \n • bool visit(std::string_view key, Function&& function);
+    /// \n • bool contains(std::string_view key) const;
+    /// \n • bool erase(std::string_view key);
+    /// \n • size_t length() const;
+    /// \n • size_t bytes() const;
+    /// \n • CacheStats stats() const;
+    /// \n • size_t shard_count() const noexcept.
+    ///
+    /// \tparam HashType Тип значений кеша.
+    /// \tparam StoragePolicy Политика хранения записей сегментов.
+    /// \tparam Hasher Функция хеширования ключей.
+    template <class HashType, class StoragePolicy = ChainedStorage,
+              class Hasher = WyHasher>
+    class ConcurrentBoundedOrderedHashTable {
+        private:
+            static inline constexpr size_t CACHE_LINE_SIZE{ 64 };      ///< \brief Размер кеш-линии.
+            static inline constexpr size_t DEFAULT_SHARD_COUNT{ 16 };  ///< \brief Количество сегментов
+                                                                       ///< по умолчанию.
+
+            using Cache = BoundedOrderedHashTable<HashType, StoragePolicy, Hasher>;
+
+            /// \class Структура Shard описывает сегмент кеша, выровненный по
+            /// кеш-линии.
+            struct alignas(CACHE_LINE_SIZE) Shard {
+                mutable std::mutex mutex_;
+                Cache cache_;
+
+                explicit Shard(const CacheOptions&);
+            };
+
+            size_t shard_count_;
+            Shard* shards_;
+            Hasher hasher_;
+
+            [[nodiscard]]
+            inline Shard& shard_of(const uint64_t&) const noexcept;
+            [[nodiscard]]
+            static CacheOptions shard_options(const CacheOptions&, const size_t&);
+            template <class Value>
+            bool assign(std::string_view, Value&&);
+        public:
+            explicit ConcurrentBoundedOrderedHashTable(
+                    const CacheOptions& options,
+                    const size_t& shard_count = DEFAULT_SHARD_COUNT);
+            ConcurrentBoundedOrderedHashTable(
+                    const ConcurrentBoundedOrderedHashTable&) = delete;
+            ConcurrentBoundedOrderedHashTable& operator = (
+                    const ConcurrentBoundedOrderedHashTable&) = delete;
+            ~ConcurrentBoundedOrderedHashTable();
+
+            [[maybe_unused]]
+            bool insert(std::string_view key, const HashType& value);
+            [[maybe_unused]]
+            bool insert(std::string_view key, HashType&& value);
+            [[nodiscard]] [[maybe_unused]]
+            HashType get(std::string_view key);
+            template <class Function>
+            [[maybe_unused]]
+            bool visit(std::string_view key, Function&& function);
+            [[nodiscard]] [[maybe_unused]]
+            bool contains(std::string_view key) const;
+            [[maybe_unused]]
+            bool erase(std::string_view key);
+
+            [[nodiscard]] [[maybe_unused]]
+            size_t length() const;
+            [[nodiscard]] [[maybe_unused]]
+            size_t bytes() const;
+            [[nodiscard]] [[maybe_unused]]
+            CacheStats stats() const;
+            [[nodiscard]] [[maybe_unused]]
+            inline size_t shard_count() const noexcept;
+    };
+
+// Определения методов классов.
+/* =============================== CacheStats =============================== */
+
+    /// \brief Вычисляет долю поисков, нашедших ключ.
+    ///
+    /// \return Доля попаданий от 0 до 1 или 0, если поисков не было.
+    [[nodiscard]] [[maybe_unused]]
+    inline double CacheStats::hit_ratio() const noexcept {
+        const uint64_t lookups{ this->hits_ + this->misses_ };
+        return (lookups == 0) ? 0.0 : static_cast<double>(this->hits_) /
+                                      static_cast<double>(lookups);
+    }
+
+/* ================================= Entry ================================= */
+
+    /// \brief Стандартный конструктор экземпляра класса
+    /// BoundedOrderedHashTable::Entry.
+    ///
+    /// \param value Значение записи.
+    /// \param bytes Объем записи в байтах.
+    template <class T, class S, class H>
+    template <class Value>
+    BoundedOrderedHashTable<T, S, H>::Entry::Entry(Value&& value,
+                                                   const size_t& bytes) :
+            value_(std::forward<Value>(value)), bytes_(bytes),
+            referenced_(false) { }
+
+/* ========================= BoundedOrderedHashTable ========================= */
+// PRIVATE
+
+    /// \brief Вычисляет объем записи.
+    ///
+    /// \param key Ключ записи.
+    /// \param value Значение записи.
+    ///
+    /// \return Объем записи в байтах.
+    template <class T, class S, class H>
+    [[nodiscard]]
+    size_t BoundedOrderedHashTable<T, S, H>::entry_bytes(std::string_view key,
+                                                         const T& value) noexcept {
+        size_t bytes{ sizeof(Record) + key.size() };
+        if constexpr (IS_STRING_VALUE)
+            bytes += value.size();
+        return bytes;
+    }
+
+    /// \brief Проверяет, превышает ли кеш указанного наполнения свои
+    /// ограничения.
+    ///
+    /// \param length Количество записей.
+    /// \param bytes Суммарный объем записей.
+    ///
+    /// \return Булевое значение.
+    template <class T, class S, class H>
+    [[nodiscard]]
+    inline bool BoundedOrderedHashTable<T, S, H>::overflows(const size_t& length,
+                                                            const size_t& bytes)
+    const noexcept {
+        return (this->options_.max_entries_ != 0 && length > this->options_.max_entries_) ||
+               (this->options_.max_bytes_ != 0 && bytes > this->options_.max_bytes_);
+    }
+
+    /// \brief Ищет запись и отмечает обращение к ней.
+    ///
+    /// При LRU найденная запись переносится в конец порядка, при CLOCK у
+    /// нее ставится отметка обращения.
+    ///
+    /// \param key Ключ записи.
+    /// \param hash Хеш ключа.
+    ///
+    /// \return Указатель на значение записи или nullptr, если ее нет.
+    template <class T, class S, class H>
+    [[nodiscard]]
+    T* BoundedOrderedHashTable<T, S, H>::lookup(std::string_view key,
+                                                const uint64_t& hash) {
+        Record* record{ this->table_.find(key, hash) };
+        if (record == nullptr) {
+            this->misses_++;
+            return nullptr;
+        }
+        this->hits_++;
+        if (this->options_.policy_ == EvictionPolicy::CLOCK) {
+            record->value_.referenced_ = true;
+        }
+        else {
+            this->table_.reserve_order();
+            this->table_.relink_back(record);
+        }
+        return &record->value_.value_;
+    }
+
+    /// \brief Проверяет, есть ли запись, не отмечая обращения к ней.
+    ///
+    /// \param key Ключ записи.
+    /// \param hash Хеш ключа.
+    ///
+    /// \return Булевое значение.
+    template <class T, class S, class H>
+    [[nodiscard]]
+    inline bool BoundedOrderedHashTable<T, S, H>::contains(std::string_view key,
+                                                           const uint64_t& hash)
+    const noexcept {
+        return this->table_.find(key, hash) != nullptr;
+    }
+
+    /// \brief Добавляет запись или изменяет значение по существующему
+    /// ключу, вытесняя записи до соблюдения ограничений.
+    ///
+    /// Измененная запись переносится в конец порядка и вытесняется
+    /// последней. Новая запись добавляется после вытеснения, поэтому сама
+    /// не вытесняется.
+    ///
+    /// \param key Ключ записи.
+    /// \param hash Хеш ключа.
+    /// \param value Значение записи; rvalue перемещается.
+    ///
+    /// \return true, если значение помещено в кеш; false, если запись
+    /// одна превышает ограничение объема - тогда прежнее значение по
+    /// ключу удаляется.
+    template <class T, class S, class H>
+    template <class Value>
+    bool BoundedOrderedHashTable<T, S, H>::assign(std::string_view key,
+                                                  const uint64_t& hash,
+                                                  Value&& value) {
+        const size_t bytes{ entry_bytes(key, value) };
+        if (this->overflows(1, bytes)) {
+            static_cast<void>(this->remove(key, hash));
+            return false;
+        }
+
+        Record* record{ this->table_.find(key, hash) };
+        if (record != nullptr) {
+            this->table_.reserve_order();
+            this->table_.relink_back(record);
+            record->value_.value_ = std::forward<Value>(value);
+            record->value_.referenced_ = true;
+            this->bytes_ = this->bytes_ - record->value_.bytes_ + bytes;
+            record->value_.bytes_ = bytes;
+            while (this->table_.length() > 1 &&
+                   this->overflows(this->table_.length(), this->bytes_))
+                this->evict();
+            return true;
+        }
+
+        while (this->table_.length() != 0 &&
+               this->overflows(this->table_.length() + 1, this->bytes_ + bytes))
+            this->evict();
+        static_cast<void>(this->table_.append(key, hash, std::forward<Value>(value),
+                                              bytes));
+        this->bytes_ += bytes;
+        return true;
+    }
+
+    /// \brief Удаляет запись по ключу.
+    ///
+    /// \param key Ключ записи.
+    /// \param hash Хеш ключа.
+    ///
+    /// \return true, если запись была удалена.
+    template <class T, class S, class H>
+    bool BoundedOrderedHashTable<T, S, H>::remove(std::string_view key,
+                                                  const uint64_t& hash) {
+        const Record* record{ this->table_.find(key, hash) };
+        if (record == nullptr)
+            return false;
+        this->bytes_ -= record->value_.bytes_;
+        return this->table_.erase_record(key, hash);
+    }
+
+    /// \brief Вытесняет одну запись.
+    ///
+    /// Кандидат - первая запись в порядке. При CLOCK отмеченные записи
+    /// теряют отметку и переносятся в конец; каждая запись переносится не
+    /// больше одного раза, поэтому проход конечен.
+    template <class T, class S, class H>
+    void BoundedOrderedHashTable<T, S, H>::evict() {
+        Record* record{ this->table_.order_[this->table_.order_front_] };
+        if (this->options_.policy_ == EvictionPolicy::CLOCK) {
+            while (record->value_.referenced_) {
+                record->value_.referenced_ = false;
+                this->table_.reserve_order();
+                this->table_.relink_back(record);
+                record = this->table_.order_[this->table_.order_front_];
+            }
+        }
+        this->bytes_ -= record->value_.bytes_;
+        this->evictions_++;
+        // Хеш ключа хранится в записи: ключ не нужно хешировать повторно.
+        static_cast<void>(this->table_.erase_record(record->key_, record->hash_));
+    }
+
+// PUBLIC
+
+    /// \brief Стандартный конструктор экземпляра класса
+    /// BoundedOrderedHashTable.
+    ///
+    /// Если задано ограничение количества записей, таблица сразу
+    /// расширяется под него и при работе кеша не перехешируется.
+    ///
+    /// \param options Ограничения емкости и способ вытеснения.
+    ///
+    /// \throw std::invalid_argument Исключение возбуждается, если не
+    /// задано ни одно ограничение.
+    template <class T, class S, class H>
+    BoundedOrderedHashTable<T, S, H>::BoundedOrderedHashTable(
+            const CacheOptions& options) :
+            table_(), options_(options), bytes_(0), hits_(0), misses_(0),
+            evictions_(0) {
+        if (options.max_entries_ == 0 && options.max_bytes_ == 0)
+            throw std::invalid_argument("Cache requires an entry or byte limit.");
+        if (options.max_entries_ != 0)
+            this->table_.reserve(options.max_entries_);
+    }
+
+    /// \brief Метод, добавляющий элемент.
+    ///
+    /// \param key Строковый ключ элемента для вставки/изменения.
+    /// \param value Значение элемента для вставки/изменения.
+    ///
+    /// \return true, если значение помещено в кеш.
+    template <class T, class S, class H>
+    [[maybe_unused]]
+    bool BoundedOrderedHashTable<T, S, H>::insert(std::string_view key,
+                                                  const T& value) {
+        return this->assign(key, this->table_.hash_function(key), value);
+    }
+
+    /// \brief Метод, добавляющий элемент с перемещением значения.
+    ///
+    /// \param key Строковый ключ элемента для вставки/изменения.
+    /// \param value Значение элемента для вставки/изменения.
+    ///
+    /// \return true, если значение помещено в кеш.
+    template <class T, class S, class H>
+    [[maybe_unused]]
+    bool BoundedOrderedHashTable<T, S, H>::insert(std::string_view key, T&& value) {
+        return this->assign(key, this->table_.hash_function(key), std::move(value));
+    }
+
+    /// \brief Ищет значение элемента по ключу.
+    ///
+    /// Попадание отмечает обращение к элементу; оба исхода учитываются
+    /// в счетчиках.
+    ///
+    /// \param key Строковый ключ элемента.
+    ///
+    /// \return Указатель на значение или nullptr, если элемента нет.
+    /// Указатель действителен до следующего изменения кеша.
+    template <class T, class S, class H>
+    [[nodiscard]] [[maybe_unused]]
+    T* BoundedOrderedHashTable<T, S, H>::find(std::string_view key) {
+        return this->lookup(key, this->table_.hash_function(key));
+    }
+
+    /// \brief Метод, позволяющий получить значение элемента по ключу.
+    ///
+    /// В случае ненахождения элемента будет возвращено стандартное значение.
+    ///
+    /// \param key Строковый ключ, значение по которому нужно найти.
+    ///
+    /// \return Ссылку на найденное значение ключа или на стандартное
+    /// значение.
+    template <class T, class S, class H>
+    [[maybe_unused]]
+    const T& BoundedOrderedHashTable<T, S, H>::get(std::string_view key) {
+        // Дефолтное значение.
+        static const T DEFAULT_VALUE{};
+
+        const T* value{ this->find(key) };
+        return (value != nullptr) ? *value : DEFAULT_VALUE;
+    }
+
+    /// \brief Перегрузка оператора [] для получения доступа к элементам
+    /// кеша.
+    ///
+    /// \param key Строковый ключ элемента для доступа.
+    ///
+    /// \return Ссылка на значение указанного типа.
+    ///
+    /// \throw DataStructures::OrderedHashTable::KeyException Возбуждается,
+    /// если элемент с указанным ключом не найден.
+    template <class T, class S, class H>
+    T& BoundedOrderedHashTable<T, S, H>::operator [] (std::string_view key) {
+        T* value{ this->find(key) };
+        if (value != nullptr)
+            return *value;
+        // Промах: исключение возбуждает сама таблица.
+        return this->table_[key].value_;
+    }
+
+    /// \brief Проверяет, есть ли в кеше элемент с указанным ключом.
+    ///
+    /// Проверка не считается обращением к элементу и не учитывается в
+    /// счетчиках.
+    ///
+    /// \param key Строковый ключ элемента.
+    ///
+    /// \return Булевое значение.
+    template <class T, class S, class H>
+    [[nodiscard]] [[maybe_unused]]
+    bool BoundedOrderedHashTable<T, S, H>::contains(std::string_view key) const {
+        return this->contains(key, this->table_.hash_function(key));
+    }
+
+    /// \brief Метод, стирающий из кеша элемент с указанным ключом.
+    ///
+    /// \param key Строковый ключ элемента, который требуется удалить.
+    ///
+    /// \return true, если элемент был удален.
+    template <class T, class S, class H>
+    [[maybe_unused]]
+    bool BoundedOrderedHashTable<T, S, H>::erase(std::string_view key) {
+        return this->remove(key, this->table_.hash_function(key));
+    }
+
+    /// \brief Предоставляет доступ к количеству элементов кеша.
+    ///
+    /// \return Значение кол-ва элементов.
+    template <class T, class S, class H>
+    [[nodiscard]] [[maybe_unused]]
+    inline size_t BoundedOrderedHashTable<T, S, H>::length() const noexcept {
+        return this->table_.length();
+    }
+
+    /// \brief Предоставляет доступ к суммарному объему элементов кеша.
+    ///
+    /// \return Объем в байтах.
+    template <class T, class S, class H>
+    [[nodiscard]] [[maybe_unused]]
+    inline size_t BoundedOrderedHashTable<T, S, H>::bytes() const noexcept {
+        return this->bytes_;
+    }
+
+    /// \brief Предоставляет доступ к ограничениям кеша.
+    ///
+    /// \return Ссылку на ограничения емкости и способ вытеснения.
+    template <class T, class S, class H>
+    [[nodiscard]] [[maybe_unused]]
+    inline const CacheOptions& BoundedOrderedHashTable<T, S, H>::options()
+    const noexcept {
+        return this->options_;
+    }
+
+    /// \brief Собирает снимок счетчиков кеша.
+    ///
+    /// \return Счетчики попаданий, промахов и вытеснений и наполнение кеша.
+    template <class T, class S, class H>
+    [[nodiscard]] [[maybe_unused]]
+    CacheStats BoundedOrderedHashTable<T, S, H>::stats() const noexcept {
+        return { this->hits_, this->misses_, this->evictions_,
+                 this->table_.length(), this->bytes_ };
+    }
+
+    /// \brief Обнуляет счетчики попаданий, промахов и вытеснений.
+    template <class T, class S, class H>
+    [[maybe_unused]]
+    void BoundedOrderedHashTable<T, S, H>::reset_stats() noexcept {
+        this->hits_ = this->misses_ = this->evictions_ = 0;
+    }
+
+/* ================================= Shard ================================= */
+
+    /// \brief Стандартный конструктор экземпляра класса
+    /// ConcurrentBoundedOrderedHashTable::Shard.
+    ///
+    /// \param options Ограничения емкости сегмента.
+    template <class T, class S, class H>
+    ConcurrentBoundedOrderedHashTable<T, S, H>::Shard::Shard(
+            const CacheOptions& options) : mutex_(), cache_(options) { }
+
+/* ==================== ConcurrentBoundedOrderedHashTable ==================== */
+// PRIVATE
+
+    /// \brief Определяет сегмент, которому принадлежит хеш.
+    ///
+    /// Сегмент выбирается по средним битам хеша, как в
+    /// ConcurrentOrderedHashTable.
+    ///
+    /// \param hash Хеш ключа.
+    ///
+    /// \return Ссылку на сегмент.
+    template <class T, class S, class H>
+    [[nodiscard]]
+    inline ConcurrentBoundedOrderedHashTable<T, S, H>::Shard&
+    ConcurrentBoundedOrderedHashTable<T, S, H>::shard_of(const uint64_t& hash)
+    const noexcept {
+        return this->shards_[bucket_index(std::rotl(hash, 32),
+                                          this->shard_count_)];
+    }
+
+    /// \brief Делит ограничения кеша между сегментами.
+    ///
+    /// Доли округляются вверх, чтобы каждый сегмент мог хранить хотя бы
+    /// одну запись.
+    ///
+    /// \param options Ограничения всего кеша.
+    /// \param shard_count Количество сегментов.
+    ///
+    /// \return Ограничения одного сегмента.
+    template <class T, class S, class H>
+    [[nodiscard]]
+    CacheOptions ConcurrentBoundedOrderedHashTable<T, S, H>::shard_options(
+            const CacheOptions& options, const size_t& shard_count) {
+        CacheOptions result{ options };
+        result.max_entries_ = (options.max_entries_ + shard_count - 1) / shard_count;
+        result.max_bytes_ = (options.max_bytes_ + shard_count - 1) / shard_count;
+        return result;
+    }
+
+    /// \brief Добавляет элемент или изменяет значение по существующему
+    /// ключу.
+    ///
+    /// \param key Строковый ключ элемента.
+    /// \param value Значение элемента; rvalue перемещается.
+    ///
+    /// \return true, если значение помещено в кеш.
+    template <class T, class S, class H>
+    template <class Value>
+    bool ConcurrentBoundedOrderedHashTable<T, S, H>::assign(std::string_view key,
+                                                            Value&& value) {
+        uint64_t hash{ this->hasher_(key) };
+        Shard& shard{ this->shard_of(hash) };
+        std::lock_guard lock{ shard.mutex_ };
+        return shard.cache_.assign(key, hash, std::forward<Value>(value));
+    }
+
+// PUBLIC
+
+    /// \brief Стандартный конструктор экземпляра класса
+    /// ConcurrentBoundedOrderedHashTable.
+    ///
+    /// \param options Ограничения емкости всего кеша и способ вытеснения.
+    /// \param shard_count Количество сегментов, не меньшее 1.
+    ///
+    /// \throw std::invalid_argument Исключение возбуждается, если не
+    /// задано ни одно ограничение.
+    template <class T, class S, class H>
+    ConcurrentBoundedOrderedHashTable<T, S, H>::ConcurrentBoundedOrderedHashTable(
+            const CacheOptions& options, const size_t& shard_count) :
+            shard_count_((shard_count == 0) ? 1 : shard_count),
+            shards_(nullptr), hasher_() {
+        if (options.max_entries_ == 0 && options.max_bytes_ == 0)
+            throw std::invalid_argument("Cache requires an entry or byte limit.");
+        const CacheOptions per_shard{ shard_options(options, this->shard_count_) };
+        // Сегменты конструируются с аргументом, поэтому память выделяется
+        // отдельно от их создания.
+        this->shards_ = static_cast<Shard*>(::operator new[](
+                this->shard_count_ * sizeof(Shard), std::align_val_t{ alignof(Shard) }));
+        size_t created{};
+        try {
+            for (; created < this->shard_count_; created++)
+                new (this->shards_ + created) Shard(per_shard);
+        }
+        catch (...) {
+            while (created != 0)
+                this->shards_[--created].~Shard();
+            ::operator delete[](this->shards_, std::align_val_t{ alignof(Shard) });
+            throw;
+        }
+    }
+
+    // Стандартный деструктор экземпляра.
+    template <class T, class S, class H>
+    ConcurrentBoundedOrderedHashTable<T, S, H>::~ConcurrentBoundedOrderedHashTable() {
+        for (size_t item{}; item < this->shard_count_; item++)
+            this->shards_[item].~Shard();
+        ::operator delete[](this->shards_, std::align_val_t{ alignof(Shard) });
+    }
+
+    /// \brief Метод, добавляющий элемент.
+    ///
+    /// \param key Строковый ключ элемента для вставки/изменения.
+    /// \param value Значение элемента для вставки/изменения.
+    ///
+    /// \return true, если значение помещено в кеш.
+    template <class T, class S, class H>
+    [[maybe_unused]]
+    bool ConcurrentBoundedOrderedHashTable<T, S, H>::insert(std::string_view key,
+                                                            const T& value) {
+        return this->assign(key, value);
+    }
+
+    /// \brief Метод, добавляющий элемент с перемещением значения.
+    ///
+    /// \param key Строковый ключ элемента для вставки/изменения.
+    /// \param value Значение элемента для вставки/изменения.
+    ///
+    /// \return true, если значение помещено в кеш.
+    template <class T, class S, class H>
+    [[maybe_unused]]
+    bool ConcurrentBoundedOrderedHashTable<T, S, H>::insert(std::string_view key,
+                                                            T&& value) {
+        return this->assign(key, std::move(value));
+    }
+
+    /// \brief Метод, позволяющий получить копию значения элемента по ключу.
+    ///
+    /// Ссылку вернуть нельзя: после снятия блокировки значение может
+    /// изменить или вытеснить другой поток. В случае ненахождения элемента
+    /// будет возвращено стандартное значение.
+    ///
+    /// \param key Строковый ключ, значение по которому нужно найти.
+    ///
+    /// \return Найденное значение ключа или стандартное значение.
+    template <class T, class S, class H>
+    [[nodiscard]] [[maybe_unused]]
+    T ConcurrentBoundedOrderedHashTable<T, S, H>::get(std::string_view key) {
+        uint64_t hash{ this->hasher_(key) };
+        Shard& shard{ this->shard_of(hash) };
+        std::lock_guard lock{ shard.mutex_ };
+
+        const T* value{ shard.cache_.lookup(key, hash) };
+        if (value != nullptr)
+            return *value;
+        return T{};
+    }
+
+    /// \brief Передает значение элемента функции без копирования.
+    ///
+    /// Функция вызывается под блокировкой сегмента и не должна обращаться
+    /// к этому же кешу.
+    ///
+    /// \param key Строковый ключ элемента.
+    /// \param function Функция, принимающая HashType&.
+    ///
+    /// \return true, если элемент найден и функция вызвана.
+    template <class T, class S, class H>
+    template <class Function>
+    [[maybe_unused]]
+    bool ConcurrentBoundedOrderedHashTable<T, S, H>::visit(std::string_view key,
+                                                           Function&& function) {
+        uint64_t hash{ this->hasher_(key) };
+        Shard& shard{ this->shard_of(hash) };
+        std::lock_guard lock{ shard.mutex_ };
+
+        T* value{ shard.cache_.lookup(key, hash) };
+        if (value == nullptr)
+            return false;
+        std::forward<Function>(function)(*value);
+        return true;
+    }
+
+    /// \brief Проверяет, есть ли в кеше элемент с указанным ключом.
+    ///
+    /// \param key Строковый ключ элемента.
+    ///
+    /// \return Булевое значение.
+    template <class T, class S, class H>
+    [[nodiscard]] [[maybe_unused]]
+    bool ConcurrentBoundedOrderedHashTable<T, S, H>::contains(std::string_view key)
+    const {
+        uint64_t hash{ this->hasher_(key) };
+        Shard& shard{ this->shard_of(hash) };
+        std::lock_guard lock{ shard.mutex_ };
+        return shard.cache_.contains(key, hash);
+    }
+
+    /// \brief Метод, стирающий из кеша элемент с указанным ключом.
+    ///
+    /// \param key Строковый ключ элемента, который требуется удалить.
+    ///
+    /// \return true, если элемент был удален.
+    template <class T, class S, class H>
+    [[maybe_unused]]
+    bool ConcurrentBoundedOrderedHashTable<T, S, H>::erase(std::string_view key) {
+        uint64_t hash{ this->hasher_(key) };
+        Shard& shard{ this->shard_of(hash) };
+        std::lock_guard lock{ shard.mutex_ };
+        return shard.cache_.remove(key, hash);
+    }
+
+    /// \brief Предоставляет доступ к количеству элементов кеша.
+    ///
+    /// Сегменты опрашиваются по очереди, поэтому при одновременных
+    /// изменениях результат приблизителен.
+    ///
+    /// \return Значение кол-ва элементов.
+    template <class T, class S, class H>
+    [[nodiscard]] [[maybe_unused]]
+    size_t ConcurrentBoundedOrderedHashTable<T, S, H>::length() const {
+        return this->stats().length_;
+    }
+
+    /// \brief Предоставляет доступ к суммарному объему элементов кеша.
+    ///
+    /// \return Объем в байтах, приблизительный при одновременных
+    /// изменениях.
+    template <class T, class S, class H>
+    [[nodiscard]] [[maybe_unused]]
+    size_t ConcurrentBoundedOrderedHashTable<T, S, H>::bytes() const {
+        return this->stats().bytes_;
+    }
+
+    /// \brief Собирает счетчики всех сегментов.
+    ///
+    /// \return Сумму счетчиков и наполнения сегментов.
+    template <class T, class S, class H>
+    [[nodiscard]] [[maybe_unused]]
+    CacheStats ConcurrentBoundedOrderedHashTable<T, S, H>::stats() const {
+        CacheStats result;
+        for (size_t item{}; item < this->shard_count_; item++) {
+            std::lock_guard lock{ this->shards_[item].mutex_ };
+            const CacheStats shard{ this->shards_[item].cache_.stats() };
+            result.hits_ += shard.hits_;
+            result.misses_ += shard.misses_;
+            result.evictions_ += shard.evictions_;
+            result.length_ += shard.length_;
+            result.bytes_ += shard.bytes_;
+        }
+        return result;
+    }
+
+    /// \brief Предоставляет доступ к количеству сегментов.
+    ///
+    /// \return Значение кол-ва сегментов.
+    template <class T, class S, class H>
+    [[nodiscard]] [[maybe_unused]]
+    inline size_t ConcurrentBoundedOrderedHashTable<T, S, H>::shard_count()
+    const noexcept {
+        return this->shard_count_;
+    }
+}
+
+#endif //CPPPROJECT_BOUNDEDHASHTABLE_H
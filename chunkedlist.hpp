@@ -0,0 +1,877 @@
+/// \file chunkedlist.hpp.
+/// \author Лошкарев Дмитрий.
+/// \date 14.10.2026.
+///
+/// \brief Содержит реализацию развернутого двусвязного списка, хранящего
+/// несколько элементов в одном узле.
+///
+/// \namespaces
+/// • DataStructures
+/// \classes
+/// • ChunkedList
+
+#ifndef CPPPROJECT_CHUNKEDLIST_H
+#define CPPPROJECT_CHUNKEDLIST_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+#include "memorypool.hpp"
+
+namespace DataStructures {
+// Объявление классов.
+
+    /// \class Класс ChunkedList предоставляет развернутый двусвязный список:
+    /// каждый узел (блок) хранит до CHUNK_CAPACITY элементов подряд.
+    ///
+    /// Интерфейс совпадает с List, поэтому ChunkedList можно использовать
+    /// вместо него, например, как ячейку ChainedStorage. Перебор элементов
+    /// блока не требует перехода по указателям, а указатели на соседей
+    /// хранятся один раз на блок, а не на каждый элемент. Вставка в
+    /// середину и удаление сдвигают элементы только внутри блока; полный
+    /// блок при вставке делится пополам, опустевший - освобождается.
+    ///
+    /// Публичные методы:
+    /// \n • NodeType pop_front();
+    /// \n • NodeType pop_back();
+    /// \n • void erase(const size_t&);
+    /// \n • Iterator erase(Iterator position);
+    /// \n • void splice_back(ChunkedList& source);
+    /// \n • size_t length() const noexcept;
+    /// \n • size_t memory_usage() const noexcept;
+    /// \n • Iterator begin() const
+    /// \n • Iterator end() const noexcept
+    /// \n • Iterator rbegin() const
+    /// \n • Iterator rend() const noexcept
+    /// \n • NodeType& operator [] (const size_t& index);
+    /// \n • void push_front(const NodeType& data)
+    /// \n • void push_front(NodeType&& data)
+    /// \n • void push_back(const NodeType& data)
+    /// \n • void push_back(NodeType&& data)
+    /// \n • NodeType& emplace_front(Args&&... args)
+    /// \n • NodeType& emplace_back(Args&&... args)
+    /// \n • void insert(const size_t& index, const NodeType& value)
+    /// \n • void insert(const size_t& index, NodeType&& value)
+    /// \n • Iterator insert(Iterator position, const NodeType& value)
+    /// \n • Iterator insert(Iterator position, NodeType&& value)
+    ///
+    /// \tparam NodeType Тип элементов списка. Должен допускать перемещение
+    /// конструктором и присваиванием.
+    /// \tparam Allocator Аллокатор блоков списка. По умолчанию блоки
+    /// берутся из пула PoolAllocator; подходит и std::pmr::polymorphic_allocator.
+    template <class NodeType, class Allocator = PoolAllocator<NodeType>>
+    class ChunkedList {
+        public:
+            static inline constexpr size_t CHUNK_BYTES{ 128 };  ///< \brief Желаемый размер блока.
+            static inline constexpr size_t CHUNK_CAPACITY{ std::max<size_t>(
+                    4, (CHUNK_BYTES - 2 * sizeof(void*) - sizeof(uint32_t)) /
+                       sizeof(NodeType)) };                       ///< \brief Количество элементов
+                                                                  ///< в одном блоке.
+        private:
+            /// \class Класс Chunk описывает блок развернутого списка.
+            /// Элементы занимают первые count_ мест хранилища блока.
+            class Chunk {
+                private:
+                    Chunk* next_;     ///< \brief Указатель на след. блок списка.
+                    Chunk* prev_;     ///< \brief Указатель на пред. блок списка.
+                    uint32_t count_;  ///< \brief Количество элементов в блоке.
+                    alignas(NodeType) std::byte storage_[sizeof(NodeType) * CHUNK_CAPACITY];
+                public:
+                    explicit Chunk() noexcept;
+                    Chunk(const Chunk&) = delete;
+                    Chunk& operator = (const Chunk&) = delete;
+                    ~Chunk();
+
+                    [[nodiscard]]
+                    inline NodeType* values() noexcept;
+                    [[nodiscard]]
+                    inline const NodeType* values() const noexcept;
+
+                friend class ChunkedList;
+            };
+
+            using ChunkAllocator = typename std::allocator_traits<Allocator>::
+                    template rebind_alloc<Chunk>;
+            using ChunkTraits = std::allocator_traits<ChunkAllocator>;
+
+            size_t length_;
+            Chunk *head_, *tail_;
+            [[no_unique_address]] ChunkAllocator allocator_;
+
+            [[nodiscard]]
+            Chunk* create_chunk();
+            void destroy_chunk(Chunk*) noexcept;
+            void link_after(Chunk*, Chunk*) noexcept;
+            void unlink(Chunk*) noexcept;
+            [[nodiscard]]
+            std::pair<Chunk*, size_t> locate(const size_t&) const;
+            template <class Value>
+            std::pair<Chunk*, size_t> insert_into(Chunk*, const size_t&, Value&&);
+            void remove_from(Chunk*, const size_t&) noexcept;
+            void clear() noexcept;
+        public:
+            using allocator_type = Allocator;
+
+            /// \class класс Iterator предоставляет объект-итератор по
+            /// элементам списка: пару из блока и позиции внутри него.
+            ///
+            /// Публичные методы:
+            /// \n • Iterator& operator ++ () noexcept
+            /// \n • Iterator operator ++ (int) noexcept
+            /// \n • Iterator& operator -- () noexcept
+            /// \n • Iterator operator -- (int) noexcept
+            /// \n • bool operator != (const Iterator& iterator) noexcept
+            /// \n • const NodeType& operator * () const noexcept
+            class Iterator {
+                private:
+                    const Chunk* current_chunk;
+                    size_t position;
+                public:
+                    explicit Iterator(const Chunk*, const size_t&) noexcept;
+
+                    Iterator& operator ++ () noexcept;
+                    Iterator operator ++ (int) noexcept;
+                    Iterator& operator -- () noexcept;
+                    Iterator operator -- (int) noexcept;
+                    bool operator != (const Iterator&) noexcept;
+                    const NodeType& operator * () const noexcept;
+
+                friend class ChunkedList;
+            };
+
+            explicit ChunkedList(const Allocator& = Allocator());
+            ChunkedList(const ChunkedList&);
+            ChunkedList(ChunkedList&&) noexcept;
+            ChunkedList& operator = (const ChunkedList&);
+            ChunkedList& operator = (ChunkedList&&);
+            ~ChunkedList();
+
+            NodeType pop_front();
+            NodeType pop_back();
+            void erase(const size_t&);
+            Iterator erase(Iterator);
+
+            void push_front(const NodeType&);
+            void push_front(NodeType&&);
+            void push_back(const NodeType&);
+            void push_back(NodeType&&);
+            template <class... Args>
+            NodeType& emplace_front(Args&&...);
+            template <class... Args>
+            NodeType& emplace_back(Args&&...);
+            void splice_back(ChunkedList&);
+            [[maybe_unused]]
+            void insert(const size_t&, const NodeType&);
+            [[maybe_unused]]
+            void insert(const size_t&, NodeType&&);
+            [[maybe_unused]]
+            Iterator insert(Iterator, const NodeType&);
+            [[maybe_unused]]
+            Iterator insert(Iterator, NodeType&&);
+
+            NodeType& operator [] (const size_t&);
+
+            [[maybe_unused]] [[nodiscard]]
+            inline size_t length() const noexcept;
+            [[nodiscard]] [[maybe_unused]]
+            inline size_t memory_usage() const noexcept;
+            inline Iterator begin() const;
+            inline Iterator end() const noexcept;
+            [[maybe_unused]]
+            inline Iterator rbegin() const;
+            [[maybe_unused]]
+            inline Iterator rend() const noexcept;
+    };
+
+// Определения методов классов.
+/* ================================ Iterator ================================ */
+
+    /// \brief Стандартный конструктор экземпляра класса ChunkedList::Iterator.
+    ///
+    /// \param chunk Указатель на блок или nullptr для конца списка.
+    /// \param position Позиция элемента внутри блока.
+    template <class T, class A>
+    ChunkedList<T, A>::Iterator::Iterator(const Chunk* chunk,
+                                          const size_t& position) noexcept :
+            current_chunk(chunk), position(position) { }
+
+    /// \brief Перемещает итератор на след. элемент списка.
+    ///
+    /// \return Объект-итератор.
+    template <class T, class A>
+    ChunkedList<T, A>::Iterator& ChunkedList<T, A>::Iterator::operator ++ () noexcept {
+        if (this->current_chunk == nullptr)
+            return *this;
+        if (++this->position == this->current_chunk->count_) {
+            this->current_chunk = this->current_chunk->next_;
+            this->position = 0;
+        }
+        return *this;
+    }
+
+    /// \brief Перемещает итератор на след. элемент списка.
+    ///
+    /// \return Объект-итератор.
+    template <class T, class A>
+    ChunkedList<T, A>::Iterator ChunkedList<T, A>::Iterator::operator ++ (int) noexcept {
+        Iterator iterator = *this;
+        ++*this;
+        return iterator;
+    }
+
+    /// \brief Перемещает итератор на пред. элемент списка.
+    ///
+    /// \return Объект-итератор.
+    template <class T, class A>
+    ChunkedList<T, A>::Iterator& ChunkedList<T, A>::Iterator::operator -- () noexcept {
+        if (this->current_chunk == nullptr)
+            return *this;
+        if (this->position == 0) {
+            this->current_chunk = this->current_chunk->prev_;
+            this->position = (this->current_chunk != nullptr) ?
+                             this->current_chunk->count_ - 1 : 0;
+        }
+        else
+            this->position--;
+        return *this;
+    }
+
+    /// \brief Перемещает итератор на пред. элемент списка.
+    ///
+    /// \return Объект-итератор.
+    template <class T, class A>
+    ChunkedList<T, A>::Iterator ChunkedList<T, A>::Iterator::operator -- (int) noexcept {
+        Iterator iterator = *this;
+        --*this;
+        return iterator;
+    }
+
+    /// \brief Проверяет, что два объекта итератора не равны.
+    ///
+    /// \param iterator Объект-итератор для сравнения.
+    ///
+    /// \return Булевое значение.
+    template <class T, class A>
+    bool ChunkedList<T, A>::Iterator::operator != (const Iterator& iterator) noexcept {
+        return this->current_chunk != iterator.current_chunk ||
+               this->position != iterator.position;
+    }
+
+    /// \brief Позволяет получить значение элемента.
+    ///
+    /// \return Ссылку на значение элемента списка.
+    template <class T, class A>
+    const T& ChunkedList<T, A>::Iterator::operator * () const noexcept {
+        return this->current_chunk->values()[this->position];
+    }
+
+/* ================================= Chunk ================================= */
+
+    /// \brief Стандартный конструктор экземпляра класса ChunkedList::Chunk.
+    template <class T, class A>
+    ChunkedList<T, A>::Chunk::Chunk() noexcept :
+            next_(nullptr), prev_(nullptr), count_(0) { }
+
+    // Стандартный деструктор экземпляра. Разрушает элементы блока.
+    template <class T, class A>
+    ChunkedList<T, A>::Chunk::~Chunk() {
+        std::destroy_n(this->values(), this->count_);
+    }
+
+    /// \brief Предоставляет доступ к элементам блока.
+    ///
+    /// \return Указатель на первый элемент блока.
+    template <class T, class A>
+    [[nodiscard]]
+    inline T* ChunkedList<T, A>::Chunk::values() noexcept {
+        return std::launder(reinterpret_cast<T*>(this->storage_));
+    }
+
+    /// \brief Предоставляет доступ к элементам блока.
+    ///
+    /// \return Указатель на первый элемент блока.
+    template <class T, class A>
+    [[nodiscard]]
+    inline const T* ChunkedList<T, A>::Chunk::values() const noexcept {
+        return std::launder(reinterpret_cast<const T*>(this->storage_));
+    }
+
+/* ============================== ChunkedList ============================== */
+// PRIVATE
+
+    /// \brief Создает пустой блок в памяти аллокатора.
+    ///
+    /// \return Указатель на новый блок.
+    template <class T, class A>
+    [[nodiscard]]
+    ChunkedList<T, A>::Chunk* ChunkedList<T, A>::create_chunk() {
+        Chunk* chunk{ ChunkTraits::allocate(this->allocator_, 1) };
+        std::construct_at(chunk);
+        return chunk;
+    }
+
+    /// \brief Разрушает блок вместе с элементами и возвращает его память
+    /// аллокатору.
+    ///
+    /// \param chunk Указатель на блок.
+    template <class T, class A>
+    void ChunkedList<T, A>::destroy_chunk(Chunk* chunk) noexcept {
+        std::destroy_at(chunk);
+        ChunkTraits::deallocate(this->allocator_, chunk, 1);
+    }
+
+    /// \brief Вставляет блок в список после указанного.
+    ///
+    /// \param chunk Указатель на вставляемый блок.
+    /// \param prev Блок, после которого вставляется новый, или nullptr для
+    /// вставки в начало.
+    template <class T, class A>
+    void ChunkedList<T, A>::link_after(Chunk* chunk, Chunk* prev) noexcept {
+        chunk->prev_ = prev;
+        chunk->next_ = (prev != nullptr) ? prev->next_ : this->head_;
+        if (chunk->next_ != nullptr)
+            chunk->next_->prev_ = chunk;
+        else
+            this->tail_ = chunk;
+        if (prev != nullptr)
+            prev->next_ = chunk;
+        else
+            this->head_ = chunk;
+    }
+
+    /// \brief Исключает блок из списка.
+    ///
+    /// \param chunk Указатель на исключаемый блок.
+    template <class T, class A>
+    void ChunkedList<T, A>::unlink(Chunk* chunk) noexcept {
+        if (chunk->prev_ != nullptr)
+            chunk->prev_->next_ = chunk->next_;
+        else
+            this->head_ = chunk->next_;
+        if (chunk->next_ != nullptr)
+            chunk->next_->prev_ = chunk->prev_;
+        else
+            this->tail_ = chunk->prev_;
+    }
+
+    /// \brief Находит блок и позицию элемента по индексу.
+    ///
+    /// Блоки перебираются с ближайшего к индексу конца списка.
+    ///
+    /// \param index Индекс элемента.
+    ///
+    /// \return Пару из блока и позиции элемента внутри него.
+    ///
+    /// \throw std::out_of_range Исключение возбуждается, если индекс
+    /// выходит за границы списка.
+    template <class T, class A>
+    [[nodiscard]]
+    std::pair<typename ChunkedList<T, A>::Chunk*, size_t>
+    ChunkedList<T, A>::locate(const size_t& index) const {
+        if (index >= this->length_)
+            throw std::out_of_range("List index is out of range.");
+
+        if (index < (this->length_ / 2)) {
+            size_t position{ index };
+            Chunk* chunk{ this->head_ };
+            while (position >= chunk->count_) {
+                position -= chunk->count_;
+                chunk = chunk->next_;
+            }
+            return { chunk, position };
+        }
+        size_t position{ this->length_ - 1 - index };
+        Chunk* chunk{ this->tail_ };
+        while (position >= chunk->count_) {
+            position -= chunk->count_;
+            chunk = chunk->prev_;
+        }
+        return { chunk, chunk->count_ - 1 - position };
+    }
+
+    /// \brief Вставляет элемент в блок на указанную позицию.
+    ///
+    /// Полный блок предварительно делится пополам.
+    ///
+    /// \param chunk Указатель на блок.
+    /// \param position Позиция в пределах [0, count_].
+    /// \param value Вставляемое значение.
+    ///
+    /// \return Пару из блока и позиции вставленного значения.
+    template <class T, class A>
+    template <class Value>
+    std::pair<typename ChunkedList<T, A>::Chunk*, size_t>
+    ChunkedList<T, A>::insert_into(Chunk* chunk, const size_t& position,
+                                      Value&& value) {
+        // Значение создается до сдвига, чтобы исключение конструктора не
+        // оставило в блоке пустого места.
+        T new_value(std::forward<Value>(value));
+        size_t target{ position };
+
+        if (chunk->count_ == CHUNK_CAPACITY) {
+            Chunk* new_chunk{ this->create_chunk() };
+            this->link_after(new_chunk, chunk);
+            size_t half{ CHUNK_CAPACITY / 2 };
+            std::uninitialized_move(chunk->values() + half,
+                                    chunk->values() + CHUNK_CAPACITY,
+                                    new_chunk->values());
+            std::destroy(chunk->values() + half, chunk->values() + CHUNK_CAPACITY);
+            new_chunk->count_ = static_cast<uint32_t>(CHUNK_CAPACITY - half);
+            chunk->count_ = static_cast<uint32_t>(half);
+            if (target > half) {
+                chunk = new_chunk;
+                target -= half;
+            }
+        }
+
+        T* values{ chunk->values() };
+        if (target == chunk->count_)
+            std::construct_at(values + target, std::move(new_value));
+        else {
+            std::construct_at(values + chunk->count_,
+                              std::move(values[chunk->count_ - 1]));
+            std::move_backward(values + target, values + chunk->count_ - 1,
+                               values + chunk->count_);
+            values[target] = std::move(new_value);
+        }
+        chunk->count_++;
+        this->length_++;
+        return { chunk, target };
+    }
+
+    /// \brief Удаляет элемент блока, сдвигая следующие за ним.
+    ///
+    /// Опустевший блок освобождается.
+    ///
+    /// \param chunk Указатель на блок.
+    /// \param position Позиция удаляемого элемента.
+    template <class T, class A>
+    void ChunkedList<T, A>::remove_from(Chunk* chunk,
+                                        const size_t& position) noexcept {
+        T* values{ chunk->values() };
+        std::move(values + position + 1, values + chunk->count_,
+                  values + position);
+        std::destroy_at(values + chunk->count_ - 1);
+        chunk->count_--;
+        this->length_--;
+        if (chunk->count_ == 0) {
+            this->unlink(chunk);
+            this->destroy_chunk(chunk);
+        }
+    }
+
+    // Удаляет все блоки списка.
+    template <class T, class A>
+    void ChunkedList<T, A>::clear() noexcept {
+        Chunk* chunk{ this->head_ };
+        while (chunk != nullptr) {
+            Chunk* next_chunk{ chunk->next_ };
+            this->destroy_chunk(chunk);
+            chunk = next_chunk;
+        }
+        this->head_ = this->tail_ = nullptr;
+        this->length_ = 0;
+    }
+
+// PUBLIC
+
+    /// \brief Стандартный конструктор экземпляра класса ChunkedList.
+    ///
+    /// \param allocator Аллокатор, из которого берутся блоки.
+    template <class T, class A>
+    ChunkedList<T, A>::ChunkedList(const A& allocator) :
+            length_(0ULL), head_(nullptr), tail_(nullptr),
+            allocator_(allocator) { }
+
+    /// \brief Конструктор копирования экземпляра класса ChunkedList.
+    ///
+    /// \param other Копируемый список.
+    template <class T, class A>
+    ChunkedList<T, A>::ChunkedList(const ChunkedList& other) :
+            length_(0ULL), head_(nullptr), tail_(nullptr),
+            allocator_(ChunkTraits::select_on_container_copy_construction(
+                    other.allocator_)) {
+        for (auto it{ other.begin() }; it != other.end(); ++it)
+            this->push_back(*it);
+    }
+
+    /// \brief Конструктор перемещения экземпляра класса ChunkedList.
+    ///
+    /// Блоки забираются целиком, исходный список остается пустым.
+    ///
+    /// \param other Перемещаемый список.
+    template <class T, class A>
+    ChunkedList<T, A>::ChunkedList(ChunkedList&& other) noexcept :
+            length_(std::exchange(other.length_, 0ULL)),
+            head_(std::exchange(other.head_, nullptr)),
+            tail_(std::exchange(other.tail_, nullptr)),
+            allocator_(other.allocator_) { }
+
+    /// \brief Оператор присваивания копированием.
+    ///
+    /// \param other Копируемый список.
+    ///
+    /// \return Ссылку на текущий экземпляр.
+    template <class T, class A>
+    ChunkedList<T, A>& ChunkedList<T, A>::operator = (const ChunkedList& other) {
+        if (this == &other)
+            return *this;
+
+        this->clear();
+        if constexpr (ChunkTraits::propagate_on_container_copy_assignment::value)
+            this->allocator_ = other.allocator_;
+        for (auto it{ other.begin() }; it != other.end(); ++it)
+            this->push_back(*it);
+        return *this;
+    }
+
+    /// \brief Оператор присваивания перемещением.
+    ///
+    /// Если аллокаторы списков совместимы, блоки забираются целиком. Иначе
+    /// значения перемещаются в блоки из аллокатора текущего списка.
+    ///
+    /// \param other Перемещаемый список.
+    ///
+    /// \return Ссылку на текущий экземпляр.
+    template <class T, class A>
+    ChunkedList<T, A>& ChunkedList<T, A>::operator = (ChunkedList&& other) {
+        if (this == &other)
+            return *this;
+
+        this->clear();
+        if constexpr (!ChunkTraits::propagate_on_container_move_assignment::value) {
+            if (!(this->allocator_ == other.allocator_)) {
+                for (Chunk* chunk{ other.head_ }; chunk != nullptr;
+                        chunk = chunk->next_) {
+                    for (size_t item{}; item < chunk->count_; item++)
+                        this->push_back(std::move(chunk->values()[item]));
+                }
+                other.clear();
+                return *this;
+            }
+        }
+        else
+            this->allocator_ = other.allocator_;
+
+        this->length_ = std::exchange(other.length_, 0ULL);
+        this->head_ = std::exchange(other.head_, nullptr);
+        this->tail_ = std::exchange(other.tail_, nullptr);
+        return *this;
+    }
+
+    // Стандартный деструктор экземпляра.
+    template <class T, class A>
+    ChunkedList<T, A>::~ChunkedList() {
+        this->clear();
+    }
+
+    /// \brief Извлекает элемент из начала списка и возвращает его значение.
+    ///
+    /// \return Значение первого элемента списка.
+    template <class T, class A>
+    T ChunkedList<T, A>::pop_front() {
+        if (this->head_ == nullptr)
+            return T{};
+        T popped_value{ std::move(this->head_->values()[0]) };
+        this->remove_from(this->head_, 0);
+        return popped_value;
+    }
+
+    /// \brief Извлекает элемент из конца списка и возвращает его значение.
+    ///
+    /// \return Значение последнего элемента списка.
+    template <class T, class A>
+    T ChunkedList<T, A>::pop_back() {
+        if (this->tail_ == nullptr)
+            return T{};
+        size_t last{ this->tail_->count_ - 1U };
+        T popped_value{ std::move(this->tail_->values()[last]) };
+        this->remove_from(this->tail_, last);
+        return popped_value;
+    }
+
+    /// \brief Удаляет произвольный элемент списка.
+    ///
+    /// \param index Индекс элемента.
+    template <class T, class A>
+    void ChunkedList<T, A>::erase(const size_t& index) {
+        auto [chunk, position]{ this->locate(index) };
+        this->remove_from(chunk, position);
+    }
+
+    /// \brief Удаляет элемент, на который указывает итератор.
+    ///
+    /// Сдвигаются только элементы того же блока.
+    ///
+    /// \param position Итератор на удаляемый элемент списка.
+    ///
+    /// \return Итератор на следующий за удаленным элемент.
+    template <class T, class A>
+    ChunkedList<T, A>::Iterator ChunkedList<T, A>::erase(Iterator position) {
+        auto* chunk{ const_cast<Chunk*>(position.current_chunk) };
+        if (chunk == nullptr)
+            return this->end();
+
+        Chunk* next_chunk{ chunk->next_ };
+        bool last{ position.position + 1 == chunk->count_ };
+        this->remove_from(chunk, position.position);
+        if (last)
+            return Iterator(next_chunk, 0);
+        return Iterator(chunk, position.position);
+    }
+
+    /// \brief Добавляет элемент в начало списка.
+    ///
+    /// \param data Данные, которые нужно внести в список.
+    template <class T, class A>
+    void ChunkedList<T, A>::push_front(const T& data) {
+        this->emplace_front(data);
+    }
+
+    /// \brief Добавляет элемент в начало списка, перемещая в него данные.
+    ///
+    /// \param data Данные, которые нужно внести в список.
+    template <class T, class A>
+    void ChunkedList<T, A>::push_front(T&& data) {
+        this->emplace_front(std::move(data));
+    }
+
+    /// \brief Добавляет элемент в конец списка.
+    ///
+    /// \param data Данные, которые нужно внести в список.
+    template <class T, class A>
+    void ChunkedList<T, A>::push_back(const T& data) {
+        this->emplace_back(data);
+    }
+
+    /// \brief Добавляет элемент в конец списка, перемещая в него данные.
+    ///
+    /// \param data Данные, которые нужно внести в список.
+    template <class T, class A>
+    void ChunkedList<T, A>::push_back(T&& data) {
+        this->emplace_back(std::move(data));
+    }
+
+    /// \brief Создает значение в начале списка.
+    ///
+    /// Если первый блок полон, перед ним создается новый.
+    ///
+    /// \param args Аргументы конструктора значения.
+    ///
+    /// \return Ссылку на созданное значение.
+    template <class T, class A>
+    template <class... Args>
+    T& ChunkedList<T, A>::emplace_front(Args&&... args) {
+        if (this->head_ == nullptr || this->head_->count_ == CHUNK_CAPACITY) {
+            Chunk* new_chunk{ this->create_chunk() };
+            try {
+                std::construct_at(new_chunk->values(),
+                                  std::forward<Args>(args)...);
+            }
+            catch (...) {
+                this->destroy_chunk(new_chunk);
+                throw;
+            }
+            new_chunk->count_ = 1;
+            this->link_after(new_chunk, nullptr);
+            this->length_++;
+            return new_chunk->values()[0];
+        }
+        Chunk* chunk{ this->insert_into(this->head_, 0,
+                                        T(std::forward<Args>(args)...)).first };
+        return chunk->values()[0];
+    }
+
+    /// \brief Создает значение на месте в конце списка.
+    ///
+    /// Если последний блок полон, после него создается новый.
+    ///
+    /// \param args Аргументы конструктора значения.
+    ///
+    /// \return Ссылку на созданное значение.
+    template <class T, class A>
+    template <class... Args>
+    T& ChunkedList<T, A>::emplace_back(Args&&... args) {
+        Chunk* chunk{ this->tail_ };
+        bool created{ chunk == nullptr || chunk->count_ == CHUNK_CAPACITY };
+        if (created)
+            chunk = this->create_chunk();
+        try {
+            std::construct_at(chunk->values() + chunk->count_,
+                              std::forward<Args>(args)...);
+        }
+        catch (...) {
+            if (created)
+                this->destroy_chunk(chunk);
+            throw;
+        }
+        if (created)
+            this->link_after(chunk, this->tail_);
+        chunk->count_++;
+        this->length_++;
+        return chunk->values()[chunk->count_ - 1];
+    }
+
+    /// \brief Переносит первый элемент другого списка в конец текущего.
+    ///
+    /// В отличие от List::splice_back элемент перемещается между блоками,
+    /// поэтому может понадобиться новый блок. Если исходный список пуст,
+    /// ничего не меняется.
+    ///
+    /// \param source Список, из начала которого забирается элемент.
+    template <class T, class A>
+    void ChunkedList<T, A>::splice_back(ChunkedList& source) {
+        if (source.head_ == nullptr)
+            return;
+        this->emplace_back(std::move(source.head_->values()[0]));
+        source.remove_from(source.head_, 0);
+    }
+
+    /// \brief Вставляет новый элемент в произвольное место списка.
+    ///
+    /// \param index Индекс, на который нужно вставить новый элемент.
+    /// \param value Данные, которые нужно внести в список.
+    template <class T, class A>
+    [[maybe_unused]]
+    void ChunkedList<T, A>::insert(const size_t& index, const T& value) {
+        auto [chunk, position]{ this->locate(index) };
+        this->insert_into(chunk, position, value);
+    }
+
+    /// \brief Вставляет новый элемент в произвольное место списка, перемещая
+    /// в него данные.
+    ///
+    /// \param index Индекс, на который нужно вставить новый элемент.
+    /// \param value Данные, которые нужно внести в список.
+    template <class T, class A>
+    [[maybe_unused]]
+    void ChunkedList<T, A>::insert(const size_t& index, T&& value) {
+        auto [chunk, position]{ this->locate(index) };
+        this->insert_into(chunk, position, std::move(value));
+    }
+
+    /// \brief Вставляет новый элемент перед элементом, на который
+    /// указывает итератор.
+    ///
+    /// \param position Итератор на элемент, перед которым вставляется
+    /// новый; end() - вставка в конец.
+    /// \param value Данные, которые нужно внести в список.
+    ///
+    /// \return Итератор на вставленный элемент.
+    template <class T, class A>
+    [[maybe_unused]]
+    ChunkedList<T, A>::Iterator ChunkedList<T, A>::insert(Iterator position,
+                                                          const T& value) {
+        if (position.current_chunk == nullptr) {
+            this->emplace_back(value);
+            return this->rbegin();
+        }
+        auto [chunk, target]{ this->insert_into(
+                const_cast<Chunk*>(position.current_chunk), position.position,
+                value) };
+        return Iterator(chunk, target);
+    }
+
+    /// \brief Вставляет новый элемент перед элементом, на который
+    /// указывает итератор, перемещая в него данные.
+    ///
+    /// \param position Итератор на элемент, перед которым вставляется
+    /// новый; end() - вставка в конец.
+    /// \param value Данные, которые нужно внести в список.
+    ///
+    /// \return Итератор на вставленный элемент.
+    template <class T, class A>
+    [[maybe_unused]]
+    ChunkedList<T, A>::Iterator ChunkedList<T, A>::insert(Iterator position,
+                                                          T&& value) {
+        if (position.current_chunk == nullptr) {
+            this->emplace_back(std::move(value));
+            return this->rbegin();
+        }
+        auto [chunk, target]{ this->insert_into(
+                const_cast<Chunk*>(position.current_chunk), position.position,
+                std::move(value)) };
+        return Iterator(chunk, target);
+    }
+
+    /// \brief Позволяет получить значение элемента по индексу.
+    ///
+    /// \param index Индекс элемента.
+    ///
+    /// \return Значение элемента списка.
+    ///
+    /// \throw std::out_of_range Исключение возбуждается, если индекс
+    /// выходит за границы списка.
+    template <class T, class A>
+    T& ChunkedList<T, A>::operator [] (const size_t& index) {
+        auto [chunk, position]{ this->locate(index) };
+        return chunk->values()[position];
+    }
+
+    /// \brief Позволяет получить количество элементов списка.
+    ///
+    /// \return Значение кол-ва элементов.
+    template <class T, class A>
+    [[maybe_unused]] [[nodiscard]]
+    inline size_t ChunkedList<T, A>::length() const noexcept {
+        return this->length_;
+    }
+
+    /// \brief Определяет объем памяти, занятой блоками списка.
+    ///
+    /// Блоки пересчитываются обходом списка.
+    ///
+    /// \return Количество байтов, выделенных под блоки.
+    template <class T, class A>
+    [[nodiscard]] [[maybe_unused]]
+    inline size_t ChunkedList<T, A>::memory_usage() const noexcept {
+        size_t chunk_count{};
+        for (const Chunk* chunk{ this->head_ }; chunk != nullptr;
+                chunk = chunk->next_)
+            chunk_count++;
+        return chunk_count * sizeof(Chunk);
+    }
+
+    /// \brief Создает итератор от начала списка.
+    ///
+    /// \return Объект-итератор.
+    template <class T, class A>
+    inline ChunkedList<T, A>::Iterator ChunkedList<T, A>::begin() const {
+        return Iterator(this->head_, 0);
+    }
+
+    /// \brief Создает итератор на конец списка.
+    ///
+    /// \return Объект-итератор.
+    template <class T, class A>
+    inline ChunkedList<T, A>::Iterator ChunkedList<T, A>::end() const noexcept {
+        return Iterator(nullptr, 0);
+    }
+
+    /// \brief Создает итератор от конца списка (реверсивный перебор).
+    ///
+    /// \return Объект-итератор.
+    template <class T, class A>
+    [[maybe_unused]]
+    inline ChunkedList<T, A>::Iterator ChunkedList<T, A>::rbegin() const {
+        if (this->tail_ == nullptr)
+            return this->rend();
+        return Iterator(this->tail_, this->tail_->count_ - 1U);
+    }
+
+    /// \brief Создает итератор на начало списка (реверсивный перебор).
+    ///
+    /// \return Объект-итератор.
+    template <class T, class A>
+    [[maybe_unused]]
+    inline ChunkedList<T, A>::Iterator ChunkedList<T, A>::rend() const noexcept {
+        return Iterator(nullptr, 0);
+    }
+}
+
+#endif
@@ -0,0 +1,706 @@
+/// \file columnartable.hpp.
+/// \author Лошкарев Дмитрий.
+/// \date 14.10.2026.
+///
+/// \brief Содержит таблицу строк с общей схемой полей, хранящую значения
+/// каждого поля столбцом подряд.
+///
+/// \namespaces
+/// • DataStructures
+/// \classes
+/// • TableSchema
+/// • ColumnarTable
+
+#ifndef CPPPROJECT_COLUMNARTABLE_H
+#define CPPPROJECT_COLUMNARTABLE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "orderhashtable.hpp"
+
+namespace DataStructures {
+// Объявление классов.
+
+    /// \class Класс TableSchema описывает набор именованных полей строк.
+    ///
+    /// Имена полей хранятся один раз - ключами словаря, сопоставляющего
+    /// имени номер поля. Схема неизменяема и разделяется таблицами через
+    /// std::shared_ptr, поэтому ни строки, ни таблицы не хранят имена
+    /// повторно.
+    ///
+    /// Публичные методы:
+    /// \n • size_t field_count() const noexcept;
+    /// \n • std::string_view field_name(const size_t& field) const;
+    /// \n • size_t field_index(std::string_view name) const;
+    /// \n • bool contains(std::string_view name) const.
+    class TableSchema {
+        private:
+            OrderedHashTable<uint32_t> indices_;     ///< \brief Номера полей по именам.
+            std::vector<std::string_view> names_;    ///< \brief Имена полей по номерам.
+                                                     ///<
+                                                     ///< Ссылаются на ключи записей
+                                                     ///< indices_, которые не перемещаются.
+        public:
+            explicit TableSchema(std::initializer_list<std::string_view>);
+            explicit TableSchema(std::span<const std::string_view>);
+            TableSchema(const TableSchema&) = delete;
+            TableSchema& operator = (const TableSchema&) = delete;
+
+            [[nodiscard]]
+            inline size_t field_count() const noexcept;
+            [[nodiscard]]
+            inline std::string_view field_name(const size_t&) const;
+            [[nodiscard]]
+            inline size_t field_index(std::string_view) const;
+            [[nodiscard]] [[maybe_unused]]
+            inline bool contains(std::string_view) const;
+    };
+
+    /// \class Класс ColumnarTable предоставляет таблицу строк с ключами и
+    /// общей схемой полей: значения каждого поля всех строк лежат подряд в
+    /// отдельном массиве-столбце (struct of arrays).
+    ///
+    /// Строка не владеет ни хеш-таблицей, ни именами полей: она занимает
+    /// одну запись индекса ключей и по одному значению в каждом столбце.
+    /// Агрегирующий проход по полю читает один непрерывный массив, который
+    /// компилятор может векторизовать. Доступ к строке дает легкое
+    /// представление RowView из указателя на таблицу и номера строки.
+    ///
+    /// Удаленная строка замещается последней, так что столбцы остаются
+    /// плотными; номера строк поэтому не сохраняют порядок добавления и
+    /// меняются при удалении. Таблица ссылается на записи собственного
+    /// индекса и поэтому только перемещается.
+    ///
+    /// Публичные методы:
+    /// \n • const std::shared_ptr<const TableSchema>& schema() const noexcept;
+    /// \n • size_t length() const noexcept;
+    /// \n • RowView insert(std::string_view key);
+    /// \n • RowView insert(std::string_view key,
+    /// std::span<const ValueType> values);
+    /// \n • bool erase(std::string_view key);
+    /// \n • bool contains(std::string_view key) const;
+    /// \n • RowView operator [] (std::string_view key);
+    /// \n • ConstRowView at(std::string_view key) const;
+    /// \n • RowView row(const size_t& position);
+    /// \n • std::span<ValueType> column(const size_t& field);
+    /// \n • std::span<ValueType> column(std::string_view field);
+    /// \n • Result sum(std::string_view field) const;
+    /// \n • void reserve(const size_t& count).
+    ///
+    /// \tparam ValueType Тип значений полей.
+    /// \tparam StoragePolicy Политика хранения индекса ключей.
+    /// \tparam Hasher Функция хеширования ключей.
+    template <class ValueType, class StoragePolicy = ChainedStorage,
+              class Hasher = WyHasher>
+    class ColumnarTable {
+        private:
+            using Index = OrderedHashTable<uint32_t, StoragePolicy, Hasher>;
+            using IndexRecord = typename Index::Record;
+        public:
+            /// \class Класс BasicRowView предоставляет доступ к полям одной
+            /// строки. Представление действительно, пока строка не удалена
+            /// и не замещена при удалении другой строки.
+            ///
+            /// Публичные методы:
+            /// \n • std::string_view key() const noexcept
+            /// \n • size_t position() const noexcept
+            /// \n • Value& operator [] (const size_t& field) const
+            /// \n • Value& operator [] (std::string_view field) const
+            ///
+            /// \tparam IS_CONST Доступны ли поля только для чтения.
+            template <bool IS_CONST>
+            class BasicRowView {
+                private:
+                    using Table = std::conditional_t<IS_CONST, const ColumnarTable,
+                                                     ColumnarTable>;
+                    using Value = std::conditional_t<IS_CONST, const ValueType,
+                                                     ValueType>;
+
+                    Table* table_;
+                    size_t position_;
+                public:
+                    explicit BasicRowView(Table*, const size_t&) noexcept;
+
+                    [[nodiscard]] [[maybe_unused]]
+                    inline std::string_view key() const noexcept;
+                    [[nodiscard]] [[maybe_unused]]
+                    inline size_t position() const noexcept;
+                    [[nodiscard]]
+                    inline Value& operator [] (const size_t&) const;
+                    [[nodiscard]]
+                    inline Value& operator [] (std::string_view) const;
+            };
+
+            /// \brief Представление строки с изменяемыми полями.
+            using RowView = BasicRowView<false>;
+            /// \brief Представление строки только для чтения.
+            using ConstRowView = BasicRowView<true>;
+        private:
+            std::shared_ptr<const TableSchema> schema_;
+            Index index_;                               ///< \brief Номера строк по ключам.
+            std::vector<IndexRecord*> rows_;            ///< \brief Записи индекса по номерам
+                                                        ///< строк, для ключей и переноса
+                                                        ///< строк при удалении.
+            std::vector<std::vector<ValueType>> columns_;  ///< \brief Столбцы значений полей.
+
+            [[nodiscard]]
+            std::pair<RowView, bool> insert_row(std::string_view);
+            [[nodiscard]]
+            inline size_t checked_position(std::string_view) const;
+        public:
+            explicit ColumnarTable(std::shared_ptr<const TableSchema>);
+            [[maybe_unused]]
+            explicit ColumnarTable(std::initializer_list<std::string_view>);
+            ColumnarTable(const ColumnarTable&) = delete;
+            ColumnarTable(ColumnarTable&&) = default;
+            ColumnarTable& operator = (const ColumnarTable&) = delete;
+            ColumnarTable& operator = (ColumnarTable&&) = default;
+
+            [[nodiscard]] [[maybe_unused]]
+            inline const std::shared_ptr<const TableSchema>& schema() const noexcept;
+            [[nodiscard]] [[maybe_unused]]
+            inline size_t length() const noexcept;
+
+            [[maybe_unused]]
+            RowView insert(std::string_view key);
+            [[maybe_unused]]
+            RowView insert(std::string_view key, std::span<const ValueType> values);
+            [[maybe_unused]]
+            RowView insert(std::string_view key,
+                           std::initializer_list<ValueType> values);
+            [[maybe_unused]]
+            bool erase(std::string_view key);
+            [[nodiscard]] [[maybe_unused]]
+            bool contains(std::string_view key) const;
+
+            [[nodiscard]]
+            RowView operator [] (std::string_view key);
+            [[nodiscard]] [[maybe_unused]]
+            ConstRowView at(std::string_view key) const;
+            [[nodiscard]] [[maybe_unused]]
+            RowView row(const size_t& position);
+            [[nodiscard]] [[maybe_unused]]
+            ConstRowView row(const size_t& position) const;
+
+            [[nodiscard]] [[maybe_unused]]
+            inline std::span<ValueType> column(const size_t& field);
+            [[nodiscard]] [[maybe_unused]]
+            inline std::span<const ValueType> column(const size_t& field) const;
+            [[nodiscard]] [[maybe_unused]]
+            inline std::span<ValueType> column(std::string_view field);
+            [[nodiscard]] [[maybe_unused]]
+            inline std::span<const ValueType> column(std::string_view field) const;
+            template <class Result = ValueType>
+            [[nodiscard]] [[maybe_unused]]
+            Result sum(std::string_view field) const;
+
+            [[maybe_unused]]
+            void reserve(const size_t& count);
+    };
+
+// Определения методов классов.
+/* ============================== TableSchema ============================== */
+
+    /// \brief Конструктор экземпляра класса TableSchema.
+    ///
+    /// \param fields Имена полей в порядке их номеров.
+    ///
+    /// \throw std::invalid_argument Исключение возбуждается, если имена
+    /// полей повторяются.
+    inline TableSchema::TableSchema(std::initializer_list<std::string_view> fields) :
+            TableSchema(std::span<const std::string_view>(fields.begin(),
+                                                          fields.size())) { }
+
+    /// \brief Конструктор экземпляра класса TableSchema.
+    ///
+    /// \param fields Имена полей в порядке их номеров.
+    ///
+    /// \throw std::invalid_argument Исключение возбуждается, если имена
+    /// полей повторяются.
+    inline TableSchema::TableSchema(std::span<const std::string_view> fields) {
+        this->indices_.reserve(fields.size());
+        for (size_t field{}; field < fields.size(); field++) {
+            if (!this->indices_.try_emplace(fields[field],
+                                            static_cast<uint32_t>(field)).second)
+                throw std::invalid_argument("Duplicate field name in schema.");
+        }
+        this->names_.reserve(fields.size());
+        for (auto it{ this->indices_.keys()->begin() };
+                it != this->indices_.keys()->end(); ++it)
+            this->names_.emplace_back(*it);
+    }
+
+    /// \brief Предоставляет доступ к количеству полей.
+    ///
+    /// \return Значение кол-ва полей.
+    [[nodiscard]]
+    inline size_t TableSchema::field_count() const noexcept {
+        return this->names_.size();
+    }
+
+    /// \brief Определяет имя поля по номеру.
+    ///
+    /// \param field Номер поля.
+    ///
+    /// \return Имя поля.
+    ///
+    /// \throw std::out_of_range Исключение возбуждается, если поля с таким
+    /// номером нет.
+    [[nodiscard]]
+    inline std::string_view TableSchema::field_name(const size_t& field) const {
+        return this->names_.at(field);
+    }
+
+    /// \brief Определяет номер поля по имени.
+    ///
+    /// \param name Имя поля.
+    ///
+    /// \return Номер поля.
+    ///
+    /// \throw std::out_of_range Исключение возбуждается, если поля с таким
+    /// именем нет.
+    [[nodiscard]]
+    inline size_t TableSchema::field_index(std::string_view name) const {
+        const auto* record{ this->indices_.find(
+                name, this->indices_.hash_function(name)) };
+        if (record == nullptr)
+            throw std::out_of_range("Unknown field \"" + std::string(name) + "\".");
+        return record->value_;
+    }
+
+    /// \brief Проверяет, есть ли в схеме поле с указанным именем.
+    ///
+    /// \param name Имя поля.
+    ///
+    /// \return true, если поле есть.
+    [[nodiscard]] [[maybe_unused]]
+    inline bool TableSchema::contains(std::string_view name) const {
+        return this->indices_.find(name, this->indices_.hash_function(name)) !=
+               nullptr;
+    }
+
+/* ============================== BasicRowView ============================== */
+
+    /// \brief Стандартный конструктор экземпляра класса
+    /// ColumnarTable::BasicRowView.
+    ///
+    /// \param table Таблица строки.
+    /// \param position Номер строки.
+    template <class T, class S, class H>
+    template <bool C>
+    ColumnarTable<T, S, H>::BasicRowView<C>::BasicRowView(Table* table,
+                                                          const size_t& position)
+    noexcept : table_(table), position_(position) { }
+
+    /// \brief Предоставляет доступ к ключу строки.
+    ///
+    /// \return Ключ строки.
+    template <class T, class S, class H>
+    template <bool C>
+    [[nodiscard]] [[maybe_unused]]
+    inline std::string_view ColumnarTable<T, S, H>::BasicRowView<C>::key()
+    const noexcept {
+        return this->table_->rows_[this->position_]->key();
+    }
+
+    /// \brief Предоставляет доступ к номеру строки.
+    ///
+    /// \return Номер строки в столбцах.
+    template <class T, class S, class H>
+    template <bool C>
+    [[nodiscard]] [[maybe_unused]]
+    inline size_t ColumnarTable<T, S, H>::BasicRowView<C>::position()
+    const noexcept {
+        return this->position_;
+    }
+
+    /// \brief Перегрузка оператора [] для доступа к полю строки по номеру.
+    ///
+    /// \param field Номер поля.
+    ///
+    /// \return Ссылку на значение поля.
+    ///
+    /// \throw std::out_of_range Исключение возбуждается, если поля с таким
+    /// номером нет.
+    template <class T, class S, class H>
+    template <bool C>
+    [[nodiscard]]
+    inline ColumnarTable<T, S, H>::BasicRowView<C>::Value&
+    ColumnarTable<T, S, H>::BasicRowView<C>::operator [] (const size_t& field) const {
+        return this->table_->columns_.at(field)[this->position_];
+    }
+
+    /// \brief Перегрузка оператора [] для доступа к полю строки по имени.
+    ///
+    /// \param field Имя поля.
+    ///
+    /// \return Ссылку на значение поля.
+    ///
+    /// \throw std::out_of_range Исключение возбуждается, если поля с таким
+    /// именем нет.
+    template <class T, class S, class H>
+    template <bool C>
+    [[nodiscard]]
+    inline ColumnarTable<T, S, H>::BasicRowView<C>::Value&
+    ColumnarTable<T, S, H>::BasicRowView<C>::operator [] (std::string_view field) const {
+        return this->table_->columns_[this->table_->schema_->field_index(field)]
+                [this->position_];
+    }
+
+/* ============================= ColumnarTable ============================= */
+// PRIVATE
+
+    /// \brief Находит строку по ключу или добавляет новую со стандартными
+    /// значениями полей.
+    ///
+    /// \param key Ключ строки.
+    ///
+    /// \return Пару из представления строки и признака того, что строка
+    /// была добавлена.
+    template <class T, class S, class H>
+    [[nodiscard]]
+    std::pair<typename ColumnarTable<T, S, H>::RowView, bool>
+    ColumnarTable<T, S, H>::insert_row(std::string_view key) {
+        const size_t position{ this->rows_.size() };
+        auto [record, inserted]{ this->index_.try_emplace_record(
+                key, static_cast<uint32_t>(position)) };
+        if (!inserted)
+            return { RowView(this, record->value_), false };
+
+        try {
+            this->rows_.push_back(record);
+            for (auto& column : this->columns_)
+                column.emplace_back();
+        }
+        catch (...) {
+            // Столбцы, уже получившие значение, укорачиваются обратно.
+            this->rows_.resize(position);
+            for (auto& column : this->columns_)
+                column.resize(position);
+            static_cast<void>(this->index_.erase_record(key, record->hash()));
+            throw;
+        }
+        return { RowView(this, position), true };
+    }
+
+    /// \brief Определяет номер строки по ключу.
+    ///
+    /// \param key Ключ строки.
+    ///
+    /// \return Номер строки.
+    ///
+    /// \throw std::out_of_range Исключение возбуждается, если строки с
+    /// таким ключом нет.
+    template <class T, class S, class H>
+    [[nodiscard]]
+    inline size_t ColumnarTable<T, S, H>::checked_position(std::string_view key) const {
+        const IndexRecord* record{ this->index_.find(
+                key, this->index_.hash_function(key)) };
+        if (record == nullptr)
+            throw std::out_of_range("Row \"" + std::string(key) + "\" not found.");
+        return record->value_;
+    }
+
+// PUBLIC
+
+    /// \brief Конструктор экземпляра класса ColumnarTable.
+    ///
+    /// \param schema Схема полей, которую таблица разделяет с другими.
+    ///
+    /// \throw std::invalid_argument Исключение возбуждается, если схема
+    /// не задана.
+    template <class T, class S, class H>
+    ColumnarTable<T, S, H>::ColumnarTable(std::shared_ptr<const TableSchema> schema) :
+            schema_(std::move(schema)) {
+        if (this->schema_ == nullptr)
+            throw std::invalid_argument("Columnar table requires a schema.");
+        this->columns_.resize(this->schema_->field_count());
+    }
+
+    /// \brief Конструктор экземпляра класса ColumnarTable с собственной
+    /// схемой.
+    ///
+    /// \param fields Имена полей.
+    template <class T, class S, class H>
+    [[maybe_unused]]
+    ColumnarTable<T, S, H>::ColumnarTable(std::initializer_list<std::string_view> fields) :
+            ColumnarTable(std::make_shared<const TableSchema>(fields)) { }
+
+    /// \brief Предоставляет доступ к схеме полей.
+    ///
+    /// \return Указатель на схему.
+    template <class T, class S, class H>
+    [[nodiscard]] [[maybe_unused]]
+    inline const std::shared_ptr<const TableSchema>& ColumnarTable<T, S, H>::schema()
+    const noexcept {
+        return this->schema_;
+    }
+
+    /// \brief Предоставляет доступ к количеству строк.
+    ///
+    /// \return Значение кол-ва строк.
+    template <class T, class S, class H>
+    [[nodiscard]] [[maybe_unused]]
+    inline size_t ColumnarTable<T, S, H>::length() const noexcept {
+        return this->rows_.size();
+    }
+
+    /// \brief Добавляет строку со стандартными значениями полей.
+    ///
+    /// Если строка с таким ключом уже есть, она не изменяется.
+    ///
+    /// \param key Ключ строки.
+    ///
+    /// \return Представление строки.
+    template <class T, class S, class H>
+    [[maybe_unused]]
+    ColumnarTable<T, S, H>::RowView ColumnarTable<T, S, H>::insert(std::string_view key) {
+        return this->insert_row(key).first;
+    }
+
+    /// \brief Добавляет строку или заменяет значения всех ее полей.
+    ///
+    /// \param key Ключ строки.
+    /// \param values Значения полей в порядке их номеров.
+    ///
+    /// \return Представление строки.
+    ///
+    /// \throw std::invalid_argument Исключение возбуждается, если значений
+    /// не столько, сколько полей в схеме.
+    template <class T, class S, class H>
+    [[maybe_unused]]
+    ColumnarTable<T, S, H>::RowView ColumnarTable<T, S, H>::insert(
+            std::string_view key, std::span<const T> values) {
+        if (values.size() != this->columns_.size())
+            throw std::invalid_argument("Value count does not match the schema.");
+        RowView row{ this->insert_row(key).first };
+        for (size_t field{}; field < values.size(); field++)
+            this->columns_[field][row.position()] = values[field];
+        return row;
+    }
+
+    /// \brief Добавляет строку или заменяет значения всех ее полей.
+    ///
+    /// \param key Ключ строки.
+    /// \param values Значения полей в порядке их номеров.
+    ///
+    /// \return Представление строки.
+    ///
+    /// \throw std::invalid_argument Исключение возбуждается, если значений
+    /// не столько, сколько полей в схеме.
+    template <class T, class S, class H>
+    [[maybe_unused]]
+    ColumnarTable<T, S, H>::RowView ColumnarTable<T, S, H>::insert(
+            std::string_view key, std::initializer_list<T> values) {
+        return this->insert(key, std::span<const T>(values.begin(), values.size()));
+    }
+
+    /// \brief Удаляет строку с указанным ключом.
+    ///
+    /// Место строки в столбцах занимает последняя строка.
+    ///
+    /// \param key Ключ строки.
+    ///
+    /// \return true, если строка была удалена.
+    template <class T, class S, class H>
+    [[maybe_unused]]
+    bool ColumnarTable<T, S, H>::erase(std::string_view key) {
+        const uint64_t hash{ this->index_.hash_function(key) };
+        IndexRecord* record{ this->index_.find(key, hash) };
+        if (record == nullptr)
+            return false;
+
+        const size_t position{ record->value_ };
+        const size_t last{ this->rows_.size() - 1 };
+        if (position != last) {
+            for (auto& column : this->columns_)
+                column[position] = std::move(column[last]);
+            this->rows_[position] = this->rows_[last];
+            this->rows_[position]->value_ = static_cast<uint32_t>(position);
+        }
+        for (auto& column : this->columns_)
+            column.pop_back();
+        this->rows_.pop_back();
+        return this->index_.erase_record(key, hash);
+    }
+
+    /// \brief Проверяет, есть ли строка с указанным ключом.
+    ///
+    /// \param key Ключ строки.
+    ///
+    /// \return true, если строка есть.
+    template <class T, class S, class H>
+    [[nodiscard]] [[maybe_unused]]
+    bool ColumnarTable<T, S, H>::contains(std::string_view key) const {
+        return this->index_.find(key, this->index_.hash_function(key)) != nullptr;
+    }
+
+    /// \brief Перегрузка оператора [] для доступа к строке по ключу.
+    ///
+    /// \param key Ключ строки.
+    ///
+    /// \return Представление строки.
+    ///
+    /// \throw std::out_of_range Исключение возбуждается, если строки с
+    /// таким ключом нет.
+    template <class T, class S, class H>
+    [[nodiscard]]
+    ColumnarTable<T, S, H>::RowView ColumnarTable<T, S, H>::operator [] (
+            std::string_view key) {
+        return RowView(this, this->checked_position(key));
+    }
+
+    /// \brief Предоставляет доступ к строке по ключу только для чтения.
+    ///
+    /// \param key Ключ строки.
+    ///
+    /// \return Представление строки.
+    ///
+    /// \throw std::out_of_range Исключение возбуждается, если строки с
+    /// таким ключом нет.
+    template <class T, class S, class H>
+    [[nodiscard]] [[maybe_unused]]
+    ColumnarTable<T, S, H>::ConstRowView ColumnarTable<T, S, H>::at(
+            std::string_view key) const {
+        return ConstRowView(this, this->checked_position(key));
+    }
+
+    /// \brief Предоставляет доступ к строке по номеру.
+    ///
+    /// \param position Номер строки.
+    ///
+    /// \return Представление строки.
+    ///
+    /// \throw std::out_of_range Исключение возбуждается, если строки с
+    /// таким номером нет.
+    template <class T, class S, class H>
+    [[nodiscard]] [[maybe_unused]]
+    ColumnarTable<T, S, H>::RowView ColumnarTable<T, S, H>::row(const size_t& position) {
+        if (position >= this->rows_.size())
+            throw std::out_of_range("Row position is out of range.");
+        return RowView(this, position);
+    }
+
+    /// \brief Предоставляет доступ к строке по номеру только для чтения.
+    ///
+    /// \param position Номер строки.
+    ///
+    /// \return Представление строки.
+    ///
+    /// \throw std::out_of_range Исключение возбуждается, если строки с
+    /// таким номером нет.
+    template <class T, class S, class H>
+    [[nodiscard]] [[maybe_unused]]
+    ColumnarTable<T, S, H>::ConstRowView ColumnarTable<T, S, H>::row(
+            const size_t& position) const {
+        if (position >= this->rows_.size())
+            throw std::out_of_range("Row position is out of range.");
+        return ConstRowView(this, position);
+    }
+
+    /// \brief Предоставляет доступ к столбцу значений поля.
+    ///
+    /// \param field Номер поля.
+    ///
+    /// \return Значения поля всех строк по номерам строк.
+    ///
+    /// \throw std::out_of_range Исключение возбуждается, если поля с таким
+    /// номером нет.
+    template <class T, class S, class H>
+    [[nodiscard]] [[maybe_unused]]
+    inline std::span<T> ColumnarTable<T, S, H>::column(const size_t& field) {
+        return this->columns_.at(field);
+    }
+
+    /// \brief Предоставляет доступ к столбцу значений поля только для
+    /// чтения.
+    ///
+    /// \param field Номер поля.
+    ///
+    /// \return Значения поля всех строк по номерам строк.
+    ///
+    /// \throw std::out_of_range Исключение возбуждается, если поля с таким
+    /// номером нет.
+    template <class T, class S, class H>
+    [[nodiscard]] [[maybe_unused]]
+    inline std::span<const T> ColumnarTable<T, S, H>::column(const size_t& field) const {
+        return this->columns_.at(field);
+    }
+
+    /// \brief Предоставляет доступ к столбцу значений поля по имени.
+    ///
+    /// \param field Имя поля.
+    ///
+    /// \return Значения поля всех строк по номерам строк.
+    ///
+    /// \throw std::out_of_range Исключение возбуждается, если поля с таким
+    /// именем нет.
+    template <class T, class S, class H>
+    [[nodiscard]] [[maybe_unused]]
+    inline std::span<T> ColumnarTable<T, S, H>::column(std::string_view field) {
+        return this->columns_[this->schema_->field_index(field)];
+    }
+
+    /// \brief Предоставляет доступ к столбцу значений поля по имени
+    /// только для чтения.
+    ///
+    /// \param field Имя поля.
+    ///
+    /// \return Значения поля всех строк по номерам строк.
+    ///
+    /// \throw std::out_of_range Исключение возбуждается, если поля с таким
+    /// именем нет.
+    template <class T, class S, class H>
+    [[nodiscard]] [[maybe_unused]]
+    inline std::span<const T> ColumnarTable<T, S, H>::column(std::string_view field)
+    const {
+        return this->columns_[this->schema_->field_index(field)];
+    }
+
+    /// \brief Суммирует значения поля всех строк.
+    ///
+    /// Столбец обходится одним циклом по непрерывному массиву без
+    /// ветвлений, который компилятор векторизует.
+    ///
+    /// \tparam Result Тип суммы, например int64_t для полей int.
+    ///
+    /// \param field Имя поля.
+    ///
+    /// \return Сумму значений.
+    ///
+    /// \throw std::out_of_range Исключение возбуждается, если поля с таким
+    /// именем нет.
+    template <class T, class S, class H>
+    template <class Result>
+    [[nodiscard]] [[maybe_unused]]
+    Result ColumnarTable<T, S, H>::sum(std::string_view field) const {
+        Result total{};
+        for (const T& value : this->column(field))
+            total += static_cast<Result>(value);
+        return total;
+    }
+
+    /// \brief Заранее выделяет память под указанное количество строк.
+    ///
+    /// \param count Ожидаемое количество строк.
+    template <class T, class S, class H>
+    [[maybe_unused]]
+    void ColumnarTable<T, S, H>::reserve(const size_t& count) {
+        this->index_.reserve(count);
+        this->rows_.reserve(count);
+        for (auto& column : this->columns_)
+            column.reserve(count);
+    }
+}
+
+#endif
@@ -0,0 +1,358 @@
+/// \file compactkey.hpp.
+/// \author Лошкарев Дмитрий.
+/// \date 14.10.2026.
+///
+/// \brief Содержит компактное представление строковых ключей хеш-таблицы:
+/// короткие ключи хранятся внутри 16-байтового объекта, длинные - в общей
+/// арене строк, при желании без повторов.
+///
+/// \namespaces
+/// • DataStructures
+/// \classes
+/// • CompactKey
+/// • KeyArena
+
+#ifndef CPPPROJECT_COMPACTKEY_H
+#define CPPPROJECT_COMPACTKEY_H
+
+#include <algorithm>
+#include <atomic>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <unordered_set>
+#include <vector>
+
+#include "hasher.hpp"
+
+namespace DataStructures {
+// Объявление перечислений.
+
+    /// \enum Перечисление ArenaMode описывает, как арена хранит длинные
+    /// ключи.
+    ///
+    /// \n • APPEND - каждый ключ дописывается в арену заново;
+    /// \n • INTERN - одинаковые ключи хранятся один раз, и все таблицы,
+    /// разделяющие арену, ссылаются на одну копию.
+    enum class ArenaMode : uint8_t {
+        APPEND,
+        INTERN
+    };
+
+// Объявление классов.
+
+    /// \class Класс CompactKey описывает строковый ключ размером 16 байт.
+    ///
+    /// Ключи до INLINE_CAPACITY байт хранятся внутри объекта, последний
+    /// байт которого содержит длину. Более длинные ключи хранят указатель
+    /// и длину строки в арене KeyArena, которая должна жить, пока живет
+    /// ключ; такие ключи создает только KeyArena::make. Объект тривиально
+    /// копируется и не владеет памятью.
+    ///
+    /// Публичные методы:
+    /// \n • std::string_view view() const noexcept;
+    /// \n • size_t size() const noexcept;
+    /// \n • bool is_inline() const noexcept;
+    /// \n • operator std::string_view () const noexcept.
+    class CompactKey {
+        public:
+            static inline constexpr size_t INLINE_CAPACITY{ 15 };  ///< \brief Наибольшая длина ключа,
+                                                                   ///< хранимого внутри объекта.
+        private:
+            static inline constexpr size_t TAG{ INLINE_CAPACITY };  ///< \brief Байт длины или EXTERNAL.
+            static inline constexpr unsigned char EXTERNAL{ 0xFF }; ///< \brief Признак ключа в арене.
+
+            alignas(8) unsigned char bytes_[16];  ///< \brief Символы ключа или указатель
+                                                  ///< и 32-битная длина.
+
+            struct External { };
+            explicit CompactKey(const char*, const size_t&, External) noexcept;
+
+            friend class KeyArena;
+        public:
+            CompactKey() noexcept;
+            explicit CompactKey(std::string_view);
+
+            [[nodiscard]]
+            inline std::string_view view() const noexcept;
+            [[nodiscard]] [[maybe_unused]]
+            inline size_t size() const noexcept;
+            [[nodiscard]] [[maybe_unused]]
+            inline bool is_inline() const noexcept;
+            inline operator std::string_view () const noexcept;
+
+            friend inline bool operator == (const CompactKey&, const CompactKey&) noexcept;
+            friend inline bool operator == (const CompactKey&, std::string_view) noexcept;
+            friend inline std::strong_ordering operator <=> (const CompactKey&,
+                                                             const CompactKey&) noexcept;
+            friend inline std::strong_ordering operator <=> (const CompactKey&,
+                                                             std::string_view) noexcept;
+    };
+
+    static_assert(sizeof(CompactKey) == 16 && std::is_trivially_copyable_v<CompactKey>);
+
+    /// \class Класс KeyArena предоставляет память под длинные ключи
+    /// CompactKey.
+    ///
+    /// Строки дописываются подряд в блоки, размер которых удваивается от
+    /// MIN_CHUNK_SIZE до MAX_CHUNK_SIZE, так что арена маленькой таблицы
+    /// почти не занимает лишней памяти. Отдельные ключи не освобождаются,
+    /// вся память возвращается при уничтожении арены. В режиме
+    /// ArenaMode::APPEND это значит, что удаленные и перезаписанные длинные
+    /// ключи продолжают занимать место: арена таблицы, в которую постоянно
+    /// добавляют и из которой удаляют новые длинные ключи, растет без
+    /// ограничения. Для такой таблицы лучше ArenaMode::INTERN, если ключи
+    /// повторяются, или периодический перенос элементов в таблицу с новой
+    /// ареной. Арена передается таблицам через std::shared_ptr: таблица и
+    /// ее копии держат арену, пока в них остаются ключи. В режиме
+    /// ArenaMode::INTERN арена ведет множество сохраненных строк, и
+    /// повторный ключ не занимает новой памяти - так одна арена экономит
+    /// память на именах полей, повторяющихся во вложенных таблицах.
+    ///
+    /// Методы арены потокобезопасны: ее могут разделять таблицы,
+    /// которые используются из разных потоков. memory_usage не берет
+    /// мьютекс и читает оценку, которую make обновляет после каждого
+    /// длинного ключа.
+    ///
+    /// Публичные методы:
+    /// \n • CompactKey make(std::string_view key);
+    /// \n • ArenaMode mode() const noexcept;
+    /// \n • size_t memory_usage() const noexcept.
+    class KeyArena {
+        private:
+            static inline constexpr size_t MIN_CHUNK_SIZE{ 256 };    ///< \brief Размер первого блока строк.
+            static inline constexpr size_t MAX_CHUNK_SIZE{ 16384 };  ///< \brief Наибольший размер блока строк.
+
+            std::vector<std::unique_ptr<char[]>> chunks_;
+            char* cursor_;        ///< \brief Начало свободного места текущего блока.
+            size_t available_;    ///< \brief Свободных байт в текущем блоке.
+            size_t next_chunk_size_;
+            size_t memory_;       ///< \brief Байт во всех блоках.
+            std::atomic<size_t> usage_;  ///< \brief Последнее значение memory_usage.
+            ArenaMode mode_;
+            std::unordered_set<std::string_view, WyHasher> interned_;  ///< \brief Сохраненные
+                                                                       ///< строки (INTERN).
+            mutable std::mutex mutex_;
+
+            [[nodiscard]]
+            const char* store(std::string_view);
+        public:
+            explicit KeyArena(const ArenaMode& = ArenaMode::APPEND) noexcept;
+            KeyArena(const KeyArena&) = delete;
+            KeyArena& operator = (const KeyArena&) = delete;
+
+            [[nodiscard]]
+            CompactKey make(std::string_view);
+            [[nodiscard]] [[maybe_unused]]
+            inline ArenaMode mode() const noexcept;
+            [[nodiscard]] [[maybe_unused]]
+            size_t memory_usage() const noexcept;
+    };
+
+// Определения методов классов.
+/* =============================== CompactKey =============================== */
+// PRIVATE
+
+    /// \brief Конструктор ключа, хранящегося в арене.
+    ///
+    /// \param data Строка ключа в памяти арены.
+    /// \param size Длина ключа, не большая UINT32_MAX.
+    inline CompactKey::CompactKey(const char* data, const size_t& size, External) noexcept :
+            bytes_() {
+        const auto length{ static_cast<uint32_t>(size) };
+        std::memcpy(this->bytes_, &data, sizeof(data));
+        std::memcpy(this->bytes_ + sizeof(data), &length, sizeof(length));
+        this->bytes_[TAG] = EXTERNAL;
+    }
+
+// PUBLIC
+
+    /// \brief Стандартный конструктор экземпляра класса CompactKey.
+    ///
+    /// Создает пустой ключ.
+    inline CompactKey::CompactKey() noexcept : bytes_() { }
+
+    /// \brief Конструктор короткого ключа.
+    ///
+    /// \param key Строка ключа.
+    ///
+    /// \throw std::length_error Исключение возбуждается, если ключ длиннее
+    /// INLINE_CAPACITY: длинные ключи создает KeyArena::make.
+    inline CompactKey::CompactKey(std::string_view key) : bytes_() {
+        if (key.size() > INLINE_CAPACITY)
+            throw std::length_error("Key does not fit inline; use KeyArena::make.");
+        if (!key.empty())
+            std::memcpy(this->bytes_, key.data(), key.size());
+        this->bytes_[TAG] = static_cast<unsigned char>(key.size());
+    }
+
+    /// \brief Предоставляет доступ к строке ключа.
+    ///
+    /// \return Срез строки ключа.
+    [[nodiscard]]
+    inline std::string_view CompactKey::view() const noexcept {
+        if (this->bytes_[TAG] != EXTERNAL)
+            return { reinterpret_cast<const char*>(this->bytes_), this->bytes_[TAG] };
+        const char* data;
+        uint32_t length;
+        std::memcpy(&data, this->bytes_, sizeof(data));
+        std::memcpy(&length, this->bytes_ + sizeof(data), sizeof(length));
+        return { data, length };
+    }
+
+    /// \brief Позволяет получить длину ключа.
+    ///
+    /// \return Длину ключа в байтах.
+    [[nodiscard]] [[maybe_unused]]
+    inline size_t CompactKey::size() const noexcept {
+        return this->view().size();
+    }
+
+    /// \brief Проверяет, хранится ли ключ внутри объекта.
+    ///
+    /// \return true, если ключ не ссылается на арену.
+    [[nodiscard]] [[maybe_unused]]
+    inline bool CompactKey::is_inline() const noexcept {
+        return this->bytes_[TAG] != EXTERNAL;
+    }
+
+    /// \brief Приводит ключ к срезу строки.
+    ///
+    /// \return Срез строки ключа.
+    inline CompactKey::operator std::string_view () const noexcept {
+        return this->view();
+    }
+
+    /// \brief Сравнивает ключи на равенство.
+    ///
+    /// Короткие ключи сравниваются целиком по 16 байтам: байты за концом
+    /// строки всегда нулевые.
+    inline bool operator == (const CompactKey& lhs, const CompactKey& rhs) noexcept {
+        if (lhs.is_inline() && rhs.is_inline())
+            return std::memcmp(lhs.bytes_, rhs.bytes_, sizeof(lhs.bytes_)) == 0;
+        return lhs.view() == rhs.view();
+    }
+
+    /// \brief Сравнивает ключ со строкой на равенство.
+    inline bool operator == (const CompactKey& lhs, std::string_view rhs) noexcept {
+        return lhs.view() == rhs;
+    }
+
+    /// \brief Сравнивает ключи лексикографически.
+    inline std::strong_ordering operator <=> (const CompactKey& lhs,
+                                              const CompactKey& rhs) noexcept {
+        return lhs.view() <=> rhs.view();
+    }
+
+    /// \brief Сравнивает ключ со строкой лексикографически.
+    inline std::strong_ordering operator <=> (const CompactKey& lhs,
+                                              std::string_view rhs) noexcept {
+        return lhs.view() <=> rhs;
+    }
+
+/* ================================ KeyArena ================================ */
+// PRIVATE
+
+    /// \brief Копирует строку в память арены.
+    ///
+    /// Строки длиннее четверти наибольшего блока получают собственный
+    /// блок, чтобы не оставлять в текущем блоке большой неиспользованный
+    /// хвост.
+    ///
+    /// \param key Строка.
+    ///
+    /// \return Указатель на копию строки.
+    [[nodiscard]]
+    inline const char* KeyArena::store(std::string_view key) {
+        if (key.size() > MAX_CHUNK_SIZE / 4) {
+            std::unique_ptr<char[]> chunk{ new char[key.size()] };
+            std::memcpy(chunk.get(), key.data(), key.size());
+            this->chunks_.push_back(std::move(chunk));
+            this->memory_ += key.size();
+            return this->chunks_.back().get();
+        }
+        if (key.size() > this->available_) {
+            const size_t size{ std::max(this->next_chunk_size_, key.size()) };
+            std::unique_ptr<char[]> chunk{ new char[size] };
+            this->chunks_.push_back(std::move(chunk));
+            this->cursor_ = this->chunks_.back().get();
+            this->available_ = size;
+            this->memory_ += size;
+            this->next_chunk_size_ = std::min(size * 2, MAX_CHUNK_SIZE);
+        }
+        char* data{ this->cursor_ };
+        std::memcpy(data, key.data(), key.size());
+        this->cursor_ += key.size();
+        this->available_ -= key.size();
+        return data;
+    }
+
+// PUBLIC
+
+    /// \brief Стандартный конструктор экземпляра класса KeyArena.
+    ///
+    /// Память выделяется при первом длинном ключе.
+    ///
+    /// \param mode Хранить ли повторные ключи один раз.
+    inline KeyArena::KeyArena(const ArenaMode& mode) noexcept :
+            cursor_(nullptr), available_(0), next_chunk_size_(MIN_CHUNK_SIZE),
+            memory_(0), usage_(0), mode_(mode) { }
+
+    /// \brief Создает ключ: короткий - внутри объекта, длинный - в арене.
+    ///
+    /// \param key Строка ключа.
+    ///
+    /// \return Ключ, действительный, пока жива арена.
+    ///
+    /// \throw std::length_error Исключение возбуждается, если ключ длиннее
+    /// UINT32_MAX байт.
+    [[nodiscard]]
+    inline CompactKey KeyArena::make(std::string_view key) {
+        if (key.size() <= CompactKey::INLINE_CAPACITY)
+            return CompactKey(key);
+        if (key.size() > std::numeric_limits<uint32_t>::max())
+            throw std::length_error("Key is longer than 4 GiB.");
+
+        std::lock_guard lock{ this->mutex_ };
+        const char* data;
+        if (this->mode_ == ArenaMode::INTERN) {
+            auto it{ this->interned_.find(key) };
+            if (it == this->interned_.end())
+                it = this->interned_.emplace(this->store(key), key.size()).first;
+            data = it->data();
+        }
+        else
+            data = this->store(key);
+        this->usage_.store(this->memory_ + this->interned_.bucket_count() * sizeof(void*) +
+                           this->interned_.size() * (sizeof(std::string_view) +
+                                                     2 * sizeof(void*)),
+                           std::memory_order_relaxed);
+        return CompactKey(data, key.size(), CompactKey::External{});
+    }
+
+    /// \brief Позволяет узнать режим арены.
+    ///
+    /// \return Режим хранения повторных ключей.
+    [[nodiscard]] [[maybe_unused]]
+    inline ArenaMode KeyArena::mode() const noexcept {
+        return this->mode_;
+    }
+
+    /// \brief Позволяет узнать объем памяти арены.
+    ///
+    /// \return Байт в блоках строк и, в режиме INTERN, приблизительный
+    /// объем множества сохраненных строк.
+    [[nodiscard]] [[maybe_unused]]
+    inline size_t KeyArena::memory_usage() const noexcept {
+        return this->usage_.load(std::memory_order_relaxed);
+    }
+}
+
+#endif
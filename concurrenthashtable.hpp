@@ -0,0 +1,439 @@
+/// \file concurrenthashtable.hpp.
+/// \author Лошкарев Дмитрий.
+/// \date 14.10.2026.
+///
+/// \brief Содержит потокобезопасную упорядоченную хеш-таблицу,
+/// разделенную на независимо блокируемые сегменты.
+///
+/// \namespaces
+/// • DataStructures
+/// \classes
+/// • ConcurrentOrderedHashTable
+
+#ifndef CPPPROJECT_CONCURRENTHASHTABLE_H
+#define CPPPROJECT_CONCURRENTHASHTABLE_H
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <queue>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "orderhashtable.hpp"
+
+namespace DataStructures {
+// Объявление классов.
+
+    /// \class Класс ConcurrentOrderedHashTable предоставляет хеш-таблицу,
+    /// с которой одновременно работают несколько потоков.
+    ///
+    /// Ключи распределяются по хешу между N сегментами. Каждый сегмент -
+    /// обычная OrderedHashTable со своим std::shared_mutex: чтение
+    /// захватывает сегмент в разделяемом режиме, изменение - в
+    /// монопольном, поэтому потоки, работающие с разными сегментами, не
+    /// мешают друг другу. Ключ хешируется один раз: тот же хеш выбирает
+    /// сегмент и передается таблице сегмента.
+    ///
+    /// При включенном учете порядка каждая новая запись получает номер из
+    /// общего атомарного счетчика, и items() возвращает записи всех
+    /// сегментов в порядке добавления. Без учета порядка счетчик не
+    /// используется, а записи перечисляются по сегментам.
+    ///
+    /// Публичные методы:
+    /// \n • void insert(std::string_view key, const HashType& value);
+    /// \n • void insert(std::string_view key, HashType&& value);
+    /// \n • bool erase(std::string_view key);
+    /// \n • HashType get(std::string_view key) const;
+    /// \n • bool contains(std::string_view key) const;
+    /// \n • bool visit(std::string_view key, Function&& function) const;
+    /// \n • bool update(std::string_view key, Function&& function);
+    /// \n • size_t length() const;
+    /// \n • std::vector<std::pair<std::string, HashType>> items() const;
+    /// \n • size_t shard_count() const noexcept.
+    ///
+    /// \tparam HashType Тип значений хеш-таблицы.
+    /// \tparam StoragePolicy Политика хранения записей сегментов.
+    /// \tparam Hasher Функция хеширования ключей.
+    /// \tparam Allocator Аллокатор записей; каждый сегмент получает
+    /// собственную копию.
+    template <class HashType, class StoragePolicy = ChainedStorage,
+              class Hasher = WyHasher,
+              class Allocator = PoolAllocator<std::byte>>
+    class ConcurrentOrderedHashTable {
+        private:
+            static inline constexpr size_t CACHE_LINE_SIZE{ 64 };       ///< \brief Размер кеш-линии.
+            static inline constexpr size_t DEFAULT_SHARD_COUNT{ 64 };   ///< \brief Количество сегментов
+                                                                        ///< по умолчанию.
+
+            /// \class Структура Entry описывает значение записи сегмента
+            /// вместе с ее номером в общем порядке добавления.
+            struct Entry {
+                HashType value_;
+                uint64_t sequence_;  ///< \brief Номер записи в порядке добавления.
+
+                Entry() = default;
+                template <class Value>
+                Entry(Value&&, const uint64_t&);
+            };
+
+            using Table = OrderedHashTable<Entry, StoragePolicy, Hasher,
+                                           Allocator>;
+
+            /// \class Структура Shard описывает сегмент хеш-таблицы. Сегменты
+            /// выровнены по кеш-линии, чтобы блокировки соседних сегментов
+            /// не делили одну линию.
+            struct alignas(CACHE_LINE_SIZE) Shard {
+                mutable std::shared_mutex mutex_;
+                Table table_;
+            };
+
+            size_t shard_count_;
+            Shard* shards_;
+            Hasher hasher_;
+            bool track_order_;                    ///< \brief Учитывать ли общий порядок добавления.
+            alignas(CACHE_LINE_SIZE)
+            std::atomic<uint64_t> sequence_;      ///< \brief Номер следующей новой записи.
+
+            [[nodiscard]]
+            inline Shard& shard_of(const uint64_t&) const noexcept;
+            template <class Value>
+            void assign(std::string_view, Value&&);
+        public:
+            explicit ConcurrentOrderedHashTable(
+                    const size_t& shard_count = DEFAULT_SHARD_COUNT,
+                    const bool& track_order = true);
+            ConcurrentOrderedHashTable(const ConcurrentOrderedHashTable&) = delete;
+            ConcurrentOrderedHashTable& operator = (
+                    const ConcurrentOrderedHashTable&) = delete;
+            ~ConcurrentOrderedHashTable();
+
+            [[maybe_unused]]
+            void insert(std::string_view key, const HashType& value);
+            [[maybe_unused]]
+            void insert(std::string_view key, HashType&& value);
+            [[maybe_unused]]
+            bool erase(std::string_view key);
+            [[nodiscard]] [[maybe_unused]]
+            HashType get(std::string_view key) const;
+            [[nodiscard]] [[maybe_unused]]
+            bool contains(std::string_view key) const;
+            template <class Function>
+            [[maybe_unused]]
+            bool visit(std::string_view key, Function&& function) const;
+            template <class Function>
+            [[maybe_unused]]
+            bool update(std::string_view key, Function&& function);
+
+            [[nodiscard]] [[maybe_unused]]
+            size_t length() const;
+            [[nodiscard]] [[maybe_unused]]
+            std::vector<std::pair<std::string, HashType>> items() const;
+            [[nodiscard]] [[maybe_unused]]
+            inline size_t shard_count() const noexcept;
+    };
+
+// Определения методов классов.
+/* ================================= Entry ================================= */
+
+    /// \brief Стандартный конструктор экземпляра класса
+    /// ConcurrentOrderedHashTable::Entry.
+    ///
+    /// \param value Значение записи.
+    /// \param sequence Номер записи в порядке добавления.
+    template <class T, class S, class H, class A>
+    template <class Value>
+    ConcurrentOrderedHashTable<T, S, H, A>::Entry::Entry(Value&& value,
+                                                         const uint64_t& sequence) :
+            value_(std::forward<Value>(value)), sequence_(sequence) { }
+
+/* ======================= ConcurrentOrderedHashTable ======================= */
+// PRIVATE
+
+    /// \brief Определяет сегмент, которому принадлежит хеш.
+    ///
+    /// Старшие биты хеша уже выбирают ячейку внутри сегмента, а младшие -
+    /// метку ячейки при открытой адресации, поэтому сегмент выбирается по
+    /// средним битам: хеш циклически сдвигается на 32 бита.
+    ///
+    /// \param hash Хеш ключа.
+    ///
+    /// \return Ссылку на сегмент.
+    template <class T, class S, class H, class A>
+    [[nodiscard]]
+    inline ConcurrentOrderedHashTable<T, S, H, A>::Shard&
+    ConcurrentOrderedHashTable<T, S, H, A>::shard_of(const uint64_t& hash)
+    const noexcept {
+        return this->shards_[bucket_index(std::rotl(hash, 32),
+                                          this->shard_count_)];
+    }
+
+    /// \brief Добавляет элемент или изменяет значение по существующему
+    /// ключу.
+    ///
+    /// \param key Строковый ключ элемента.
+    /// \param value Значение элемента; rvalue перемещается.
+    template <class T, class S, class H, class A>
+    template <class Value>
+    void ConcurrentOrderedHashTable<T, S, H, A>::assign(std::string_view key,
+                                                        Value&& value) {
+        uint64_t hash{ this->hasher_(key) };
+        Shard& shard{ this->shard_of(hash) };
+        std::unique_lock lock{ shard.mutex_ };
+
+        auto* record{ shard.table_.find(key, hash) };
+        if (record != nullptr) {
+            record->value_.value_ = std::forward<Value>(value);
+            return;
+        }
+        // Номер выдается под блокировкой сегмента, поэтому внутри сегмента
+        // записи упорядочены по номерам.
+        uint64_t sequence{ this->track_order_
+                           ? this->sequence_.fetch_add(1, std::memory_order_relaxed)
+                           : 0 };
+        shard.table_.append(key, hash, std::forward<Value>(value), sequence);
+    }
+
+// PUBLIC
+
+    /// \brief Стандартный конструктор экземпляра класса
+    /// ConcurrentOrderedHashTable.
+    ///
+    /// \param shard_count Количество сегментов, не меньшее 1. Чем больше
+    /// потоков одновременно изменяют таблицу, тем больше сегментов стоит
+    /// задать.
+    /// \param track_order Учитывать ли общий порядок добавления записей.
+    template <class T, class S, class H, class A>
+    ConcurrentOrderedHashTable<T, S, H, A>::ConcurrentOrderedHashTable(
+            const size_t& shard_count, const bool& track_order) :
+            shard_count_((shard_count == 0) ? 1 : shard_count),
+            shards_(new Shard[this->shard_count_]), hasher_(),
+            track_order_(track_order), sequence_(0) { }
+
+    // Стандартный деструктор экземпляра.
+    template <class T, class S, class H, class A>
+    ConcurrentOrderedHashTable<T, S, H, A>::~ConcurrentOrderedHashTable() {
+        delete[] this->shards_;
+    }
+
+    /// \brief Метод, добавляющий элемент.
+    ///
+    /// \param key Строковый ключ элемента для вставки/изменения.
+    /// \param value Значение элемента для вставки/изменения.
+    template <class T, class S, class H, class A>
+    [[maybe_unused]]
+    void ConcurrentOrderedHashTable<T, S, H, A>::insert(std::string_view key,
+                                                        const T& value) {
+        this->assign(key, value);
+    }
+
+    /// \brief Метод, добавляющий элемент с перемещением значения.
+    ///
+    /// \param key Строковый ключ элемента для вставки/изменения.
+    /// \param value Значение элемента для вставки/изменения.
+    template <class T, class S, class H, class A>
+    [[maybe_unused]]
+    void ConcurrentOrderedHashTable<T, S, H, A>::insert(std::string_view key,
+                                                        T&& value) {
+        this->assign(key, std::move(value));
+    }
+
+    /// \brief Метод, стирающий из хеш-таблицы элемент с указанным ключом.
+    ///
+    /// \param key Строковый ключ элемента, который требуется удалить.
+    ///
+    /// \return true, если элемент был удален.
+    template <class T, class S, class H, class A>
+    [[maybe_unused]]
+    bool ConcurrentOrderedHashTable<T, S, H, A>::erase(std::string_view key) {
+        uint64_t hash{ this->hasher_(key) };
+        Shard& shard{ this->shard_of(hash) };
+        std::unique_lock lock{ shard.mutex_ };
+        return shard.table_.erase_record(key, hash);
+    }
+
+    /// \brief Метод, позволяющий получить копию значения элемента по ключу.
+    ///
+    /// Ссылку вернуть нельзя: после снятия блокировки значение может
+    /// изменить другой поток. В случае ненахождения элемента будет
+    /// возвращено стандартное значение.
+    ///
+    /// \param key Строковый ключ, значение по которому нужно найти.
+    ///
+    /// \return Найденное значение ключа или стандартное значение.
+    template <class T, class S, class H, class A>
+    [[nodiscard]] [[maybe_unused]]
+    T ConcurrentOrderedHashTable<T, S, H, A>::get(std::string_view key) const {
+        uint64_t hash{ this->hasher_(key) };
+        Shard& shard{ this->shard_of(hash) };
+        std::shared_lock lock{ shard.mutex_ };
+
+        auto* record{ shard.table_.find(key, hash) };
+        if (record != nullptr)
+            return record->value_.value_;
+        return T{};
+    }
+
+    /// \brief Проверяет, есть ли в хеш-таблице элемент с указанным ключом.
+    ///
+    /// \param key Строковый ключ элемента.
+    ///
+    /// \return Булевое значение.
+    template <class T, class S, class H, class A>
+    [[nodiscard]] [[maybe_unused]]
+    bool ConcurrentOrderedHashTable<T, S, H, A>::contains(std::string_view key)
+    const {
+        uint64_t hash{ this->hasher_(key) };
+        Shard& shard{ this->shard_of(hash) };
+        std::shared_lock lock{ shard.mutex_ };
+        return shard.table_.find(key, hash) != nullptr;
+    }
+
+    /// \brief Передает значение элемента функции без копирования.
+    ///
+    /// Функция вызывается под разделяемой блокировкой сегмента и не должна
+    /// обращаться к этой же хеш-таблице.
+    ///
+    /// \param key Строковый ключ элемента.
+    /// \param function Функция, принимающая const HashType&.
+    ///
+    /// \return true, если элемент найден и функция вызвана.
+    template <class T, class S, class H, class A>
+    template <class Function>
+    [[maybe_unused]]
+    bool ConcurrentOrderedHashTable<T, S, H, A>::visit(std::string_view key,
+                                                       Function&& function) const {
+        uint64_t hash{ this->hasher_(key) };
+        Shard& shard{ this->shard_of(hash) };
+        std::shared_lock lock{ shard.mutex_ };
+
+        auto* record{ shard.table_.find(key, hash) };
+        if (record == nullptr)
+            return false;
+        std::forward<Function>(function)(
+                static_cast<const T&>(record->value_.value_));
+        return true;
+    }
+
+    /// \brief Изменяет значение элемента на месте.
+    ///
+    /// Функция вызывается под монопольной блокировкой сегмента и не должна
+    /// обращаться к этой же хеш-таблице.
+    ///
+    /// \param key Строковый ключ элемента.
+    /// \param function Функция, принимающая HashType&.
+    ///
+    /// \return true, если элемент найден и функция вызвана.
+    template <class T, class S, class H, class A>
+    template <class Function>
+    [[maybe_unused]]
+    bool ConcurrentOrderedHashTable<T, S, H, A>::update(std::string_view key,
+                                                        Function&& function) {
+        uint64_t hash{ this->hasher_(key) };
+        Shard& shard{ this->shard_of(hash) };
+        std::unique_lock lock{ shard.mutex_ };
+
+        auto* record{ shard.table_.find(key, hash) };
+        if (record == nullptr)
+            return false;
+        std::forward<Function>(function)(record->value_.value_);
+        return true;
+    }
+
+    /// \brief Предоставляет доступ к количеству элементов таблицы.
+    ///
+    /// Сегменты опрашиваются по очереди, поэтому при одновременных
+    /// изменениях результат приблизителен.
+    ///
+    /// \return Значение кол-ва элементов.
+    template <class T, class S, class H, class A>
+    [[nodiscard]] [[maybe_unused]]
+    size_t ConcurrentOrderedHashTable<T, S, H, A>::length() const {
+        size_t count{};
+        for (size_t item{}; item < this->shard_count_; item++) {
+            std::shared_lock lock{ this->shards_[item].mutex_ };
+            count += this->shards_[item].table_.length();
+        }
+        return count;
+    }
+
+    /// \brief Возвращает снимок всех элементов хеш-таблицы.
+    ///
+    /// На время снимка все сегменты захватываются в разделяемом режиме
+    /// (всегда в одном порядке), поэтому снимок согласован. При учете
+    /// порядка записи сегментов, уже упорядоченные по номерам, сливаются
+    /// через кучу за O(n log N).
+    ///
+    /// \return Пары "ключ - значение" в порядке добавления или по
+    /// сегментам, если порядок не учитывается.
+    template <class T, class S, class H, class A>
+    [[nodiscard]] [[maybe_unused]]
+    std::vector<std::pair<std::string, T>>
+    ConcurrentOrderedHashTable<T, S, H, A>::items() const {
+        using Record = typename Table::Record;
+
+        std::vector<std::shared_lock<std::shared_mutex>> locks;
+        locks.reserve(this->shard_count_);
+        size_t count{};
+        for (size_t item{}; item < this->shard_count_; item++) {
+            locks.emplace_back(this->shards_[item].mutex_);
+            count += this->shards_[item].table_.length();
+        }
+
+        std::vector<std::pair<std::string, T>> result;
+        result.reserve(count);
+        if (!this->track_order_) {
+            for (size_t item{}; item < this->shard_count_; item++) {
+                for (const Record* record : this->shards_[item].table_.order_) {
+                    if (record != nullptr)
+                        result.emplace_back(record->key_, record->value_.value_);
+                }
+            }
+            return result;
+        }
+
+        // Слияние упорядоченных массивов сегментов: в куче лежит по одной
+        // текущей записи каждого сегмента вместе с номером сегмента.
+        using Cursor = std::pair<const Record*, size_t>;
+        auto later{ [](const Cursor& left, const Cursor& right) {
+            return left.first->value_.sequence_ > right.first->value_.sequence_;
+        } };
+        std::priority_queue<Cursor, std::vector<Cursor>, decltype(later)> heads(later);
+        for (size_t item{}; item < this->shard_count_; item++) {
+            const Table& table{ this->shards_[item].table_ };
+            if (table.record_count_ != 0)
+                heads.emplace(table.order_[table.order_front_], item);
+        }
+        while (!heads.empty()) {
+            const auto [record, shard]{ heads.top() };
+            heads.pop();
+            result.emplace_back(record->key_, record->value_.value_);
+            const auto& order{ this->shards_[shard].table_.order_ };
+            for (size_t position{ record->position_ + 1 }; position < order.size();
+                    position++) {
+                if (order[position] != nullptr) {
+                    heads.emplace(order[position], shard);
+                    break;
+                }
+            }
+        }
+        return result;
+    }
+
+    /// \brief Предоставляет доступ к количеству сегментов.
+    ///
+    /// \return Значение кол-ва сегментов.
+    template <class T, class S, class H, class A>
+    [[nodiscard]] [[maybe_unused]]
+    inline size_t ConcurrentOrderedHashTable<T, S, H, A>::shard_count()
+    const noexcept {
+        return this->shard_count_;
+    }
+}
+
+#endif
@@ -0,0 +1,453 @@
+/// \file csvimport.hpp.
+/// \author Лошкарев Дмитрий.
+/// \date 14.10.2026.
+///
+/// \brief Содержит потоковый импорт файлов с разделителями (CSV, TSV) в
+/// хеш-таблицу.
+///
+/// \namespaces
+/// • DataStructures
+/// \classes
+/// • CsvImportOptions
+/// • CsvImportResult
+/// • CsvValueParser
+/// • CsvImporter
+
+#ifndef CPPPROJECT_CSVIMPORT_H
+#define CPPPROJECT_CSVIMPORT_H
+
+#include <algorithm>
+#include <charconv>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace DataStructures {
+// Объявление классов.
+
+    /// \class Структура CsvImportOptions описывает формат импортируемого
+    /// файла.
+    struct CsvImportOptions {
+        char delimiter_{ ',' };          ///< \brief Разделитель полей.
+        size_t key_column_{ 0 };         ///< \brief Номер поля ключа (с 0).
+        size_t value_column_{ 1 };       ///< \brief Номер поля значения (с 0).
+        bool has_header_{ false };       ///< \brief Пропускать ли первую строку.
+        size_t block_size_{ 1 << 22 };   ///< \brief Размер читаемого блока в байтах.
+    };
+
+    /// \class Структура CsvImportResult описывает итог импорта.
+    struct CsvImportResult {
+        uint64_t bytes_{};         ///< \brief Прочитано байтов.
+        uint64_t rows_{};          ///< \brief Передано в таблицу строк.
+        uint64_t skipped_rows_{};  ///< \brief Строк без нужных полей или с
+                                   ///< неразборчивым значением.
+    };
+
+    /// \class Класс CsvValueParser предоставляет разбор поля значения по
+    /// умолчанию: числа читаются std::from_chars, остальные типы
+    /// создаются из std::string_view.
+    ///
+    /// Публичные методы:
+    /// \n • bool operator () (std::string_view field, HashType& value) const
+    ///
+    /// \tparam HashType Тип значений таблицы.
+    template <class HashType>
+    class CsvValueParser {
+        public:
+            [[nodiscard]]
+            bool operator () (std::string_view, HashType&) const;
+    };
+
+    /// \class Класс CsvImporter предоставляет потоковый импорт файла с
+    /// разделителями в хеш-таблицу без загрузки файла целиком.
+    ///
+    /// Импорт работает конвейером из двух потоков. Читающий поток берет
+    /// файл блоками по block_size_ байт, находит концы строк и
+    /// разделители полей через std::memchr (в стандартных библиотеках он
+    /// векторизован) и раскладывает строки в пары из среза ключа прямо в
+    /// буфере блока и разобранного значения. Вызывающий поток тем временем
+    /// хеширует и добавляет пары предыдущего блока через insert_batch.
+    /// В работе одновременно находится не более PIPELINE_DEPTH блоков, так
+    /// что память не зависит от размера файла. Неполная последняя строка
+    /// блока переносится в начало следующего.
+    ///
+    /// Поля в кавычках не поддерживаются: разделитель внутри поля
+    /// считается концом поля. Завершающий '\r' строки отбрасывается,
+    /// пустые строки пропускаются.
+    ///
+    /// Публичные методы:
+    /// \n • CsvImportResult import_file(Table& table,
+    /// const std::filesystem::path& path);
+    ///
+    /// \tparam HashType Тип значений таблицы.
+    /// \tparam Parser Разбор поля значения: bool(std::string_view,
+    /// HashType&), false для неразборчивого поля.
+    template <class HashType, class Parser = CsvValueParser<HashType>>
+    class CsvImporter {
+        private:
+            static inline constexpr size_t PIPELINE_DEPTH{ 3 };  ///< \brief Количество блоков в работе.
+
+            /// \class Структура Block описывает прочитанный блок файла и
+            /// разобранные из него пары.
+            struct Block {
+                std::vector<char> buffer_;
+                std::vector<std::pair<std::string_view, HashType>> items_;
+                uint64_t bytes_;
+                uint64_t skipped_rows_;
+                bool last_;  ///< \brief Последний блок файла.
+            };
+
+            /// \class Класс Pipeline описывает очереди свободных и готовых
+            /// блоков между читающим и вызывающим потоками.
+            class Pipeline {
+                private:
+                    std::mutex mutex_;
+                    std::condition_variable changed_;
+                    std::deque<Block*> free_;
+                    std::deque<Block*> ready_;
+                    bool stopping_{ false };
+                    std::exception_ptr error_;
+                public:
+                    [[nodiscard]]
+                    Block* acquire_free();
+                    void push_ready(Block*);
+                    [[nodiscard]]
+                    Block* acquire_ready();
+                    void release(Block*);
+                    void fail(std::exception_ptr) noexcept;
+                    void stop() noexcept;
+                    void rethrow();
+            };
+
+            CsvImportOptions options_;
+            Parser parser_;
+
+            void parse_line(Block&, std::string_view) const;
+            void read_blocks(std::ifstream&, Pipeline&) const;
+        public:
+            explicit CsvImporter(const CsvImportOptions& = CsvImportOptions(),
+                                 const Parser& = Parser());
+
+            template <class Table>
+            [[maybe_unused]]
+            CsvImportResult import_file(Table& table,
+                                        const std::filesystem::path& path);
+    };
+
+// Определения методов классов.
+/* ============================= CsvValueParser ============================= */
+
+    /// \brief Разбирает поле значения.
+    ///
+    /// \param field Срез поля.
+    /// \param value Значение, в которое записывается результат.
+    ///
+    /// \return true, если поле разобрано целиком.
+    template <class T>
+    [[nodiscard]]
+    bool CsvValueParser<T>::operator () (std::string_view field, T& value) const {
+        if constexpr (std::is_arithmetic_v<T> && !std::is_same_v<T, bool>) {
+            const char* end{ field.data() + field.size() };
+            auto [ptr, error]{ std::from_chars(field.data(), end, value) };
+            return error == std::errc() && ptr == end;
+        }
+        else {
+            static_assert(std::is_constructible_v<T, std::string_view>,
+                          "CsvValueParser needs a value constructible from "
+                          "std::string_view; pass a custom parser.");
+            value = T(field);
+            return true;
+        }
+    }
+
+/* =============================== Pipeline =============================== */
+
+    /// \brief Берет свободный блок, дожидаясь его освобождения.
+    ///
+    /// \return Указатель на блок или nullptr, если импорт остановлен.
+    template <class T, class P>
+    [[nodiscard]]
+    CsvImporter<T, P>::Block* CsvImporter<T, P>::Pipeline::acquire_free() {
+        std::unique_lock lock{ this->mutex_ };
+        this->changed_.wait(lock, [this] {
+            return this->stopping_ || !this->free_.empty();
+        });
+        if (this->stopping_)
+            return nullptr;
+        Block* block{ this->free_.front() };
+        this->free_.pop_front();
+        return block;
+    }
+
+    /// \brief Передает заполненный блок вызывающему потоку.
+    ///
+    /// \param block Указатель на блок.
+    template <class T, class P>
+    void CsvImporter<T, P>::Pipeline::push_ready(Block* block) {
+        {
+            std::lock_guard lock{ this->mutex_ };
+            this->ready_.push_back(block);
+        }
+        this->changed_.notify_all();
+    }
+
+    /// \brief Берет заполненный блок, дожидаясь его готовности.
+    ///
+    /// \return Указатель на блок или nullptr, если чтение завершилось
+    /// ошибкой.
+    template <class T, class P>
+    [[nodiscard]]
+    CsvImporter<T, P>::Block* CsvImporter<T, P>::Pipeline::acquire_ready() {
+        std::unique_lock lock{ this->mutex_ };
+        this->changed_.wait(lock, [this] {
+            return this->error_ || !this->ready_.empty();
+        });
+        if (this->error_)
+            return nullptr;
+        Block* block{ this->ready_.front() };
+        this->ready_.pop_front();
+        return block;
+    }
+
+    /// \brief Возвращает обработанный блок читающему потоку.
+    ///
+    /// \param block Указатель на блок.
+    template <class T, class P>
+    void CsvImporter<T, P>::Pipeline::release(Block* block) {
+        {
+            std::lock_guard lock{ this->mutex_ };
+            this->free_.push_back(block);
+        }
+        this->changed_.notify_all();
+    }
+
+    /// \brief Сохраняет исключение читающего потока.
+    ///
+    /// \param error Исключение.
+    template <class T, class P>
+    void CsvImporter<T, P>::Pipeline::fail(std::exception_ptr error) noexcept {
+        {
+            std::lock_guard lock{ this->mutex_ };
+            this->error_ = std::move(error);
+        }
+        this->changed_.notify_all();
+    }
+
+    // Останавливает читающий поток после ошибки вызывающего.
+    template <class T, class P>
+    void CsvImporter<T, P>::Pipeline::stop() noexcept {
+        {
+            std::lock_guard lock{ this->mutex_ };
+            this->stopping_ = true;
+        }
+        this->changed_.notify_all();
+    }
+
+    // Возбуждает сохраненное исключение читающего потока, если оно есть.
+    template <class T, class P>
+    void CsvImporter<T, P>::Pipeline::rethrow() {
+        std::lock_guard lock{ this->mutex_ };
+        if (this->error_)
+            std::rethrow_exception(this->error_);
+    }
+
+/* ============================== CsvImporter ============================== */
+// PRIVATE
+
+    /// \brief Разбирает строку и добавляет пару в блок.
+    ///
+    /// Поля перебираются только до последнего нужного.
+    ///
+    /// \param block Блок, которому принадлежит строка.
+    /// \param line Срез строки без '\n'.
+    template <class T, class P>
+    void CsvImporter<T, P>::parse_line(Block& block, std::string_view line) const {
+        if (!line.empty() && line.back() == '\r')
+            line.remove_suffix(1);
+        if (line.empty())
+            return;
+
+        const size_t last_column{ std::max(this->options_.key_column_,
+                                           this->options_.value_column_) };
+        std::string_view key, value;
+        bool has_key{ false }, has_value{ false };
+        const char* field{ line.data() };
+        const char* line_end{ line.data() + line.size() };
+        for (size_t column{};; column++) {
+            auto* delimiter{ static_cast<const char*>(std::memchr(
+                    field, this->options_.delimiter_,
+                    static_cast<size_t>(line_end - field))) };
+            const char* field_end{ (delimiter != nullptr) ? delimiter : line_end };
+            std::string_view current(field, static_cast<size_t>(field_end - field));
+            if (column == this->options_.key_column_) {
+                key = current;
+                has_key = true;
+            }
+            if (column == this->options_.value_column_) {
+                value = current;
+                has_value = true;
+            }
+            if (column == last_column || delimiter == nullptr)
+                break;
+            field = delimiter + 1;
+        }
+
+        T parsed{};
+        if (!has_key || !has_value || !this->parser_(value, parsed)) {
+            block.skipped_rows_++;
+            return;
+        }
+        block.items_.emplace_back(key, std::move(parsed));
+    }
+
+    /// \brief Цикл читающего потока: чтение блоков и разбор строк.
+    ///
+    /// \param in Открытый файл.
+    /// \param pipeline Очереди блоков.
+    ///
+    /// \throw std::runtime_error Исключение возбуждается при ошибке чтения.
+    template <class T, class P>
+    void CsvImporter<T, P>::read_blocks(std::ifstream& in, Pipeline& pipeline) const {
+        const size_t block_size{ std::max<size_t>(this->options_.block_size_, 1) };
+        std::vector<char> carry;
+        bool header_pending{ this->options_.has_header_ };
+        bool last{ false };
+
+        while (!last) {
+            Block* block{ pipeline.acquire_free() };
+            if (block == nullptr)
+                return;
+            if (block->buffer_.size() < carry.size() + block_size)
+                block->buffer_.resize(carry.size() + block_size);
+            std::copy(carry.begin(), carry.end(), block->buffer_.begin());
+            in.read(block->buffer_.data() + carry.size(),
+                    static_cast<std::streamsize>(block_size));
+            if (in.bad())
+                throw std::runtime_error("Cannot read the imported file.");
+            const auto read{ static_cast<size_t>(in.gcount()) };
+            last = read < block_size;
+
+            block->items_.clear();
+            block->bytes_ = read;
+            block->skipped_rows_ = 0;
+            block->last_ = last;
+
+            // В конце неполного блока - начало строки следующего блока.
+            const char* begin{ block->buffer_.data() };
+            const char* end{ begin + carry.size() + read };
+            const char* lines_end{ end };
+            if (!last) {
+                lines_end = begin;
+                for (const char* byte{ end }; byte != begin; byte--) {
+                    if (*(byte - 1) == '\n') {
+                        lines_end = byte;
+                        break;
+                    }
+                }
+            }
+
+            const char* line{ begin };
+            while (line < lines_end) {
+                auto* newline{ static_cast<const char*>(std::memchr(
+                        line, '\n', static_cast<size_t>(lines_end - line))) };
+                const char* line_end{ (newline != nullptr) ? newline : lines_end };
+                if (header_pending)
+                    header_pending = false;
+                else
+                    this->parse_line(*block, std::string_view(
+                            line, static_cast<size_t>(line_end - line)));
+                line = line_end + 1;
+            }
+            carry.assign(lines_end, end);
+            pipeline.push_ready(block);
+        }
+    }
+
+// PUBLIC
+
+    /// \brief Стандартный конструктор экземпляра класса CsvImporter.
+    ///
+    /// \param options Формат импортируемого файла.
+    /// \param parser Разбор поля значения.
+    template <class T, class P>
+    CsvImporter<T, P>::CsvImporter(const CsvImportOptions& options,
+                                   const P& parser) :
+            options_(options), parser_(parser) { }
+
+    /// \brief Импортирует файл в хеш-таблицу.
+    ///
+    /// Пары передаются в таблицу по блокам через insert_batch, поэтому
+    /// повторный ключ изменяет значение, а порядок добавления совпадает с
+    /// порядком строк файла.
+    ///
+    /// \param table Хеш-таблица с методом insert_batch(std::span<const
+    /// std::pair<std::string_view, HashType>>).
+    /// \param path Путь к файлу.
+    ///
+    /// \return Итог импорта.
+    ///
+    /// \throw std::runtime_error Исключение возбуждается, если файл не
+    /// удалось открыть или прочитать. Исключения таблицы пробрасываются
+    /// после остановки читающего потока.
+    template <class T, class P>
+    template <class Table>
+    [[maybe_unused]]
+    CsvImportResult CsvImporter<T, P>::import_file(Table& table,
+                                              const std::filesystem::path& path) {
+        std::ifstream in{ path, std::ios::binary };
+        if (!in)
+            throw std::runtime_error("Cannot open \"" + path.string() + "\".");
+
+        Pipeline pipeline;
+        std::vector<Block> blocks(PIPELINE_DEPTH);
+        for (Block& block : blocks)
+            pipeline.release(&block);
+
+        std::thread reader{ [this, &in, &pipeline] {
+            try {
+                this->read_blocks(in, pipeline);
+            }
+            catch (...) {
+                pipeline.fail(std::current_exception());
+            }
+        } };
+
+        CsvImportResult result;
+        try {
+            while (Block* block{ pipeline.acquire_ready() }) {
+                table.insert_batch(std::span<const std::pair<std::string_view, T>>(
+                        block->items_));
+                result.bytes_ += block->bytes_;
+                result.rows_ += block->items_.size();
+                result.skipped_rows_ += block->skipped_rows_;
+                bool last{ block->last_ };
+                pipeline.release(block);
+                if (last)
+                    break;
+            }
+        }
+        catch (...) {
+            pipeline.stop();
+            reader.join();
+            throw;
+        }
+        reader.join();
+        pipeline.rethrow();
+        return result;
+    }
+}
+
+#endif
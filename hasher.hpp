@@ -0,0 +1,292 @@
+/// \file hasher.hpp.
+/// \author Лошкарев Дмитрий.
+/// \date 14.10.2026.
+///
+/// \brief Содержит функции хеширования ключей хеш-таблицы.
+///
+/// \namespaces
+/// • DataStructures
+/// \classes
+/// • Djb2Hasher
+/// • WyHasher
+/// • IntegerHasher
+
+#ifndef CPPPROJECT_HASHER_H
+#define CPPPROJECT_HASHER_H
+
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+
+// Макросы для функции хеширования.
+#define HASH_CONST_D ((2.23606797749978969 - 1) / 2)
+#define HASH_CONST_I 5381
+#define HASH_CONST_I_2 33
+
+namespace DataStructures {
+    // 128-битное беззнаковое целое (расширение GNU C++) для произведений
+    // 64-битных чисел.
+    __extension__ typedef unsigned __int128 uint128_t;
+
+// Объявление классов.
+
+    /// \class Класс Djb2Hasher предоставляет исходную функцию хеширования
+    /// хеш-таблицы: 32-битный DJB2 с побайтовым проходом по строке и
+    /// мультипликативным методом Кнута.
+    ///
+    /// Сохранен для совместимости и сравнения. Вместо вычисления
+    /// fmod(key_int * HASH_CONST_D, 1) в double дробная часть берется в
+    /// формате с фиксированной точкой: произведение на KNUTH_MULTIPLIER
+    /// по модулю 2^64. Старшие биты результата задают то же
+    /// распределение по ячейкам, что и прежняя формула.
+    ///
+    /// Публичные методы:
+    /// \n • uint64_t operator () (std::string_view key) const noexcept
+    class Djb2Hasher {
+        private:
+            static inline constexpr uint64_t KNUTH_MULTIPLIER{ 0x9E3779B97F4A7C15 };  ///< \brief HASH_CONST_D · 2^64.
+        public:
+            [[nodiscard]]
+            inline uint64_t operator () (std::string_view) const noexcept;
+    };
+
+    /// \class Класс WyHasher предоставляет 64-битную функцию хеширования
+    /// строк семейства wyhash.
+    ///
+    /// Строка читается по 8 байтов, длинные строки обрабатываются тремя
+    /// независимыми потоками по 48 байтов за итерацию, которые процессор
+    /// исполняет параллельно. Каждый шаг - одно 64x64 -> 128-битное
+    /// умножение. Все биты результата равномерно распределены, поэтому
+    /// пригодны и для выбора ячейки, и для метки ячейки.
+    ///
+    /// Публичные методы:
+    /// \n • uint64_t operator () (std::string_view key) const noexcept
+    class WyHasher {
+        private:
+            static inline constexpr uint64_t SECRET[4]{ 0x2d358dccaa6c78a5,
+                                                        0x8bb84b93962eacc9,
+                                                        0x4b33a62ed433d4a3,
+                                                        0x4d5a2da51de1aa47 };  ///< \brief Константы перемешивания.
+
+            uint64_t seed_;  ///< \brief Зерно хеширования.
+
+            [[nodiscard]]
+            static inline uint64_t mix(const uint64_t&,
+                                       const uint64_t&) noexcept;
+            [[nodiscard]]
+            static inline uint64_t read8(const unsigned char*) noexcept;
+            [[nodiscard]]
+            static inline uint64_t read4(const unsigned char*) noexcept;
+            [[nodiscard]]
+            static inline uint64_t read3(const unsigned char*,
+                                         const size_t&) noexcept;
+        public:
+            explicit WyHasher(const uint64_t& = 0) noexcept;
+
+            [[nodiscard]]
+            inline uint64_t operator () (std::string_view) const noexcept;
+    };
+
+    /// \class Класс IntegerHasher предоставляет функцию хеширования
+    /// целочисленных и других trivially copyable ключей.
+    ///
+    /// Ключ до 8 байтов читается как одно число и перемешивается одним
+    /// 128-битным умножением, без прохода по байтам. Более длинные ключи
+    /// хешируются WyHasher по байтам представления. Байты представления
+    /// должны однозначно задавать значение (без битов выравнивания и
+    /// чисел с плавающей точкой).
+    ///
+    /// Публичные методы:
+    /// \n • uint64_t operator () (const Key& key) const noexcept
+    class IntegerHasher {
+        private:
+            static inline constexpr uint64_t SECRET[2]{ 0x2d358dccaa6c78a5,
+                                                        0x8bb84b93962eacc9 };  ///< \brief Константы перемешивания.
+
+            uint64_t seed_;  ///< \brief Зерно хеширования.
+        public:
+            explicit IntegerHasher(const uint64_t& = 0) noexcept;
+
+            template <class Key>
+            [[nodiscard]]
+            inline uint64_t operator () (const Key&) const noexcept;
+    };
+
+// Определения методов классов.
+/* =============================== Djb2Hasher =============================== */
+
+    /// \brief Высчитывает хеш строки.
+    ///
+    /// \param key Строковый ключ, который необходимо захешировать.
+    ///
+    /// \return uint64-значение хеша.
+    [[nodiscard]]
+    inline uint64_t Djb2Hasher::operator () (std::string_view key)
+    const noexcept {
+        uint32_t key_int{ HASH_CONST_I };
+        // Хеширование строки в число.
+        for (const char& i : key)
+            key_int = HASH_CONST_I_2 * key_int + static_cast<unsigned char>(i);
+        return key_int * KNUTH_MULTIPLIER;
+    }
+
+/* ================================ WyHasher ================================ */
+// PRIVATE
+
+    /// \brief Перемешивает два числа через 128-битное произведение.
+    ///
+    /// \param a Первый множитель.
+    /// \param b Второй множитель.
+    ///
+    /// \return Сумма по модулю 2 младшей и старшей половин произведения.
+    [[nodiscard]]
+    inline uint64_t WyHasher::mix(const uint64_t& a,
+                                  const uint64_t& b) noexcept {
+        uint128_t product{ static_cast<uint128_t>(a) * b };
+        return static_cast<uint64_t>(product) ^
+               static_cast<uint64_t>(product >> 64);
+    }
+
+    /// \brief Читает 8 байтов строки как число.
+    ///
+    /// \param ptr Указатель на первый байт.
+    ///
+    /// \return Прочитанное значение.
+    [[nodiscard]]
+    inline uint64_t WyHasher::read8(const unsigned char* ptr) noexcept {
+        uint64_t value;
+        std::memcpy(&value, ptr, sizeof(value));
+        return value;
+    }
+
+    /// \brief Читает 4 байта строки как число.
+    ///
+    /// \param ptr Указатель на первый байт.
+    ///
+    /// \return Прочитанное значение.
+    [[nodiscard]]
+    inline uint64_t WyHasher::read4(const unsigned char* ptr) noexcept {
+        uint32_t value;
+        std::memcpy(&value, ptr, sizeof(value));
+        return value;
+    }
+
+    /// \brief Собирает число из первого, среднего и последнего байтов
+    /// короткой (1-3 байта) строки.
+    ///
+    /// \param ptr Указатель на первый байт.
+    /// \param length Длина строки.
+    ///
+    /// \return Собранное значение.
+    [[nodiscard]]
+    inline uint64_t WyHasher::read3(const unsigned char* ptr,
+                                    const size_t& length) noexcept {
+        return (static_cast<uint64_t>(ptr[0]) << 16) |
+               (static_cast<uint64_t>(ptr[length >> 1]) << 8) |
+               ptr[length - 1];
+    }
+
+// PUBLIC
+
+    /// \brief Стандартный конструктор экземпляра класса WyHasher.
+    ///
+    /// \param seed Зерно хеширования. Разные зерна дают независимые
+    /// функции хеширования.
+    inline WyHasher::WyHasher(const uint64_t& seed) noexcept : seed_(seed) { }
+
+    /// \brief Высчитывает хеш строки.
+    ///
+    /// \param key Строковый ключ, который необходимо захешировать.
+    ///
+    /// \return uint64-значение хеша.
+    [[nodiscard]]
+    inline uint64_t WyHasher::operator () (std::string_view key)
+    const noexcept {
+        const auto* ptr{ reinterpret_cast<const unsigned char*>(key.data()) };
+        size_t length{ key.size() };
+        uint64_t seed{ this->seed_ ^ mix(this->seed_ ^ SECRET[0], SECRET[1]) };
+        uint64_t a, b;
+
+        if (length <= 16) {
+            if (length >= 4) {
+                size_t shift{ (length >> 3) << 2 };
+                a = (read4(ptr) << 32) | read4(ptr + shift);
+                b = (read4(ptr + length - 4) << 32) |
+                    read4(ptr + length - 4 - shift);
+            }
+            else if (length > 0) {
+                a = read3(ptr, length);
+                b = 0;
+            }
+            else
+                a = b = 0;
+        }
+        else {
+            size_t left{ length };
+            // Три независимых потока перемешивания по 16 байтов каждый.
+            if (left > 48) {
+                uint64_t seed_1{ seed }, seed_2{ seed };
+                do {
+                    seed = mix(read8(ptr) ^ SECRET[1], read8(ptr + 8) ^ seed);
+                    seed_1 = mix(read8(ptr + 16) ^ SECRET[2],
+                                 read8(ptr + 24) ^ seed_1);
+                    seed_2 = mix(read8(ptr + 32) ^ SECRET[3],
+                                 read8(ptr + 40) ^ seed_2);
+                    ptr += 48;
+                    left -= 48;
+                } while (left > 48);
+                seed ^= seed_1 ^ seed_2;
+            }
+            while (left > 16) {
+                seed = mix(read8(ptr) ^ SECRET[1], read8(ptr + 8) ^ seed);
+                ptr += 16;
+                left -= 16;
+            }
+            a = read8(ptr + left - 16);
+            b = read8(ptr + left - 8);
+        }
+
+        a ^= SECRET[1];
+        b ^= seed;
+        uint128_t product{ static_cast<uint128_t>(a) * b };
+        a = static_cast<uint64_t>(product);
+        b = static_cast<uint64_t>(product >> 64);
+        return mix(a ^ SECRET[0] ^ length, b ^ SECRET[1]);
+    }
+
+/* ============================== IntegerHasher ============================== */
+
+    /// \brief Стандартный конструктор экземпляра класса IntegerHasher.
+    ///
+    /// \param seed Зерно хеширования.
+    inline IntegerHasher::IntegerHasher(const uint64_t& seed) noexcept :
+            seed_(seed) { }
+
+    /// \brief Высчитывает хеш ключа.
+    ///
+    /// \param key Ключ, который необходимо захешировать.
+    ///
+    /// \return uint64-значение хеша.
+    template <class Key>
+    [[nodiscard]]
+    inline uint64_t IntegerHasher::operator () (const Key& key) const noexcept {
+        static_assert(std::is_trivially_copyable_v<Key> &&
+                      std::has_unique_object_representations_v<Key>,
+                      "Key bytes must uniquely represent its value.");
+
+        if constexpr (sizeof(Key) <= sizeof(uint64_t)) {
+            uint64_t value{};
+            std::memcpy(&value, &key, sizeof(Key));
+            uint128_t product{ static_cast<uint128_t>(value ^ this->seed_ ^ SECRET[0]) *
+                               (SECRET[1] ^ sizeof(Key)) };
+            return static_cast<uint64_t>(product) ^
+                   static_cast<uint64_t>(product >> 64);
+        }
+        else
+            return WyHasher(this->seed_)(std::string_view(
+                    reinterpret_cast<const char*>(&key), sizeof(Key)));
+    }
+}
+
+#endif
@@ -0,0 +1,145 @@
+/// \file hashstats.hpp.
+/// \author Лошкарев Дмитрий.
+/// \date 14.10.2026.
+///
+/// \brief Содержит статистику работы хеш-таблицы: длины цепочек и
+/// поиска, заполненность, расширения, выделения памяти.
+///
+/// Счетчики ведутся, только если определен макрос ORDERHASHTABLE_STATS
+/// (опция CMake ORDERHASHTABLE_STATS); без него OrderedHashTable не
+/// содержит ни счетчиков, ни метода stats().
+///
+/// \namespaces
+/// • DataStructures
+/// \classes
+/// • HashTableStats
+/// • HashTableCounters
+
+#ifndef CPPPROJECT_HASHSTATS_H
+#define CPPPROJECT_HASHSTATS_H
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace DataStructures {
+// Объявление классов.
+
+    /// \class Структура HashTableStats описывает снимок статистики
+    /// хеш-таблицы, возвращаемый OrderedHashTable::stats().
+    ///
+    /// Гистограмма и объем памяти вычисляются при вызове stats() обходом
+    /// хранилища, счетчики поиска, расширений и выделений накапливаются
+    /// операциями таблицы.
+    struct HashTableStats {
+        static inline constexpr size_t HISTOGRAM_SIZE{ 16 };  ///< \brief Количество корзин гистограммы.
+
+        std::array<uint64_t, HISTOGRAM_SIZE> chain_lengths_{};  ///< \brief Гистограмма длин цепочек.
+                                                                ///<
+                                                                ///< Для цепочек - количество ячеек
+                                                                ///< с цепочкой длины i, для открытой
+                                                                ///< адресации - количество записей,
+                                                                ///< смещенных на i групп. Последняя
+                                                                ///< корзина считает и все большие.
+        uint64_t get_count_{};                ///< \brief Количество вызовов get().
+        double average_probe_length_{};       ///< \brief Средняя длина поиска в get().
+        uint64_t max_probe_length_{};         ///< \brief Наибольшая длина поиска в get().
+        double load_factor_{};                ///< \brief Отношение количества ключей
+                                              ///< к размеру таблицы.
+        double max_load_factor_{};            ///< \brief Заполненность, при которой таблица
+                                              ///< расширяется (GrowthPolicy::max_load_factor_).
+        uint64_t expand_count_{};             ///< \brief Количество расширений.
+        uint64_t last_expand_nanoseconds_{};  ///< \brief Длительность последнего расширения.
+        uint64_t max_expand_nanoseconds_{};   ///< \brief Длительность самого долгого расширения.
+        uint64_t total_expand_nanoseconds_{}; ///< \brief Суммарная длительность расширений.
+        uint64_t allocation_count_{};         ///< \brief Выделения записей и хранилищ.
+        uint64_t deallocation_count_{};       ///< \brief Освобождения записей и хранилищ.
+        size_t memory_bytes_{};               ///< \brief Память таблицы, записей, строковых
+                                              ///< ключей и хранилищ в байтах.
+    };
+
+    /// \class Класс HashTableCounters накапливает счетчики горячих путей
+    /// хеш-таблицы. Счетчики не атомарны: как и сама таблица, они
+    /// рассчитаны на работу из одного потока.
+    ///
+    /// Публичные методы:
+    /// \n • void count_get(const size_t& probes) noexcept;
+    /// \n • void count_expand(const std::chrono::nanoseconds& duration) noexcept;
+    /// \n • void count_allocation() noexcept;
+    /// \n • void count_deallocation() noexcept;
+    /// \n • void fill(HashTableStats& stats) const noexcept.
+    class HashTableCounters {
+        private:
+            uint64_t get_count_{};
+            uint64_t probe_total_{};       ///< \brief Сумма длин поиска в get().
+            uint64_t probe_max_{};
+            uint64_t expand_count_{};
+            uint64_t expand_last_{};       ///< \brief Длительности расширений в нс.
+            uint64_t expand_max_{};
+            uint64_t expand_total_{};
+            uint64_t allocation_count_{};
+            uint64_t deallocation_count_{};
+        public:
+            inline void count_get(const size_t&) noexcept;
+            inline void count_expand(const std::chrono::nanoseconds&) noexcept;
+            inline void count_allocation() noexcept;
+            inline void count_deallocation() noexcept;
+            inline void fill(HashTableStats&) const noexcept;
+    };
+
+// Определения методов классов.
+/* ============================ HashTableCounters ============================ */
+
+    /// \brief Учитывает поиск ключа методом get().
+    ///
+    /// \param probes Длина поиска: просмотренные записи цепочки или
+    /// группы ячеек открытой адресации.
+    inline void HashTableCounters::count_get(const size_t& probes) noexcept {
+        this->get_count_++;
+        this->probe_total_ += probes;
+        this->probe_max_ = std::max<uint64_t>(this->probe_max_, probes);
+    }
+
+    /// \brief Учитывает расширение таблицы.
+    ///
+    /// \param duration Длительность расширения.
+    inline void HashTableCounters::count_expand(
+            const std::chrono::nanoseconds& duration) noexcept {
+        auto nanoseconds{ static_cast<uint64_t>(duration.count()) };
+        this->expand_count_++;
+        this->expand_last_ = nanoseconds;
+        this->expand_max_ = std::max(this->expand_max_, nanoseconds);
+        this->expand_total_ += nanoseconds;
+    }
+
+    /// \brief Учитывает выделение записи или хранилища.
+    inline void HashTableCounters::count_allocation() noexcept {
+        this->allocation_count_++;
+    }
+
+    /// \brief Учитывает освобождение записи или хранилища.
+    inline void HashTableCounters::count_deallocation() noexcept {
+        this->deallocation_count_++;
+    }
+
+    /// \brief Переносит накопленные счетчики в снимок статистики.
+    ///
+    /// \param stats Заполняемый снимок.
+    inline void HashTableCounters::fill(HashTableStats& stats) const noexcept {
+        stats.get_count_ = this->get_count_;
+        stats.average_probe_length_ = (this->get_count_ == 0) ? 0.0 :
+                static_cast<double>(this->probe_total_) /
+                static_cast<double>(this->get_count_);
+        stats.max_probe_length_ = this->probe_max_;
+        stats.expand_count_ = this->expand_count_;
+        stats.last_expand_nanoseconds_ = this->expand_last_;
+        stats.max_expand_nanoseconds_ = this->expand_max_;
+        stats.total_expand_nanoseconds_ = this->expand_total_;
+        stats.allocation_count_ = this->allocation_count_;
+        stats.deallocation_count_ = this->deallocation_count_;
+    }
+}
+
+#endif
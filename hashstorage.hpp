@@ -0,0 +1,963 @@
+/// \file hashstorage.hpp.
+/// \author Лошкарев Дмитрий.
+/// \date 14.10.2026.
+///
+/// \brief Содержит политики хранения записей хеш-таблицы.
+///
+/// \namespaces
+/// • DataStructures
+/// \classes
+/// • BasicChainedStorage
+/// • OpenAddressingStorage
+
+#ifndef CPPPROJECT_HASHSTORAGE_H
+#define CPPPROJECT_HASHSTORAGE_H
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "list.hpp"
+#include "chunkedlist.hpp"
+#include "hasher.hpp"
+#include "threadpool.hpp"
+
+namespace DataStructures {
+// Вспомогательные функции.
+
+    /// \brief Отображает хеш ключа на индекс ячейки массива.
+    ///
+    /// Хеш рассматривается как дробь hash / 2^64, умножаемая на размер
+    /// массива (fastrange): одно целочисленное умножение вместо ceil и
+    /// fmod в double, причем размер не обязан быть степенью двойки.
+    /// Индекс определяется старшими битами хеша, младшие остаются для
+    /// меток ячеек.
+    ///
+    /// \param hash Числовое значение хеша ключа.
+    /// \param size Размер массива, на который отображается хеш.
+    ///
+    /// \return Индекс ячейки в пределах [0, size).
+    inline uint64_t bucket_index(const uint64_t& hash,
+                                 const size_t& size) noexcept {
+        return static_cast<uint64_t>(
+                (static_cast<uint128_t>(hash) * size) >> 64);
+    }
+
+// Объявление классов.
+
+    /// \class Политика BasicChainedStorage описывает хранение записей
+    /// методом цепочек: каждая ячейка массива - список указателей на
+    /// записи, попавшие в нее. Списки лежат в массиве подряд. Для List при
+    /// перехешировании узлы перевешиваются, а не создаются заново;
+    /// ChunkedList хранит указатели цепочки подряд в блоках, и ее перебор
+    /// не переходит по указателю на каждом элементе.
+    ///
+    /// Любая политика хранения предоставляет шаблонный класс Engine,
+    /// параметризуемый типом записи и аллокатором, из которого берется
+    /// память под ячейки. Запись обязана иметь методы key() и
+    /// hash(), возвращающие ключ и сохраненный в записи хеш, и тип
+    /// KeyArgument, в котором ключ передается для поиска. Ключи
+    /// сравниваются только после совпадения хешей. Константа
+    /// MAX_LOAD_FACTOR ограничивает коэффициент заполнения, который
+    /// хеш-таблица может задать хранилищу. Публичные методы
+    /// Engine:
+    /// \n • RecordType* find(KeyArgument, const uint64_t&) const noexcept;
+    /// \n • RecordType* find(KeyArgument, const uint64_t&, size_t&) const noexcept;
+    /// \n • void insert(RecordType*, const uint64_t&);
+    /// \n • RecordType* remove(KeyArgument, const uint64_t&);
+    /// \n • size_t transfer(const size_t&, const size_t&, Engine&);
+    /// \n • void insert_all(std::span<RecordType* const>, ThreadPool&);
+    /// \n • void transfer_all(Engine&, ThreadPool&);
+    /// \n • void prefetch(const uint64_t&) const noexcept;
+    /// \n • bool overloaded() const noexcept;
+    /// \n • size_t capacity() const noexcept;
+    /// \n • void probe_histogram(std::span<uint64_t>) const noexcept;
+    /// \n • size_t memory_usage() const noexcept.
+    ///
+    /// \tparam Container Шаблон списка ячейки с интерфейсом List:
+    /// List или ChunkedList.
+    template <template <class, class> class Container>
+    struct BasicChainedStorage {
+        template <class RecordType, class Allocator>
+        class Engine {
+            private:
+                static inline constexpr size_t PARALLEL_MIN_SIZE{ 1 << 14 };  ///< \brief Количество ячеек, начиная
+                                                                              ///< с которого перенос делится
+                                                                              ///< между потоками.
+                static inline constexpr size_t TASKS_PER_THREAD{ 4 };         ///< \brief Количество задач на поток
+                                                                              ///< при разделении работы.
+
+                using Bucket = Container<RecordType*, typename std::allocator_traits<
+                        Allocator>::template rebind_alloc<RecordType*>>;
+                using BucketAllocator = typename std::allocator_traits<
+                        Allocator>::template rebind_alloc<Bucket>;
+                using BucketTraits = std::allocator_traits<BucketAllocator>;
+                using KeyArgument = typename RecordType::KeyArgument;
+
+                size_t size_;                  ///< \brief Количество ячеек.
+                [[no_unique_address]] BucketAllocator allocator_;
+                Bucket* buckets_;              ///< \brief Массив списков указателей
+                                               ///< на записи.
+            public:
+                static inline constexpr double MAX_LOAD_FACTOR{
+                        std::numeric_limits<double>::infinity() };  ///< \brief Цепочки не ограничивают
+                                                                    ///< заполнение.
+
+                explicit Engine(const size_t&, const Allocator&);
+                Engine(const Engine&) = delete;
+                Engine& operator = (const Engine&) = delete;
+                ~Engine();
+
+                [[nodiscard]]
+                RecordType* find(KeyArgument,
+                                 const uint64_t&) const noexcept;
+                [[nodiscard]]
+                RecordType* find(KeyArgument, const uint64_t&,
+                                 size_t&) const noexcept;
+                void insert(RecordType*, const uint64_t&);
+                RecordType* remove(KeyArgument, const uint64_t&);
+                size_t transfer(const size_t&, const size_t&, Engine&);
+                void insert_all(std::span<RecordType* const>, ThreadPool&);
+                void transfer_all(Engine&, ThreadPool&);
+                inline void prefetch(const uint64_t&) const noexcept;
+
+                [[nodiscard]]
+                inline bool overloaded() const noexcept;
+                [[nodiscard]] [[maybe_unused]]
+                inline size_t capacity() const noexcept;
+                [[maybe_unused]]
+                void probe_histogram(std::span<uint64_t>) const noexcept;
+                [[nodiscard]] [[maybe_unused]]
+                size_t memory_usage() const noexcept;
+        };
+    };
+
+    /// \brief Хранение цепочками в двусвязных списках List.
+    using ChainedStorage = BasicChainedStorage<List>;
+    /// \brief Хранение цепочками в развернутых списках ChunkedList.
+    using ChunkedChainedStorage = BasicChainedStorage<ChunkedList>;
+
+    /// \class Политика OpenAddressingStorage описывает хранение записей
+    /// методом открытой адресации (в духе Swiss table): плоский массив
+    /// указателей на записи и параллельный ему массив управляющих байтов.
+    ///
+    /// Управляющий байт свободной ячейки равен CTRL_EMPTY, удаленной -
+    /// CTRL_DELETED, занятой - 7-битной метке из хеша ключа. Поиск сравнивает
+    /// метки сразу группой из GROUP_WIDTH байтов и обращается к записи
+    /// только при совпадении метки. Зондирование линейное, по группам.
+    struct OpenAddressingStorage {
+        template <class RecordType, class Allocator>
+        class Engine {
+            private:
+                static inline constexpr size_t GROUP_WIDTH{ 16 };       ///< \brief Ширина группы управляющих байтов.
+                static inline constexpr int8_t CTRL_EMPTY{ -128 };      ///< \brief Метка свободной ячейки.
+                static inline constexpr int8_t CTRL_DELETED{ -2 };      ///< \brief Метка удаленной ячейки.
+                static inline constexpr double MAX_FILL_PERCENT{ 0.875 };  ///< \brief Допустимая доля занятых
+                                                                           ///< и удаленных ячеек.
+                static inline constexpr size_t PARALLEL_MIN_SIZE{ 1 << 14 };  ///< \brief Количество записей или
+                                                                              ///< ячеек, начиная с которого
+                                                                              ///< работа делится между потоками.
+                static inline constexpr size_t TASKS_PER_THREAD{ 4 };         ///< \brief Количество задач на поток
+                                                                              ///< при разделении работы.
+
+                using SlotAllocator = typename std::allocator_traits<
+                        Allocator>::template rebind_alloc<RecordType*>;
+                using SlotTraits = std::allocator_traits<SlotAllocator>;
+                using KeyArgument = typename RecordType::KeyArgument;
+
+                size_t capacity_;      ///< \brief Количество ячеек.
+                size_t used_;          ///< \brief Количество занятых и удаленных ячеек.
+                [[no_unique_address]] SlotAllocator allocator_;
+                RecordType** slots_;   ///< \brief Массив указателей на записи.
+                                       ///<
+                                       ///< Управляющие байты размещаются в том же
+                                       ///< блоке памяти сразу за ним.
+                int8_t* ctrl_;         ///< \brief Управляющие байты.
+                                       ///<
+                                       ///< Первые GROUP_WIDTH - 1 байтов продублированы
+                                       ///< в конце массива, чтобы группа у границы
+                                       ///< читалась одним обращением.
+
+                [[nodiscard]]
+                static inline int8_t tag(const uint64_t&) noexcept;
+                [[nodiscard]]
+                inline uint32_t match(const size_t&,
+                                      const int8_t&) const noexcept;
+                [[nodiscard]]
+                inline uint32_t match_empty(const size_t&) const noexcept;
+                [[nodiscard]]
+                inline uint32_t match_free(const size_t&) const noexcept;
+                inline void set_ctrl(const size_t&, const int8_t&) noexcept;
+                [[nodiscard]]
+                size_t find_index(KeyArgument, const uint64_t&,
+                                  size_t&) const noexcept;
+                [[nodiscard]]
+                inline size_t block_length() const noexcept;
+            public:
+                static inline constexpr double MAX_LOAD_FACTOR{ MAX_FILL_PERCENT };  ///< \brief Заполнение, при котором
+                                                                                     ///< хранилище перестраивается.
+
+                explicit Engine(const size_t&, const Allocator&);
+                Engine(const Engine&) = delete;
+                Engine& operator = (const Engine&) = delete;
+                ~Engine();
+
+                [[nodiscard]]
+                RecordType* find(KeyArgument,
+                                 const uint64_t&) const noexcept;
+                [[nodiscard]]
+                RecordType* find(KeyArgument, const uint64_t&,
+                                 size_t&) const noexcept;
+                void insert(RecordType*, const uint64_t&);
+                RecordType* remove(KeyArgument, const uint64_t&);
+                size_t transfer(const size_t&, const size_t&, Engine&);
+                void insert_all(std::span<RecordType* const>, ThreadPool&);
+                void transfer_all(Engine&, ThreadPool&);
+                inline void prefetch(const uint64_t&) const noexcept;
+
+                [[nodiscard]]
+                inline bool overloaded() const noexcept;
+                [[nodiscard]] [[maybe_unused]]
+                inline size_t capacity() const noexcept;
+                [[maybe_unused]]
+                void probe_histogram(std::span<uint64_t>) const noexcept;
+                [[nodiscard]] [[maybe_unused]]
+                size_t memory_usage() const noexcept;
+        };
+    };
+
+// Определения методов классов.
+/* ========================== BasicChainedStorage ========================== */
+
+    /// \brief Стандартный конструктор экземпляра класса
+    /// BasicChainedStorage::Engine.
+    ///
+    /// Массив списков размещается одним блоком памяти аллокатора, а все
+    /// списки берут узлы из того же аллокатора.
+    ///
+    /// \param size Количество ячеек-списков.
+    /// \param allocator Аллокатор хеш-таблицы.
+    template <template <class, class> class C>
+    template <class R, class A>
+    BasicChainedStorage<C>::Engine<R, A>::Engine(const size_t& size,
+                                         const A& allocator) :
+            size_(size), allocator_(allocator),
+            buckets_(BucketTraits::allocate(this->allocator_, size)) {
+        // Списки создаются напрямую: allocator_traits::construct для
+        // std::pmr::polymorphic_allocator передал бы списку аллокатор повторно.
+        typename Bucket::allocator_type bucket_allocator(allocator);
+        for (size_t item{}; item < this->size_; item++)
+            std::construct_at(this->buckets_ + item, bucket_allocator);
+    }
+
+    // Стандартный деструктор экземпляра. Записи не удаляются - ими владеет
+    // хеш-таблица.
+    template <template <class, class> class C>
+    template <class R, class A>
+    BasicChainedStorage<C>::Engine<R, A>::~Engine() {
+        for (size_t item{}; item < this->size_; item++)
+            std::destroy_at(this->buckets_ + item);
+        BucketTraits::deallocate(this->allocator_, this->buckets_, this->size_);
+    }
+
+    /// \brief Ищет запись с указанным ключом.
+    ///
+    /// \param key Ключ записи.
+    /// \param hash Хеш ключа.
+    ///
+    /// \return Указатель на запись или nullptr, если ее нет.
+    template <template <class, class> class C>
+    template <class R, class A>
+    R* BasicChainedStorage<C>::Engine<R, A>::find(KeyArgument key,
+                                       const uint64_t& hash) const noexcept {
+        size_t probes;
+        return this->find(key, hash, probes);
+    }
+
+    /// \brief Ищет запись с указанным ключом и считает длину поиска.
+    ///
+    /// \param key Ключ записи.
+    /// \param hash Хеш ключа.
+    /// \param probes Количество просмотренных записей цепочки.
+    ///
+    /// \return Указатель на запись или nullptr, если ее нет.
+    template <template <class, class> class C>
+    template <class R, class A>
+    R* BasicChainedStorage<C>::Engine<R, A>::find(KeyArgument key,
+                                       const uint64_t& hash,
+                                       size_t& probes) const noexcept {
+        const Bucket& table_cell{
+                this->buckets_[bucket_index(hash, this->size_)] };
+        probes = 0;
+        for (auto it{ table_cell.begin() }; it != table_cell.end(); ++it) {
+            probes++;
+            if ((*it)->hash() == hash && (*it)->key() == key)
+                return *it;
+        }
+        return nullptr;
+    }
+
+    /// \brief Добавляет запись, ключа которой еще нет в хранилище.
+    ///
+    /// \param record Указатель на запись.
+    /// \param hash Хеш ключа записи.
+    template <template <class, class> class C>
+    template <class R, class A>
+    void BasicChainedStorage<C>::Engine<R, A>::insert(R* record, const uint64_t& hash) {
+        this->buckets_[bucket_index(hash, this->size_)].push_back(record);
+    }
+
+    /// \brief Исключает запись с указанным ключом из хранилища.
+    ///
+    /// \param key Ключ записи.
+    /// \param hash Хеш ключа.
+    ///
+    /// \return Указатель на исключенную запись или nullptr, если ее нет.
+    template <template <class, class> class C>
+    template <class R, class A>
+    R* BasicChainedStorage<C>::Engine<R, A>::remove(KeyArgument key,
+                                         const uint64_t& hash) {
+        Bucket& table_cell{ this->buckets_[bucket_index(hash, this->size_)] };
+        for (auto it{ table_cell.begin() }; it != table_cell.end(); ++it) {
+            if ((*it)->hash() == hash && (*it)->key() == key) {
+                R* record{ *it };
+                table_cell.erase(it);
+                return record;
+            }
+        }
+        return nullptr;
+    }
+
+    /// \brief Переносит записи из диапазона ячеек в другое хранилище.
+    ///
+    /// Узлы списков перевешиваются в ячейки другого хранилища без
+    /// выделения памяти; перенесенные ячейки становятся пустыми.
+    ///
+    /// \param from Индекс первой переносимой ячейки.
+    /// \param count Количество переносимых ячеек.
+    /// \param dest Хранилище, в которое переносятся записи.
+    ///
+    /// \return Индекс первой еще не перенесенной ячейки.
+    template <template <class, class> class C>
+    template <class R, class A>
+    size_t BasicChainedStorage<C>::Engine<R, A>::transfer(const size_t& from,
+                                               const size_t& count,
+                                               Engine& dest) {
+        size_t to{ (from + count > this->size_) ? this->size_ : from + count };
+        for (size_t item{ from }; item < to; item++) {
+            Bucket& table_cell{ this->buckets_[item] };
+            while (table_cell.length() != 0) {
+                R* record{ *table_cell.begin() };
+                dest.buckets_[bucket_index(record->hash(), dest.size_)]
+                        .splice_back(table_cell);
+            }
+        }
+        return to;
+    }
+
+    /// \brief Добавляет набор записей, ключей которых еще нет в хранилище.
+    ///
+    /// Узлы списков выделяются из общего аллокатора хеш-таблицы, который
+    /// не рассчитан на одновременную работу потоков, поэтому записи
+    /// добавляются в вызывающем потоке.
+    ///
+    /// \param records Указатели на добавляемые записи.
+    template <template <class, class> class C>
+    template <class R, class A>
+    void BasicChainedStorage<C>::Engine<R, A>::insert_all(std::span<R* const> records,
+                                                  ThreadPool&) {
+        for (R* record : records)
+            this->insert(record, record->hash());
+    }
+
+    /// \brief Переносит все записи в другое хранилище несколькими потоками.
+    ///
+    /// Если размер нового хранилища кратен размеру текущего, записи ячейки
+    /// i попадают только в ячейки [i * k, (i + 1) * k) нового хранилища
+    /// (индекс определяется старшими битами хеша). Тогда непересекающиеся
+    /// диапазоны ячеек переносятся разными потоками, а узлы перевешиваются
+    /// без выделения памяти. Иначе, а также для списков, перенос между
+    /// которыми выделяет память (ChunkedList), перенос выполняется в
+    /// вызывающем потоке.
+    ///
+    /// \param dest Хранилище, в которое переносятся записи.
+    /// \param pool Пул потоков.
+    template <template <class, class> class C>
+    template <class R, class A>
+    void BasicChainedStorage<C>::Engine<R, A>::transfer_all(Engine& dest,
+                                                    ThreadPool& pool) {
+        constexpr bool relinks{ noexcept(std::declval<Bucket&>().splice_back(
+                std::declval<Bucket&>())) };
+        if (!relinks || dest.size_ % this->size_ != 0 ||
+            this->size_ < PARALLEL_MIN_SIZE || pool.size() == 1) {
+            this->transfer(0, this->size_, dest);
+            return;
+        }
+        size_t task_count{ std::min(pool.size() * TASKS_PER_THREAD, this->size_) };
+        pool.run(task_count, [this, &dest, &task_count](size_t task) {
+            size_t from{ this->size_ * task / task_count };
+            size_t to{ this->size_ * (task + 1) / task_count };
+            this->transfer(from, to - from, dest);
+        });
+    }
+
+    /// \brief Заранее подгружает в кеш ячейку, в которую попадает хеш.
+    ///
+    /// Позволяет совместить ожидание памяти для нескольких ключей, прежде
+    /// чем искать их по очереди.
+    ///
+    /// \param hash Хеш ключа.
+    template <template <class, class> class C>
+    template <class R, class A>
+    inline void BasicChainedStorage<C>::Engine<R, A>::prefetch(const uint64_t& hash)
+    const noexcept {
+        __builtin_prefetch(this->buckets_ + bucket_index(hash, this->size_));
+    }
+
+    /// \brief Сообщает, что хранилищу требуется перестроение.
+    ///
+    /// Цепочки не накапливают удаленных ячеек, поэтому перестроение
+    /// требуется только при росте таблицы.
+    ///
+    /// \return Всегда false.
+    template <template <class, class> class C>
+    template <class R, class A>
+    [[nodiscard]]
+    inline bool BasicChainedStorage<C>::Engine<R, A>::overloaded() const noexcept {
+        return false;
+    }
+
+    /// \brief Предоставляет доступ к количеству ячеек.
+    ///
+    /// \return Значение кол-ва ячеек.
+    template <template <class, class> class C>
+    template <class R, class A>
+    [[nodiscard]] [[maybe_unused]]
+    inline size_t BasicChainedStorage<C>::Engine<R, A>::capacity() const noexcept {
+        return this->size_;
+    }
+
+    /// \brief Строит гистограмму длин цепочек.
+    ///
+    /// \param histogram Счетчики ячеек: i-й элемент увеличивается для каждой
+    /// ячейки с цепочкой длины i, последний - и для всех более длинных.
+    template <template <class, class> class C>
+    template <class R, class A>
+    [[maybe_unused]]
+    void BasicChainedStorage<C>::Engine<R, A>::probe_histogram(
+            std::span<uint64_t> histogram) const noexcept {
+        if (histogram.empty())
+            return;
+        for (size_t item{}; item < this->size_; item++)
+            histogram[std::min(this->buckets_[item].length(),
+                               histogram.size() - 1)]++;
+    }
+
+    /// \brief Определяет объем памяти, занятой массивом ячеек и узлами
+    /// цепочек.
+    ///
+    /// \return Количество байтов.
+    template <template <class, class> class C>
+    template <class R, class A>
+    [[nodiscard]] [[maybe_unused]]
+    size_t BasicChainedStorage<C>::Engine<R, A>::memory_usage() const noexcept {
+        size_t bytes{ this->size_ * sizeof(Bucket) };
+        for (size_t item{}; item < this->size_; item++)
+            bytes += this->buckets_[item].memory_usage();
+        return bytes;
+    }
+
+/* ========================= OpenAddressingStorage ========================= */
+// PRIVATE
+
+    /// \brief Выделяет из хеша 7-битную метку для управляющего байта.
+    ///
+    /// \param hash Хеш ключа.
+    ///
+    /// \return Неотрицательное значение метки.
+    template <class R, class A>
+    [[nodiscard]]
+    inline int8_t OpenAddressingStorage::Engine<R, A>::tag(const uint64_t& hash)
+    noexcept {
+        return static_cast<int8_t>(hash & 0x7F);
+    }
+
+    /// \brief Ищет в группе управляющих байтов заданное значение.
+    ///
+    /// \param pos Индекс первого байта группы.
+    /// \param value Искомое значение байта.
+    ///
+    /// \return Битовая маска: i-й бит выставлен, если байт pos + i совпал.
+    template <class R, class A>
+    [[nodiscard]]
+    inline uint32_t OpenAddressingStorage::Engine<R, A>::match(const size_t& pos,
+                                                            const int8_t& value)
+    const noexcept {
+#if defined(__SSE2__)
+        __m128i group{ _mm_loadu_si128(
+                reinterpret_cast<const __m128i*>(this->ctrl_ + pos)) };
+        return static_cast<uint32_t>(_mm_movemask_epi8(
+                _mm_cmpeq_epi8(group, _mm_set1_epi8(value))));
+#else
+        uint32_t mask{};
+        for (size_t i{}; i < GROUP_WIDTH; i++)
+            if (this->ctrl_[pos + i] == value)
+                mask |= (1U << i);
+        return mask;
+#endif
+    }
+
+    /// \brief Ищет в группе свободные ячейки.
+    ///
+    /// \param pos Индекс первого байта группы.
+    ///
+    /// \return Битовая маска свободных ячеек группы.
+    template <class R, class A>
+    [[nodiscard]]
+    inline uint32_t OpenAddressingStorage::Engine<R, A>::match_empty(
+            const size_t& pos) const noexcept {
+        return this->match(pos, CTRL_EMPTY);
+    }
+
+    /// \brief Ищет в группе ячейки, пригодные для вставки (свободные
+    /// или удаленные).
+    ///
+    /// \param pos Индекс первого байта группы.
+    ///
+    /// \return Битовая маска пригодных ячеек группы.
+    template <class R, class A>
+    [[nodiscard]]
+    inline uint32_t OpenAddressingStorage::Engine<R, A>::match_free(
+            const size_t& pos) const noexcept {
+#if defined(__SSE2__)
+        // У свободной и удаленной ячеек выставлен старший бит.
+        return static_cast<uint32_t>(_mm_movemask_epi8(_mm_loadu_si128(
+                reinterpret_cast<const __m128i*>(this->ctrl_ + pos))));
+#else
+        uint32_t mask{};
+        for (size_t i{}; i < GROUP_WIDTH; i++)
+            if (this->ctrl_[pos + i] < 0)
+                mask |= (1U << i);
+        return mask;
+#endif
+    }
+
+    /// \brief Записывает управляющий байт ячейки и его копию в конце
+    /// массива, если она есть.
+    ///
+    /// \param index Индекс ячейки.
+    /// \param value Новое значение управляющего байта.
+    template <class R, class A>
+    inline void OpenAddressingStorage::Engine<R, A>::set_ctrl(const size_t& index,
+                                                           const int8_t& value)
+    noexcept {
+        this->ctrl_[index] = value;
+        if (index < GROUP_WIDTH - 1)
+            this->ctrl_[this->capacity_ + index] = value;
+    }
+
+    /// \brief Определяет длину блока памяти хранилища.
+    ///
+    /// Указатели на записи и управляющие байты размещаются одним блоком;
+    /// длина считается в указателях, чтобы блок был выровнен под них.
+    ///
+    /// \return Количество указателей, занимающих блок.
+    template <class R, class A>
+    [[nodiscard]]
+    inline size_t OpenAddressingStorage::Engine<R, A>::block_length()
+    const noexcept {
+        size_t ctrl_bytes{ this->capacity_ + GROUP_WIDTH - 1 };
+        return this->capacity_ + (ctrl_bytes + sizeof(R*) - 1) / sizeof(R*);
+    }
+
+    /// \brief Ищет индекс ячейки с записью по указанному ключу.
+    ///
+    /// \param key Ключ записи.
+    /// \param hash Хеш ключа.
+    /// \param probes Количество просмотренных групп.
+    ///
+    /// \return Индекс ячейки или capacity_, если записи нет.
+    template <class R, class A>
+    [[nodiscard]]
+    size_t OpenAddressingStorage::Engine<R, A>::find_index(KeyArgument key,
+                                                        const uint64_t& hash,
+                                                        size_t& probes)
+    const noexcept {
+        const int8_t key_tag{ tag(hash) };
+        size_t pos{ bucket_index(hash, this->capacity_) };
+        probes = 0;
+        // Группы перебираются подряд, пока не встретится свободная ячейка.
+        for (size_t probe{}; probe <= this->capacity_ / GROUP_WIDTH; probe++) {
+            probes++;
+            for (uint32_t mask{ this->match(pos, key_tag) }; mask != 0;
+                    mask &= mask - 1) {
+                size_t index{ pos + static_cast<size_t>(__builtin_ctz(mask)) };
+                if (index >= this->capacity_)
+                    index -= this->capacity_;
+                const R* record{ this->slots_[index] };
+                if (record->hash() == hash && record->key() == key)
+                    return index;
+            }
+            if (this->match_empty(pos) != 0)
+                break;
+            pos += GROUP_WIDTH;
+            if (pos >= this->capacity_)
+                pos -= this->capacity_;
+        }
+        return this->capacity_;
+    }
+
+// PUBLIC
+
+    /// \brief Стандартный конструктор экземпляра класса
+    /// OpenAddressingStorage::Engine.
+    ///
+    /// \param size Количество ячеек, не меньшее GROUP_WIDTH.
+    /// \param allocator Аллокатор хеш-таблицы.
+    template <class R, class A>
+    OpenAddressingStorage::Engine<R, A>::Engine(const size_t& size,
+                                                const A& allocator) :
+            capacity_((size < GROUP_WIDTH) ? GROUP_WIDTH : size), used_(0),
+            allocator_(allocator),
+            slots_(SlotTraits::allocate(this->allocator_, this->block_length())),
+            ctrl_(reinterpret_cast<int8_t*>(this->slots_ + this->capacity_)) {
+        for (size_t item{}; item < this->capacity_ + GROUP_WIDTH - 1; item++)
+            this->ctrl_[item] = CTRL_EMPTY;
+    }
+
+    // Стандартный деструктор экземпляра. Записи не удаляются - ими владеет
+    // хеш-таблица.
+    template <class R, class A>
+    OpenAddressingStorage::Engine<R, A>::~Engine() {
+        SlotTraits::deallocate(this->allocator_, this->slots_,
+                               this->block_length());
+    }
+
+    /// \brief Ищет запись с указанным ключом.
+    ///
+    /// \param key Ключ записи.
+    /// \param hash Хеш ключа.
+    ///
+    /// \return Указатель на запись или nullptr, если ее нет.
+    template <class R, class A>
+    R* OpenAddressingStorage::Engine<R, A>::find(KeyArgument key,
+                                              const uint64_t& hash)
+    const noexcept {
+        size_t probes;
+        return this->find(key, hash, probes);
+    }
+
+    /// \brief Ищет запись с указанным ключом и считает длину поиска.
+    ///
+    /// \param key Ключ записи.
+    /// \param hash Хеш ключа.
+    /// \param probes Количество просмотренных групп.
+    ///
+    /// \return Указатель на запись или nullptr, если ее нет.
+    template <class R, class A>
+    R* OpenAddressingStorage::Engine<R, A>::find(KeyArgument key,
+                                              const uint64_t& hash,
+                                              size_t& probes)
+    const noexcept {
+        size_t index{ this->find_index(key, hash, probes) };
+        return (index == this->capacity_) ? nullptr : this->slots_[index];
+    }
+
+    /// \brief Добавляет запись, ключа которой еще нет в хранилище.
+    ///
+    /// Запись занимает первую свободную или удаленную ячейку на пути
+    /// зондирования.
+    ///
+    /// \param record Указатель на запись.
+    /// \param hash Хеш ключа записи.
+    template <class R, class A>
+    void OpenAddressingStorage::Engine<R, A>::insert(R* record,
+                                                  const uint64_t& hash) {
+        size_t pos{ bucket_index(hash, this->capacity_) };
+        uint32_t mask{ this->match_free(pos) };
+        while (mask == 0) {
+            pos += GROUP_WIDTH;
+            if (pos >= this->capacity_)
+                pos -= this->capacity_;
+            mask = this->match_free(pos);
+        }
+        size_t index{ pos + static_cast<size_t>(__builtin_ctz(mask)) };
+        if (index >= this->capacity_)
+            index -= this->capacity_;
+
+        if (this->ctrl_[index] == CTRL_EMPTY)
+            this->used_++;
+        this->set_ctrl(index, tag(hash));
+        this->slots_[index] = record;
+    }
+
+    /// \brief Исключает запись с указанным ключом из хранилища.
+    ///
+    /// Ячейка сразу становится свободной, если следующая за ней ячейка
+    /// свободна: ни одна цепочка зондирования через нее не проходит.
+    /// Иначе ячейка помечается удаленной.
+    ///
+    /// \param key Ключ записи.
+    /// \param hash Хеш ключа.
+    ///
+    /// \return Указатель на исключенную запись или nullptr, если ее нет.
+    template <class R, class A>
+    R* OpenAddressingStorage::Engine<R, A>::remove(KeyArgument key,
+                                                const uint64_t& hash) {
+        size_t probes;
+        size_t index{ this->find_index(key, hash, probes) };
+        if (index == this->capacity_)
+            return nullptr;
+
+        size_t next{ (index + 1 == this->capacity_) ? 0 : index + 1 };
+        if (this->ctrl_[next] == CTRL_EMPTY) {
+            this->set_ctrl(index, CTRL_EMPTY);
+            this->used_--;
+        }
+        else
+            this->set_ctrl(index, CTRL_DELETED);
+        return this->slots_[index];
+    }
+
+    /// \brief Переносит записи из диапазона ячеек в другое хранилище.
+    ///
+    /// Используется при постепенном перехешировании. Перенесенные ячейки
+    /// помечаются удаленными, а не свободными, чтобы цепочки зондирования
+    /// еще не перенесенных записей не обрывались.
+    ///
+    /// \param from Индекс первой переносимой ячейки.
+    /// \param count Количество переносимых ячеек.
+    /// \param dest Хранилище, в которое переносятся записи.
+    ///
+    /// \return Индекс первой еще не перенесенной ячейки.
+    template <class R, class A>
+    size_t OpenAddressingStorage::Engine<R, A>::transfer(const size_t& from,
+                                                      const size_t& count,
+                                                      Engine& dest) {
+        size_t to{ (from + count > this->capacity_) ? this->capacity_ :
+                                                      from + count };
+        for (size_t item{ from }; item < to; item++) {
+            if (this->ctrl_[item] < 0)
+                continue;
+            dest.insert(this->slots_[item], this->slots_[item]->hash());
+            this->set_ctrl(item, CTRL_DELETED);
+        }
+        return to;
+    }
+
+    /// \brief Добавляет набор записей, ключей которых еще нет в хранилище,
+    /// несколькими потоками.
+    ///
+    /// Ячейки делятся на непересекающиеся диапазоны, записи раскладываются
+    /// по диапазонам своих начальных ячеек радикс-разбиением (подсчет,
+    /// смещения, раскладка), и каждый диапазон заполняется отдельной
+    /// задачей. Зондирование внутри задачи побайтовое и не выходит за
+    /// диапазон, поэтому задачи не читают и не пишут чужих ячеек, а запись
+    /// занимает ту же ячейку, что и при обычной вставке. Записи, которым не
+    /// хватило места до конца диапазона, добавляются после в вызывающем
+    /// потоке.
+    ///
+    /// \param records Указатели на добавляемые записи.
+    /// \param pool Пул потоков.
+    template <class R, class A>
+    void OpenAddressingStorage::Engine<R, A>::insert_all(std::span<R* const> records,
+                                                         ThreadPool& pool) {
+        // Каждый диапазон не короче группы: копии первых управляющих байтов
+        // в конце массива пишет только задача первого диапазона.
+        size_t part_count{ std::min(pool.size() * TASKS_PER_THREAD,
+                                    this->capacity_ / GROUP_WIDTH) };
+        if (part_count <= 1 || records.size() < PARALLEL_MIN_SIZE) {
+            for (R* record : records)
+                this->insert(record, record->hash());
+            return;
+        }
+        // Диапазон p - начальные ячейки [ceil(p * C / P), ceil((p + 1) * C / P)).
+        auto part_of{ [this, part_count](const R* record) -> size_t {
+            return bucket_index(record->hash(), this->capacity_) * part_count /
+                   this->capacity_;
+        } };
+        auto part_start{ [this, part_count](const size_t& part) -> size_t {
+            return (part * this->capacity_ + part_count - 1) / part_count;
+        } };
+
+        size_t chunk_count{ pool.size() };
+        auto chunk_start{ [&records, chunk_count](const size_t& chunk) -> size_t {
+            return records.size() * chunk / chunk_count;
+        } };
+        std::vector<size_t> offsets(chunk_count * part_count);
+        pool.run(chunk_count, [&](size_t chunk) {
+            size_t* counts{ offsets.data() + chunk * part_count };
+            for (size_t item{ chunk_start(chunk) }; item < chunk_start(chunk + 1);
+                    item++)
+                counts[part_of(records[item])]++;
+        });
+        std::vector<size_t> part_begin(part_count + 1);
+        size_t total{};
+        for (size_t part{}; part < part_count; part++) {
+            part_begin[part] = total;
+            for (size_t chunk{}; chunk < chunk_count; chunk++)
+                total += std::exchange(offsets[chunk * part_count + part], total);
+        }
+        part_begin[part_count] = total;
+
+        std::vector<R*> sorted(records.size());
+        pool.run(chunk_count, [&](size_t chunk) {
+            size_t* positions{ offsets.data() + chunk * part_count };
+            for (size_t item{ chunk_start(chunk) }; item < chunk_start(chunk + 1);
+                    item++)
+                sorted[positions[part_of(records[item])]++] = records[item];
+        });
+
+        std::vector<std::vector<R*>> overflow(part_count);
+        std::vector<size_t> used(part_count);
+        pool.run(part_count, [&](size_t part) {
+            size_t last{ part_start(part + 1) };
+            for (size_t item{ part_begin[part] }; item < part_begin[part + 1];
+                    item++) {
+                R* record{ sorted[item] };
+                size_t index{ bucket_index(record->hash(), this->capacity_) };
+                while (index < last && this->ctrl_[index] >= 0)
+                    index++;
+                if (index == last) {
+                    overflow[part].push_back(record);
+                    continue;
+                }
+                if (this->ctrl_[index] == CTRL_EMPTY)
+                    used[part]++;
+                this->set_ctrl(index, tag(record->hash()));
+                this->slots_[index] = record;
+            }
+        });
+
+        for (size_t part{}; part < part_count; part++) {
+            this->used_ += used[part];
+            for (R* record : overflow[part])
+                this->insert(record, record->hash());
+        }
+    }
+
+    /// \brief Переносит все записи в другое хранилище несколькими потоками.
+    ///
+    /// Записи собираются из ячеек параллельно по диапазонам и добавляются в
+    /// новое хранилище через insert_all. Текущее хранилище остается пустым.
+    ///
+    /// \param dest Хранилище, в которое переносятся записи.
+    /// \param pool Пул потоков.
+    template <class R, class A>
+    void OpenAddressingStorage::Engine<R, A>::transfer_all(Engine& dest,
+                                                           ThreadPool& pool) {
+        if (this->capacity_ < PARALLEL_MIN_SIZE || pool.size() == 1) {
+            this->transfer(0, this->capacity_, dest);
+            return;
+        }
+        size_t chunk_count{ pool.size() * TASKS_PER_THREAD };
+        auto chunk_start{ [this, chunk_count](const size_t& chunk) -> size_t {
+            return this->capacity_ * chunk / chunk_count;
+        } };
+        std::vector<size_t> offsets(chunk_count + 1);
+        pool.run(chunk_count, [&](size_t chunk) {
+            for (size_t item{ chunk_start(chunk) }; item < chunk_start(chunk + 1);
+                    item++)
+                offsets[chunk + 1] += (this->ctrl_[item] >= 0);
+        });
+        for (size_t chunk{}; chunk < chunk_count; chunk++)
+            offsets[chunk + 1] += offsets[chunk];
+
+        std::vector<R*> records(offsets[chunk_count]);
+        pool.run(chunk_count, [&](size_t chunk) {
+            size_t position{ offsets[chunk] };
+            for (size_t item{ chunk_start(chunk) }; item < chunk_start(chunk + 1);
+                    item++) {
+                if (this->ctrl_[item] >= 0)
+                    records[position++] = this->slots_[item];
+            }
+        });
+        dest.insert_all(records, pool);
+
+        std::fill(this->ctrl_, this->ctrl_ + this->capacity_ + GROUP_WIDTH - 1,
+                  CTRL_EMPTY);
+        this->used_ = 0;
+    }
+
+    /// \brief Заранее подгружает в кеш первую группу управляющих байтов
+    /// и ячеек на пути зондирования хеша.
+    ///
+    /// \param hash Хеш ключа.
+    template <class R, class A>
+    inline void OpenAddressingStorage::Engine<R, A>::prefetch(
+            const uint64_t& hash) const noexcept {
+        size_t pos{ bucket_index(hash, this->capacity_) };
+        __builtin_prefetch(this->ctrl_ + pos);
+        __builtin_prefetch(this->slots_ + pos);
+    }
+
+    /// \brief Сообщает, что хранилищу требуется перестроение.
+    ///
+    /// Удаленные ячейки удлиняют зондирование так же, как занятые,
+    /// поэтому при их избытке хранилище нужно перестроить.
+    ///
+    /// \return true, если доля занятых и удаленных ячеек превысила
+    /// MAX_FILL_PERCENT.
+    template <class R, class A>
+    [[nodiscard]]
+    inline bool OpenAddressingStorage::Engine<R, A>::overloaded() const noexcept {
+        return (this->used_ / static_cast<double>(this->capacity_)) >=
+               MAX_FILL_PERCENT;
+    }
+
+    /// \brief Предоставляет доступ к количеству ячеек.
+    ///
+    /// \return Значение кол-ва ячеек.
+    template <class R, class A>
+    [[nodiscard]] [[maybe_unused]]
+    inline size_t OpenAddressingStorage::Engine<R, A>::capacity() const noexcept {
+        return this->capacity_;
+    }
+
+    /// \brief Строит гистограмму длин зондирования.
+    ///
+    /// Для каждой записи определяется, на сколько групп она смещена от
+    /// группы, в которую попадает ее хеш: поиск такой записи просматривает
+    /// на одну группу больше.
+    ///
+    /// \param histogram Счетчики записей: i-й элемент увеличивается для
+    /// каждой записи, найденной за i + 1 групп, последний - и для всех
+    /// более далеких.
+    template <class R, class A>
+    [[maybe_unused]]
+    void OpenAddressingStorage::Engine<R, A>::probe_histogram(
+            std::span<uint64_t> histogram) const noexcept {
+        if (histogram.empty())
+            return;
+        for (size_t item{}; item < this->capacity_; item++) {
+            if (this->ctrl_[item] < 0)
+                continue;
+            size_t home{ bucket_index(this->slots_[item]->hash(), this->capacity_) };
+            size_t distance{ (item >= home) ? item - home
+                                            : item + this->capacity_ - home };
+            histogram[std::min(distance / GROUP_WIDTH, histogram.size() - 1)]++;
+        }
+    }
+
+    /// \brief Определяет объем памяти, занятой ячейками и управляющими
+    /// байтами.
+    ///
+    /// \return Количество байтов.
+    template <class R, class A>
+    [[nodiscard]] [[maybe_unused]]
+    size_t OpenAddressingStorage::Engine<R, A>::memory_usage() const noexcept {
+        return this->block_length() * sizeof(R*);
+    }
+}
+
+#endif
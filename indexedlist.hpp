@@ -0,0 +1,714 @@
+/// \file indexedlist.hpp.
+/// \author Лошкарев Дмитрий.
+/// \date 14.10.2026.
+///
+/// \brief Содержит двусвязный список с доступом по индексу за O(log n).
+///
+/// \namespaces
+/// • DataStructures
+/// \classes
+/// • IndexedList
+
+#ifndef CPPPROJECT_INDEXEDLIST_H
+#define CPPPROJECT_INDEXEDLIST_H
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <utility>
+
+#include "memorypool.hpp"
+
+namespace DataStructures {
+// Объявление классов.
+
+    /// \class Класс IndexedList предоставляет двусвязный список, в котором
+    /// обращение, вставка и удаление по индексу выполняются в среднем за
+    /// O(log n).
+    ///
+    /// Над обычными связями lvl 0 строится индексируемый список с пропусками
+    /// (skip list): узел получает случайное число уровней, а каждая связь
+    /// уровня хранит, через сколько элементов она ведет. Поиск индекса
+    /// спускается с верхнего уровня, суммируя длины связей. Уровень узла
+    /// распределен геометрически с p = 1/2, поэтому узел в среднем хранит
+    /// две связи. Перебор итератором идет по нижнему уровню, как в List.
+    ///
+    /// Публичные методы:
+    /// \n • NodeType pop_front();
+    /// \n • NodeType pop_back();
+    /// \n • void erase(const size_t& index);
+    /// \n • size_t length() const noexcept;
+    /// \n • Iterator begin() const
+    /// \n • Iterator end() const noexcept
+    /// \n • Iterator rbegin() const
+    /// \n • Iterator rend() const noexcept
+    /// \n • NodeType& operator [] (const size_t& index);
+    /// \n • void push_front(const NodeType& data)
+    /// \n • void push_front(NodeType&& data)
+    /// \n • void push_back(const NodeType& data)
+    /// \n • void push_back(NodeType&& data)
+    /// \n • NodeType& emplace(const size_t& index, Args&&... args)
+    /// \n • void insert(const size_t& index, const NodeType& value)
+    /// \n • void insert(const size_t& index, NodeType&& value)
+    ///
+    /// \tparam NodeType Тип элементов списка.
+    /// \tparam Allocator Аллокатор узлов и их связей. По умолчанию память
+    /// берется из пула PoolAllocator; подходит и std::pmr::polymorphic_allocator.
+    template <class NodeType, class Allocator = PoolAllocator<NodeType>>
+    class IndexedList {
+        private:
+            static inline constexpr size_t MAX_LEVEL{ 32 };  ///< \brief Максимальное число уровней.
+
+            class Node;
+
+            /// \class Структура Link описывает связь узла на одном уровне.
+            struct Link {
+                Node* next_;    ///< \brief След. узел этого уровня или nullptr.
+                size_t width_;  ///< \brief Сколько элементов пропускает связь.
+            };
+
+            /// \class Класс Node описывает узел списка: значение, обратную
+            /// связь нижнего уровня и массив связей всех уровней узла.
+            class Node {
+                private:
+                    NodeType value_;
+                    Node* prev_;    ///< \brief Указатель на пред. элем. списка.
+                    Link* links_;   ///< \brief Связи уровней [0, level_).
+                    uint32_t level_;
+                public:
+                    template <class... Args>
+                    explicit Node(Link*, const uint32_t&, Args&&...);
+
+                friend class IndexedList;
+            };
+
+            using NodeAllocator = typename std::allocator_traits<Allocator>::
+                    template rebind_alloc<Node>;
+            using NodeTraits = std::allocator_traits<NodeAllocator>;
+            using LinkAllocator = typename std::allocator_traits<Allocator>::
+                    template rebind_alloc<Link>;
+            using LinkTraits = std::allocator_traits<LinkAllocator>;
+
+            size_t length_;
+            uint32_t level_;             ///< \brief Число используемых уровней.
+            Link head_[MAX_LEVEL];       ///< \brief Связи начала списка (позиция 0).
+            Node* tail_;
+            [[no_unique_address]] NodeAllocator allocator_;
+            std::minstd_rand random_;    ///< \brief Генератор уровней узлов.
+
+            [[nodiscard]]
+            uint32_t random_level() noexcept;
+            [[nodiscard]]
+            inline Link* links_of(Node*) noexcept;
+            template <class... Args>
+            [[nodiscard]]
+            Node* create_node(Args&&...);
+            void destroy_node(Node*) noexcept;
+            void find_previous(const size_t&, Node**, size_t*) noexcept;
+            [[nodiscard]]
+            Node* locate(const size_t&) const;
+            void reset() noexcept;
+            void clear() noexcept;
+        public:
+            using allocator_type = Allocator;
+
+            /// \class класс Iterator предоставляет объект-итератор по
+            /// элементам списка.
+            ///
+            /// Публичные методы:
+            /// \n • Iterator& operator ++ () noexcept
+            /// \n • Iterator operator ++ (int) noexcept
+            /// \n • Iterator& operator -- () noexcept
+            /// \n • Iterator operator -- (int) noexcept
+            /// \n • bool operator != (const Iterator& iterator) noexcept
+            /// \n • const NodeType& operator * () const noexcept
+            class Iterator {
+                private:
+                    const Node* current_node;
+                public:
+                    explicit Iterator(const Node*) noexcept;
+
+                    Iterator& operator ++ () noexcept;
+                    Iterator operator ++ (int) noexcept;
+                    Iterator& operator -- () noexcept;
+                    Iterator operator -- (int) noexcept;
+                    bool operator != (const Iterator&) noexcept;
+                    const NodeType& operator * () const noexcept;
+            };
+
+            explicit IndexedList(const Allocator& = Allocator());
+            IndexedList(const IndexedList&);
+            IndexedList(IndexedList&&) noexcept;
+            IndexedList& operator = (const IndexedList&);
+            IndexedList& operator = (IndexedList&&);
+            ~IndexedList();
+
+            NodeType pop_front();
+            NodeType pop_back();
+            void erase(const size_t&);
+
+            void push_front(const NodeType&);
+            void push_front(NodeType&&);
+            void push_back(const NodeType&);
+            void push_back(NodeType&&);
+            template <class... Args>
+            NodeType& emplace(const size_t&, Args&&...);
+            [[maybe_unused]]
+            void insert(const size_t&, const NodeType&);
+            [[maybe_unused]]
+            void insert(const size_t&, NodeType&&);
+
+            NodeType& operator [] (const size_t&);
+
+            [[maybe_unused]] [[nodiscard]]
+            inline size_t length() const noexcept;
+            inline Iterator begin() const;
+            inline Iterator end() const noexcept;
+            [[maybe_unused]]
+            inline Iterator rbegin() const;
+            [[maybe_unused]]
+            inline Iterator rend() const noexcept;
+    };
+
+// Определения методов классов.
+/* ================================ Iterator ================================ */
+
+    /// \brief Стандартный конструктор экземпляра класса IndexedList::Iterator.
+    ///
+    /// \param node Указатель на узел или nullptr для конца списка.
+    template <class T, class A>
+    IndexedList<T, A>::Iterator::Iterator(const Node* node) noexcept :
+            current_node(node) { }
+
+    /// \brief Перемещает итератор на след. элемент списка.
+    ///
+    /// \return Объект-итератор.
+    template <class T, class A>
+    IndexedList<T, A>::Iterator& IndexedList<T, A>::Iterator::operator ++ () noexcept {
+        if (this->current_node != nullptr)
+            this->current_node = this->current_node->links_[0].next_;
+        return *this;
+    }
+
+    /// \brief Перемещает итератор на след. элемент списка.
+    ///
+    /// \return Объект-итератор.
+    template <class T, class A>
+    IndexedList<T, A>::Iterator IndexedList<T, A>::Iterator::operator ++ (int) noexcept {
+        Iterator iterator = *this;
+        ++*this;
+        return iterator;
+    }
+
+    /// \brief Перемещает итератор на пред. элемент списка.
+    ///
+    /// \return Объект-итератор.
+    template <class T, class A>
+    IndexedList<T, A>::Iterator& IndexedList<T, A>::Iterator::operator -- () noexcept {
+        if (this->current_node != nullptr)
+            this->current_node = this->current_node->prev_;
+        return *this;
+    }
+
+    /// \brief Перемещает итератор на пред. элемент списка.
+    ///
+    /// \return Объект-итератор.
+    template <class T, class A>
+    IndexedList<T, A>::Iterator IndexedList<T, A>::Iterator::operator -- (int) noexcept {
+        Iterator iterator = *this;
+        --*this;
+        return iterator;
+    }
+
+    /// \brief Проверяет, что два объекта итератора не равны.
+    ///
+    /// \param iterator Объект-итератор для сравнения.
+    ///
+    /// \return Булевое значение.
+    template <class T, class A>
+    bool IndexedList<T, A>::Iterator::operator != (const Iterator& iterator) noexcept {
+        return this->current_node != iterator.current_node;
+    }
+
+    /// \brief Позволяет получить значение, хранящееся в узле.
+    ///
+    /// \return Ссылку на значение узла списка.
+    template <class T, class A>
+    const T& IndexedList<T, A>::Iterator::operator * () const noexcept {
+        return this->current_node->value_;
+    }
+
+/* ================================== Node ================================== */
+
+    /// \brief Стандартный конструктор экземпляра класса IndexedList::Node.
+    ///
+    /// \param links Массив связей узла.
+    /// \param level Число уровней узла.
+    /// \param args Аргументы конструктора значения.
+    template <class T, class A>
+    template <class... Args>
+    IndexedList<T, A>::Node::Node(Link* links, const uint32_t& level,
+                                  Args&&... args) :
+            value_(std::forward<Args>(args)...), prev_(nullptr), links_(links),
+            level_(level) { }
+
+/* ============================== IndexedList ============================== */
+// PRIVATE
+
+    /// \brief Выбирает число уровней нового узла.
+    ///
+    /// \return Значение в пределах [1, MAX_LEVEL] с вероятностью 2^-k для k.
+    template <class T, class A>
+    [[nodiscard]]
+    uint32_t IndexedList<T, A>::random_level() noexcept {
+        // Каждый младший единичный бит поднимает узел на уровень выше.
+        auto bits{ static_cast<uint32_t>(this->random_()) };
+        auto extra_levels{ static_cast<uint32_t>(std::countr_one(bits)) };
+        return 1 + std::min(extra_levels, static_cast<uint32_t>(MAX_LEVEL - 1));
+    }
+
+    /// \brief Предоставляет доступ к связям узла или начала списка.
+    ///
+    /// \param node Указатель на узел или nullptr для начала списка.
+    ///
+    /// \return Массив связей.
+    template <class T, class A>
+    [[nodiscard]]
+    inline IndexedList<T, A>::Link* IndexedList<T, A>::links_of(Node* node) noexcept {
+        return (node != nullptr) ? node->links_ : this->head_;
+    }
+
+    /// \brief Создает узел со случайным числом уровней.
+    ///
+    /// \param args Аргументы конструктора значения узла.
+    ///
+    /// \return Указатель на новый узел.
+    template <class T, class A>
+    template <class... Args>
+    [[nodiscard]]
+    IndexedList<T, A>::Node* IndexedList<T, A>::create_node(Args&&... args) {
+        uint32_t level{ this->random_level() };
+        LinkAllocator link_allocator(this->allocator_);
+        Link* links{ LinkTraits::allocate(link_allocator, level) };
+        Node* node;
+        try {
+            node = NodeTraits::allocate(this->allocator_, 1);
+        }
+        catch (...) {
+            LinkTraits::deallocate(link_allocator, links, level);
+            throw;
+        }
+        try {
+            NodeTraits::construct(this->allocator_, node, links, level,
+                                  std::forward<Args>(args)...);
+        }
+        catch (...) {
+            NodeTraits::deallocate(this->allocator_, node, 1);
+            LinkTraits::deallocate(link_allocator, links, level);
+            throw;
+        }
+        return node;
+    }
+
+    /// \brief Уничтожает узел вместе со связями.
+    ///
+    /// \param node Указатель на узел.
+    template <class T, class A>
+    void IndexedList<T, A>::destroy_node(Node* node) noexcept {
+        LinkAllocator link_allocator(this->allocator_);
+        LinkTraits::deallocate(link_allocator, node->links_, node->level_);
+        NodeTraits::destroy(this->allocator_, node);
+        NodeTraits::deallocate(this->allocator_, node, 1);
+    }
+
+    /// \brief Находит на каждом уровне последний узел перед позицией.
+    ///
+    /// Позиции считаются с 1, начало списка имеет позицию 0.
+    ///
+    /// \param position Позиция, перед которой ищутся узлы.
+    /// \param update Найденные узлы (nullptr - начало списка), по одному
+    /// на уровень.
+    /// \param positions Позиции найденных узлов.
+    template <class T, class A>
+    void IndexedList<T, A>::find_previous(const size_t& position, Node** update,
+                                          size_t* positions) noexcept {
+        Node* node{ nullptr };
+        size_t node_position{};
+        for (uint32_t level{ MAX_LEVEL }; level-- > 0;) {
+            Link* links{ this->links_of(node) };
+            while (links[level].next_ != nullptr &&
+                   node_position + links[level].width_ < position) {
+                node_position += links[level].width_;
+                node = links[level].next_;
+                links = node->links_;
+            }
+            update[level] = node;
+            positions[level] = node_position;
+        }
+    }
+
+    /// \brief Находит узел по индексу.
+    ///
+    /// \param index Индекс узла.
+    ///
+    /// \return Указатель на узел.
+    ///
+    /// \throw std::out_of_range Исключение возбуждается, если индекс
+    /// выходит за границы списка.
+    template <class T, class A>
+    [[nodiscard]]
+    IndexedList<T, A>::Node* IndexedList<T, A>::locate(const size_t& index) const {
+        if (index >= this->length_)
+            throw std::out_of_range("List index is out of range.");
+
+        const Link* links{ this->head_ };
+        Node* node{ nullptr };
+        size_t position{};
+        for (uint32_t level{ this->level_ }; level-- > 0;) {
+            while (links[level].next_ != nullptr &&
+                   position + links[level].width_ <= index + 1) {
+                position += links[level].width_;
+                node = links[level].next_;
+                links = node->links_;
+            }
+        }
+        return node;
+    }
+
+    // Приводит связи начала списка к состоянию пустого списка.
+    template <class T, class A>
+    void IndexedList<T, A>::reset() noexcept {
+        for (Link& link : this->head_)
+            link = { nullptr, 1 };
+        this->length_ = 0;
+        this->level_ = 1;
+        this->tail_ = nullptr;
+    }
+
+    // Удаляет все узлы списка.
+    template <class T, class A>
+    void IndexedList<T, A>::clear() noexcept {
+        Node* node{ this->head_[0].next_ };
+        while (node != nullptr) {
+            Node* next_node{ node->links_[0].next_ };
+            this->destroy_node(node);
+            node = next_node;
+        }
+        this->reset();
+    }
+
+// PUBLIC
+
+    /// \brief Стандартный конструктор экземпляра класса IndexedList.
+    ///
+    /// \param allocator Аллокатор, из которого берутся узлы.
+    template <class T, class A>
+    IndexedList<T, A>::IndexedList(const A& allocator) :
+            length_(0), level_(1), head_(), tail_(nullptr),
+            allocator_(allocator), random_() {
+        this->reset();
+    }
+
+    /// \brief Конструктор копирования экземпляра класса IndexedList.
+    ///
+    /// \param other Копируемый список.
+    template <class T, class A>
+    IndexedList<T, A>::IndexedList(const IndexedList& other) :
+            length_(0), level_(1), head_(), tail_(nullptr),
+            allocator_(NodeTraits::select_on_container_copy_construction(
+                    other.allocator_)), random_() {
+        this->reset();
+        for (auto it{ other.begin() }; it != other.end(); ++it)
+            this->push_back(*it);
+    }
+
+    /// \brief Конструктор перемещения экземпляра класса IndexedList.
+    ///
+    /// Узлы забираются целиком, исходный список остается пустым. Первый
+    /// узел не ссылается на начало списка, поэтому связи начала просто
+    /// копируются.
+    ///
+    /// \param other Перемещаемый список.
+    template <class T, class A>
+    IndexedList<T, A>::IndexedList(IndexedList&& other) noexcept :
+            length_(other.length_), level_(other.level_), head_(),
+            tail_(other.tail_), allocator_(other.allocator_),
+            random_(other.random_) {
+        std::copy(std::begin(other.head_), std::end(other.head_), this->head_);
+        other.reset();
+    }
+
+    /// \brief Оператор присваивания копированием.
+    ///
+    /// \param other Копируемый список.
+    ///
+    /// \return Ссылку на текущий экземпляр.
+    template <class T, class A>
+    IndexedList<T, A>& IndexedList<T, A>::operator = (const IndexedList& other) {
+        if (this == &other)
+            return *this;
+
+        this->clear();
+        if constexpr (NodeTraits::propagate_on_container_copy_assignment::value)
+            this->allocator_ = other.allocator_;
+        for (auto it{ other.begin() }; it != other.end(); ++it)
+            this->push_back(*it);
+        return *this;
+    }
+
+    /// \brief Оператор присваивания перемещением.
+    ///
+    /// \param other Перемещаемый список.
+    ///
+    /// \return Ссылку на текущий экземпляр.
+    template <class T, class A>
+    IndexedList<T, A>& IndexedList<T, A>::operator = (IndexedList&& other) {
+        if (this == &other)
+            return *this;
+
+        this->clear();
+        if constexpr (!NodeTraits::propagate_on_container_move_assignment::value) {
+            if (!(this->allocator_ == other.allocator_)) {
+                for (Node* node{ other.head_[0].next_ }; node != nullptr;
+                        node = node->links_[0].next_)
+                    this->push_back(std::move(node->value_));
+                other.clear();
+                return *this;
+            }
+        }
+        else
+            this->allocator_ = other.allocator_;
+
+        std::copy(std::begin(other.head_), std::end(other.head_), this->head_);
+        this->length_ = other.length_;
+        this->level_ = other.level_;
+        this->tail_ = other.tail_;
+        other.reset();
+        return *this;
+    }
+
+    // Стандартный деструктор экземпляра.
+    template <class T, class A>
+    IndexedList<T, A>::~IndexedList() {
+        this->clear();
+    }
+
+    /// \brief Извлекает элемент из начала списка и возвращает его значение.
+    ///
+    /// \return Значение первого элемента списка.
+    template <class T, class A>
+    T IndexedList<T, A>::pop_front() {
+        if (this->length_ == 0)
+            return T{};
+        T popped_value{ std::move(this->head_[0].next_->value_) };
+        this->erase(0);
+        return popped_value;
+    }
+
+    /// \brief Извлекает элемент из конца списка и возвращает его значение.
+    ///
+    /// \return Значение последнего элемента списка.
+    template <class T, class A>
+    T IndexedList<T, A>::pop_back() {
+        if (this->length_ == 0)
+            return T{};
+        T popped_value{ std::move(this->tail_->value_) };
+        this->erase(this->length_ - 1);
+        return popped_value;
+    }
+
+    /// \brief Удаляет произвольный элемент списка за O(log n).
+    ///
+    /// \param index Индекс элемента.
+    ///
+    /// \throw std::out_of_range Исключение возбуждается, если индекс
+    /// выходит за границы списка.
+    template <class T, class A>
+    void IndexedList<T, A>::erase(const size_t& index) {
+        if (index >= this->length_)
+            throw std::out_of_range("List index is out of range.");
+
+        Node* update[MAX_LEVEL];
+        size_t positions[MAX_LEVEL];
+        this->find_previous(index + 1, update, positions);
+        Node* erasing_node{ this->links_of(update[0])[0].next_ };
+
+        for (uint32_t level{}; level < MAX_LEVEL; level++) {
+            Link& link{ this->links_of(update[level])[level] };
+            if (level < erasing_node->level_) {
+                link.width_ += erasing_node->links_[level].width_ - 1;
+                link.next_ = erasing_node->links_[level].next_;
+            }
+            else
+                link.width_--;
+        }
+
+        Node* next_node{ erasing_node->links_[0].next_ };
+        if (next_node != nullptr)
+            next_node->prev_ = erasing_node->prev_;
+        else
+            this->tail_ = erasing_node->prev_;
+        this->length_--;
+        this->destroy_node(erasing_node);
+    }
+
+    /// \brief Добавляет элемент в начало списка.
+    ///
+    /// \param data Данные, которые нужно внести в узел.
+    template <class T, class A>
+    void IndexedList<T, A>::push_front(const T& data) {
+        this->emplace(0, data);
+    }
+
+    /// \brief Добавляет элемент в начало списка, перемещая в него данные.
+    ///
+    /// \param data Данные, которые нужно внести в узел.
+    template <class T, class A>
+    void IndexedList<T, A>::push_front(T&& data) {
+        this->emplace(0, std::move(data));
+    }
+
+    /// \brief Добавляет элемент в конец списка.
+    ///
+    /// \param data Данные, которые нужно внести в узел.
+    template <class T, class A>
+    void IndexedList<T, A>::push_back(const T& data) {
+        this->emplace(this->length_, data);
+    }
+
+    /// \brief Добавляет элемент в конец списка, перемещая в него данные.
+    ///
+    /// \param data Данные, которые нужно внести в узел.
+    template <class T, class A>
+    void IndexedList<T, A>::push_back(T&& data) {
+        this->emplace(this->length_, std::move(data));
+    }
+
+    /// \brief Создает значение на месте в новом узле с указанным индексом
+    /// за O(log n).
+    ///
+    /// \param index Индекс нового элемента в пределах [0, length()].
+    /// \param args Аргументы конструктора значения.
+    ///
+    /// \return Ссылку на созданное значение.
+    ///
+    /// \throw std::out_of_range Исключение возбуждается, если индекс
+    /// больше длины списка.
+    template <class T, class A>
+    template <class... Args>
+    T& IndexedList<T, A>::emplace(const size_t& index, Args&&... args) {
+        if (index > this->length_)
+            throw std::out_of_range("List index is out of range.");
+
+        Node* new_node{ this->create_node(std::forward<Args>(args)...) };
+        size_t position{ index + 1 };
+        Node* update[MAX_LEVEL];
+        size_t positions[MAX_LEVEL];
+        this->find_previous(position, update, positions);
+
+        for (uint32_t level{}; level < MAX_LEVEL; level++) {
+            Link& link{ this->links_of(update[level])[level] };
+            if (level < new_node->level_) {
+                // Позиция следующего узла после вставки сдвигается на 1.
+                new_node->links_[level] = {
+                        link.next_, positions[level] + link.width_ + 1 - position };
+                link = { new_node, position - positions[level] };
+            }
+            else
+                link.width_++;
+        }
+        if (new_node->level_ > this->level_)
+            this->level_ = new_node->level_;
+
+        new_node->prev_ = update[0];
+        Node* next_node{ new_node->links_[0].next_ };
+        if (next_node != nullptr)
+            next_node->prev_ = new_node;
+        else
+            this->tail_ = new_node;
+        this->length_++;
+        return new_node->value_;
+    }
+
+    /// \brief Вставляет новый узел в произвольное место списка за O(log n).
+    ///
+    /// \param index Индекс, на который нужно вставить новый узел.
+    /// \param value Данные, которые нужно внести в узел.
+    template <class T, class A>
+    [[maybe_unused]]
+    void IndexedList<T, A>::insert(const size_t& index, const T& value) {
+        this->emplace(index, value);
+    }
+
+    /// \brief Вставляет новый узел в произвольное место списка, перемещая
+    /// в него данные.
+    ///
+    /// \param index Индекс, на который нужно вставить новый узел.
+    /// \param value Данные, которые нужно внести в узел.
+    template <class T, class A>
+    [[maybe_unused]]
+    void IndexedList<T, A>::insert(const size_t& index, T&& value) {
+        this->emplace(index, std::move(value));
+    }
+
+    /// \brief Позволяет получить значение элемента по индексу за O(log n).
+    ///
+    /// \param index Индекс элемента.
+    ///
+    /// \return Значение элемента списка.
+    template <class T, class A>
+    T& IndexedList<T, A>::operator [] (const size_t& index) {
+        return this->locate(index)->value_;
+    }
+
+    /// \brief Позволяет получить количество элементов списка.
+    ///
+    /// \return Значение кол-ва элементов.
+    template <class T, class A>
+    [[maybe_unused]] [[nodiscard]]
+    inline size_t IndexedList<T, A>::length() const noexcept {
+        return this->length_;
+    }
+
+    /// \brief Создает итератор от начала списка.
+    ///
+    /// \return Объект-итератор.
+    template <class T, class A>
+    inline IndexedList<T, A>::Iterator IndexedList<T, A>::begin() const {
+        return Iterator(this->head_[0].next_);
+    }
+
+    /// \brief Создает итератор на конец списка (nullptr).
+    ///
+    /// \return Объект-итератор.
+    template <class T, class A>
+    inline IndexedList<T, A>::Iterator IndexedList<T, A>::end() const noexcept {
+        return Iterator(nullptr);
+    }
+
+    /// \brief Создает итератор от конца списка (реверсивный перебор).
+    ///
+    /// \return Объект-итератор.
+    template <class T, class A>
+    [[maybe_unused]]
+    inline IndexedList<T, A>::Iterator IndexedList<T, A>::rbegin() const {
+        return Iterator(this->tail_);
+    }
+
+    /// \brief Создает итератор на начало списка (nullptr)
+    /// (реверсивный перебор).
+    ///
+    /// \return Объект-итератор.
+    template <class T, class A>
+    [[maybe_unused]]
+    inline IndexedList<T, A>::Iterator IndexedList<T, A>::rend() const noexcept {
+        return Iterator(nullptr);
+    }
+}
+
+#endif
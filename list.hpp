@@ -13,6 +13,10 @@
 #define CPPPROJECT_LIST_H
 
 #include <iostream>
+#include <memory>
+#include <utility>
+
+#include "memorypool.hpp"
 
 /// \namespace Пространство имен DataStructures содержит в себе
 /// классы-реализации двух структур данных: двусвязного списка в виде
@@ -33,20 +37,32 @@ namespace DataStructures {
     /// \n • NodeType pop_front();
     /// \n • NodeType pop_back();
     /// \n • void erase(const size_t&);
+    /// \n • Iterator erase(Iterator position);
+    /// \n • void splice_back(List& source) noexcept;
     /// \n • size_t length() const noexcept;
+    /// \n • size_t memory_usage() const noexcept;
     /// \n • Iterator begin() const
     /// \n • Iterator end() const noexcept
     /// \n • Iterator rbegin() const
     /// \n • Iterator rend() const noexcept
     /// \n • NodeType& operator [] (const size_t& index);
-    /// \n • Node* push_front(const NodeType& data)
-    /// \n • Node* push_back(const NodeType& data)
+    /// \n • void push_front(const NodeType& data)
+    /// \n • void push_front(NodeType&& data)
+    /// \n • void push_back(const NodeType& data)
+    /// \n • void push_back(NodeType&& data)
+    /// \n • NodeType& emplace_front(Args&&... args)
+    /// \n • NodeType& emplace_back(Args&&... args)
     /// \n • Node* at(const size_t& index)
-    /// \n • Node* insert(const size_t& index, const NodeType& value)
+    /// \n • void insert(const size_t& index, const NodeType& value)
+    /// \n • void insert(const size_t& index, NodeType&& value)
+    /// \n • Iterator insert(Iterator position, const NodeType& value)
+    /// \n • Iterator insert(Iterator position, NodeType&& value)
     ///
     /// \tparam NodeType Тип данных, который предполагается для использования
     /// в качестве "контейнера" для считываемой и обрабатываемой информации.
-    template <class NodeType>
+    /// \tparam Allocator Аллокатор узлов списка. По умолчанию узлы берутся из
+    /// пула PoolAllocator; подходит и std::pmr::polymorphic_allocator.
+    template <class NodeType, class Allocator = PoolAllocator<NodeType>>
     class List {
         private:
             /// \class класс Node описывает структуру узла двусвязного списка.
@@ -56,14 +72,30 @@ namespace DataStructures {
                     Node* next_;   ///< \brief Указатель на след. элем. списка.
                     Node* prev_;   ///< \brief Указатель на пред. элем. списка.
                 public:
-                    explicit Node(const NodeType&) noexcept;
+                    template <class... Args>
+                    explicit Node(Args&&...);
 
                 friend class List;
             };
 
+            using NodeAllocator = typename std::allocator_traits<Allocator>::
+                    template rebind_alloc<Node>;
+            using NodeTraits = std::allocator_traits<NodeAllocator>;
+
             size_t length_;
             Node *head_, *tail_;
+            [[no_unique_address]] NodeAllocator allocator_;
+
+            template <class... Args>
+            [[nodiscard]]
+            Node* create_node(Args&&...);
+            void destroy_node(Node*) noexcept;
+            void link_front(Node*) noexcept;
+            void link_back(Node*) noexcept;
+            void link_before(Node*, Node*) noexcept;
         public:
+            using allocator_type = Allocator;
+
             /// \class класс Iterator предоставляет объект-итератор, дающий
             /// возможность более комфортно итерироваться по элементам списка.
             ///
@@ -74,7 +106,7 @@ namespace DataStructures {
             /// \n • Iterator& operator -- () noexcept
             /// \n • terator* operator -- (int) noexcept
             /// \n • bool operator != (const Iterator& iterator) noexcept
-            /// \n • NodeType operator * ()
+            /// \n • const NodeType& operator * () const noexcept
             class Iterator {
                 private:
                     const Node* current_node;
@@ -87,28 +119,48 @@ namespace DataStructures {
                     Iterator& operator -- () noexcept;
                     Iterator operator -- (int) noexcept;
                     bool operator != (const Iterator&) noexcept;
-                    NodeType operator * ();
+                    const NodeType& operator * () const noexcept;
 
                 friend class List;
             };
 
-            explicit List() noexcept;
+            explicit List(const Allocator& = Allocator());
+            List(const List&);
+            List(List&&) noexcept;
+            List& operator = (const List&);
+            List& operator = (List&&);
             ~List();
 
             NodeType pop_front();
             NodeType pop_back();
             void erase(const size_t&);
+            Iterator erase(Iterator);
 
             void push_front(const NodeType&);
+            void push_front(NodeType&&);
             void push_back(const NodeType&);
+            void push_back(NodeType&&);
+            template <class... Args>
+            NodeType& emplace_front(Args&&...);
+            template <class... Args>
+            NodeType& emplace_back(Args&&...);
+            void splice_back(List&) noexcept;
             [[maybe_unused]]
             void insert(const size_t&, const NodeType&);
+            [[maybe_unused]]
+            void insert(const size_t&, NodeType&&);
+            [[maybe_unused]]
+            Iterator insert(Iterator, const NodeType&);
+            [[maybe_unused]]
+            Iterator insert(Iterator, NodeType&&);
 
             Node* at(const size_t&);
             NodeType& operator [] (const size_t&);
 
             [[maybe_unused]] [[nodiscard]]
             inline size_t length() const noexcept;
+            [[nodiscard]] [[maybe_unused]]
+            inline size_t memory_usage() const noexcept;
             inline Iterator begin() const;
             inline Iterator end() const noexcept;
             [[maybe_unused]]
@@ -123,8 +175,8 @@ namespace DataStructures {
     ///
     /// \param node Указатель на узел, на основе которого
     /// нужно создать итератор.
-    template <class T>
-    List<T>::Iterator::Iterator(const Node* node) noexcept :
+    template <class T, class A>
+    List<T, A>::Iterator::Iterator(const Node* node) noexcept :
             current_node(node) { }
 
     /// \brief Позволяет переназначить узел, на который ссылается итератор.
@@ -132,8 +184,8 @@ namespace DataStructures {
     /// \param node Указатель на новый узел.
     ///
     /// \return Объект-итератор.
-    template <class T>
-    List<T>::Iterator& List<T>::Iterator::operator = (const Node* node) noexcept {
+    template <class T, class A>
+    List<T, A>::Iterator& List<T, A>::Iterator::operator = (const Node* node) noexcept {
         this->current_node = node;
         return *this;
     }
@@ -141,8 +193,8 @@ namespace DataStructures {
     /// \brief Перемещает итератор на след. элемент списка.
     ///
     /// \return Объект-итератор.
-    template <class T>
-    List<T>::Iterator& List<T>::Iterator::operator ++ () noexcept {
+    template <class T, class A>
+    List<T, A>::Iterator& List<T, A>::Iterator::operator ++ () noexcept {
         if (this->current_node != nullptr)
             this->current_node = this->current_node->next_;
         return *this;
@@ -151,8 +203,8 @@ namespace DataStructures {
     /// \brief Перемещает итератор на след. элемент списка.
     ///
     /// \return Объект-итератор.
-    template <class T>
-    List<T>::Iterator List<T>::Iterator::operator ++ (int) noexcept {
+    template <class T, class A>
+    List<T, A>::Iterator List<T, A>::Iterator::operator ++ (int) noexcept {
         Iterator iterator = *this;
         ++*this;
         return iterator;
@@ -161,8 +213,8 @@ namespace DataStructures {
     /// \brief Перемещает итератор на пред. элемент списка.
     ///
     /// \return Объект-итератор.
-    template <class T>
-    List<T>::Iterator& List<T>::Iterator::operator -- () noexcept {
+    template <class T, class A>
+    List<T, A>::Iterator& List<T, A>::Iterator::operator -- () noexcept {
         if (this->current_node != nullptr)
             this->current_node = this->current_node->prev_;
         return *this;
@@ -171,8 +223,8 @@ namespace DataStructures {
     /// \brief Перемещает итератор на пред. элемент списка.
     ///
     /// \return Объект-итератор.
-    template <class T>
-    List<T>::Iterator List<T>::Iterator::operator -- (int) noexcept {
+    template <class T, class A>
+    List<T, A>::Iterator List<T, A>::Iterator::operator -- (int) noexcept {
         Iterator* iterator = *this;
         --*this;
         return iterator;
@@ -183,16 +235,16 @@ namespace DataStructures {
     /// \param iterator Объект-итератор для сравнения.
     ///
     /// \return Булевое значение.
-    template <class T>
-    bool List<T>::Iterator::operator != (const Iterator& iterator) noexcept {
+    template <class T, class A>
+    bool List<T, A>::Iterator::operator != (const Iterator& iterator) noexcept {
         return this->current_node != iterator.current_node;
     }
 
     /// \brief Позволяет получить значение, хранящееся в узле.
     ///
-    /// \return Значение узла списка указанного при создании типа.
-    template <class T>
-    T List<T>::Iterator::operator * ()  {
+    /// \return Ссылку на значение узла списка указанного при создании типа.
+    template <class T, class A>
+    const T& List<T, A>::Iterator::operator * () const noexcept {
         return this->current_node->value_;
     }
 
@@ -200,49 +252,211 @@ namespace DataStructures {
     
     /// \brief Стандартный конструктор экземпляра класса List::Node.
     ///
-    /// \param value Значение указанного при создании списка типа
-    /// данных, которое должен хранить узел.
-    template <class T>
-    List<T>::Node::Node(const T& value) noexcept :
-            value_(value), next_(nullptr), prev_(nullptr) { }
+    /// Значение узла конструируется на месте из переданных аргументов.
+    ///
+    /// \param args Аргументы конструктора значения указанного при создании
+    /// списка типа данных.
+    template <class T, class A>
+    template <class... Args>
+    List<T, A>::Node::Node(Args&&... args) :
+            value_(std::forward<Args>(args)...), next_(nullptr),
+            prev_(nullptr) { }
 
 /* ================================== List ================================== */
 
+    /// \brief Создает узел в памяти аллокатора.
+    ///
+    /// \param args Аргументы конструктора значения узла.
+    ///
+    /// \return Указатель на новый узел.
+    template <class T, class A>
+    template <class... Args>
+    List<T, A>::Node* List<T, A>::create_node(Args&&... args) {
+        Node* node{ NodeTraits::allocate(this->allocator_, 1) };
+        try {
+            NodeTraits::construct(this->allocator_, node,
+                                  std::forward<Args>(args)...);
+        }
+        catch (...) {
+            NodeTraits::deallocate(this->allocator_, node, 1);
+            throw;
+        }
+        return node;
+    }
+
+    /// \brief Уничтожает узел и возвращает его память аллокатору.
+    ///
+    /// \param node Указатель на узел.
+    template <class T, class A>
+    void List<T, A>::destroy_node(Node* node) noexcept {
+        NodeTraits::destroy(this->allocator_, node);
+        NodeTraits::deallocate(this->allocator_, node, 1);
+    }
+
+    /// \brief Присоединяет созданный узел к началу списка.
+    ///
+    /// \param node Указатель на узел.
+    template <class T, class A>
+    void List<T, A>::link_front(Node* node) noexcept {
+        this->length_++;
+        node->next_ = this->head_;
+
+        if (this->head_ != nullptr)
+            this->head_->prev_ = node;
+        if (this->tail_ == nullptr)
+            this->tail_ = node;
+
+        this->head_ = node;
+    }
+
+    /// \brief Присоединяет созданный узел к концу списка.
+    ///
+    /// \param node Указатель на узел.
+    template <class T, class A>
+    void List<T, A>::link_back(Node* node) noexcept {
+        this->length_++;
+        node->prev_ = this->tail_;
+
+        if (this->tail_ != nullptr)
+            this->tail_->next_ = node;
+        if (this->head_ == nullptr)
+            this->head_ = node;
+
+        this->tail_ = node;
+    }
+
+    /// \brief Присоединяет созданный узел перед указанным.
+    ///
+    /// \param node Указатель на новый узел.
+    /// \param next Узел, перед которым встает новый, или nullptr для
+    /// присоединения к концу списка.
+    template <class T, class A>
+    void List<T, A>::link_before(Node* node, Node* next) noexcept {
+        if (next == nullptr)
+            return this->link_back(node);
+        if (next->prev_ == nullptr)
+            return this->link_front(node);
+
+        this->length_++;
+        node->prev_ = next->prev_;
+        node->next_ = next;
+        next->prev_->next_ = node;
+        next->prev_ = node;
+    }
+
     /// \brief Стандартный конструктор экземпляра класса List.
-    template <class T>
-     List<T>::List() noexcept :
-            length_(0ULL), head_(nullptr), tail_(nullptr) { }
+    ///
+    /// \param allocator Аллокатор, из которого берутся узлы.
+    template <class T, class A>
+    List<T, A>::List(const A& allocator) :
+            length_(0ULL), head_(nullptr), tail_(nullptr),
+            allocator_(allocator) { }
+
+    /// \brief Конструктор копирования экземпляра класса List.
+    ///
+    /// \param other Копируемый список.
+    template <class T, class A>
+    List<T, A>::List(const List& other) :
+            length_(0ULL), head_(nullptr), tail_(nullptr),
+            allocator_(NodeTraits::select_on_container_copy_construction(
+                    other.allocator_)) {
+        for (Node* node{ other.head_ }; node != nullptr; node = node->next_)
+            this->push_back(node->value_);
+    }
+
+    /// \brief Конструктор перемещения экземпляра класса List.
+    ///
+    /// Узлы забираются целиком, исходный список остается пустым.
+    ///
+    /// \param other Перемещаемый список.
+    template <class T, class A>
+    List<T, A>::List(List&& other) noexcept :
+            length_(std::exchange(other.length_, 0ULL)),
+            head_(std::exchange(other.head_, nullptr)),
+            tail_(std::exchange(other.tail_, nullptr)),
+            allocator_(other.allocator_) { }
+
+    /// \brief Оператор присваивания копированием.
+    ///
+    /// \param other Копируемый список.
+    ///
+    /// \return Ссылку на текущий экземпляр.
+    template <class T, class A>
+    List<T, A>& List<T, A>::operator = (const List& other) {
+        if (this == &other)
+            return *this;
+
+        while (this->head_ != nullptr)
+            this->pop_front();
+        if constexpr (NodeTraits::propagate_on_container_copy_assignment::value)
+            this->allocator_ = other.allocator_;
+        for (Node* node{ other.head_ }; node != nullptr; node = node->next_)
+            this->push_back(node->value_);
+        return *this;
+    }
+
+    /// \brief Оператор присваивания перемещением.
+    ///
+    /// Если аллокаторы списков совместимы, узлы забираются целиком. Иначе
+    /// значения перемещаются в узлы из аллокатора текущего списка.
+    ///
+    /// \param other Перемещаемый список.
+    ///
+    /// \return Ссылку на текущий экземпляр.
+    template <class T, class A>
+    List<T, A>& List<T, A>::operator = (List&& other) {
+        if (this == &other)
+            return *this;
+
+        while (this->head_ != nullptr)
+            this->pop_front();
+        if constexpr (!NodeTraits::propagate_on_container_move_assignment::value) {
+            if (!(this->allocator_ == other.allocator_)) {
+                for (Node* node{ other.head_ }; node != nullptr;
+                        node = node->next_)
+                    this->push_back(std::move(node->value_));
+                while (other.head_ != nullptr)
+                    other.pop_front();
+                return *this;
+            }
+        }
+        else
+            this->allocator_ = other.allocator_;
+
+        this->length_ = std::exchange(other.length_, 0ULL);
+        this->head_ = std::exchange(other.head_, nullptr);
+        this->tail_ = std::exchange(other.tail_, nullptr);
+        return *this;
+    }
 
     // Стандартный деструктор экземпляра.
-    template <class T>
-    List<T>::~List() {
+    template <class T, class A>
+    List<T, A>::~List() {
         Node* temp{ this->head_ };
         while (temp != nullptr) {
             pop_front();
             temp = this->head_;
         }
-        delete this->head_;
-        delete this->tail_;
     }
 
     /// \brief Извлекает элемент из начала списка и возвращает его значение.
     ///
     /// \return Значение, хранящееся в узле списка.
-    template <class T>
-    T List<T>::pop_front() {
+    template <class T, class A>
+    T List<T, A>::pop_front() {
         if (this->head_ == nullptr)
             return T{};
 
         this->length_--;
         Node* new_front_node{ this->head_->next_ };
-        T popped_node_value{ this->head_->value_ };
+        T popped_node_value{ std::move(this->head_->value_) };
 
         if (new_front_node != nullptr)
             new_front_node->prev_ = nullptr;
         else
             this->tail_ = new_front_node;
 
-        delete this->head_;
+        this->destroy_node(this->head_);
         this->head_ = new_front_node;
         return popped_node_value;
     }
@@ -250,21 +464,21 @@ namespace DataStructures {
     /// \brief Извлекает элемент из конца списка и возвращает его значение.
     ///
     /// \return Значение, хранящееся в узле списка.
-    template <class T>
-    T List<T>::pop_back() {
+    template <class T, class A>
+    T List<T, A>::pop_back() {
         if (this->tail_ == nullptr)
             return T{};
 
         this->length_--;
         Node* new_back_node{ this->tail_->prev_ };
-        T popped_node_value{ this->tail_->value_ };
+        T popped_node_value{ std::move(this->tail_->value_) };
 
         if (new_back_node != nullptr)
             new_back_node->next_ = nullptr;
         else
             this->head_ = new_back_node;
 
-        delete this->tail_;
+        this->destroy_node(this->tail_);
         this->tail_ = new_back_node;
         return popped_node_value;
     }
@@ -272,8 +486,8 @@ namespace DataStructures {
     /// \brief Удаляет произвольный элемент списка.
     ///
     /// \param index Индекс узла.
-    template <class T>
-    void List<T>::erase(const size_t& index) {
+    template <class T, class A>
+    void List<T, A>::erase(const size_t& index) {
         Node* erasing_node{ this->at(index) };
 
         if (erasing_node == nullptr)
@@ -293,50 +507,130 @@ namespace DataStructures {
         left_node->next_ = right_node;
         right_node->prev_ = left_node;
 
-        delete erasing_node;
+        this->destroy_node(erasing_node);
+    }
+
+    /// \brief Удаляет элемент, на который указывает итератор, за O(1).
+    ///
+    /// \param position Итератор на удаляемый элемент списка.
+    ///
+    /// \return Итератор на следующий за удаленным элемент.
+    template <class T, class A>
+    List<T, A>::Iterator List<T, A>::erase(Iterator position) {
+        auto* erasing_node{ const_cast<Node*>(position.current_node) };
+        if (erasing_node == nullptr)
+            return this->end();
+
+        Node* next_node{ erasing_node->next_ };
+        if (erasing_node->prev_ != nullptr)
+            erasing_node->prev_->next_ = next_node;
+        else
+            this->head_ = next_node;
+        if (next_node != nullptr)
+            next_node->prev_ = erasing_node->prev_;
+        else
+            this->tail_ = erasing_node->prev_;
+
+        this->length_--;
+        this->destroy_node(erasing_node);
+        return Iterator(next_node);
     }
 
     /// \brief Добавляет узел в начало списка.
     ///
     /// \param data Данные, которые нужно внести в узел.
-    template <class T>
-    void List<T>::push_front(const T& data) {
-        this->length_++;
-        auto* new_node{ new Node(data) };
-        new_node->next_ = this->head_;
-
-        if (this->head_ != nullptr)
-            this->head_->prev_ = new_node;
-        if (this->tail_ == nullptr)
-            this->tail_ = new_node;
+    template <class T, class A>
+    void List<T, A>::push_front(const T& data) {
+        this->link_front(this->create_node(data));
+    }
 
-        this->head_ = new_node;
+    /// \brief Добавляет узел в начало списка, перемещая в него данные.
+    ///
+    /// \param data Данные, которые нужно внести в узел.
+    template <class T, class A>
+    void List<T, A>::push_front(T&& data) {
+        this->link_front(this->create_node(std::move(data)));
     }
 
     /// \brief Добавляет узел в конец списка.
     ///
     /// \param data Данные, которые нужно внести в узел.
-    template <class T>
-    void List<T>::push_back(const T& data) {
-        this->length_++;
-        auto* new_node{ new Node(data) };
-        new_node->prev_ = this->tail_;
+    template <class T, class A>
+    void List<T, A>::push_back(const T& data) {
+        this->link_back(this->create_node(data));
+    }
 
-        if (this->tail_ != nullptr)
-            this->tail_->next_ = new_node;
-        if (this->head_ == nullptr)
-            this->head_ = new_node;
+    /// \brief Добавляет узел в конец списка, перемещая в него данные.
+    ///
+    /// \param data Данные, которые нужно внести в узел.
+    template <class T, class A>
+    void List<T, A>::push_back(T&& data) {
+        this->link_back(this->create_node(std::move(data)));
+    }
 
-        this->tail_ = new_node;
+    /// \brief Создает значение на месте в новом узле в начале списка.
+    ///
+    /// \param args Аргументы конструктора значения.
+    ///
+    /// \return Ссылку на созданное значение.
+    template <class T, class A>
+    template <class... Args>
+    T& List<T, A>::emplace_front(Args&&... args) {
+        Node* new_node{ this->create_node(std::forward<Args>(args)...) };
+        this->link_front(new_node);
+        return new_node->value_;
+    }
+
+    /// \brief Создает значение на месте в новом узле в конце списка.
+    ///
+    /// \param args Аргументы конструктора значения.
+    ///
+    /// \return Ссылку на созданное значение.
+    template <class T, class A>
+    template <class... Args>
+    T& List<T, A>::emplace_back(Args&&... args) {
+        Node* new_node{ this->create_node(std::forward<Args>(args)...) };
+        this->link_back(new_node);
+        return new_node->value_;
+    }
+
+    /// \brief Переносит первый узел другого списка в конец текущего.
+    ///
+    /// Узел перевешивается целиком: ни выделения памяти, ни копирования
+    /// значения не происходит. Если исходный список пуст, ничего не
+    /// меняется. Аллокаторы списков должны быть равны.
+    ///
+    /// \param source Список, из начала которого забирается узел.
+    template <class T, class A>
+    void List<T, A>::splice_back(List& source) noexcept {
+        Node* moved_node{ source.head_ };
+        if (moved_node == nullptr)
+            return;
+
+        source.length_--;
+        source.head_ = moved_node->next_;
+        if (source.head_ != nullptr)
+            source.head_->prev_ = nullptr;
+        else
+            source.tail_ = nullptr;
+
+        this->length_++;
+        moved_node->next_ = nullptr;
+        moved_node->prev_ = this->tail_;
+        if (this->tail_ != nullptr)
+            this->tail_->next_ = moved_node;
+        else
+            this->head_ = moved_node;
+        this->tail_ = moved_node;
     }
 
     /// \brief Вставляет новый узел в произвольное место списка
     ///
     /// \param index Индекс, на который нужно вставить новый узел.
     /// \param value Данные, которые нужно внести в узел.
-    template <class T>
+    template <class T, class A>
     [[maybe_unused]]
-    void List<T>::insert(const size_t& index, const T& value) {
+    void List<T, A>::insert(const size_t& index, const T& value) {
         Node* right_node{ this->at(index) };
         if (right_node == nullptr)
             return this->push_back(value);
@@ -345,14 +639,70 @@ namespace DataStructures {
         if (left_node == nullptr)
             return this->push_front(value);
 
+        Node* new_node{ this->create_node(value) };
         this->length_++;
-        auto* new_node{ new Node(value) };
         new_node->prev_ = left_node;
         new_node->next_ = right_node;
         left_node->next_ = new_node;
         right_node->prev_ = new_node;
     }
 
+    /// \brief Вставляет новый узел в произвольное место списка, перемещая
+    /// в него данные.
+    ///
+    /// \param index Индекс, на который нужно вставить новый узел.
+    /// \param value Данные, которые нужно внести в узел.
+    template <class T, class A>
+    [[maybe_unused]]
+    void List<T, A>::insert(const size_t& index, T&& value) {
+        Node* right_node{ this->at(index) };
+        if (right_node == nullptr)
+            return this->push_back(std::move(value));
+
+        Node* left_node{ right_node->prev_ };
+        if (left_node == nullptr)
+            return this->push_front(std::move(value));
+
+        Node* new_node{ this->create_node(std::move(value)) };
+        this->length_++;
+        new_node->prev_ = left_node;
+        new_node->next_ = right_node;
+        left_node->next_ = new_node;
+        right_node->prev_ = new_node;
+    }
+
+    /// \brief Вставляет новый узел перед элементом, на который указывает
+    /// итератор, за O(1).
+    ///
+    /// \param position Итератор на элемент, перед которым вставляется
+    /// новый; end() - вставка в конец.
+    /// \param value Данные, которые нужно внести в узел.
+    ///
+    /// \return Итератор на вставленный элемент.
+    template <class T, class A>
+    [[maybe_unused]]
+    List<T, A>::Iterator List<T, A>::insert(Iterator position, const T& value) {
+        Node* new_node{ this->create_node(value) };
+        this->link_before(new_node, const_cast<Node*>(position.current_node));
+        return Iterator(new_node);
+    }
+
+    /// \brief Вставляет новый узел перед элементом, на который указывает
+    /// итератор, перемещая в него данные.
+    ///
+    /// \param position Итератор на элемент, перед которым вставляется
+    /// новый; end() - вставка в конец.
+    /// \param value Данные, которые нужно внести в узел.
+    ///
+    /// \return Итератор на вставленный элемент.
+    template <class T, class A>
+    [[maybe_unused]]
+    List<T, A>::Iterator List<T, A>::insert(Iterator position, T&& value) {
+        Node* new_node{ this->create_node(std::move(value)) };
+        this->link_before(new_node, const_cast<Node*>(position.current_node));
+        return Iterator(new_node);
+    }
+
     /// \brief Позволяет получить узел списка по индексу.
     ///
     /// \param index Индекс узла.
@@ -361,8 +711,8 @@ namespace DataStructures {
     ///
     /// \throw std::out_of_range Исключение возбуждается, если индекс
     /// выходит за границы списка.
-    template <class T>
-    List<T>::Node* List<T>::at(const size_t& index) {
+    template <class T, class A>
+    List<T, A>::Node* List<T, A>::at(const size_t& index) {
         if (index > (this->length_ - 1)) {
             throw std::out_of_range("List index is out of range.");
         }
@@ -396,42 +746,51 @@ namespace DataStructures {
     /// \param index Индекс узла.
     ///
     /// \return Значение узла списка указанного при создании типа.
-    template <class T>
-    T& List<T>::operator [] (const size_t& index) {
+    template <class T, class A>
+    T& List<T, A>::operator [] (const size_t& index) {
         return this->at(index)->value_;
     }
 
     /// \brief Позволяет получить количество элементов списка.
     ///
     /// \return Значение кол-ва элементов.
-    template <class T>
+    template <class T, class A>
     [[maybe_unused]] [[nodiscard]]
-    inline size_t List<T>::length() const noexcept {
+    inline size_t List<T, A>::length() const noexcept {
         return this->length_;
     }
 
+    /// \brief Определяет объем памяти, занятой узлами списка.
+    ///
+    /// \return Количество байтов, выделенных под узлы.
+    template <class T, class A>
+    [[nodiscard]] [[maybe_unused]]
+    inline size_t List<T, A>::memory_usage() const noexcept {
+        return this->length_ * sizeof(Node);
+    }
+
     /// \brief Создает итератор от начала списка.
     ///
     /// \return Объект-итератор.
-    template <class T>
-    inline List<T>::Iterator List<T>::begin() const {
+    template <class T, class A>
+    inline List<T, A>::Iterator List<T, A>::begin() const {
         return Iterator(this->head_);
     }
 
     /// \brief Создает итератор на конец списка (nullptr).
     ///
     /// \return Объект-итератор.
-    template <class T>
-    inline List<T>::Iterator List<T>::end() const noexcept {
+    template <class T, class A>
+    inline List<T, A>::Iterator List<T, A>::end() const noexcept {
         return Iterator(nullptr);
     }
 
     /// \brief Создает итератор от конца списка (реверсивный перебор).
     ///
     /// \return Объект-итератор.
-    template <class T>
+    template <class T, class A>
     [[maybe_unused]]
-    inline List<T>::Iterator List<T>::rbegin() const {
+    inline List<T, A>::Iterator List<T, A>::rbegin() const {
         return Iterator(this->tail_);
     }
 
@@ -439,9 +798,9 @@ namespace DataStructures {
     /// (реверсивный перебор).
     ///
     /// \return Объект-итератор.
-    template <class T>
+    template <class T, class A>
     [[maybe_unused]]
-    inline List<T>::Iterator List<T>::rend() const noexcept {
+    inline List<T, A>::Iterator List<T, A>::rend() const noexcept {
         return Iterator(nullptr);
     }
 }
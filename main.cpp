@@ -1,8 +1,14 @@
 #include <iostream>
+#include "boundedhashtable.hpp"
+#include "columnartable.hpp"
 #include "orderhashtable.hpp"
+#include "persistenthashtable.hpp"
 
+using DataStructures::BoundedOrderedHashTable;
+using DataStructures::ColumnarTable;
 using DataStructures::List;
 using DataStructures::OrderedHashTable;
+using DataStructures::PersistentOrderedHashTable;
 
 int main() {
     // Примеры использования.
@@ -24,9 +30,37 @@ int main() {
 
     ht.insert("Test", temp);
 
-    for (auto it{ ht["Test"].keys()->begin() };
-             it != ht["Test"].keys()->end(); it++)
-        std::cout << *it << " : " << ht["Test"][*it] << std::endl;
+    // Пары перебираются по массиву порядка добавления без повторного
+    // поиска каждого ключа.
+    for (const auto& [key, value] : ht["Test"].items())
+        std::cout << key << " : " << value << std::endl;
+
+    // Те же строки с общей схемой: имена полей хранятся один раз, а
+    // значения каждого поля - одним массивом.
+    ColumnarTable<int> rows{ "Count", "WinRate", "Town" };
+    rows.insert("Test", { 3, 50, -1234 });
+    rows.insert("Other", { 7, 25, 45 });
+    rows["Test"]["Town"] = 45;
+    std::cout << "Town sum : " << rows.sum("Town") << std::endl;
+
+    // Снимок берется за O(1) и не видит последующих изменений.
+    PersistentOrderedHashTable<int> scores;
+    scores.insert("Sun", 643);
+    scores.insert("Moon", 12);
+    const auto frozen{ scores.snapshot() };
+    scores.insert("Moon", 13);
+    scores.erase("Sun");
+    for (auto it{ frozen.begin() }; it != frozen.end(); ++it)
+        std::cout << (*it).first << " : " << (*it).second << std::endl;
+
+    // Кеш на две записи: обращение к "Sun" делает первой кандидатом на
+    // вытеснение запись "Moon".
+    BoundedOrderedHashTable<int> cache{ { .max_entries_ = 2 } };
+    cache.insert("Sun", 643);
+    cache.insert("Moon", 12);
+    std::cout << cache["Sun"] << std::endl;
+    cache.insert("Town", 45);
+    std::cout << "Moon cached : " << std::boolalpha << cache.contains("Moon") << std::endl;
 
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,385 @@
+/// \file memorypool.hpp.
+/// \author Лошкарев Дмитрий.
+/// \date 14.10.2026.
+///
+/// \brief Содержит пул памяти для узлов списков и записей хеш-таблиц.
+///
+/// \namespaces
+/// • DataStructures
+/// \classes
+/// • SlabPool
+/// • PoolAllocator
+
+#ifndef CPPPROJECT_MEMORYPOOL_H
+#define CPPPROJECT_MEMORYPOOL_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <type_traits>
+
+namespace DataStructures {
+// Объявление классов.
+
+    /// \class Класс SlabPool предоставляет пул памяти для мелких объектов
+    /// (узлов, записей), совместимый с std::pmr::memory_resource.
+    ///
+    /// Память запрашивается у вышестоящего ресурса крупными блоками (slab),
+    /// размер которых удваивается от MIN_SLAB_SIZE до MAX_SLAB_SIZE, и
+    /// нарезается на ячейки размером, кратным BLOCK_ALIGN. Освобожденные
+    /// ячейки попадают в список свободных ячеек своего размера и выдаются
+    /// повторно. Запросы крупнее MAX_BLOCK_SIZE передаются вышестоящему
+    /// ресурсу напрямую. При уничтожении пула все блоки освобождаются разом.
+    ///
+    /// Пул не потокобезопасен: каждой хеш-таблице полагается свой пул.
+    /// Атомарен только счетчик ссылок, так что аллокаторы одного пула
+    /// можно копировать и уничтожать в разных потоках, например когда
+    /// таблицу создают в одном потоке, а уничтожают в другом.
+    ///
+    /// Публичные методы:
+    /// \n • void release() noexcept
+    /// \n • size_t slab_count() const noexcept
+    class SlabPool : public std::pmr::memory_resource {
+        private:
+            static inline constexpr size_t BLOCK_ALIGN{ 16 };        ///< \brief Выравнивание и шаг размеров ячеек.
+            static inline constexpr size_t MAX_BLOCK_SIZE{ 256 };    ///< \brief Максимальный размер ячейки пула.
+            static inline constexpr size_t MIN_SLAB_SIZE{ 1024 };    ///< \brief Размер первого блока.
+            static inline constexpr size_t MAX_SLAB_SIZE{ 65536 };   ///< \brief Максимальный размер блока.
+            static inline constexpr size_t CLASS_COUNT{ MAX_BLOCK_SIZE /
+                                                        BLOCK_ALIGN };  ///< \brief Количество размеров ячеек.
+
+            /// \class Структура FreeBlock описывает освобожденную ячейку,
+            /// хранящую в себе указатель на следующую свободную ячейку.
+            struct FreeBlock {
+                FreeBlock* next_;
+            };
+
+            /// \class Структура Slab описывает заголовок блока памяти,
+            /// связывающий все блоки пула в список.
+            struct alignas(BLOCK_ALIGN) Slab {
+                Slab* next_;
+                size_t size_;  ///< \brief Размер блока вместе с заголовком.
+            };
+
+            std::pmr::memory_resource* upstream_;  ///< \brief Вышестоящий ресурс.
+            FreeBlock* free_lists_[CLASS_COUNT];   ///< \brief Списки свободных ячеек по размерам.
+            Slab* slabs_;                          ///< \brief Список выделенных блоков.
+            std::byte* cursor_;                    ///< \brief Начало неразмеченной памяти блока.
+            std::byte* slab_end_;                  ///< \brief Конец текущего блока.
+            size_t next_slab_size_;                ///< \brief Размер следующего блока.
+            size_t slab_count_;
+            std::atomic<size_t> ref_count_;        ///< \brief Количество PoolAllocator, ссылающихся
+                                                   ///< на пул.
+
+            [[nodiscard]]
+            static inline size_t size_class(const size_t&) noexcept;
+            void add_slab();
+
+            void* do_allocate(size_t, size_t) override;
+            void do_deallocate(void*, size_t, size_t) override;
+            [[nodiscard]]
+            bool do_is_equal(const std::pmr::memory_resource&)
+                const noexcept override;
+        public:
+            explicit SlabPool(std::pmr::memory_resource* =
+                    std::pmr::new_delete_resource()) noexcept;
+            SlabPool(const SlabPool&) = delete;
+            SlabPool& operator = (const SlabPool&) = delete;
+            ~SlabPool() override;
+
+            void release() noexcept;
+            [[nodiscard]] [[maybe_unused]]
+            inline size_t slab_count() const noexcept;
+
+            template <class T>
+            friend class PoolAllocator;
+    };
+
+    /// \class Класс PoolAllocator предоставляет аллокатор, совместимый со
+    /// стандартными контейнерами, поверх пула SlabPool.
+    ///
+    /// Созданный по умолчанию аллокатор заводит собственный пул; копии и
+    /// перепривязанные к другому типу аллокаторы разделяют его. Пул
+    /// уничтожается вместе с последним ссылающимся на него аллокатором,
+    /// поэтому память хеш-таблицы возвращается системе целиком при ее
+    /// уничтожении. Копия контейнера получает новый пул
+    /// (select_on_container_copy_construction).
+    ///
+    /// Публичные методы:
+    /// \n • T* allocate(size_t n)
+    /// \n • void deallocate(T* ptr, size_t n) noexcept
+    /// \n • PoolAllocator select_on_container_copy_construction() const
+    /// \n • SlabPool* resource() const noexcept
+    ///
+    /// \tparam T Тип размещаемых объектов.
+    template <class T>
+    class PoolAllocator {
+        private:
+            SlabPool* pool_;
+
+            template <class U>
+            friend class PoolAllocator;
+        public:
+            using value_type = T;
+            using propagate_on_container_copy_assignment = std::false_type;
+            using propagate_on_container_move_assignment = std::true_type;
+            using propagate_on_container_swap = std::true_type;
+            using is_always_equal = std::false_type;
+
+            PoolAllocator();
+            PoolAllocator(const PoolAllocator&) noexcept;
+            template <class U>
+            PoolAllocator(const PoolAllocator<U>&) noexcept;
+            PoolAllocator& operator = (const PoolAllocator&) noexcept;
+            ~PoolAllocator();
+
+            [[nodiscard]]
+            T* allocate(const size_t&);
+            void deallocate(T*, const size_t&) noexcept;
+            [[nodiscard]]
+            PoolAllocator select_on_container_copy_construction() const;
+            [[nodiscard]] [[maybe_unused]]
+            inline SlabPool* resource() const noexcept;
+
+            template <class U>
+            bool operator == (const PoolAllocator<U>&) const noexcept;
+    };
+
+// Определения методов классов.
+/* ================================ SlabPool ================================ */
+// PRIVATE
+
+    /// \brief Определяет номер списка свободных ячеек для размера.
+    ///
+    /// \param bytes Запрошенный размер в байтах.
+    ///
+    /// \return Номер размера ячейки.
+    [[nodiscard]]
+    inline size_t SlabPool::size_class(const size_t& bytes) noexcept {
+        return (bytes == 0) ? 0 : (bytes - 1) / BLOCK_ALIGN;
+    }
+
+    /// \brief Запрашивает у вышестоящего ресурса новый блок памяти.
+    ///
+    /// Неразмеченный остаток текущего блока при этом больше не используется.
+    inline void SlabPool::add_slab() {
+        auto* slab{ static_cast<Slab*>(this->upstream_->allocate(
+                this->next_slab_size_, BLOCK_ALIGN)) };
+        slab->next_ = this->slabs_;
+        slab->size_ = this->next_slab_size_;
+        this->slabs_ = slab;
+        this->slab_count_++;
+
+        this->cursor_ = reinterpret_cast<std::byte*>(slab) + sizeof(Slab);
+        this->slab_end_ = reinterpret_cast<std::byte*>(slab) + slab->size_;
+        if (this->next_slab_size_ < MAX_SLAB_SIZE)
+            this->next_slab_size_ *= 2;
+    }
+
+    /// \brief Выделяет память из пула.
+    ///
+    /// \param bytes Размер в байтах.
+    /// \param alignment Требуемое выравнивание.
+    ///
+    /// \return Указатель на выделенную память.
+    inline void* SlabPool::do_allocate(size_t bytes, size_t alignment) {
+        if (bytes > MAX_BLOCK_SIZE || alignment > BLOCK_ALIGN)
+            return this->upstream_->allocate(bytes, alignment);
+
+        size_t block_class{ size_class(bytes) };
+        // Сначала повторно используется освобожденная ячейка.
+        FreeBlock* block{ this->free_lists_[block_class] };
+        if (block != nullptr) {
+            this->free_lists_[block_class] = block->next_;
+            return block;
+        }
+
+        size_t block_size{ (block_class + 1) * BLOCK_ALIGN };
+        if (this->cursor_ == nullptr ||
+            static_cast<size_t>(this->slab_end_ - this->cursor_) < block_size)
+            this->add_slab();
+        void* memory{ this->cursor_ };
+        this->cursor_ += block_size;
+        return memory;
+    }
+
+    /// \brief Возвращает память в пул.
+    ///
+    /// \param ptr Указатель на освобождаемую память.
+    /// \param bytes Размер в байтах, указанный при выделении.
+    /// \param alignment Выравнивание, указанное при выделении.
+    inline void SlabPool::do_deallocate(void* ptr, size_t bytes,
+                                        size_t alignment) {
+        if (bytes > MAX_BLOCK_SIZE || alignment > BLOCK_ALIGN) {
+            this->upstream_->deallocate(ptr, bytes, alignment);
+            return;
+        }
+        size_t block_class{ size_class(bytes) };
+        auto* block{ static_cast<FreeBlock*>(ptr) };
+        block->next_ = this->free_lists_[block_class];
+        this->free_lists_[block_class] = block;
+    }
+
+    /// \brief Проверяет, что память одного ресурса можно освободить другим.
+    ///
+    /// \param other Ресурс для сравнения.
+    ///
+    /// \return true, только если это тот же самый пул.
+    [[nodiscard]]
+    inline bool SlabPool::do_is_equal(const std::pmr::memory_resource& other)
+    const noexcept {
+        return this == &other;
+    }
+
+// PUBLIC
+
+    /// \brief Стандартный конструктор экземпляра класса SlabPool.
+    ///
+    /// \param upstream Ресурс, у которого запрашиваются блоки памяти.
+    inline SlabPool::SlabPool(std::pmr::memory_resource* upstream) noexcept :
+            upstream_(upstream), free_lists_(), slabs_(nullptr),
+            cursor_(nullptr), slab_end_(nullptr),
+            next_slab_size_(MIN_SLAB_SIZE), slab_count_(0), ref_count_(0) { }
+
+    // Стандартный деструктор экземпляра.
+    inline SlabPool::~SlabPool() {
+        this->release();
+    }
+
+    /// \brief Освобождает все блоки пула разом.
+    ///
+    /// Все выделенные из пула ячейки становятся недействительными.
+    /// Крупные запросы, переданные вышестоящему ресурсу, не затрагиваются.
+    inline void SlabPool::release() noexcept {
+        while (this->slabs_ != nullptr) {
+            Slab* next_slab{ this->slabs_->next_ };
+            this->upstream_->deallocate(this->slabs_, this->slabs_->size_,
+                                        BLOCK_ALIGN);
+            this->slabs_ = next_slab;
+        }
+        for (auto& free_list : this->free_lists_)
+            free_list = nullptr;
+        this->cursor_ = this->slab_end_ = nullptr;
+        this->next_slab_size_ = MIN_SLAB_SIZE;
+        this->slab_count_ = 0;
+    }
+
+    /// \brief Предоставляет доступ к количеству выделенных блоков.
+    ///
+    /// \return Значение кол-ва блоков.
+    [[nodiscard]] [[maybe_unused]]
+    inline size_t SlabPool::slab_count() const noexcept {
+        return this->slab_count_;
+    }
+
+/* ============================== PoolAllocator ============================== */
+
+    /// \brief Стандартный конструктор экземпляра класса PoolAllocator.
+    ///
+    /// Заводит новый пул.
+    template <class T>
+    PoolAllocator<T>::PoolAllocator() : pool_(new SlabPool()) {
+        this->pool_->ref_count_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /// \brief Конструктор копирования: копия разделяет пул с исходным
+    /// аллокатором.
+    ///
+    /// \param other Копируемый аллокатор.
+    template <class T>
+    PoolAllocator<T>::PoolAllocator(const PoolAllocator& other) noexcept :
+            pool_(other.pool_) {
+        this->pool_->ref_count_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /// \brief Конструктор перепривязки к другому типу: новый аллокатор
+    /// разделяет пул с исходным.
+    ///
+    /// \param other Исходный аллокатор.
+    template <class T>
+    template <class U>
+    PoolAllocator<T>::PoolAllocator(const PoolAllocator<U>& other) noexcept :
+            pool_(other.pool_) {
+        this->pool_->ref_count_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /// \brief Оператор присваивания копированием.
+    ///
+    /// \param other Копируемый аллокатор.
+    ///
+    /// \return Ссылку на текущий экземпляр.
+    template <class T>
+    PoolAllocator<T>& PoolAllocator<T>::operator = (const PoolAllocator& other)
+    noexcept {
+        other.pool_->ref_count_.fetch_add(1, std::memory_order_relaxed);
+        if (this->pool_->ref_count_.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            delete this->pool_;
+        this->pool_ = other.pool_;
+        return *this;
+    }
+
+    // Стандартный деструктор экземпляра. Последний аллокатор уничтожает пул.
+    template <class T>
+    PoolAllocator<T>::~PoolAllocator() {
+        // acq_rel: перед удалением пула видны все действия с ним в других
+        // потоках, отпустивших свои ссылки.
+        if (this->pool_->ref_count_.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            delete this->pool_;
+    }
+
+    /// \brief Выделяет память под несколько объектов.
+    ///
+    /// \param count Количество объектов.
+    ///
+    /// \return Указатель на память под первый объект.
+    template <class T>
+    [[nodiscard]]
+    T* PoolAllocator<T>::allocate(const size_t& count) {
+        return static_cast<T*>(this->pool_->allocate(count * sizeof(T),
+                                                     alignof(T)));
+    }
+
+    /// \brief Возвращает память в пул.
+    ///
+    /// \param ptr Указатель, полученный от allocate().
+    /// \param count Количество объектов, указанное при выделении.
+    template <class T>
+    void PoolAllocator<T>::deallocate(T* ptr, const size_t& count) noexcept {
+        this->pool_->deallocate(ptr, count * sizeof(T), alignof(T));
+    }
+
+    /// \brief Выбирает аллокатор для копии контейнера.
+    ///
+    /// \return Аллокатор с новым пулом: копии контейнеров не разделяют
+    /// память.
+    template <class T>
+    [[nodiscard]]
+    PoolAllocator<T> PoolAllocator<T>::select_on_container_copy_construction()
+    const {
+        return PoolAllocator();
+    }
+
+    /// \brief Предоставляет доступ к пулу аллокатора.
+    ///
+    /// \return Указатель на пул.
+    template <class T>
+    [[nodiscard]] [[maybe_unused]]
+    inline SlabPool* PoolAllocator<T>::resource() const noexcept {
+        return this->pool_;
+    }
+
+    /// \brief Проверяет, что аллокаторы разделяют один пул.
+    ///
+    /// \param other Аллокатор для сравнения.
+    ///
+    /// \return Булевое значение.
+    template <class T>
+    template <class U>
+    bool PoolAllocator<T>::operator == (const PoolAllocator<U>& other)
+    const noexcept {
+        return this->pool_ == other.pool_;
+    }
+}
+
+#endif
@@ -7,23 +7,40 @@
 /// \namespaces
 /// • DataStructures
 /// \classes
+/// • GrowthPolicy
 /// • OrderedHashTable
 
 #ifndef CPPPROJECT_ORDERHASHTABLE_H
 #define CPPPROJECT_ORDERHASHTABLE_H
 
 #include <iostream>
-#include <cmath>
 #include <format>
+#include <cstddef>
 #include <cstdint>
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <concepts>
+#include <memory>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
 #include <utility>
+#include <variant>
+#include <vector>
 
+#include "compactkey.hpp"
 #include "list.hpp"
-
-// Макросы для функции хеширования.
-#define HASH_CONST_D ((2.23606797749978969 - 1) / 2)
-#define HASH_CONST_I 5381
-#define HASH_CONST_I_2 33
+#include "memorypool.hpp"
+#include "hasher.hpp"
+#include "hashstats.hpp"
+#include "hashstorage.hpp"
+#include "sortedindex.hpp"
+#include "threadpool.hpp"
 
 /// \namespace Пространство имен DataStructures содержит в себе
 /// классы-реализации двух структур данных: двусвязного списка в виде
@@ -34,25 +51,181 @@
 /// \n • OrderedHashTable;
 /// \n • List.
 namespace DataStructures {
+// Объявление перечислений.
+
+    /// \enum Перечисление RehashMode описывает способ перехеширования
+    /// хеш-таблицы при ее расширении.
+    ///
+    /// \n • BLOCKING - все ключи переносятся за один вызов expand();
+    /// \n • INCREMENTAL - старое и новое хранилища существуют одновременно,
+    /// каждая операция переносит ограниченное число ячеек.
+    enum class RehashMode : uint8_t {
+        BLOCKING,
+        INCREMENTAL
+    };
+
+    /// \enum Перечисление TableSizing описывает выбор размеров хеш-таблицы.
+    ///
+    /// \n • GEOMETRIC - размер умножается на коэффициент расширения;
+    /// \n • POWER_OF_TWO - размер округляется вверх до степени двойки;
+    /// \n • PRIME - размер округляется вверх до простого числа.
+    enum class TableSizing : uint8_t {
+        GEOMETRIC,
+        POWER_OF_TWO,
+        PRIME
+    };
+
 // Объявление классов.
 
+    /// \class Структура GrowthPolicy описывает, когда и до какого размера
+    /// хеш-таблица расширяется и сжимается.
+    ///
+    /// Размеры берутся из ряда min_size_ * growth_factor_^k (GEOMETRIC)
+    /// или округляются до степени двойки или простого числа. Политика -
+    /// литеральный тип, так что ее можно задать constexpr-константой.
+    ///
+    /// Публичные методы:
+    /// \n • size_t grow(const size_t& size) const noexcept;
+    /// \n • size_t fit(const size_t& count) const noexcept;
+    /// \n • bool valid(const double& storage_max_load) const noexcept.
+    struct GrowthPolicy {
+        double max_load_factor_{ 0.5 };  ///< \brief Отношение количества ключей к размеру
+                                         ///< таблицы, при котором она расширяется.
+        double min_load_factor_{ 0.0 };  ///< \brief Отношение, ниже которого таблица
+                                         ///< сжимается после удаления, или 0, если
+                                         ///< таблица не сжимается.
+        double growth_factor_{ 2.0 };    ///< \brief Коэффициент расширения.
+        size_t min_size_{ 64 };          ///< \brief Минимальный размер таблицы.
+        TableSizing sizing_{ TableSizing::GEOMETRIC };
+
+        [[nodiscard]]
+        constexpr size_t grow(const size_t&) const noexcept;
+        [[nodiscard]]
+        constexpr size_t fit(const size_t&) const noexcept;
+        [[nodiscard]]
+        constexpr bool valid(const double&) const noexcept;
+    private:
+        [[nodiscard]]
+        constexpr size_t round(const size_t&) const noexcept;
+        [[nodiscard]]
+        static constexpr size_t next_prime(size_t) noexcept;
+    };
+
+    template <class HashType, class StoragePolicy, class Hasher,
+              class Allocator>
+    class ConcurrentOrderedHashTable;
+
+    template <class HashType, class Hasher>
+    class MappedOrderedHashTable;
+
+    template <class HashType, class Hasher>
+    class AsyncSnapshot;
+
+    template <class HashType, class StoragePolicy, class Hasher>
+    class DurableOrderedHashTable;
+
+    template <class ValueType, class StoragePolicy, class Hasher>
+    class ColumnarTable;
+
+    template <class HashType, class StoragePolicy, class Hasher>
+    class BoundedOrderedHashTable;
+
+    class TableSchema;
+
     /// \class Класс OrderedHashTable предоставляет реализацию структуры
     /// данных "хеш-таблица", позволяет эффективно хранить пары "ключ-значение"
     /// и обращаться к ним.
     /// Также класс предоставляет возможность итерироваться
-    /// по хеш-таблице в порядке добавления ключей.
+    /// по хеш-таблице в порядке добавления ключей: указатели на записи
+    /// лежат в этом порядке в непрерывном массиве, поэтому полный обход
+    /// - последовательное чтение памяти без хеширования. Каждая запись
+    /// знает свою позицию в массиве, поэтому удаление заменяет ее пустой
+    /// ячейкой за O(1), а пустые ячейки уплотняются, когда их становится
+    /// больше, чем записей.
+    /// По запросу таблица ведет упорядоченный индекс ключей (B+-дерево),
+    /// через который перебираются ключи из диапазона или с префиксом без
+    /// обхода всех записей.
+    /// Ключи для поиска принимаются как KeyArgument: строковые - как
+    /// std::string_view, поэтому срезы буфера и строки C не копируются во
+    /// временные std::string, а строка ключа создается только при добавлении
+    /// новой записи. Целочисленные и другие trivially copyable ключи
+    /// передаются по значению, хранятся в записи без отдельной памяти и
+    /// хешируются IntegerHasher, если Hasher принимает только строки.
     ///
     /// Публичные методы:
-    /// \n • void insert(const std::string& key, const HashType& value);
-    /// \n • void erase(const std::string& key);
+    /// \n • const KeyView* keys() const noexcept;
+    /// \n • ItemView items() noexcept;
+    /// \n • void insert(KeyArgument key, const HashType& value);
+    /// \n • void insert(KeyArgument key, HashType&& value);
+    /// \n • HashType& emplace(KeyArgument key, Args&&... args);
+    /// \n • std::pair<HashType&, bool> try_emplace(KeyArgument key,
+    /// Args&&... args);
+    /// \n • std::pair<HashType&, bool> insert_or_assign(KeyArgument key,
+    /// Value&& value);
+    /// \n • void erase(KeyArgument key);
     /// \n • HashType pop();
-    /// \n • HashType get(const std::string& key);
-    /// \n • HashType& operator [] (const std::string& key).
+    /// \n • HashType pop_front();
+    /// \n • const HashType& get(KeyArgument key);
+    /// \n • HashType& operator [] (KeyArgument key);
+    /// \n • void reserve(const size_t& count);
+    /// \n • void shrink_to_fit();
+    /// \n • void set_growth_policy(const GrowthPolicy& policy);
+    /// \n • const GrowthPolicy& growth_policy() const noexcept;
+    /// \n • const std::shared_ptr<KeyArena>& key_arena() const noexcept
+    /// (для ключей CompactKey);
+    /// \n • void insert_batch(std::span<const std::pair<KeyArgument,
+    /// HashType>> items);
+    /// \n • void get_batch(std::span<const KeyArgument> keys,
+    /// std::span<HashType*> out);
+    /// \n • static OrderedHashTable bulk_build(const Range& items,
+    /// ThreadPool& pool, const Allocator& allocator);
+    /// \n • void enable_sorted_index();
+    /// \n • SortedRange range(KeyArgument low, KeyArgument high);
+    /// \n • SortedRange prefix(std::string_view prefix);
+    /// \n • void set_rehash_mode(RehashMode mode) noexcept;
+    /// \n • void set_thread_pool(ThreadPool* pool) noexcept;
+    /// \n • double rehash_progress() const noexcept;
+    /// \n • HashTableStats stats() const noexcept (если определен
+    /// ORDERHASHTABLE_STATS).
     ///
     /// \tparam HashType Тип данных, который предполагается для использования
     /// в качестве "контейнера" для считываемой и обрабатываемой информации.
-    template <class HashType>
+    /// \tparam StoragePolicy Политика хранения записей: ChainedStorage
+    /// (метод цепочек), ChunkedChainedStorage (цепочки в развернутых
+    /// списках) или OpenAddressingStorage (открытая адресация).
+    /// \tparam Hasher Функция хеширования ключей: WyHasher или Djb2Hasher
+    /// (исходная). Должна отображать ключ в равномерно распределенное
+    /// 64-битное значение.
+    /// \tparam Allocator Аллокатор записей и ячеек хранилища. По умолчанию
+    /// каждая таблица получает собственный пул PoolAllocator; подходит и
+    /// std::pmr::polymorphic_allocator с внешним ресурсом памяти.
+    /// \tparam KeyType Тип ключей: std::string, CompactKey (16 байт на
+    /// ключ, длинные ключи - в арене KeyArena) или trivially copyable тип
+    /// с оператором ==. Упорядоченный индекс доступен, если ключи
+    /// сравнимы оператором <.
+    template <class HashType, class StoragePolicy = ChainedStorage,
+              class Hasher = WyHasher,
+              class Allocator = PoolAllocator<std::byte>,
+              class KeyType = std::string>
     class OrderedHashTable {
+        private:
+            static inline constexpr bool IS_COMPACT_KEY{
+                    std::is_same_v<KeyType, CompactKey> };  ///< \brief Хранятся ли ключи в арене.
+
+            static inline constexpr bool IS_STRING_KEY{
+                    std::is_same_v<KeyType, std::string> ||
+                    IS_COMPACT_KEY };                       ///< \brief Строковые ли ключи.
+
+            static inline constexpr bool IS_ORDERED_KEY{
+                    std::totally_ordered<KeyType> };  ///< \brief Доступен ли упорядоченный индекс.
+
+            static_assert(IS_STRING_KEY || std::is_trivially_copyable_v<KeyType>,
+                          "Keys must be std::string or trivially copyable.");
+        public:
+            /// \brief Тип, в котором ключ передается в методы: std::string_view
+            /// для строковых ключей, KeyType по значению для остальных.
+            using KeyArgument = std::conditional_t<IS_STRING_KEY, std::string_view,
+                                                   KeyType>;
         private:
             /// \class Класс KeyException описывает тип исключения,
             /// возбуждаемого при попытке доступа к несуществующему элементу
@@ -74,62 +247,549 @@ namespace DataStructures {
             };
 
             /// \class Класс Record описывает объект записи хеш-таблицы,
-            /// состоящий из строки-ключа и значения типа, указанного в
+            /// состоящий из ключа и значения типа, указанного в
             /// качестве "контейнера" для данных при создании хеш-таблицы.
+            /// Запись также хранит полный хеш ключа, чтобы не высчитывать его
+            /// повторно при перехешировании и сравнивать ключи только при
+            /// совпадении хешей, и свою позицию в массиве порядка
+            /// добавления.
+            ///
+            /// Публичные методы:
+            /// \n • const KeyType& key() const noexcept
+            /// \n • const uint64_t& hash() const noexcept
             class Record {
                 private:
-                    std::string key_;
+                    KeyType key_;
                     HashType value_;
+                    uint64_t hash_;    ///< \brief Полный хеш ключа.
+                    size_t position_;  ///< \brief Позиция записи в массиве порядка добавления.
                 public:
-                    explicit Record(std::string, const HashType&)
-                        noexcept;
+                    using KeyArgument = OrderedHashTable::KeyArgument;
+
+                    template <class Key, class... Args>
+                    explicit Record(Key&&, const uint64_t&, Args&&...);
+
+                    [[nodiscard]]
+                    inline const KeyType& key() const noexcept;
+                    [[nodiscard]]
+                    inline const uint64_t& hash() const noexcept;
 
                 friend class OrderedHashTable;
+                template <class, class, class, class>
+                friend class ConcurrentOrderedHashTable;
+                template <class, class>
+                friend class MappedOrderedHashTable;
+                template <class, class>
+                friend class AsyncSnapshot;
+                template <class, class, class>
+                friend class DurableOrderedHashTable;
+                template <class, class, class>
+                friend class ColumnarTable;
+                template <class, class, class>
+                friend class BoundedOrderedHashTable;
+                friend class TableSchema;
+            };
+        public:
+            /// \class Класс KeyView предоставляет доступ к ключам хеш-таблицы
+            /// в порядке их добавления. Ключи читаются прямо из записей и не
+            /// хранятся повторно. Итераторы остаются действительными при
+            /// добавлении записей, но не при удалении.
+            ///
+            /// Публичные методы:
+            /// \n • Iterator begin() const noexcept
+            /// \n • Iterator end() const noexcept
+            /// \n • Iterator rbegin() const noexcept
+            /// \n • Iterator rend() const noexcept
+            /// \n • size_t length() const noexcept
+            class KeyView {
+                private:
+                    const OrderedHashTable* table_;
+                public:
+                    /// \class Класс Iterator предоставляет объект-итератор
+                    /// по ключам хеш-таблицы.
+                    ///
+                    /// Публичные методы:
+                    /// \n • Iterator& operator ++ () noexcept
+                    /// \n • Iterator operator ++ (int) noexcept
+                    /// \n • Iterator& operator -- () noexcept
+                    /// \n • Iterator operator -- (int) noexcept
+                    /// \n • bool operator != (const Iterator& iterator) noexcept
+                    /// \n • const KeyType& operator * () const noexcept
+                    class Iterator {
+                        private:
+                            const OrderedHashTable* table_;
+                            size_t position_;  ///< \brief Позиция в массиве порядка добавления
+                                               ///< или его длина для конца перебора.
+                        public:
+                            Iterator(const OrderedHashTable*, const size_t&) noexcept;
+
+                            Iterator& operator ++ () noexcept;
+                            Iterator operator ++ (int) noexcept;
+                            Iterator& operator -- () noexcept;
+                            Iterator operator -- (int) noexcept;
+                            bool operator != (const Iterator&) noexcept;
+                            const KeyType& operator * () const noexcept;
+                    };
+
+                    explicit KeyView(const OrderedHashTable*) noexcept;
+
+                    [[maybe_unused]] [[nodiscard]]
+                    inline size_t length() const noexcept;
+                    inline Iterator begin() const noexcept;
+                    inline Iterator end() const noexcept;
+                    [[maybe_unused]]
+                    inline Iterator rbegin() const noexcept;
+                    [[maybe_unused]]
+                    inline Iterator rend() const noexcept;
+            };
+        private:
+            using RecordAllocator = typename std::allocator_traits<
+                    Allocator>::template rebind_alloc<Record>;
+            using RecordTraits = std::allocator_traits<RecordAllocator>;
+            using Storage = typename StoragePolicy::template Engine<
+                    Record, RecordAllocator>;
+            using Index = SortedIndex<Record, RecordAllocator>;
+            using OrderAllocator = typename std::allocator_traits<
+                    Allocator>::template rebind_alloc<Record*>;
+        public:
+            /// \class Класс ItemView предоставляет перебор пар
+            /// "ключ - значение" в порядке добавления. Перебор идет по
+            /// непрерывному массиву указателей на записи: ключи не
+            /// копируются и не хешируются повторно. Представление
+            /// действительно, пока таблица не изменяется.
+            ///
+            /// Публичные методы:
+            /// \n • Iterator begin() const noexcept
+            /// \n • Iterator end() const noexcept
+            /// \n • size_t length() const noexcept
+            class ItemView {
+                private:
+                    Record* const* first_;  ///< \brief Первая ячейка массива порядка.
+                    Record* const* last_;   ///< \brief Ячейка за последней.
+                    size_t length_;
+                public:
+                    /// \class Класс Iterator предоставляет объект-итератор
+                    /// по парам "ключ - значение" в порядке добавления.
+                    ///
+                    /// Публичные методы:
+                    /// \n • Iterator& operator ++ () noexcept
+                    /// \n • Iterator operator ++ (int) noexcept
+                    /// \n • bool operator != (const Iterator& iterator) noexcept
+                    /// \n • std::pair<const KeyType&, HashType&>
+                    /// operator * () const noexcept
+                    class Iterator {
+                        private:
+                            Record* const* current_;
+                            Record* const* last_;
+                        public:
+                            Iterator(Record* const*, Record* const*) noexcept;
+
+                            Iterator& operator ++ () noexcept;
+                            Iterator operator ++ (int) noexcept;
+                            bool operator != (const Iterator&) noexcept;
+                            std::pair<const KeyType&, HashType&>
+                            operator * () const noexcept;
+                    };
+
+                    ItemView(Record* const*, Record* const*, const size_t&) noexcept;
+
+                    [[maybe_unused]] [[nodiscard]]
+                    inline size_t length() const noexcept;
+                    inline Iterator begin() const noexcept;
+                    inline Iterator end() const noexcept;
+            };
+
+            /// \class Класс SortedRange предоставляет перебор пар
+            /// "ключ - значение" из упорядоченного индекса в порядке
+            /// возрастания ключей. Диапазон действителен, пока таблица не
+            /// изменяется.
+            ///
+            /// Публичные методы:
+            /// \n • Iterator begin() const noexcept
+            /// \n • Iterator end() const noexcept
+            class SortedRange {
+                private:
+                    typename Index::Range range_;
+                public:
+                    /// \class Класс Iterator предоставляет объект-итератор
+                    /// по парам "ключ - значение" диапазона.
+                    ///
+                    /// Публичные методы:
+                    /// \n • Iterator& operator ++ () noexcept
+                    /// \n • Iterator operator ++ (int) noexcept
+                    /// \n • bool operator != (const Iterator& iterator) noexcept
+                    /// \n • std::pair<const KeyType&, HashType&>
+                    /// operator * () const noexcept
+                    class Iterator {
+                        private:
+                            typename Index::Iterator position_;
+                        public:
+                            explicit Iterator(const typename Index::Iterator&)
+                            noexcept;
+
+                            Iterator& operator ++ () noexcept;
+                            Iterator operator ++ (int) noexcept;
+                            bool operator != (const Iterator&) noexcept;
+                            std::pair<const KeyType&, HashType&>
+                            operator * () const noexcept;
+                    };
+
+                    explicit SortedRange(const typename Index::Range&) noexcept;
+
+                    inline Iterator begin() const noexcept;
+                    inline Iterator end() const noexcept;
             };
+        private:
 
             // Статические константы класса.
-            static inline constexpr size_t MIN_TABLE_SIZE{ 64 };    ///< \brief Минимальный размер хеш-таблицы.
-            static inline constexpr uint32_t GROWTH_RATE{ 2 };       ///< \brief Коэффициент расширения хеш-таблицы.
-            static inline constexpr double MAX_UTIL_PERCENT{ 0.5 };  ///< \brief Коэффициент заполнения.
-                                                                     ///<
-                                                                     ///< Отношение количества ключей
-                                                                     ///< к физическому размеру таблицы.
+            static inline constexpr size_t MIN_TABLE_SIZE{
+                    GrowthPolicy{}.min_size_ };                   ///< \brief Минимальный размер хеш-таблицы
+                                                                     ///< по умолчанию.
+            static inline constexpr size_t MIGRATION_STEP{ 4 };     ///< \brief Количество ячеек, переносимых
+                                                                     ///< за одну операцию при
+                                                                     ///< постепенном перехешировании.
+            static inline constexpr size_t BATCH_WINDOW{ 16 };      ///< \brief Количество ключей пакета,
+                                                                     ///< которые хешируются и подгружаются
+                                                                     ///< в кеш до начала поиска.
+            static inline constexpr size_t TASKS_PER_THREAD{ 4 };   ///< \brief Количество задач на поток
+                                                                     ///< при параллельном построении.
 
             size_t size_{ MIN_TABLE_SIZE };  ///< \brief "Физический" размер хеш-таблицы.
             uint32_t record_count_;
-            List<Record*>** record_arr_;     ///< \brief Массив двусвязных списков для пар
+            [[no_unique_address]] RecordAllocator allocator_;
+            Storage* storage_;               ///< \brief Хранилище указателей на пары
                                              ///< "ключ-значение".
-            List<std::string>* key_list_;    ///< \brief Список ключей в порядке их добавления.
+            Storage* old_storage_;           ///< \brief Хранилище, из которого еще идет
+                                             ///< перенос записей, или nullptr.
+            size_t migrate_cursor_;          ///< \brief Первая не перенесенная ячейка
+                                             ///< старого хранилища.
+            RehashMode rehash_mode_;
+            ThreadPool* thread_pool_;        ///< \brief Пул потоков для перехеширования
+                                             ///< или nullptr.
+            Index* sorted_index_;            ///< \brief Упорядоченный индекс ключей
+                                             ///< или nullptr, если он не ведется.
+            Hasher hasher_;
+            GrowthPolicy growth_policy_;
+            std::vector<Record*, OrderAllocator> order_;  ///< \brief Записи в порядке добавления,
+                                                          ///< nullptr на месте удаленных.
+                                                          ///<
+                                                          ///< Благодаря этому массиву
+                                                          ///< хеш-таблицу можно назвать
+                                                          ///< упорядоченной.
+            size_t order_front_;             ///< \brief Позиция первой записи в order_: все
+                                             ///< ячейки перед ней пусты.
+            KeyView key_view_;               ///< \brief Представление ключей для keys().
+            [[no_unique_address]]
+            std::conditional_t<IS_COMPACT_KEY, std::shared_ptr<KeyArena>,
+                               std::monostate> key_arena_;  ///< \brief Арена длинных ключей
+                                                            ///< CompactKey или nullptr до
+                                                            ///< первого такого ключа.
+#ifdef ORDERHASHTABLE_STATS
+            HashTableCounters stats_;        ///< \brief Счетчики горячих путей.
                                              ///<
-                                             ///< Благодаря ему хеш-таблицу можно
-                                             ///< назвать упорядоченной.
+                                             ///< Не переносятся при копировании
+                                             ///< и перемещении таблицы.
+#endif
 
             [[nodiscard]]
-            uint64_t hash_function(const std::string&,
-                                   const size_t& = 0) const noexcept;
+            uint64_t hash_function(KeyArgument) const noexcept;
+            [[nodiscard]]
+            Record* find(KeyArgument, const uint64_t&) const noexcept;
+            [[nodiscard]]
+            Record* find(KeyArgument, const uint64_t&, size_t&) const noexcept;
+            [[nodiscard]]
+            Record* detach(KeyArgument, const uint64_t&);
+            template <class Key, class... Args>
+            [[nodiscard]]
+            Record* create_record(Key&&, const uint64_t&, Args&&...);
+            void destroy_record(Record*) noexcept;
+            void reserve_order();
+            void link_back(Record*) noexcept;
+            template <class Key, class... Args>
+            Record* append(Key&&, const uint64_t&, Args&&...);
+            template <class Key, class... Args>
+            std::pair<Record*, bool> try_emplace_record(Key&&, Args&&...);
+            template <class Key>
+            void insert_batch_items(std::span<const std::pair<Key, HashType>>);
+            template <class Key>
+            void get_batch_items(std::span<const Key>, std::span<HashType*>);
+            inline void prefetch(const uint64_t&) const noexcept;
+            bool erase_record(KeyArgument, const uint64_t&);
+            void unlink(Record*) noexcept;
+            void relink_back(Record*) noexcept;
+            void trim_order() noexcept;
+            void compact_order() noexcept;
+            void migrate(const size_t&);
+            void rehash(const size_t&);
             void expand();
+            void shrink_if_sparse() noexcept;
+            void clear() noexcept;
+            [[nodiscard]]
+            static const GrowthPolicy& checked_policy(const GrowthPolicy&);
+
+            template <class, class, class, class>
+            friend class ConcurrentOrderedHashTable;
+            template <class, class>
+            friend class MappedOrderedHashTable;
+            template <class, class>
+            friend class AsyncSnapshot;
+            template <class, class, class>
+            friend class DurableOrderedHashTable;
+            template <class, class, class>
+            friend class ColumnarTable;
+            template <class, class, class>
+            friend class BoundedOrderedHashTable;
+            friend class TableSchema;
         public:
             explicit OrderedHashTable() noexcept;
             [[maybe_unused]]
             explicit OrderedHashTable(const size_t&) noexcept;
+            [[maybe_unused]]
+            explicit OrderedHashTable(const Allocator&) noexcept;
+            [[maybe_unused]]
+            OrderedHashTable(const size_t&, const Allocator&) noexcept;
+            [[maybe_unused]]
+            explicit OrderedHashTable(const GrowthPolicy&, const size_t& = 0,
+                                      const Allocator& = Allocator());
+            [[maybe_unused]]
+            explicit OrderedHashTable(std::shared_ptr<KeyArena>,
+                                      const Allocator& = Allocator()) noexcept
+            requires std::is_same_v<KeyType, CompactKey>;
+            OrderedHashTable(const OrderedHashTable&);
+            OrderedHashTable(OrderedHashTable&&) noexcept;
+            OrderedHashTable& operator = (const OrderedHashTable&);
+            OrderedHashTable& operator = (OrderedHashTable&&);
             ~OrderedHashTable();
 
             [[nodiscard]] [[maybe_unused]]
-            inline const List<std::string>* keys() const noexcept;
+            inline const KeyView* keys() const noexcept;
+            [[nodiscard]] [[maybe_unused]]
+            inline ItemView items() noexcept;
             [[nodiscard]] [[maybe_unused]]
             inline const uint32_t& length() const noexcept;
 
             [[maybe_unused]]
-            void insert(const std::string& key, const HashType& value);
+            void insert(KeyArgument key, const HashType& value);
+            [[maybe_unused]]
+            void insert(KeyArgument key, HashType&& value);
+            template <class... Args>
+            [[maybe_unused]]
+            HashType& emplace(KeyArgument key, Args&&... args);
+            template <class... Args>
+            [[maybe_unused]]
+            HashType& emplace(std::string&& key, Args&&... args)
+            requires std::is_same_v<KeyType, std::string>;
+            template <class... Args>
+            [[maybe_unused]]
+            HashType& emplace(const char* key, Args&&... args)
+            requires std::is_same_v<KeyType, std::string>;
+            template <class... Args>
+            [[maybe_unused]]
+            std::pair<HashType&, bool> try_emplace(KeyArgument key,
+                                                   Args&&... args);
+            template <class... Args>
             [[maybe_unused]]
-            void erase(const std::string& key);
+            std::pair<HashType&, bool> try_emplace(std::string&& key,
+                                                   Args&&... args)
+            requires std::is_same_v<KeyType, std::string>;
+            template <class... Args>
+            [[maybe_unused]]
+            std::pair<HashType&, bool> try_emplace(const char* key,
+                                                   Args&&... args)
+            requires std::is_same_v<KeyType, std::string>;
+            template <class Value>
+            [[maybe_unused]]
+            std::pair<HashType&, bool> insert_or_assign(KeyArgument key,
+                                                        Value&& value);
+            template <class Value>
+            [[maybe_unused]]
+            std::pair<HashType&, bool> insert_or_assign(std::string&& key,
+                                                        Value&& value)
+            requires std::is_same_v<KeyType, std::string>;
+            template <class Value>
+            [[maybe_unused]]
+            std::pair<HashType&, bool> insert_or_assign(const char* key,
+                                                        Value&& value)
+            requires std::is_same_v<KeyType, std::string>;
+            [[maybe_unused]]
+            void erase(KeyArgument key);
             [[maybe_unused]]
             HashType pop();
-            HashType get(const std::string& key);
-            HashType& operator [] (const std::string& key);
+            [[maybe_unused]]
+            HashType pop_front();
+            const HashType& get(KeyArgument key);
+            HashType& operator [] (KeyArgument key);
+
+            [[maybe_unused]]
+            void reserve(const size_t& count);
+            [[maybe_unused]]
+            void shrink_to_fit();
+            [[maybe_unused]]
+            void set_growth_policy(const GrowthPolicy& policy);
+            [[nodiscard]] [[maybe_unused]]
+            inline const GrowthPolicy& growth_policy() const noexcept;
+            [[nodiscard]] [[maybe_unused]]
+            inline const std::shared_ptr<KeyArena>& key_arena() const noexcept
+            requires std::is_same_v<KeyType, CompactKey>;
+            [[maybe_unused]]
+            void insert_batch(
+                    std::span<const std::pair<std::string, HashType>> items)
+            requires std::is_same_v<KeyType, std::string>;
+            [[maybe_unused]]
+            void insert_batch(
+                    std::span<const std::pair<KeyArgument, HashType>> items);
+            [[maybe_unused]]
+            void get_batch(std::span<const std::string> keys,
+                           std::span<HashType*> out)
+            requires std::is_same_v<KeyType, std::string>;
+            [[maybe_unused]]
+            void get_batch(std::span<const KeyArgument> keys,
+                           std::span<HashType*> out);
+
+            template <class Range>
+            [[nodiscard]] [[maybe_unused]]
+            static OrderedHashTable bulk_build(const Range& items,
+                                               ThreadPool& pool,
+                                               const Allocator& allocator = Allocator());
+
+            [[maybe_unused]]
+            inline void set_rehash_mode(RehashMode mode) noexcept;
+            [[maybe_unused]]
+            inline void set_thread_pool(ThreadPool* pool) noexcept;
+            [[nodiscard]] [[maybe_unused]]
+            inline double rehash_progress() const noexcept;
+#ifdef ORDERHASHTABLE_STATS
+            [[nodiscard]] [[maybe_unused]]
+            HashTableStats stats() const noexcept;
+#endif
+
+            [[maybe_unused]]
+            void enable_sorted_index()
+            requires std::totally_ordered<KeyType>;
+            [[nodiscard]] [[maybe_unused]]
+            SortedRange range(KeyArgument low, KeyArgument high)
+            requires std::totally_ordered<KeyType>;
+            [[nodiscard]] [[maybe_unused]]
+            SortedRange prefix(std::string_view prefix)
+            requires (std::is_same_v<KeyType, std::string> ||
+                      std::is_same_v<KeyType, CompactKey>);
     };
 
+    /// \brief Псевдоним OrderedHashTable с типом ключей первым параметром,
+    /// например KeyedOrderedHashTable<uint64_t, User>.
+    template <class KeyType, class HashType, class StoragePolicy = ChainedStorage,
+              class Hasher = WyHasher,
+              class Allocator = PoolAllocator<std::byte>>
+    using KeyedOrderedHashTable = OrderedHashTable<HashType, StoragePolicy, Hasher,
+                                                   Allocator, KeyType>;
+
 // Определения методов классов.
+/* ============================== GrowthPolicy ============================== */
+// PRIVATE
+
+    /// \brief Округляет размер таблицы по выбранному способу.
+    ///
+    /// \param size Наименьший допустимый размер.
+    ///
+    /// \return Размер из ряда политики, не меньший size и min_size_.
+    [[nodiscard]]
+    constexpr size_t GrowthPolicy::round(const size_t& size) const noexcept {
+        const size_t target{ std::max(size, this->min_size_) };
+        switch (this->sizing_) {
+            case TableSizing::POWER_OF_TWO:
+                return std::bit_ceil(target);
+            case TableSizing::PRIME:
+                return next_prime(target);
+            default: {
+                size_t result{ this->min_size_ };
+                while (result < target)
+                    result = this->grow(result);
+                return result;
+            }
+        }
+    }
+
+    /// \brief Ищет простое число, не меньшее указанного.
+    ///
+    /// \param number Начальное значение.
+    ///
+    /// \return Наименьшее простое число, не меньшее number.
+    [[nodiscard]]
+    constexpr size_t GrowthPolicy::next_prime(size_t number) noexcept {
+        if (number <= 2)
+            return 2;
+        number |= 1;
+        for (;; number += 2) {
+            bool prime{ true };
+            for (size_t divisor{ 3 }; divisor <= number / divisor; divisor += 2) {
+                if (number % divisor == 0) {
+                    prime = false;
+                    break;
+                }
+            }
+            if (prime)
+                return number;
+        }
+    }
+
+// PUBLIC
+
+    /// \brief Определяет размер таблицы после расширения.
+    ///
+    /// \param size Текущий размер таблицы.
+    ///
+    /// \return Новый размер: не меньше size * growth_factor_ и строго
+    /// больше size.
+    [[nodiscard]]
+    constexpr size_t GrowthPolicy::grow(const size_t& size) const noexcept {
+        const double scaled{ static_cast<double>(size) * this->growth_factor_ };
+        size_t result{ static_cast<size_t>(scaled) };
+        if (static_cast<double>(result) < scaled)
+            result++;
+        result = std::max(result, size + 1);
+        switch (this->sizing_) {
+            case TableSizing::POWER_OF_TWO:
+                return std::bit_ceil(result);
+            case TableSizing::PRIME:
+                return next_prime(result);
+            default:
+                return result;
+        }
+    }
+
+    /// \brief Определяет наименьший размер таблицы, в который count
+    /// записей помещаются без расширения.
+    ///
+    /// \param count Количество записей.
+    ///
+    /// \return Размер таблицы.
+    [[nodiscard]]
+    constexpr size_t GrowthPolicy::fit(const size_t& count) const noexcept {
+        return this->round(static_cast<size_t>(
+                static_cast<double>(count) / this->max_load_factor_) + 1);
+    }
+
+    /// \brief Проверяет согласованность коэффициентов политики.
+    ///
+    /// Таблица, сжатая или расширенная до нового размера, должна
+    /// оказаться между порогами сжатия и расширения, иначе она
+    /// перестраивалась бы на каждой операции.
+    ///
+    /// \param storage_max_load Наибольший коэффициент заполнения,
+    /// допустимый для хранилища.
+    ///
+    /// \return true, если политика корректна.
+    [[nodiscard]]
+    constexpr bool GrowthPolicy::valid(const double& storage_max_load)
+    const noexcept {
+        return this->max_load_factor_ > 0.0 &&
+               this->max_load_factor_ < storage_max_load &&
+               this->growth_factor_ > 1.0 && this->min_load_factor_ >= 0.0 &&
+               this->min_load_factor_ <
+               this->max_load_factor_ / this->growth_factor_ &&
+               this->min_size_ > 0;
+    }
+
 /* ============================== KeyException ============================== */
 
     /// \brief Стандартный конструктор экземпляра класса
@@ -139,8 +799,8 @@ namespace DataStructures {
     /// std::cerr.
     ///
     /// \param key Строковый ключ, который возбудил исключение.
-    template <class T>
-    OrderedHashTable<T>::KeyException::KeyException(std::string key) noexcept :
+    template <class T, class S, class H, class A, class K>
+    OrderedHashTable<T, S, H, A, K>::KeyException::KeyException(std::string key) noexcept :
             key_(std::move(key)) {
         std::cerr << this->what() << std::endl;
     }
@@ -148,9 +808,9 @@ namespace DataStructures {
     /// \brief Формирует сообщение о произошедшей ошибке.
     ///
     /// \return Строку с пояснением ошибки и советом.
-    template <class T>
+    template <class T, class S, class H, class A, class K>
     [[maybe_unused]]
-    std::string OrderedHashTable<T>::KeyException::what() noexcept {
+    std::string OrderedHashTable<T, S, H, A, K>::KeyException::what() noexcept {
         std::string msg{ std::format("Key (\"{}\") not found. Use "
                                      ".get() method if you not "
                                      "sure that record exits.",
@@ -163,275 +823,1911 @@ namespace DataStructures {
     /// \brief Стандартный конструктор экземпляра класса
     /// OrderedHashTable::Record.
     ///
-    /// Позволяет создать объект записи, указав сразу ключ и
-    /// значение.
+    /// Позволяет создать объект записи, указав сразу ключ и аргументы
+    /// конструктора значения: значение создается на месте.
     ///
-    /// \param key Строковый ключ записи.
-    /// \param value Значение записи.
-    template <class T>
-    OrderedHashTable<T>::Record::Record(std::string key, const T& value) noexcept :
-            key_(std::move(key)), value_(value) { }
+    /// \param key Ключ записи.
+    /// \param hash Полный хеш ключа.
+    /// \param args Аргументы конструктора значения записи.
+    template <class T, class S, class H, class A, class K>
+    template <class Key, class... Args>
+    OrderedHashTable<T, S, H, A, K>::Record::Record(Key&& key, const uint64_t& hash,
+                                              Args&&... args) :
+            key_(std::forward<Key>(key)), value_(std::forward<Args>(args)...),
+            hash_(hash), position_(0) { }
 
-/* ============================ OrderedHashTable ============================ */
-// PRIVATE
+    /// \brief Предоставляет доступ к ключу записи.
+    ///
+    /// \return Ссылку на ключ.
+    template <class T, class S, class H, class A, class K>
+    [[nodiscard]]
+    inline const K& OrderedHashTable<T, S, H, A, K>::Record::key() const noexcept {
+        return this->key_;
+    }
 
-    /// \brief Метод, высчитывающий хеш.
+    /// \brief Предоставляет доступ к сохраненному хешу ключа записи.
     ///
-    /// Преобразует ключ элемента в уникальную (почти) цифровую
-    /// последовательность - хеш. Этот хеш определяет местоположение
-    /// элемента в хеш-таблице..
+    /// \return Ссылку на значение хеша.
+    template <class T, class S, class H, class A, class K>
+    [[nodiscard]]
+    inline const uint64_t& OrderedHashTable<T, S, H, A, K>::Record::hash() const noexcept {
+        return this->hash_;
+    }
+
+/* ============================ KeyView::Iterator ============================ */
+
+    /// \brief Стандартный конструктор экземпляра класса
+    /// OrderedHashTable::KeyView::Iterator.
     ///
-    /// \param key Строковый ключ, который необходимо захешировать.
-    /// \param arr_size Размерная переменная, отображающая текущий размер
-    /// хеш-таблицы. По умолчанию используется размер из экземпляра класса,
-    /// но при необходимости для расчета хеша может использоваться стороннее
-    /// значение.
+    /// \param table Хеш-таблица, ключи которой перебираются.
+    /// \param position Позиция записи в массиве порядка добавления или его
+    /// длина для конца перебора.
+    template <class T, class S, class H, class A, class K>
+    OrderedHashTable<T, S, H, A, K>::KeyView::Iterator::Iterator(
+            const OrderedHashTable* table, const size_t& position) noexcept :
+            table_(table), position_(position) { }
+
+    /// \brief Перемещает итератор на след. ключ.
     ///
-    /// \return uint64-значение хеша - индекса элемента в хеш-таблице.
-    template <class T>
-    uint64_t OrderedHashTable<T>::hash_function(const std::string& key,
-                                                const size_t& arr_size)
-    const noexcept {
-        size_t size_arr_{ (arr_size == 0) ? this->size_ : arr_size };
-        uint32_t key_int{ HASH_CONST_I };
-        uint64_t hash;
-        // Хеширование строки в число.
-        for (const char& i : key)
-            key_int = HASH_CONST_I_2 * key_int + static_cast<unsigned char>(i);
+    /// Пустые ячейки удаленных записей пропускаются.
+    ///
+    /// \return Объект-итератор.
+    template <class T, class S, class H, class A, class K>
+    OrderedHashTable<T, S, H, A, K>::KeyView::Iterator&
+    OrderedHashTable<T, S, H, A, K>::KeyView::Iterator::operator ++ () noexcept {
+        const auto& order{ this->table_->order_ };
+        if (this->position_ >= order.size())
+            return *this;
+        do
+            this->position_++;
+        while (this->position_ < order.size() && order[this->position_] == nullptr);
+        return *this;
+    }
 
-        // Хеширование числового представления строки в зависимости от размера
-        // HASH_CONST_D - константа для наилучшего распределения ключей,
-        // описана Кнутом.
-        hash = static_cast<uint64_t>(ceil(static_cast<double>(size_arr_) *
-                                          fmod((key_int * HASH_CONST_D), 1)) - 1);
-        return hash;
+    /// \brief Перемещает итератор на след. ключ.
+    ///
+    /// \return Объект-итератор.
+    template <class T, class S, class H, class A, class K>
+    OrderedHashTable<T, S, H, A, K>::KeyView::Iterator
+    OrderedHashTable<T, S, H, A, K>::KeyView::Iterator::operator ++ (int) noexcept {
+        Iterator iterator = *this;
+        ++*this;
+        return iterator;
     }
 
-    /// \brief Метод, динамически расширяющий хеш-таблицу по мере ее заполнения.
+    /// \brief Перемещает итератор на пред. ключ.
     ///
-    /// Начинают свою работу, когда заполненность хеш-таблицы ключами
-    /// превышает определенный процент от общей емкости (MAX_UTIL_PERCENT) таблицы.
-    /// Таблица увеличивается в GROWTH_RATE раза.
-    template <class T>
-    void OrderedHashTable<T>::expand() {
-        // Создание новой таблицы и ее заполнение двусвязными списками.
-        auto** temp{ new List<Record*>*[this->size_ * GROWTH_RATE] };
-
-        for (size_t i{}; i < this->size_ * GROWTH_RATE; i++)
-            temp[i] = new List<Record*>;
-
-        // Перехеширование ключей по новому размеру, запись ключей в новую
-        // таблицу.
-        for (auto it{ this->key_list_->begin() }; it != this->key_list_->end();
-             ++it) {
-            uint64_t index{ hash_function((*it), this->size_ *
-                                                 GROWTH_RATE) };
-            T value{ this->get((*it)) };
-            auto* record{ new Record((*it), value) };
-            temp[index]->push_back(record);
+    /// От первого ключа итератор переходит в конец перебора, как и
+    /// прежде при обходе связей записей.
+    ///
+    /// \return Объект-итератор.
+    template <class T, class S, class H, class A, class K>
+    OrderedHashTable<T, S, H, A, K>::KeyView::Iterator&
+    OrderedHashTable<T, S, H, A, K>::KeyView::Iterator::operator -- () noexcept {
+        const auto& order{ this->table_->order_ };
+        if (this->position_ >= order.size())
+            return *this;
+        if (this->position_ <= this->table_->order_front_) {
+            this->position_ = order.size();
+            return *this;
         }
+        do
+            this->position_--;
+        while (order[this->position_] == nullptr);
+        return *this;
+    }
 
-        // Удаление старой таблицы, изменение значение размера таблицы в
-        // экземпляре класса.
-        for (size_t item{}; item < this->size_ / GROWTH_RATE; item++)
-            delete this->record_arr_[item];
-        delete[] this->record_arr_;
-        this->record_arr_ = temp;
-        this->size_ *= GROWTH_RATE;
+    /// \brief Перемещает итератор на пред. ключ.
+    ///
+    /// \return Объект-итератор.
+    template <class T, class S, class H, class A, class K>
+    OrderedHashTable<T, S, H, A, K>::KeyView::Iterator
+    OrderedHashTable<T, S, H, A, K>::KeyView::Iterator::operator -- (int) noexcept {
+        Iterator iterator = *this;
+        --*this;
+        return iterator;
     }
 
-// PUBLIC
+    /// \brief Проверяет, что два объекта итератора не равны.
+    ///
+    /// \param iterator Объект-итератор для сравнения.
+    ///
+    /// \return Булевое значение.
+    template <class T, class S, class H, class A, class K>
+    bool OrderedHashTable<T, S, H, A, K>::KeyView::Iterator::operator != (
+            const Iterator& iterator) noexcept {
+        return this->position_ != iterator.position_;
+    }
 
-    /// \brief Стандартный конструктор экземпляра класса OrderedHashTable.
+    /// \brief Позволяет получить ключ, на который указывает итератор.
     ///
-    /// Инициализирует хеш-таблицу
-    /// со стандартным размером MIN_TABLE_SIZE.
-    template <class T>
-    OrderedHashTable<T>::OrderedHashTable() noexcept :
-            size_(MIN_TABLE_SIZE), record_count_(0),
-            record_arr_(new List<Record*>*[this->size_]),
-            key_list_(new List<std::string>())
-    {
-        for (size_t item{}; item < this->size_; item++)
-            this->record_arr_[item] = new List<Record*>;
+    /// \return Ссылку на ключ записи.
+    template <class T, class S, class H, class A, class K>
+    const K& OrderedHashTable<T, S, H, A, K>::KeyView::Iterator::operator * ()
+    const noexcept {
+        return this->table_->order_[this->position_]->key_;
     }
 
-    /// \brief Конструктор экземпляра класса с возможностью указать
-    /// размер.
+/* ================================ KeyView ================================ */
+
+    /// \brief Стандартный конструктор экземпляра класса
+    /// OrderedHashTable::KeyView.
     ///
-    /// Инициализирует хеш-таблицу с пользовательским размером,
-    /// не меньшим, чем минимальный размер MIN_TABLE_SIZE.
+    /// \param table Хеш-таблица, ключи которой нужно представить.
+    template <class T, class S, class H, class A, class K>
+    OrderedHashTable<T, S, H, A, K>::KeyView::KeyView(const OrderedHashTable* table)
+    noexcept : table_(table) { }
+
+    /// \brief Позволяет получить количество ключей.
     ///
-    /// \param size Физический размер хеш-таблицы.
-    template <class T>
+    /// \return Значение кол-ва ключей.
+    template <class T, class S, class H, class A, class K>
+    [[maybe_unused]] [[nodiscard]]
+    inline size_t OrderedHashTable<T, S, H, A, K>::KeyView::length() const noexcept {
+        return this->table_->record_count_;
+    }
+
+    /// \brief Создает итератор от первого добавленного ключа.
+    ///
+    /// \return Объект-итератор.
+    template <class T, class S, class H, class A, class K>
+    inline OrderedHashTable<T, S, H, A, K>::KeyView::Iterator
+    OrderedHashTable<T, S, H, A, K>::KeyView::begin() const noexcept {
+        return Iterator(this->table_, this->table_->order_front_);
+    }
+
+    /// \brief Создает итератор на конец ключей.
+    ///
+    /// \return Объект-итератор.
+    template <class T, class S, class H, class A, class K>
+    inline OrderedHashTable<T, S, H, A, K>::KeyView::Iterator
+    OrderedHashTable<T, S, H, A, K>::KeyView::end() const noexcept {
+        return Iterator(this->table_, this->table_->order_.size());
+    }
+
+    /// \brief Создает итератор от последнего добавленного ключа
+    /// (реверсивный перебор).
+    ///
+    /// \return Объект-итератор.
+    template <class T, class S, class H, class A, class K>
     [[maybe_unused]]
-    OrderedHashTable<T>::OrderedHashTable(const size_t& size) noexcept :
-            size_((MIN_TABLE_SIZE > size) ? MIN_TABLE_SIZE : size),
-            record_count_(0), record_arr_(new List<Record*>*[this->size_]),
-            key_list_(new List<std::string>())
-    {
-        for (size_t item{}; item < this->size_; item++)
-            this->record_arr_[item] = new List<Record*>;
+    inline OrderedHashTable<T, S, H, A, K>::KeyView::Iterator
+    OrderedHashTable<T, S, H, A, K>::KeyView::rbegin() const noexcept {
+        const auto& order{ this->table_->order_ };
+        return Iterator(this->table_, order.empty() ? 0 : order.size() - 1);
     }
 
-    // Стандартный деструктор экземпляра.
-    template <class T>
-    OrderedHashTable<T>::~OrderedHashTable() {
-        for (size_t item{}; item < this->size_; item++) {
-            auto temp{ this->record_arr_[item] };
-            delete temp;
-        }
-        delete[] this->record_arr_;
-        delete this->key_list_;
+    /// \brief Создает итератор на начало ключей
+    /// (реверсивный перебор).
+    ///
+    /// \return Объект-итератор.
+    template <class T, class S, class H, class A, class K>
+    [[maybe_unused]]
+    inline OrderedHashTable<T, S, H, A, K>::KeyView::Iterator
+    OrderedHashTable<T, S, H, A, K>::KeyView::rend() const noexcept {
+        return Iterator(this->table_, this->table_->order_.size());
     }
 
-    /// \brief Предоставляет доступ к ключам хеш-таблицы.
+/* ========================== SortedRange::Iterator ========================== */
+
+    /// \brief Стандартный конструктор экземпляра класса
+    /// OrderedHashTable::SortedRange::Iterator.
     ///
-    /// Возвращает список ключей таблицы в порядке их добавления,
-    /// предоставляет возможность итерации по ним.
+    /// \param position Итератор упорядоченного индекса.
+    template <class T, class S, class H, class A, class K>
+    OrderedHashTable<T, S, H, A, K>::SortedRange::Iterator::Iterator(
+            const typename Index::Iterator& position) noexcept :
+            position_(position) { }
+
+    /// \brief Перемещает итератор на след. по возрастанию ключ.
     ///
-    /// \return Список из строковых ключей хеш-таблицы.
-    template <class T>
-    [[nodiscard]] [[maybe_unused]]
-    inline const List<std::string>* OrderedHashTable<T>::keys() const noexcept {
-        return this->key_list_;
+    /// \return Объект-итератор.
+    template <class T, class S, class H, class A, class K>
+    OrderedHashTable<T, S, H, A, K>::SortedRange::Iterator&
+    OrderedHashTable<T, S, H, A, K>::SortedRange::Iterator::operator ++ () noexcept {
+        ++this->position_;
+        return *this;
     }
 
-    /// \brief Предоставляет доступ к количеству элементов таблицы.
+    /// \brief Перемещает итератор на след. по возрастанию ключ.
     ///
-    /// \return Ссылку на переменную, хранящую кол-во ключей.
-    template <class T>
-    [[nodiscard]] [[maybe_unused]]
-    inline const uint32_t& OrderedHashTable<T>::length() const noexcept {
-        return this->record_count_;
+    /// \return Объект-итератор.
+    template <class T, class S, class H, class A, class K>
+    OrderedHashTable<T, S, H, A, K>::SortedRange::Iterator
+    OrderedHashTable<T, S, H, A, K>::SortedRange::Iterator::operator ++ (int) noexcept {
+        Iterator iterator = *this;
+        ++*this;
+        return iterator;
     }
 
-    /// \brief Метод, добавляющий элемент.
+    /// \brief Проверяет, что два объекта итератора не равны.
     ///
-    /// Добавляет в хеш-таблицу новую пару "ключ - значение" или
-    /// изменяет значение по уже существующему ключу.
+    /// \param iterator Объект-итератор для сравнения.
     ///
-    /// \param key Строковый ключ элемента для вставки/изменения.
-    /// \param value Значение элемента для вставки/изменения.
-    template <class T>
-    [[maybe_unused]]
-    void OrderedHashTable<T>::insert(const std::string& key, const T& value) {
-        size_t index{ hash_function(key) };
-        List<Record*>* table_cell{ this->record_arr_[index] };
-        // Проверка, что ключ существует в списке по указанному хешу.
-        for (auto it{ table_cell->begin() }; it != table_cell->end(); ++it) {
-            if ((*it)->key_ == key) {
-                (*it)->value_ = value;
-                return;
-            }
-        }
-        // Создание новой записи и ее пуш в список по указанному хешу.
-        auto* new_record{ new Record(key, value) };
-        this->key_list_->push_back(key);
-        this->record_count_++;
-        table_cell->push_back(new_record);
+    /// \return Булевое значение.
+    template <class T, class S, class H, class A, class K>
+    bool OrderedHashTable<T, S, H, A, K>::SortedRange::Iterator::operator != (
+            const Iterator& iterator) noexcept {
+        return this->position_ != iterator.position_;
+    }
 
-        // Если ключей уже многовато - пора расширить таблицу.
-        if ((this->record_count_ / static_cast<double>(this->size_)) >=
-            MAX_UTIL_PERCENT)
-            this->expand();
+    /// \brief Позволяет получить пару, на которую указывает итератор.
+    ///
+    /// \return Пару из ссылок на ключ и значение записи.
+    template <class T, class S, class H, class A, class K>
+    std::pair<const K&, T&>
+    OrderedHashTable<T, S, H, A, K>::SortedRange::Iterator::operator * () const noexcept {
+        Record* record{ *this->position_ };
+        return { record->key_, record->value_ };
     }
 
-    /// \brief Метод, стирающий из хеш-таблицы элемент с указанным ключом.
+/* =============================== SortedRange =============================== */
+
+    /// \brief Стандартный конструктор экземпляра класса
+    /// OrderedHashTable::SortedRange.
     ///
-    /// \param key Строковый ключ элемента, который требуется удалить.
-    template <class T>
-    [[maybe_unused]]
-    void OrderedHashTable<T>::erase(const std::string& key) {
-        size_t index{ hash_function(key) };
-        size_t list_ind{};
-        List<Record*>* table_cell{ this->record_arr_[index] };
-        // Поиск ключа в списке по указанному хешу.
-        for (auto it{ table_cell->begin() }; it != table_cell->end();
-                ++it, list_ind++) {
-            if ((*it)->key_ == key) {
-                table_cell->erase(list_ind);
-                this->record_count_--;
-                break;
-            }
-        }
-        // Поиск ключа в общем списке ключей.
-        list_ind = 0;
-        for (auto it{ this->key_list_->begin() };
-                it != this->key_list_->end() ; ++it, ++list_ind) {
-            if ((*it) == key) {
-                this->key_list_->erase(list_ind);
-                return;
-            }
-        }
+    /// \param range Диапазон записей упорядоченного индекса.
+    template <class T, class S, class H, class A, class K>
+    OrderedHashTable<T, S, H, A, K>::SortedRange::SortedRange(
+            const typename Index::Range& range) noexcept : range_(range) { }
+
+    /// \brief Создает итератор от наименьшего ключа диапазона.
+    ///
+    /// \return Объект-итератор.
+    template <class T, class S, class H, class A, class K>
+    inline OrderedHashTable<T, S, H, A, K>::SortedRange::Iterator
+    OrderedHashTable<T, S, H, A, K>::SortedRange::begin() const noexcept {
+        return Iterator(this->range_.begin());
     }
 
-    /// \brief Удаляет элемент и возвращает его.
+    /// \brief Создает итератор за наибольшим ключом диапазона.
     ///
-    /// Метод извлекает из хеш-таблицы последний добавленный элемент и
-    /// возвращает записанное в него значение.
+    /// \return Объект-итератор.
+    template <class T, class S, class H, class A, class K>
+    inline OrderedHashTable<T, S, H, A, K>::SortedRange::Iterator
+    OrderedHashTable<T, S, H, A, K>::SortedRange::end() const noexcept {
+        return Iterator(this->range_.end());
+    }
+
+/* =========================== ItemView::Iterator =========================== */
+
+    /// \brief Стандартный конструктор экземпляра класса
+    /// OrderedHashTable::ItemView::Iterator.
     ///
-    /// \return Значение извлеченного элемента указанного типа данных.
-    template <class T>
-    [[maybe_unused]]
-    T OrderedHashTable<T>::pop() {
-        // Извлечение последнего элемента из списка ключей и получение
-        // элемента для извлечения по нему.
-        std::string key{ this->key_list_->pop_back() };
-        size_t index{ hash_function(key) };
-        List<Record*>* table_cell{ this->record_arr_[index] };
-        Record *popped_record{ table_cell->pop_back() };
-        T ret_val{ popped_record->value_ };
+    /// \param current Ячейка массива порядка с записью или last.
+    /// \param last Ячейка за последней в массиве порядка.
+    template <class T, class S, class H, class A, class K>
+    OrderedHashTable<T, S, H, A, K>::ItemView::Iterator::Iterator(
+            Record* const* current, Record* const* last) noexcept :
+            current_(current), last_(last) { }
 
-        // Удаление извлеченного элемента.
-        delete popped_record;
-        this->record_count_--;
-        return ret_val;
+    /// \brief Перемещает итератор на след. пару, пропуская пустые ячейки
+    /// удаленных записей.
+    ///
+    /// \return Объект-итератор.
+    template <class T, class S, class H, class A, class K>
+    OrderedHashTable<T, S, H, A, K>::ItemView::Iterator&
+    OrderedHashTable<T, S, H, A, K>::ItemView::Iterator::operator ++ () noexcept {
+        do
+            this->current_++;
+        while (this->current_ != this->last_ && *this->current_ == nullptr);
+        return *this;
     }
 
-    /// \brief Метод, позволяющий получить значение элемента по ключу.
+    /// \brief Перемещает итератор на след. пару.
     ///
-    /// В случае ненахождения элемента будет возвращено стандартное значение.
+    /// \return Объект-итератор.
+    template <class T, class S, class H, class A, class K>
+    OrderedHashTable<T, S, H, A, K>::ItemView::Iterator
+    OrderedHashTable<T, S, H, A, K>::ItemView::Iterator::operator ++ (int) noexcept {
+        Iterator iterator = *this;
+        ++*this;
+        return iterator;
+    }
+
+    /// \brief Проверяет, что два объекта итератора не равны.
     ///
-    /// \param key Строковый ключ, значение по которому нужно найти.
-    ///
-    /// \return Найденное значение ключа или стандартное значение.
-    template <class T>
-    T OrderedHashTable<T>::get(const std::string& key) {
-        size_t index{ hash_function(key) };
-        List<Record*>* table_cell{ this->record_arr_[index] };
-        // Поиск элемента в списке по указанному хешу.
-        for (auto it{ table_cell->begin() }; it != table_cell->end(); ++it) {
-            if ((*it)->key_ == key) {
-                T ret_val = (*it)->value_;
-                return ret_val;
-            }
-        }
-        // Дефолтное значение.
-        return T{};
+    /// \param iterator Объект-итератор для сравнения.
+    ///
+    /// \return Булевое значение.
+    template <class T, class S, class H, class A, class K>
+    bool OrderedHashTable<T, S, H, A, K>::ItemView::Iterator::operator != (
+            const Iterator& iterator) noexcept {
+        return this->current_ != iterator.current_;
     }
 
-    /// \brief Перегрузка оператора [] для получения доступа к элементам
-    /// хеш-таблицы.
+    /// \brief Позволяет получить пару, на которую указывает итератор.
     ///
-    /// \param key Строковый ключ элемента для доступа.
+    /// \return Пару из ссылок на ключ и значение записи.
+    template <class T, class S, class H, class A, class K>
+    std::pair<const K&, T&>
+    OrderedHashTable<T, S, H, A, K>::ItemView::Iterator::operator * () const noexcept {
+        Record* record{ *this->current_ };
+        return { record->key_, record->value_ };
+    }
+
+/* ================================ ItemView ================================ */
+
+    /// \brief Стандартный конструктор экземпляра класса
+    /// OrderedHashTable::ItemView.
     ///
-    /// \return Ссылка на значение указанного типа.
+    /// \param first Ячейка массива порядка с первой записью.
+    /// \param last Ячейка за последней в массиве порядка.
+    /// \param length Количество записей.
+    template <class T, class S, class H, class A, class K>
+    OrderedHashTable<T, S, H, A, K>::ItemView::ItemView(Record* const* first,
+                                                        Record* const* last,
+                                                        const size_t& length)
+    noexcept : first_(first), last_(last), length_(length) { }
+
+    /// \brief Позволяет получить количество пар.
     ///
-    /// \throw DataStructures::OrderedHashTable::KeyException Возбуждается,
-    /// если элемент с указанным ключом не найден. Рекомендуется использовать
-    /// .get(), если присутствие ключа не точно.
-    template <class T>
-    T& OrderedHashTable<T>::operator [] (const std::string& key) {
-        size_t index{ hash_function(key) };
-        List<Record*>* table_cell{ this->record_arr_[index] };
-        // Поиск элемента в списке по указанному хешу.
-        for (auto it{ table_cell->begin() }; it != table_cell->end(); ++it) {
-            if ((*it)->key_ == key) {
-                return (*it)->value_;
-            }
-        }
-        throw KeyException(key);
+    /// \return Значение кол-ва пар.
+    template <class T, class S, class H, class A, class K>
+    [[maybe_unused]] [[nodiscard]]
+    inline size_t OrderedHashTable<T, S, H, A, K>::ItemView::length() const noexcept {
+        return this->length_;
+    }
+
+    /// \brief Создает итератор от первой добавленной пары.
+    ///
+    /// \return Объект-итератор.
+    template <class T, class S, class H, class A, class K>
+    inline OrderedHashTable<T, S, H, A, K>::ItemView::Iterator
+    OrderedHashTable<T, S, H, A, K>::ItemView::begin() const noexcept {
+        return Iterator(this->first_, this->last_);
+    }
+
+    /// \brief Создает итератор за последней добавленной парой.
+    ///
+    /// \return Объект-итератор.
+    template <class T, class S, class H, class A, class K>
+    inline OrderedHashTable<T, S, H, A, K>::ItemView::Iterator
+    OrderedHashTable<T, S, H, A, K>::ItemView::end() const noexcept {
+        return Iterator(this->last_, this->last_);
+    }
+
+/* ============================ OrderedHashTable ============================ */
+// PRIVATE
+
+    /// \brief Метод, высчитывающий хеш.
+    ///
+    /// Преобразует ключ элемента в уникальную (почти) цифровую
+    /// последовательность - хеш. На его основе хранилище определяет
+    /// местоположение элемента в хеш-таблице.
+    ///
+    /// Значение высчитывается функцией Hasher целиком в 64 битах и
+    /// сохраняется в записи. Ключи, которые Hasher не принимает
+    /// (целочисленные при строковом WyHasher), перемешиваются
+    /// IntegerHasher.
+    ///
+    /// \param key Ключ, который необходимо захешировать.
+    ///
+    /// \return uint64-значение хеша.
+    template <class T, class S, class H, class A, class K>
+    uint64_t OrderedHashTable<T, S, H, A, K>::hash_function(KeyArgument key)
+    const noexcept {
+        if constexpr (std::is_invocable_r_v<uint64_t, const H&, KeyArgument>)
+            return this->hasher_(key);
+        else
+            return IntegerHasher()(key);
+    }
+
+    /// \brief Ищет запись с указанным ключом в хранилище.
+    ///
+    /// Во время постепенного перехеширования запись ищется сначала в новом,
+    /// затем в старом хранилище.
+    ///
+    /// \param key Ключ записи.
+    /// \param hash Хеш ключа.
+    ///
+    /// \return Указатель на запись или nullptr, если ее нет.
+    template <class T, class S, class H, class A, class K>
+    OrderedHashTable<T, S, H, A, K>::Record* OrderedHashTable<T, S, H, A, K>::find(
+            KeyArgument key, const uint64_t& hash) const noexcept {
+        // После перемещения у таблицы нет хранилища.
+        if (this->storage_ == nullptr)
+            return nullptr;
+        Record* record{ this->storage_->find(key, hash) };
+        if (record == nullptr && this->old_storage_ != nullptr)
+            record = this->old_storage_->find(key, hash);
+        return record;
+    }
+
+    /// \brief Ищет запись с указанным ключом в хранилище и считает длину
+    /// поиска.
+    ///
+    /// \param key Ключ записи.
+    /// \param hash Хеш ключа.
+    /// \param probes Длина поиска по обоим хранилищам: просмотренные записи
+    /// цепочек или группы ячеек открытой адресации.
+    ///
+    /// \return Указатель на запись или nullptr, если ее нет.
+    template <class T, class S, class H, class A, class K>
+    OrderedHashTable<T, S, H, A, K>::Record* OrderedHashTable<T, S, H, A, K>::find(
+            KeyArgument key, const uint64_t& hash, size_t& probes) const noexcept {
+        probes = 0;
+        if (this->storage_ == nullptr)
+            return nullptr;
+        Record* record{ this->storage_->find(key, hash, probes) };
+        if (record == nullptr && this->old_storage_ != nullptr) {
+            size_t old_probes;
+            record = this->old_storage_->find(key, hash, old_probes);
+            probes += old_probes;
+        }
+        return record;
+    }
+
+    /// \brief Исключает запись с указанным ключом из хранилища.
+    ///
+    /// \param key Ключ записи.
+    /// \param hash Хеш ключа.
+    ///
+    /// \return Указатель на исключенную запись или nullptr, если ее нет.
+    template <class T, class S, class H, class A, class K>
+    OrderedHashTable<T, S, H, A, K>::Record* OrderedHashTable<T, S, H, A, K>::detach(
+            KeyArgument key, const uint64_t& hash) {
+        if (this->storage_ == nullptr)
+            return nullptr;
+        Record* record{ this->storage_->remove(key, hash) };
+        if (record == nullptr && this->old_storage_ != nullptr)
+            record = this->old_storage_->remove(key, hash);
+        return record;
+    }
+
+    /// \brief Создает запись в памяти аллокатора хеш-таблицы.
+    ///
+    /// Для ключей CompactKey строка ключа переводится в CompactKey
+    /// ареной таблицы; готовый CompactKey (при копировании таблицы)
+    /// копируется как есть.
+    ///
+    /// \param key Ключ записи.
+    /// \param hash Хеш ключа.
+    /// \param args Аргументы конструктора значения записи.
+    ///
+    /// \return Указатель на созданную запись.
+    template <class T, class S, class H, class A, class K>
+    template <class Key, class... Args>
+    [[nodiscard]]
+    OrderedHashTable<T, S, H, A, K>::Record*
+    OrderedHashTable<T, S, H, A, K>::create_record(Key&& key, const uint64_t& hash,
+                                                   Args&&... args) {
+        if constexpr (IS_COMPACT_KEY && !std::is_same_v<std::remove_cvref_t<Key>, K>) {
+            // Строка становится CompactKey; арена заводится при первом
+            // ключе, не помещающемся в объект.
+            const std::string_view view{ key };
+            if (view.size() > CompactKey::INLINE_CAPACITY && this->key_arena_ == nullptr)
+                this->key_arena_ = std::make_shared<KeyArena>();
+            const K compact{ (this->key_arena_ != nullptr) ?
+                             this->key_arena_->make(view) : K(view) };
+            return this->create_record(compact, hash, std::forward<Args>(args)...);
+        }
+
+        Record* record{ RecordTraits::allocate(this->allocator_, 1) };
+        try {
+            RecordTraits::construct(this->allocator_, record,
+                                    std::forward<Key>(key), hash,
+                                    std::forward<Args>(args)...);
+        }
+        catch (...) {
+            RecordTraits::deallocate(this->allocator_, record, 1);
+            throw;
+        }
+#ifdef ORDERHASHTABLE_STATS
+        this->stats_.count_allocation();
+#endif
+        return record;
+    }
+
+    /// \brief Разрушает запись и возвращает ее память аллокатору.
+    ///
+    /// \param record Указатель на удаляемую запись.
+    template <class T, class S, class H, class A, class K>
+    void OrderedHashTable<T, S, H, A, K>::destroy_record(Record* record) noexcept {
+        RecordTraits::destroy(this->allocator_, record);
+        RecordTraits::deallocate(this->allocator_, record, 1);
+#ifdef ORDERHASHTABLE_STATS
+        this->stats_.count_deallocation();
+#endif
+    }
+
+    /// \brief Гарантирует место под еще одну запись в массиве порядка
+    /// добавления, чтобы link_back не выделял память.
+    ///
+    /// \throw std::bad_alloc Исключение возбуждается, если память под
+    /// массив выделить не удалось.
+    template <class T, class S, class H, class A, class K>
+    void OrderedHashTable<T, S, H, A, K>::reserve_order() {
+        if (this->order_.size() == this->order_.capacity())
+            this->order_.reserve(std::max(this->order_.size() * 2, MIN_TABLE_SIZE));
+    }
+
+    /// \brief Ставит запись в конец порядка добавления.
+    ///
+    /// Место в массиве порядка должно быть заранее выделено
+    /// reserve_order().
+    ///
+    /// \param record Указатель на запись.
+    template <class T, class S, class H, class A, class K>
+    void OrderedHashTable<T, S, H, A, K>::link_back(Record* record) noexcept {
+        record->position_ = this->order_.size();
+        this->order_.push_back(record);
+        this->record_count_++;
+    }
+
+    /// \brief Создает новую запись и добавляет ее в конец порядка добавления.
+    ///
+    /// Ключа еще не должно быть в хеш-таблице. Если ведется упорядоченный
+    /// индекс, запись добавляется и в него. При необходимости таблица
+    /// расширяется или перестраивается.
+    ///
+    /// \param key Ключ записи.
+    /// \param hash Хеш ключа.
+    /// \param args Аргументы конструктора значения записи.
+    ///
+    /// \return Указатель на добавленную запись.
+    template <class T, class S, class H, class A, class K>
+    template <class Key, class... Args>
+    OrderedHashTable<T, S, H, A, K>::Record* OrderedHashTable<T, S, H, A, K>::append(Key&& key,
+                                                             const uint64_t& hash,
+                                                             Args&&... args) {
+        if (this->storage_ == nullptr)
+            this->storage_ = new Storage(this->size_, this->allocator_);
+        this->reserve_order();
+        Record* new_record{ this->create_record(std::forward<Key>(key), hash,
+                                                std::forward<Args>(args)...) };
+        if constexpr (IS_ORDERED_KEY) {
+            if (this->sorted_index_ != nullptr) {
+                try {
+                    this->sorted_index_->insert(new_record);
+                }
+                catch (...) {
+                    this->destroy_record(new_record);
+                    throw;
+                }
+            }
+        }
+        this->link_back(new_record);
+        this->storage_->insert(new_record, hash);
+
+        // Если ключей уже многовато - пора расширить таблицу.
+        if ((this->record_count_ / static_cast<double>(this->size_)) >=
+            this->growth_policy_.max_load_factor_)
+            this->expand();
+        // Если хранилище засорено удаленными ячейками - пора его перестроить.
+        else if (this->old_storage_ == nullptr && this->storage_->overloaded())
+            this->rehash(this->size_);
+        return new_record;
+    }
+
+    /// \brief Находит запись по ключу или добавляет новую.
+    ///
+    /// Аргументы конструктора значения используются только при добавлении
+    /// записи.
+    ///
+    /// \param key Ключ записи.
+    /// \param args Аргументы конструктора значения записи.
+    ///
+    /// \return Пару из указателя на запись и признака того, что запись
+    /// была добавлена.
+    template <class T, class S, class H, class A, class K>
+    template <class Key, class... Args>
+    std::pair<typename OrderedHashTable<T, S, H, A, K>::Record*, bool>
+    OrderedHashTable<T, S, H, A, K>::try_emplace_record(Key&& key, Args&&... args) {
+        this->migrate(MIGRATION_STEP);
+        uint64_t hash{ hash_function(key) };
+        // Проверка, что ключ уже существует в хранилище.
+        Record* record{ this->find(key, hash) };
+        if (record != nullptr)
+            return { record, false };
+        // Создание новой записи и ее добавление в хранилище.
+        return { this->append(std::forward<Key>(key), hash,
+                              std::forward<Args>(args)...), true };
+    }
+
+    /// \brief Добавляет пакет пар "ключ - значение".
+    ///
+    /// Таблица заранее расширяется под весь пакет, поэтому при вставке
+    /// перехеширование происходит не более одного раза. Ключи
+    /// обрабатываются окнами по BATCH_WINDOW: сначала все ключи окна
+    /// хешируются и их ячейки подгружаются в кеш, затем выполняется поиск,
+    /// так что ожидание памяти для разных ключей перекрывается.
+    ///
+    /// \param items Пары "ключ - значение" для вставки/изменения.
+    template <class T, class S, class H, class A, class K>
+    template <class Key>
+    void OrderedHashTable<T, S, H, A, K>::insert_batch_items(
+            std::span<const std::pair<Key, T>> items) {
+        this->reserve(this->record_count_ + items.size());
+        uint64_t hashes[BATCH_WINDOW];
+
+        for (size_t first{}; first < items.size(); first += BATCH_WINDOW) {
+            size_t count{ std::min(BATCH_WINDOW, items.size() - first) };
+            this->migrate(MIGRATION_STEP);
+            for (size_t item{}; item < count; item++) {
+                hashes[item] = hash_function(items[first + item].first);
+                this->prefetch(hashes[item]);
+            }
+            for (size_t item{}; item < count; item++) {
+                const auto& [key, value]{ items[first + item] };
+                Record* record{ this->find(key, hashes[item]) };
+                if (record != nullptr)
+                    record->value_ = value;
+                else
+                    this->append(key, hashes[item], value);
+            }
+        }
+    }
+
+    /// \brief Ищет пакет ключей.
+    ///
+    /// Ключи обрабатываются окнами по BATCH_WINDOW так же, как при пакетной
+    /// вставке.
+    ///
+    /// \param keys Ключи для поиска.
+    /// \param out Указатели на найденные значения или nullptr для
+    /// отсутствующих ключей, по одному на каждый ключ.
+    ///
+    /// \throw std::out_of_range Исключение возбуждается, если out короче
+    /// keys.
+    template <class T, class S, class H, class A, class K>
+    template <class Key>
+    void OrderedHashTable<T, S, H, A, K>::get_batch_items(std::span<const Key> keys,
+                                                          std::span<T*> out) {
+        if (out.size() < keys.size())
+            throw std::out_of_range("Batch output is shorter than batch keys.");
+        uint64_t hashes[BATCH_WINDOW];
+
+        for (size_t first{}; first < keys.size(); first += BATCH_WINDOW) {
+            size_t count{ std::min(BATCH_WINDOW, keys.size() - first) };
+            this->migrate(MIGRATION_STEP);
+            for (size_t item{}; item < count; item++) {
+                hashes[item] = hash_function(keys[first + item]);
+                this->prefetch(hashes[item]);
+            }
+            for (size_t item{}; item < count; item++) {
+                Record* record{ this->find(keys[first + item], hashes[item]) };
+                out[first + item] = (record != nullptr) ? &record->value_
+                                                         : nullptr;
+            }
+        }
+    }
+
+    /// \brief Заранее подгружает в кеш ячейки хранилищ, в которые попадает
+    /// хеш.
+    ///
+    /// \param hash Хеш ключа.
+    template <class T, class S, class H, class A, class K>
+    inline void OrderedHashTable<T, S, H, A, K>::prefetch(const uint64_t& hash)
+    const noexcept {
+        if (this->storage_ != nullptr)
+            this->storage_->prefetch(hash);
+        if (this->old_storage_ != nullptr)
+            this->old_storage_->prefetch(hash);
+    }
+
+    /// \brief Удаляет запись с указанным ключом.
+    ///
+    /// \param key Ключ записи.
+    /// \param hash Хеш ключа.
+    ///
+    /// \return true, если запись была удалена.
+    template <class T, class S, class H, class A, class K>
+    bool OrderedHashTable<T, S, H, A, K>::erase_record(KeyArgument key,
+                                                       const uint64_t& hash) {
+        Record* erased_record{ this->detach(key, hash) };
+        if (erased_record == nullptr)
+            return false;
+        this->unlink(erased_record);
+        this->destroy_record(erased_record);
+        this->shrink_if_sparse();
+        return true;
+    }
+
+    /// \brief Исключает запись из порядка добавления за O(1) и из
+    /// упорядоченного индекса за O(log n), если он ведется.
+    ///
+    /// \param record Указатель на исключаемую запись.
+    template <class T, class S, class H, class A, class K>
+    void OrderedHashTable<T, S, H, A, K>::unlink(Record* record) noexcept {
+        if constexpr (IS_ORDERED_KEY) {
+            if (this->sorted_index_ != nullptr)
+                static_cast<void>(this->sorted_index_->remove(record->key_));
+        }
+        this->order_[record->position_] = nullptr;
+        this->record_count_--;
+        this->trim_order();
+    }
+
+    /// \brief Переносит запись в конец порядка добавления за O(1).
+    ///
+    /// Место записи становится пустой ячейкой, как при удалении. Место
+    /// в конце массива должно быть заранее выделено reserve_order().
+    ///
+    /// \param record Указатель на переносимую запись.
+    template <class T, class S, class H, class A, class K>
+    void OrderedHashTable<T, S, H, A, K>::relink_back(Record* record) noexcept {
+        if (record->position_ + 1 == this->order_.size())
+            return;
+        this->order_[record->position_] = nullptr;
+        record->position_ = this->order_.size();
+        this->order_.push_back(record);
+        this->trim_order();
+    }
+
+    /// \brief Убирает пустые ячейки по краям массива порядка добавления
+    /// и уплотняет его, если пустых ячеек больше, чем записей.
+    template <class T, class S, class H, class A, class K>
+    void OrderedHashTable<T, S, H, A, K>::trim_order() noexcept {
+        // Пустые ячейки по краям массива убираются сразу: последняя
+        // ячейка и ячейка order_front_ всегда заняты записями.
+        while (!this->order_.empty() && this->order_.back() == nullptr)
+            this->order_.pop_back();
+        if (this->order_.empty())
+            this->order_front_ = 0;
+        while (this->order_front_ < this->order_.size() &&
+               this->order_[this->order_front_] == nullptr)
+            this->order_front_++;
+        if (this->order_.size() - this->record_count_ > this->record_count_)
+            this->compact_order();
+    }
+
+    /// \brief Убирает пустые ячейки из массива порядка добавления.
+    ///
+    /// Записи сдвигаются к началу массива с сохранением порядка и
+    /// получают новые позиции. Вызывается, когда пустых ячеек становится
+    /// больше, чем записей, поэтому удаление остается O(1) в среднем.
+    template <class T, class S, class H, class A, class K>
+    void OrderedHashTable<T, S, H, A, K>::compact_order() noexcept {
+        size_t position{};
+        for (size_t item{ this->order_front_ }; item < this->order_.size(); item++) {
+            Record* record{ this->order_[item] };
+            if (record == nullptr)
+                continue;
+            record->position_ = position;
+            this->order_[position++] = record;
+        }
+        this->order_.resize(position);
+        this->order_front_ = 0;
+    }
+
+    /// \brief Переносит часть записей из старого хранилища в новое.
+    ///
+    /// Когда старое хранилище опустошено, оно удаляется.
+    ///
+    /// \param count Количество ячеек старого хранилища для переноса.
+    template <class T, class S, class H, class A, class K>
+    void OrderedHashTable<T, S, H, A, K>::migrate(const size_t& count) {
+        if (this->old_storage_ == nullptr)
+            return;
+
+        this->migrate_cursor_ = this->old_storage_->transfer(
+                this->migrate_cursor_, count, *this->storage_);
+
+        if (this->migrate_cursor_ >= this->old_storage_->capacity()) {
+            delete this->old_storage_;
+            this->old_storage_ = nullptr;
+            this->migrate_cursor_ = 0;
+#ifdef ORDERHASHTABLE_STATS
+            this->stats_.count_deallocation();
+#endif
+        }
+    }
+
+    /// \brief Перестраивает хранилище под указанный размер.
+    ///
+    /// Хранилище обходится по ячейкам, и указатели на записи перевешиваются
+    /// в новое хранилище по сохраненным в записях хешам: ни записи, ни
+    /// значения не копируются, ключи не хешируются повторно, а память
+    /// выделяется только под новый массив ячеек. Незавершенное постепенное
+    /// перехеширование предварительно доводится до конца. Если задан пул
+    /// потоков, записи переносятся несколькими потоками.
+    ///
+    /// \param new_size Новый "физический" размер хеш-таблицы.
+    template <class T, class S, class H, class A, class K>
+    void OrderedHashTable<T, S, H, A, K>::rehash(const size_t& new_size) {
+        if (this->old_storage_ != nullptr)
+            this->migrate(this->old_storage_->capacity());
+        auto* temp{ new Storage(new_size, this->allocator_) };
+
+        if (this->thread_pool_ != nullptr)
+            this->storage_->transfer_all(*temp, *this->thread_pool_);
+        else
+            this->storage_->transfer(0, this->storage_->capacity(), *temp);
+
+        delete this->storage_;
+        this->storage_ = temp;
+        this->size_ = new_size;
+#ifdef ORDERHASHTABLE_STATS
+        this->stats_.count_allocation();
+        this->stats_.count_deallocation();
+#endif
+    }
+
+    /// \brief Метод, динамически расширяющий хеш-таблицу по мере ее заполнения.
+    ///
+    /// Начинают свою работу, когда заполненность хеш-таблицы ключами
+    /// превышает определенный процент от общей емкости
+    /// (GrowthPolicy::max_load_factor_) таблицы. Новый размер выбирает
+    /// GrowthPolicy::grow(). В режиме
+    /// RehashMode::INCREMENTAL создается только новое хранилище, а записи
+    /// переносятся в него последующими операциями, поэтому в статистику
+    /// попадает лишь время создания хранилища.
+    template <class T, class S, class H, class A, class K>
+    void OrderedHashTable<T, S, H, A, K>::expand() {
+#ifdef ORDERHASHTABLE_STATS
+        auto start{ std::chrono::steady_clock::now() };
+#endif
+        const size_t new_size{ this->growth_policy_.grow(this->size_) };
+        if (this->rehash_mode_ == RehashMode::BLOCKING)
+            this->rehash(new_size);
+        else {
+            // Предыдущий перенос должен завершиться до начала следующего.
+            if (this->old_storage_ != nullptr)
+                this->migrate(this->old_storage_->capacity());
+
+            this->old_storage_ = this->storage_;
+            this->storage_ = new Storage(new_size, this->allocator_);
+            this->migrate_cursor_ = 0;
+            this->size_ = new_size;
+#ifdef ORDERHASHTABLE_STATS
+            this->stats_.count_allocation();
+#endif
+        }
+#ifdef ORDERHASHTABLE_STATS
+        this->stats_.count_expand(std::chrono::steady_clock::now() - start);
+#endif
+    }
+
+    /// \brief Сжимает хеш-таблицу, если после удаления она заполнена меньше,
+    /// чем на GrowthPolicy::min_load_factor_.
+    ///
+    /// Новый размер выбирается с запасом на growth_factor_ раз больше
+    /// записей, чтобы чередование вставок и удалений у границы не
+    /// перестраивало таблицу каждый раз. Сжатие - необязательная
+    /// оптимизация: если памяти под новое хранилище не хватило, таблица
+    /// остается прежнего размера.
+    template <class T, class S, class H, class A, class K>
+    void OrderedHashTable<T, S, H, A, K>::shrink_if_sparse() noexcept {
+        const GrowthPolicy& policy{ this->growth_policy_ };
+        if (policy.min_load_factor_ == 0.0 || this->storage_ == nullptr ||
+            this->size_ <= policy.min_size_ ||
+            (this->record_count_ / static_cast<double>(this->size_)) >=
+            policy.min_load_factor_)
+            return;
+
+        const size_t new_size{ policy.fit(static_cast<size_t>(
+                this->record_count_ * policy.growth_factor_)) };
+        if (new_size >= this->size_)
+            return;
+        try {
+            this->rehash(new_size);
+        }
+        catch (const std::bad_alloc&) { }
+    }
+
+    /// \brief Проверяет политику расширения.
+    ///
+    /// \param policy Проверяемая политика.
+    ///
+    /// \return Ту же политику.
+    ///
+    /// \throw std::invalid_argument Исключение возбуждается, если
+    /// коэффициенты политики противоречат друг другу или хранилищу.
+    template <class T, class S, class H, class A, class K>
+    [[nodiscard]]
+    const GrowthPolicy& OrderedHashTable<T, S, H, A, K>::checked_policy(
+            const GrowthPolicy& policy) {
+        if (!policy.valid(Storage::MAX_LOAD_FACTOR))
+            throw std::invalid_argument("Inconsistent hash table growth policy.");
+        return policy;
+    }
+
+    /// \brief Удаляет все записи хеш-таблицы.
+    ///
+    /// Записи удаляются обходом по порядку добавления, упорядоченный индекс
+    /// опустошается. Хранилище при этом не очищается: вызывающий код
+    /// должен заменить или удалить его.
+    template <class T, class S, class H, class A, class K>
+    void OrderedHashTable<T, S, H, A, K>::clear() noexcept {
+        for (Record* record : this->order_) {
+            if (record != nullptr)
+                this->destroy_record(record);
+        }
+        this->order_.clear();
+        this->order_front_ = 0;
+        this->record_count_ = 0;
+        if (this->sorted_index_ != nullptr)
+            this->sorted_index_->clear();
+    }
+
+// PUBLIC
+
+    /// \brief Стандартный конструктор экземпляра класса OrderedHashTable.
+    ///
+    /// Инициализирует хеш-таблицу
+    /// со стандартным размером MIN_TABLE_SIZE.
+    template <class T, class S, class H, class A, class K>
+    OrderedHashTable<T, S, H, A, K>::OrderedHashTable() noexcept :
+            OrderedHashTable(MIN_TABLE_SIZE, A()) { }
+
+    /// \brief Конструктор экземпляра класса с возможностью указать
+    /// размер.
+    ///
+    /// Инициализирует хеш-таблицу с пользовательским размером,
+    /// не меньшим, чем минимальный размер MIN_TABLE_SIZE.
+    ///
+    /// \param size Физический размер хеш-таблицы.
+    template <class T, class S, class H, class A, class K>
+    [[maybe_unused]]
+    OrderedHashTable<T, S, H, A, K>::OrderedHashTable(const size_t& size) noexcept :
+            OrderedHashTable(size, A()) { }
+
+    /// \brief Конструктор экземпляра класса с возможностью указать
+    /// аллокатор.
+    ///
+    /// \param allocator Аллокатор, из которого берется память под записи
+    /// и ячейки хранилища.
+    template <class T, class S, class H, class A, class K>
+    [[maybe_unused]]
+    OrderedHashTable<T, S, H, A, K>::OrderedHashTable(const A& allocator) noexcept :
+            OrderedHashTable(MIN_TABLE_SIZE, allocator) { }
+
+    /// \brief Конструктор экземпляра класса с возможностью указать
+    /// размер и аллокатор.
+    ///
+    /// \param size Физический размер хеш-таблицы, не меньший
+    /// MIN_TABLE_SIZE.
+    /// \param allocator Аллокатор, из которого берется память под записи
+    /// и ячейки хранилища.
+    template <class T, class S, class H, class A, class K>
+    [[maybe_unused]]
+    OrderedHashTable<T, S, H, A, K>::OrderedHashTable(const size_t& size,
+                                                      const A& allocator) noexcept :
+            size_((MIN_TABLE_SIZE > size) ? MIN_TABLE_SIZE : size),
+            record_count_(0), allocator_(allocator),
+            storage_(new Storage(this->size_, this->allocator_)),
+            old_storage_(nullptr), migrate_cursor_(0),
+            rehash_mode_(RehashMode::BLOCKING), thread_pool_(nullptr),
+            sorted_index_(nullptr), hasher_(), growth_policy_(),
+            order_(OrderAllocator(this->allocator_)), order_front_(0),
+            key_view_(this) { }
+
+    /// \brief Конструктор экземпляра класса с политикой расширения.
+    ///
+    /// Таблица сразу создается такого размера, чтобы count записей
+    /// поместились без расширения.
+    ///
+    /// \param policy Политика расширения и сжатия.
+    /// \param count Ожидаемое количество записей.
+    /// \param allocator Аллокатор, из которого берется память под записи
+    /// и ячейки хранилища.
+    ///
+    /// \throw std::invalid_argument Исключение возбуждается, если политика
+    /// некорректна.
+    template <class T, class S, class H, class A, class K>
+    [[maybe_unused]]
+    OrderedHashTable<T, S, H, A, K>::OrderedHashTable(const GrowthPolicy& policy,
+                                                      const size_t& count,
+                                                      const A& allocator) :
+            size_(checked_policy(policy).fit(count)),
+            record_count_(0), allocator_(allocator),
+            storage_(new Storage(this->size_, this->allocator_)),
+            old_storage_(nullptr), migrate_cursor_(0),
+            rehash_mode_(RehashMode::BLOCKING), thread_pool_(nullptr),
+            sorted_index_(nullptr), hasher_(), growth_policy_(policy),
+            order_(OrderAllocator(this->allocator_)), order_front_(0),
+            key_view_(this) { }
+
+    /// \brief Конструктор экземпляра класса с общей ареной ключей.
+    ///
+    /// Таблицы, созданные с одной ареной ArenaMode::INTERN, хранят
+    /// одинаковые длинные ключи один раз - например, имена полей
+    /// вложенных таблиц.
+    ///
+    /// \param arena Арена длинных ключей или nullptr, чтобы таблица
+    /// завела собственную.
+    /// \param allocator Аллокатор, из которого берется память под записи
+    /// и ячейки хранилища.
+    template <class T, class S, class H, class A, class K>
+    [[maybe_unused]]
+    OrderedHashTable<T, S, H, A, K>::OrderedHashTable(std::shared_ptr<KeyArena> arena,
+                                                      const A& allocator) noexcept
+    requires std::is_same_v<K, CompactKey> :
+            OrderedHashTable(MIN_TABLE_SIZE, allocator) {
+        this->key_arena_ = std::move(arena);
+    }
+
+    /// \brief Конструктор копирования экземпляра класса OrderedHashTable.
+    ///
+    /// Создает независимую копию всех записей с сохранением порядка
+    /// добавления ключей. Аллокатор копии выбирается через
+    /// select_on_container_copy_construction: PoolAllocator заводит
+    /// копии собственный пул. Арену ключей CompactKey копия разделяет с
+    /// оригиналом.
+    ///
+    /// \param other Копируемая хеш-таблица.
+    template <class T, class S, class H, class A, class K>
+    OrderedHashTable<T, S, H, A, K>::OrderedHashTable(const OrderedHashTable& other) :
+            size_(other.size_), record_count_(0),
+            allocator_(RecordTraits::select_on_container_copy_construction(
+                    other.allocator_)),
+            storage_(new Storage(this->size_, this->allocator_)),
+            old_storage_(nullptr),
+            migrate_cursor_(0), rehash_mode_(other.rehash_mode_),
+            thread_pool_(other.thread_pool_),
+            sorted_index_((other.sorted_index_ != nullptr) ?
+                          new Index(this->allocator_) : nullptr),
+            hasher_(other.hasher_), growth_policy_(other.growth_policy_),
+            order_(OrderAllocator(this->allocator_)), order_front_(0),
+            key_view_(this), key_arena_(other.key_arena_) {
+        this->order_.reserve(other.record_count_);
+        for (Record* record : other.order_) {
+            if (record != nullptr)
+                this->append(record->key_, record->hash_, record->value_);
+        }
+    }
+
+    /// \brief Конструктор перемещения экземпляра класса OrderedHashTable.
+    ///
+    /// Забирает записи и хранилища другой таблицы без копирования.
+    /// Перемещенная таблица остается пустой и создаст хранилище при
+    /// следующей вставке.
+    ///
+    /// \param other Перемещаемая хеш-таблица.
+    template <class T, class S, class H, class A, class K>
+    OrderedHashTable<T, S, H, A, K>::OrderedHashTable(OrderedHashTable&& other)
+    noexcept :
+            size_(std::exchange(other.size_, other.growth_policy_.fit(0))),
+            record_count_(std::exchange(other.record_count_, 0)),
+            allocator_(std::move(other.allocator_)),
+            storage_(std::exchange(other.storage_, nullptr)),
+            old_storage_(std::exchange(other.old_storage_, nullptr)),
+            migrate_cursor_(std::exchange(other.migrate_cursor_, 0)),
+            rehash_mode_(other.rehash_mode_), thread_pool_(other.thread_pool_),
+            sorted_index_(std::exchange(other.sorted_index_, nullptr)),
+            hasher_(other.hasher_), growth_policy_(other.growth_policy_),
+            order_(std::move(other.order_)),
+            order_front_(std::exchange(other.order_front_, 0)), key_view_(this),
+            key_arena_(std::move(other.key_arena_)) { }
+
+    /// \brief Оператор присваивания копированием.
+    ///
+    /// \param other Копируемая хеш-таблица.
+    ///
+    /// \return Ссылку на текущий экземпляр.
+    template <class T, class S, class H, class A, class K>
+    OrderedHashTable<T, S, H, A, K>& OrderedHashTable<T, S, H, A, K>::operator = (
+            const OrderedHashTable& other) {
+        if (this == &other)
+            return *this;
+
+        this->clear();
+        delete this->old_storage_;
+        this->old_storage_ = nullptr;
+        this->migrate_cursor_ = 0;
+        delete this->storage_;
+        if constexpr (RecordTraits::propagate_on_container_copy_assignment::value)
+            this->allocator_ = other.allocator_;
+        this->storage_ = new Storage(this->size_, this->allocator_);
+        delete this->sorted_index_;
+        this->sorted_index_ = (other.sorted_index_ != nullptr) ?
+                              new Index(this->allocator_) : nullptr;
+
+        this->rehash_mode_ = other.rehash_mode_;
+        this->thread_pool_ = other.thread_pool_;
+        this->hasher_ = other.hasher_;
+        this->growth_policy_ = other.growth_policy_;
+        this->key_arena_ = other.key_arena_;
+        this->order_.reserve(other.record_count_);
+        for (Record* record : other.order_) {
+            if (record != nullptr)
+                this->append(record->key_, record->hash_, record->value_);
+        }
+        return *this;
+    }
+
+    /// \brief Оператор присваивания перемещением.
+    ///
+    /// Если аллокаторы таблиц совместимы, записи и хранилища забираются
+    /// целиком. Иначе записи создаются заново в памяти текущей таблицы,
+    /// а ключи и значения перемещаются в них.
+    ///
+    /// \param other Перемещаемая хеш-таблица.
+    ///
+    /// \return Ссылку на текущий экземпляр.
+    template <class T, class S, class H, class A, class K>
+    OrderedHashTable<T, S, H, A, K>& OrderedHashTable<T, S, H, A, K>::operator = (
+            OrderedHashTable&& other) {
+        if (this == &other)
+            return *this;
+
+        this->clear();
+        delete this->old_storage_;
+        delete this->storage_;
+        this->old_storage_ = this->storage_ = nullptr;
+        this->migrate_cursor_ = 0;
+        delete this->sorted_index_;
+        this->sorted_index_ = nullptr;
+        this->rehash_mode_ = other.rehash_mode_;
+        this->thread_pool_ = other.thread_pool_;
+        this->hasher_ = other.hasher_;
+        this->growth_policy_ = other.growth_policy_;
+
+        if constexpr (!RecordTraits::propagate_on_container_move_assignment::value) {
+            if (!(this->allocator_ == other.allocator_)) {
+                this->size_ = other.size_;
+                this->key_arena_ = other.key_arena_;
+                if (other.sorted_index_ != nullptr)
+                    this->sorted_index_ = new Index(this->allocator_);
+                this->order_.reserve(other.record_count_);
+                for (Record* record : other.order_) {
+                    if (record != nullptr)
+                        this->append(std::move(record->key_), record->hash_,
+                                     std::move(record->value_));
+                }
+                other.clear();
+                delete other.old_storage_;
+                delete other.storage_;
+                delete other.sorted_index_;
+                other.old_storage_ = other.storage_ = nullptr;
+                other.sorted_index_ = nullptr;
+                other.migrate_cursor_ = 0;
+                other.size_ = other.growth_policy_.fit(0);
+                return *this;
+            }
+        }
+        else
+            this->allocator_ = std::move(other.allocator_);
+
+        this->size_ = std::exchange(other.size_, other.growth_policy_.fit(0));
+        this->record_count_ = std::exchange(other.record_count_, 0);
+        this->storage_ = std::exchange(other.storage_, nullptr);
+        this->old_storage_ = std::exchange(other.old_storage_, nullptr);
+        this->migrate_cursor_ = std::exchange(other.migrate_cursor_, 0);
+        this->sorted_index_ = std::exchange(other.sorted_index_, nullptr);
+        this->order_ = std::move(other.order_);
+        other.order_.clear();
+        this->order_front_ = std::exchange(other.order_front_, 0);
+        this->key_arena_ = std::move(other.key_arena_);
+        return *this;
+    }
+
+    // Стандартный деструктор экземпляра.
+    template <class T, class S, class H, class A, class K>
+    OrderedHashTable<T, S, H, A, K>::~OrderedHashTable() {
+        this->clear();
+        delete this->storage_;
+        delete this->old_storage_;
+        delete this->sorted_index_;
+    }
+
+    /// \brief Предоставляет доступ к ключам хеш-таблицы.
+    ///
+    /// Возвращает представление ключей таблицы в порядке их добавления,
+    /// предоставляет возможность итерации по ним.
+    ///
+    /// \return Представление ключей хеш-таблицы.
+    template <class T, class S, class H, class A, class K>
+    [[nodiscard]] [[maybe_unused]]
+    inline const OrderedHashTable<T, S, H, A, K>::KeyView*
+    OrderedHashTable<T, S, H, A, K>::keys() const noexcept {
+        return &this->key_view_;
+    }
+
+    /// \brief Предоставляет доступ к парам "ключ - значение" хеш-таблицы.
+    ///
+    /// Пары перебираются в порядке добавления последовательным проходом
+    /// по массиву порядка: в отличие от перебора keys() с operator [],
+    /// ключи не копируются и не хешируются повторно.
+    ///
+    /// \return Представление пар хеш-таблицы.
+    template <class T, class S, class H, class A, class K>
+    [[nodiscard]] [[maybe_unused]]
+    inline OrderedHashTable<T, S, H, A, K>::ItemView
+    OrderedHashTable<T, S, H, A, K>::items() noexcept {
+        Record* const* order{ this->order_.data() };
+        return ItemView(order + this->order_front_, order + this->order_.size(),
+                        this->record_count_);
+    }
+
+    /// \brief Предоставляет доступ к количеству элементов таблицы.
+    ///
+    /// \return Ссылку на переменную, хранящую кол-во ключей.
+    template <class T, class S, class H, class A, class K>
+    [[nodiscard]] [[maybe_unused]]
+    inline const uint32_t& OrderedHashTable<T, S, H, A, K>::length() const noexcept {
+        return this->record_count_;
+    }
+
+    /// \brief Метод, добавляющий элемент.
+    ///
+    /// Добавляет в хеш-таблицу новую пару "ключ - значение" или
+    /// изменяет значение по уже существующему ключу.
+    ///
+    /// \param key Ключ элемента для вставки/изменения.
+    /// \param value Значение элемента для вставки/изменения.
+    template <class T, class S, class H, class A, class K>
+    [[maybe_unused]]
+    void OrderedHashTable<T, S, H, A, K>::insert(KeyArgument key, const T& value) {
+        static_cast<void>(this->insert_or_assign(key, value));
+    }
+
+    /// \brief Метод, добавляющий элемент с перемещением значения.
+    ///
+    /// Добавляет в хеш-таблицу новую пару "ключ - значение" или
+    /// изменяет значение по уже существующему ключу. Значение не
+    /// копируется, а перемещается в запись.
+    ///
+    /// \param key Ключ элемента для вставки/изменения.
+    /// \param value Значение элемента для вставки/изменения.
+    template <class T, class S, class H, class A, class K>
+    [[maybe_unused]]
+    void OrderedHashTable<T, S, H, A, K>::insert(KeyArgument key, T&& value) {
+        static_cast<void>(this->insert_or_assign(key, std::move(value)));
+    }
+
+    /// \brief Создает значение элемента на месте.
+    ///
+    /// Значение конструируется прямо в записи из переданных аргументов.
+    /// Если ключ уже существует, его значение заменяется новым.
+    ///
+    /// \param key Ключ элемента.
+    /// \param args Аргументы конструктора значения.
+    ///
+    /// \return Ссылку на значение элемента.
+    template <class T, class S, class H, class A, class K>
+    template <class... Args>
+    [[maybe_unused]]
+    T& OrderedHashTable<T, S, H, A, K>::emplace(KeyArgument key,
+                                                Args&&... args) {
+        auto [record, inserted]{ this->try_emplace_record(
+                key, std::forward<Args>(args)...) };
+        if (!inserted)
+            record->value_ = T(std::forward<Args>(args)...);
+        return record->value_;
+    }
+
+    /// \brief Создает значение элемента на месте, перемещая ключ в запись.
+    ///
+    /// \param key Строковый ключ элемента.
+    /// \param args Аргументы конструктора значения.
+    ///
+    /// \return Ссылку на значение элемента.
+    template <class T, class S, class H, class A, class K>
+    template <class... Args>
+    [[maybe_unused]]
+    T& OrderedHashTable<T, S, H, A, K>::emplace(std::string&& key,
+                                                Args&&... args)
+    requires std::is_same_v<K, std::string> {
+        auto [record, inserted]{ this->try_emplace_record(
+                std::move(key), std::forward<Args>(args)...) };
+        if (!inserted)
+            record->value_ = T(std::forward<Args>(args)...);
+        return record->value_;
+    }
+
+    /// \brief Создает значение элемента на месте по ключу-строке C.
+    ///
+    /// \param key Строковый ключ элемента.
+    /// \param args Аргументы конструктора значения.
+    ///
+    /// \return Ссылку на значение элемента.
+    template <class T, class S, class H, class A, class K>
+    template <class... Args>
+    [[maybe_unused]]
+    T& OrderedHashTable<T, S, H, A, K>::emplace(const char* key, Args&&... args)
+    requires std::is_same_v<K, std::string> {
+        return this->emplace(std::string_view(key), std::forward<Args>(args)...);
+    }
+
+    /// \brief Добавляет элемент, только если ключа еще нет в хеш-таблице.
+    ///
+    /// Аргументы конструктора значения не используются, если ключ уже
+    /// существует.
+    ///
+    /// \param key Ключ элемента.
+    /// \param args Аргументы конструктора значения.
+    ///
+    /// \return Пару из ссылки на значение элемента и признака того, что
+    /// элемент был добавлен.
+    template <class T, class S, class H, class A, class K>
+    template <class... Args>
+    [[maybe_unused]]
+    std::pair<T&, bool> OrderedHashTable<T, S, H, A, K>::try_emplace(
+            KeyArgument key, Args&&... args) {
+        auto [record, inserted]{ this->try_emplace_record(
+                key, std::forward<Args>(args)...) };
+        return { record->value_, inserted };
+    }
+
+    /// \brief Добавляет элемент, только если ключа еще нет в хеш-таблице,
+    /// перемещая ключ в запись.
+    ///
+    /// \param key Строковый ключ элемента.
+    /// \param args Аргументы конструктора значения.
+    ///
+    /// \return Пару из ссылки на значение элемента и признака того, что
+    /// элемент был добавлен.
+    template <class T, class S, class H, class A, class K>
+    template <class... Args>
+    [[maybe_unused]]
+    std::pair<T&, bool> OrderedHashTable<T, S, H, A, K>::try_emplace(
+            std::string&& key, Args&&... args)
+    requires std::is_same_v<K, std::string> {
+        auto [record, inserted]{ this->try_emplace_record(
+                std::move(key), std::forward<Args>(args)...) };
+        return { record->value_, inserted };
+    }
+
+    /// \brief Добавляет элемент по ключу-строке C, только если ключа еще
+    /// нет в хеш-таблице.
+    ///
+    /// \param key Строковый ключ элемента.
+    /// \param args Аргументы конструктора значения.
+    ///
+    /// \return Пару из ссылки на значение элемента и признака того, что
+    /// элемент был добавлен.
+    template <class T, class S, class H, class A, class K>
+    template <class... Args>
+    [[maybe_unused]]
+    std::pair<T&, bool> OrderedHashTable<T, S, H, A, K>::try_emplace(
+            const char* key, Args&&... args)
+    requires std::is_same_v<K, std::string> {
+        return this->try_emplace(std::string_view(key),
+                                 std::forward<Args>(args)...);
+    }
+
+    /// \brief Добавляет элемент или присваивает новое значение по
+    /// существующему ключу.
+    ///
+    /// \param key Ключ элемента.
+    /// \param value Значение элемента; rvalue перемещается.
+    ///
+    /// \return Пару из ссылки на значение элемента и признака того, что
+    /// элемент был добавлен.
+    template <class T, class S, class H, class A, class K>
+    template <class Value>
+    [[maybe_unused]]
+    std::pair<T&, bool> OrderedHashTable<T, S, H, A, K>::insert_or_assign(
+            KeyArgument key, Value&& value) {
+        auto [record, inserted]{ this->try_emplace_record(
+                key, std::forward<Value>(value)) };
+        if (!inserted)
+            record->value_ = std::forward<Value>(value);
+        return { record->value_, inserted };
+    }
+
+    /// \brief Добавляет элемент или присваивает новое значение по
+    /// существующему ключу, перемещая ключ в запись.
+    ///
+    /// \param key Строковый ключ элемента.
+    /// \param value Значение элемента; rvalue перемещается.
+    ///
+    /// \return Пару из ссылки на значение элемента и признака того, что
+    /// элемент был добавлен.
+    template <class T, class S, class H, class A, class K>
+    template <class Value>
+    [[maybe_unused]]
+    std::pair<T&, bool> OrderedHashTable<T, S, H, A, K>::insert_or_assign(
+            std::string&& key, Value&& value)
+    requires std::is_same_v<K, std::string> {
+        auto [record, inserted]{ this->try_emplace_record(
+                std::move(key), std::forward<Value>(value)) };
+        if (!inserted)
+            record->value_ = std::forward<Value>(value);
+        return { record->value_, inserted };
+    }
+
+    /// \brief Добавляет элемент по ключу-строке C или присваивает новое
+    /// значение по существующему ключу.
+    ///
+    /// \param key Строковый ключ элемента.
+    /// \param value Значение элемента; rvalue перемещается.
+    ///
+    /// \return Пару из ссылки на значение элемента и признака того, что
+    /// элемент был добавлен.
+    template <class T, class S, class H, class A, class K>
+    template <class Value>
+    [[maybe_unused]]
+    std::pair<T&, bool> OrderedHashTable<T, S, H, A, K>::insert_or_assign(
+            const char* key, Value&& value)
+    requires std::is_same_v<K, std::string> {
+        return this->insert_or_assign(std::string_view(key),
+                                      std::forward<Value>(value));
+    }
+
+    /// \brief Метод, стирающий из хеш-таблицы элемент с указанным ключом.
+    ///
+    /// Длинный ключ CompactKey остается в арене KeyArena: в режиме
+    /// ArenaMode::APPEND его память не переиспользуется до уничтожения
+    /// арены.
+    ///
+    /// \param key Ключ элемента, который требуется удалить.
+    template <class T, class S, class H, class A, class K>
+    [[maybe_unused]]
+    void OrderedHashTable<T, S, H, A, K>::erase(KeyArgument key) {
+        this->migrate(MIGRATION_STEP);
+        static_cast<void>(this->erase_record(key, hash_function(key)));
+    }
+
+    /// \brief Удаляет элемент и возвращает его.
+    ///
+    /// Метод извлекает из хеш-таблицы последний добавленный элемент и
+    /// возвращает записанное в него значение. Для пустой таблицы
+    /// возвращается стандартное значение.
+    ///
+    /// \return Значение извлеченного элемента указанного типа данных.
+    template <class T, class S, class H, class A, class K>
+    [[maybe_unused]]
+    T OrderedHashTable<T, S, H, A, K>::pop() {
+        if (this->record_count_ == 0)
+            return T{};
+
+        // Последняя добавленная запись известна заранее: ключ не нужно
+        // хешировать повторно.
+        this->migrate(MIGRATION_STEP);
+        Record* popped_record{ this->order_.back() };
+        static_cast<void>(this->detach(popped_record->key_,
+                                       popped_record->hash_));
+        this->unlink(popped_record);
+        T ret_val{ std::move(popped_record->value_) };
+
+        // Удаление извлеченного элемента.
+        this->destroy_record(popped_record);
+        this->shrink_if_sparse();
+        return ret_val;
+    }
+
+    /// \brief Удаляет первый добавленный элемент и возвращает его.
+    ///
+    /// Первая запись берется из начала массива порядка, поэтому метод
+    /// работает за O(1), как и pop(). Для пустой таблицы возвращается
+    /// стандартное значение.
+    ///
+    /// \return Значение извлеченного элемента указанного типа данных.
+    template <class T, class S, class H, class A, class K>
+    [[maybe_unused]]
+    T OrderedHashTable<T, S, H, A, K>::pop_front() {
+        if (this->record_count_ == 0)
+            return T{};
+
+        this->migrate(MIGRATION_STEP);
+        Record* popped_record{ this->order_[this->order_front_] };
+        static_cast<void>(this->detach(popped_record->key_,
+                                       popped_record->hash_));
+        this->unlink(popped_record);
+        T ret_val{ std::move(popped_record->value_) };
+
+        this->destroy_record(popped_record);
+        this->shrink_if_sparse();
+        return ret_val;
+    }
+
+    /// \brief Метод, позволяющий получить значение элемента по ключу.
+    ///
+    /// В случае ненахождения элемента будет возвращено стандартное значение.
+    /// Значение не копируется: ссылка действительна, пока элемент не удален
+    /// из хеш-таблицы.
+    ///
+    /// \param key Ключ, значение по которому нужно найти.
+    ///
+    /// \return Ссылку на найденное значение ключа или на стандартное
+    /// значение.
+    template <class T, class S, class H, class A, class K>
+    const T& OrderedHashTable<T, S, H, A, K>::get(KeyArgument key) {
+        // Дефолтное значение.
+        static const T DEFAULT_VALUE{};
+
+        this->migrate(MIGRATION_STEP);
+#ifdef ORDERHASHTABLE_STATS
+        size_t probes;
+        Record* record{ this->find(key, hash_function(key), probes) };
+        this->stats_.count_get(probes);
+#else
+        Record* record{ this->find(key, hash_function(key)) };
+#endif
+        if (record != nullptr)
+            return record->value_;
+        return DEFAULT_VALUE;
+    }
+
+    /// \brief Перегрузка оператора [] для получения доступа к элементам
+    /// хеш-таблицы.
+    ///
+    /// \param key Ключ элемента для доступа.
+    ///
+    /// \return Ссылка на значение указанного типа.
+    ///
+    /// \throw DataStructures::OrderedHashTable::KeyException Возбуждается,
+    /// если элемент с указанным ключом не найден. Рекомендуется использовать
+    /// .get(), если присутствие ключа не точно.
+    template <class T, class S, class H, class A, class K>
+    T& OrderedHashTable<T, S, H, A, K>::operator [] (KeyArgument key) {
+        this->migrate(MIGRATION_STEP);
+        Record* record{ this->find(key, hash_function(key)) };
+        if (record != nullptr)
+            return record->value_;
+        if constexpr (IS_STRING_KEY)
+            throw KeyException(std::string(key));
+        else if constexpr (std::is_arithmetic_v<K>)
+            throw KeyException(std::to_string(key));
+        else
+            throw KeyException(std::to_string(sizeof(K)) + "-byte key");
+    }
+
+    /// \brief Заранее расширяет хеш-таблицу под указанное количество
+    /// элементов.
+    ///
+    /// Размер выбирается GrowthPolicy::fit() так, чтобы count элементов
+    /// уложились в max_load_factor_, после чего хранилище перестраивается
+    /// один раз. Последующие вставки до count элементов не расширяют
+    /// таблицу. Таблица меньше не становится.
+    ///
+    /// \param count Ожидаемое количество элементов.
+    template <class T, class S, class H, class A, class K>
+    [[maybe_unused]]
+    void OrderedHashTable<T, S, H, A, K>::reserve(const size_t& count) {
+        const size_t new_size{ this->growth_policy_.fit(count) };
+        if (new_size <= this->size_)
+            return;
+
+        // Хранилища еще нет - оно будет создано сразу нужного размера.
+        if (this->storage_ == nullptr)
+            this->size_ = new_size;
+        else
+            this->rehash(new_size);
+    }
+
+    /// \brief Сжимает хеш-таблицу до наименьшего размера, при котором
+    /// имеющиеся записи не превышают max_load_factor_.
+    ///
+    /// Незавершенное постепенное перехеширование доводится до конца, у
+    /// открытой адресации заодно очищаются удаленные ячейки.
+    template <class T, class S, class H, class A, class K>
+    [[maybe_unused]]
+    void OrderedHashTable<T, S, H, A, K>::shrink_to_fit() {
+        const size_t new_size{ this->growth_policy_.fit(this->record_count_) };
+        if (this->storage_ == nullptr)
+            this->size_ = new_size;
+        else
+            this->rehash(new_size);
+    }
+
+    /// \brief Задает политику расширения и сжатия.
+    ///
+    /// Если при новой политике таблица переполнена или слишком разрежена,
+    /// она сразу перестраивается.
+    ///
+    /// \param policy Новая политика.
+    ///
+    /// \throw std::invalid_argument Исключение возбуждается, если политика
+    /// некорректна.
+    template <class T, class S, class H, class A, class K>
+    [[maybe_unused]]
+    void OrderedHashTable<T, S, H, A, K>::set_growth_policy(
+            const GrowthPolicy& policy) {
+        this->growth_policy_ = checked_policy(policy);
+        if ((this->record_count_ / static_cast<double>(this->size_)) >=
+            policy.max_load_factor_)
+            this->reserve(this->record_count_);
+        else
+            this->shrink_if_sparse();
+    }
+
+    /// \brief Предоставляет доступ к политике расширения.
+    ///
+    /// \return Ссылку на текущую политику.
+    template <class T, class S, class H, class A, class K>
+    [[nodiscard]] [[maybe_unused]]
+    inline const GrowthPolicy& OrderedHashTable<T, S, H, A, K>::growth_policy()
+    const noexcept {
+        return this->growth_policy_;
+    }
+
+    /// \brief Предоставляет доступ к арене длинных ключей.
+    ///
+    /// \return Арену или nullptr, если длинных ключей еще не было.
+    template <class T, class S, class H, class A, class K>
+    [[nodiscard]] [[maybe_unused]]
+    inline const std::shared_ptr<KeyArena>&
+    OrderedHashTable<T, S, H, A, K>::key_arena() const noexcept
+    requires std::is_same_v<K, CompactKey> {
+        return this->key_arena_;
+    }
+
+    /// \brief Добавляет пакет пар "ключ - значение".
+    ///
+    /// \param items Пары "ключ - значение" для вставки/изменения.
+    template <class T, class S, class H, class A, class K>
+    [[maybe_unused]]
+    void OrderedHashTable<T, S, H, A, K>::insert_batch(
+            std::span<const std::pair<std::string, T>> items)
+    requires std::is_same_v<K, std::string> {
+        this->insert_batch_items(items);
+    }
+
+    /// \brief Добавляет пакет пар "ключ - значение" с ключами-срезами.
+    ///
+    /// \param items Пары "ключ - значение" для вставки/изменения.
+    template <class T, class S, class H, class A, class K>
+    [[maybe_unused]]
+    void OrderedHashTable<T, S, H, A, K>::insert_batch(
+            std::span<const std::pair<KeyArgument, T>> items) {
+        this->insert_batch_items(items);
+    }
+
+    /// \brief Ищет пакет ключей.
+    ///
+    /// \param keys Строковые ключи для поиска.
+    /// \param out Указатели на найденные значения или nullptr.
+    template <class T, class S, class H, class A, class K>
+    [[maybe_unused]]
+    void OrderedHashTable<T, S, H, A, K>::get_batch(std::span<const std::string> keys,
+                                                    std::span<T*> out)
+    requires std::is_same_v<K, std::string> {
+        this->get_batch_items(keys, out);
+    }
+
+    /// \brief Ищет пакет ключей-срезов.
+    ///
+    /// \param keys Ключи для поиска.
+    /// \param out Указатели на найденные значения или nullptr.
+    template <class T, class S, class H, class A, class K>
+    [[maybe_unused]]
+    void OrderedHashTable<T, S, H, A, K>::get_batch(
+            std::span<const KeyArgument> keys, std::span<T*> out) {
+        this->get_batch_items(keys, out);
+    }
+
+    /// \brief Строит хеш-таблицу из большого набора пар несколькими
+    /// потоками.
+    ///
+    /// Результат совпадает с последовательной вставкой пар по порядку:
+    /// ключ занимает место первого вхождения, а значение берется из
+    /// последнего. Ключи хешируются параллельно, затем индексы пар
+    /// раскладываются радикс-разбиением по старшим битам хеша, так что
+    /// одинаковые ключи попадают в один диапазон, и повторы внутри
+    /// диапазонов отбрасываются параллельно. Записи создаются в порядке
+    /// добавления вызывающим потоком (аллокатор не рассчитан на
+    /// одновременную работу), а в хранилище добавляются через insert_all.
+    /// Таблица сразу получает размер под все ключи и не перехешируется.
+    ///
+    /// Пул потоков не сохраняется в таблице; для параллельного расширения
+    /// его нужно задать через set_thread_pool.
+    ///
+    /// \param items Диапазон с произвольным доступом из пар, у которых
+    /// first приводится к KeyArgument, а second - к HashType.
+    /// \param pool Пул потоков.
+    /// \param allocator Аллокатор новой таблицы.
+    ///
+    /// \return Построенную хеш-таблицу.
+    template <class T, class S, class H, class A, class K>
+    template <class Range>
+    [[nodiscard]] [[maybe_unused]]
+    OrderedHashTable<T, S, H, A, K> OrderedHashTable<T, S, H, A, K>::bulk_build(
+            const Range& items, ThreadPool& pool, const A& allocator) {
+        static constexpr size_t NOT_KEPT{ SIZE_MAX };
+        const size_t count{ static_cast<size_t>(std::ranges::size(items)) };
+        const auto first{ std::ranges::begin(items) };
+        auto key_of{ [&first](const size_t& item) -> KeyArgument {
+            return first[item].first;
+        } };
+
+        OrderedHashTable table(GrowthPolicy{}, count, allocator);
+
+        const size_t task_count{ pool.size() * TASKS_PER_THREAD };
+        auto chunk_start{ [count, task_count](const size_t& chunk) -> size_t {
+            return count * chunk / task_count;
+        } };
+        std::vector<uint64_t> hashes(count);
+        pool.run(task_count, [&](size_t chunk) {
+            for (size_t item{ chunk_start(chunk) }; item < chunk_start(chunk + 1);
+                    item++)
+                hashes[item] = table.hash_function(key_of(item));
+        });
+
+        // Радикс-разбиение индексов по диапазонам хеша: подсчет, смещения,
+        // раскладка. Внутри диапазона индексы идут по возрастанию.
+        std::vector<size_t> offsets(task_count * task_count);
+        pool.run(task_count, [&](size_t chunk) {
+            size_t* counts{ offsets.data() + chunk * task_count };
+            for (size_t item{ chunk_start(chunk) }; item < chunk_start(chunk + 1);
+                    item++)
+                counts[bucket_index(hashes[item], task_count)]++;
+        });
+        std::vector<size_t> part_begin(task_count + 1);
+        size_t total{};
+        for (size_t part{}; part < task_count; part++) {
+            part_begin[part] = total;
+            for (size_t chunk{}; chunk < task_count; chunk++)
+                total += std::exchange(offsets[chunk * task_count + part], total);
+        }
+        part_begin[task_count] = total;
+
+        std::vector<size_t> order(count);
+        pool.run(task_count, [&](size_t chunk) {
+            size_t* positions{ offsets.data() + chunk * task_count };
+            for (size_t item{ chunk_start(chunk) }; item < chunk_start(chunk + 1);
+                    item++)
+                order[positions[bucket_index(hashes[item], task_count)]++] = item;
+        });
+
+        // source[i] - индекс пары, чье значение получит ключ первого
+        // вхождения i, или NOT_KEPT для повторов.
+        std::vector<size_t> source(count, NOT_KEPT);
+        pool.run(task_count, [&](size_t part) {
+            auto begin{ order.begin() + part_begin[part] };
+            auto end{ order.begin() + part_begin[part + 1] };
+            std::stable_sort(begin, end, [&](const size_t& lhs, const size_t& rhs) {
+                if (hashes[lhs] != hashes[rhs])
+                    return hashes[lhs] < hashes[rhs];
+                return key_of(lhs) < key_of(rhs);
+            });
+            for (auto same{ begin }; same != end;) {
+                auto same_end{ same + 1 };
+                while (same_end != end && hashes[*same_end] == hashes[*same] &&
+                       key_of(*same_end) == key_of(*same))
+                    same_end++;
+                source[*same] = *(same_end - 1);
+                same = same_end;
+            }
+        });
+
+        // Массив порядка добавления сразу служит списком записей для
+        // параллельной вставки в хранилище.
+        table.order_.reserve(count);
+        for (size_t item{}; item < count; item++) {
+            if (source[item] == NOT_KEPT)
+                continue;
+            table.link_back(table.create_record(key_of(item), hashes[item],
+                                                first[source[item]].second));
+        }
+        table.storage_->insert_all(table.order_, pool);
+        return table;
+    }
+
+    /// \brief Позволяет выбрать способ перехеширования при расширении.
+    ///
+    /// \param mode Способ перехеширования.
+    template <class T, class S, class H, class A, class K>
+    [[maybe_unused]]
+    inline void OrderedHashTable<T, S, H, A, K>::set_rehash_mode(RehashMode mode)
+    noexcept {
+        this->rehash_mode_ = mode;
+    }
+
+    /// \brief Позволяет задать пул потоков для перехеширования.
+    ///
+    /// Пока пул задан, расширение в режиме RehashMode::BLOCKING и
+    /// reserve переносят записи несколькими потоками. Пул должен жить,
+    /// пока он задан таблице; копии таблицы получают тот же пул.
+    ///
+    /// \param pool Пул потоков или nullptr для переноса в одном потоке.
+    template <class T, class S, class H, class A, class K>
+    [[maybe_unused]]
+    inline void OrderedHashTable<T, S, H, A, K>::set_thread_pool(ThreadPool* pool)
+    noexcept {
+        this->thread_pool_ = pool;
+    }
+
+    /// \brief Предоставляет доступ к прогрессу постепенного перехеширования.
+    ///
+    /// \return Долю перенесенных ячеек старого хранилища в пределах [0, 1].
+    /// Если перенос не идет, возвращается 1.
+    template <class T, class S, class H, class A, class K>
+    [[nodiscard]] [[maybe_unused]]
+    inline double OrderedHashTable<T, S, H, A, K>::rehash_progress() const noexcept {
+        if (this->old_storage_ == nullptr)
+            return 1.0;
+        return static_cast<double>(this->migrate_cursor_) /
+               static_cast<double>(this->old_storage_->capacity());
+    }
+
+#ifdef ORDERHASHTABLE_STATS
+    /// \brief Собирает статистику работы хеш-таблицы.
+    ///
+    /// Гистограмма длин цепочек и объем памяти вычисляются обходом
+    /// хранилищ (и записей, если ключи строковые) за O(n), остальное
+    /// берется из счетчиков. Память упорядоченного индекса не учитывается.
+    ///
+    /// \return Снимок статистики.
+    template <class T, class S, class H, class A, class K>
+    [[nodiscard]] [[maybe_unused]]
+    HashTableStats OrderedHashTable<T, S, H, A, K>::stats() const noexcept {
+        HashTableStats stats{};
+        this->stats_.fill(stats);
+        stats.load_factor_ = this->record_count_ / static_cast<double>(this->size_);
+        stats.max_load_factor_ = this->growth_policy_.max_load_factor_;
+
+        stats.memory_bytes_ = sizeof(OrderedHashTable) +
+                              this->record_count_ * sizeof(Record) +
+                              this->order_.capacity() * sizeof(Record*);
+        for (const Storage* storage : { this->storage_, this->old_storage_ }) {
+            if (storage == nullptr)
+                continue;
+            storage->probe_histogram(stats.chain_lengths_);
+            stats.memory_bytes_ += sizeof(Storage) + storage->memory_usage();
+        }
+        if constexpr (IS_COMPACT_KEY) {
+            // Арена может быть общей с другими таблицами и учитывается
+            // в каждой из них целиком.
+            if (this->key_arena_ != nullptr)
+                stats.memory_bytes_ += this->key_arena_->memory_usage();
+        }
+        else if constexpr (IS_STRING_KEY) {
+            // Короткие строки хранятся внутри объекта и отдельной памяти
+            // не занимают.
+            const size_t inline_capacity{ std::string().capacity() };
+            for (const Record* record : this->order_) {
+                if (record != nullptr && record->key_.capacity() > inline_capacity)
+                    stats.memory_bytes_ += record->key_.capacity() + 1;
+            }
+        }
+        return stats;
+    }
+#endif
+
+    /// \brief Включает упорядоченный индекс ключей.
+    ///
+    /// Индекс строится по всем имеющимся записям за O(n log n) и далее
+    /// поддерживается каждой вставкой и удалением за O(log n). Повторный
+    /// вызов ничего не делает.
+    template <class T, class S, class H, class A, class K>
+    [[maybe_unused]]
+    void OrderedHashTable<T, S, H, A, K>::enable_sorted_index()
+    requires std::totally_ordered<K> {
+        if (this->sorted_index_ != nullptr)
+            return;
+        auto* index{ new Index(this->allocator_) };
+        try {
+            for (Record* record : this->order_) {
+                if (record != nullptr)
+                    index->insert(record);
+            }
+        }
+        catch (...) {
+            delete index;
+            throw;
+        }
+        this->sorted_index_ = index;
+    }
+
+    /// \brief Позволяет перебрать элементы с ключами из [low, high) в
+    /// порядке возрастания ключей.
+    ///
+    /// Если упорядоченный индекс еще не включен, он строится при первом
+    /// вызове (см. enable_sorted_index).
+    ///
+    /// \param low Нижняя граница ключей (включительно).
+    /// \param high Верхняя граница ключей (не включительно).
+    ///
+    /// \return Диапазон пар "ключ - значение".
+    template <class T, class S, class H, class A, class K>
+    [[nodiscard]] [[maybe_unused]]
+    OrderedHashTable<T, S, H, A, K>::SortedRange
+    OrderedHashTable<T, S, H, A, K>::range(KeyArgument low, KeyArgument high)
+    requires std::totally_ordered<K> {
+        this->enable_sorted_index();
+        return SortedRange(this->sorted_index_->range(low, high));
+    }
+
+    /// \brief Позволяет перебрать элементы, ключи которых начинаются с
+    /// префикса, в порядке возрастания ключей.
+    ///
+    /// Если упорядоченный индекс еще не включен, он строится при первом
+    /// вызове (см. enable_sorted_index).
+    ///
+    /// \param prefix Префикс ключей.
+    ///
+    /// \return Диапазон пар "ключ - значение".
+    template <class T, class S, class H, class A, class K>
+    [[nodiscard]] [[maybe_unused]]
+    OrderedHashTable<T, S, H, A, K>::SortedRange
+    OrderedHashTable<T, S, H, A, K>::prefix(std::string_view prefix)
+    requires (std::is_same_v<K, std::string> || std::is_same_v<K, CompactKey>) {
+        this->enable_sorted_index();
+        return SortedRange(this->sorted_index_->prefix(prefix));
     }
 }
 
@@ -0,0 +1,915 @@
+/// \file persistenthashtable.hpp.
+/// \author Лошкарев Дмитрий.
+/// \date 14.10.2026.
+///
+/// \brief Содержит упорядоченную хеш-таблицу со структурным разделением
+/// памяти: снимок таблицы берется за O(1) и не меняется, пока таблица
+/// продолжает изменяться.
+///
+/// \namespaces
+/// • DataStructures
+/// \classes
+/// • PersistentOrderedHashTable
+
+#ifndef CPPPROJECT_PERSISTENTHASHTABLE_H
+#define CPPPROJECT_PERSISTENTHASHTABLE_H
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "hasher.hpp"
+
+namespace DataStructures {
+// Объявление классов.
+
+    /// \class Класс PersistentOrderedHashTable предоставляет упорядоченную
+    /// хеш-таблицу, изменения которой не трогают уже опубликованные узлы.
+    ///
+    /// Ключи хранятся в префиксном дереве по хешу (HAMT): каждый уровень
+    /// разбирает 5 бит хеша, узел хранит битовые карты занятых позиций и
+    /// плотные массивы записей и поддеревьев. Порядок добавления хранит
+    /// второе дерево - 32-ичное дерево позиций, позиция записи выдается при
+    /// ее добавлении. Вставка и удаление копируют только путь от корня до
+    /// измененного узла в обоих деревьях (O(log32 n) узлов), остальные узлы
+    /// разделяются со старой версией через std::shared_ptr.
+    ///
+    /// Поэтому snapshot() копирует два указателя и работает за O(1), а
+    /// копия таблицы (например, значение вложенной таблицы) не копирует
+    /// записей. Снимок видит таблицу на момент своего создания и читается
+    /// из любого потока без блокировок; память версии освобождается, когда
+    /// исчезает последний ссылающийся на нее снимок.
+    ///
+    /// Изменять таблицу должен один поток (или несколько под внешней
+    /// блокировкой); snapshot() можно вызывать из любых потоков
+    /// одновременно с изменениями. Значения записей не изменяются на месте:
+    /// insert заменяет запись целиком. Удаление оставляет в дереве порядка
+    /// пустую позицию; когда пустых позиций становится больше, чем
+    /// записей, деревья перестраиваются (амортизированно O(1) на удаление).
+    ///
+    /// Публичные методы:
+    /// \n • void insert(std::string_view key, const HashType& value);
+    /// \n • void insert(std::string_view key, HashType&& value);
+    /// \n • bool erase(std::string_view key);
+    /// \n • const HashType& get(std::string_view key) const;
+    /// \n • bool contains(std::string_view key) const noexcept;
+    /// \n • size_t length() const noexcept;
+    /// \n • Snapshot snapshot() const.
+    ///
+    /// \tparam HashType Тип значений хеш-таблицы.
+    /// \tparam Hasher Функция хеширования ключей.
+    template <class HashType, class Hasher = WyHasher>
+    class PersistentOrderedHashTable {
+        private:
+            // Статические константы класса.
+            static inline constexpr uint32_t BITS{ 5 };              ///< \brief Бит хеша на уровень дерева.
+            static inline constexpr uint32_t WIDTH{ 1U << BITS };    ///< \brief Ветвление деревьев.
+            static inline constexpr uint32_t HASH_BITS{ 64 };        ///< \brief Бит в хеше; глубже узлы
+                                                                     ///< хранят полные коллизии.
+
+            /// \class Структура Entry описывает неизменяемую пару
+            /// "ключ - значение".
+            struct Entry {
+                const std::string key_;
+                const HashType value_;
+                const uint64_t hash_;  ///< \brief Полный хеш ключа.
+
+                template <class Value>
+                explicit Entry(std::string_view, Value&&, const uint64_t&);
+            };
+            using EntryPtr = std::shared_ptr<const Entry>;
+
+            /// \class Структура Slot описывает запись в узле HAMT вместе с
+            /// ее позицией в порядке добавления.
+            struct Slot {
+                EntryPtr entry_;
+                uint64_t position_;
+            };
+
+            struct Node;
+            using NodePtr = std::shared_ptr<const Node>;
+
+            /// \class Структура Node описывает узел HAMT. Ниже HASH_BITS
+            /// бит хеша узел становится корзиной коллизий: битовые карты
+            /// пусты, ключи ищутся перебором slots_.
+            struct Node {
+                uint32_t entry_map_{};            ///< \brief Позиции, занятые записями.
+                uint32_t child_map_{};            ///< \brief Позиции, занятые поддеревьями.
+                std::vector<Slot> slots_;         ///< \brief Записи по возрастанию позиций.
+                std::vector<NodePtr> children_;   ///< \brief Поддеревья по возрастанию позиций.
+            };
+
+            struct Order;
+            using OrderPtr = std::shared_ptr<const Order>;
+
+            /// \class Структура Order описывает узел дерева порядка
+            /// добавления: лист хранит записи по позициям (nullptr на
+            /// месте удаленных), внутренний узел - поддеревья.
+            struct Order {
+                std::vector<EntryPtr> entries_;
+                std::vector<OrderPtr> children_;
+            };
+
+            /// \class Структура State описывает одну версию таблицы.
+            struct State {
+                NodePtr root_;         ///< \brief Корень HAMT.
+                OrderPtr order_;       ///< \brief Корень дерева порядка.
+                uint32_t height_{};    ///< \brief Уровней дерева порядка над листьями.
+                uint64_t end_{};       ///< \brief Выданных позиций.
+                size_t count_{};       ///< \brief Количество записей.
+            };
+        public:
+            /// \class Класс Snapshot предоставляет неизменяемую версию
+            /// хеш-таблицы.
+            ///
+            /// Снимок владеет своей версией и не зависит от таблицы: его
+            /// можно читать из любого потока и после уничтожения таблицы.
+            ///
+            /// Публичные методы:
+            /// \n • const HashType* find(std::string_view key) const noexcept;
+            /// \n • const HashType& get(std::string_view key) const;
+            /// \n • bool contains(std::string_view key) const noexcept;
+            /// \n • size_t length() const noexcept;
+            /// \n • Iterator begin() const noexcept;
+            /// \n • Iterator end() const noexcept.
+            class Snapshot {
+                private:
+                    State state_;
+                    Hasher hasher_;
+
+                    explicit Snapshot(const State&, const Hasher&) noexcept;
+
+                    friend class PersistentOrderedHashTable;
+                public:
+                    /// \class Класс Iterator предоставляет объект-итератор
+                    /// по парам "ключ - значение" снимка в порядке
+                    /// добавления.
+                    ///
+                    /// Публичные методы:
+                    /// \n • Iterator& operator ++ () noexcept
+                    /// \n • Iterator operator ++ (int) noexcept
+                    /// \n • bool operator != (const Iterator& iterator) const noexcept
+                    /// \n • std::pair<const std::string&, const HashType&>
+                    /// operator * () const noexcept
+                    class Iterator {
+                        private:
+                            const State* state_;
+                            uint64_t position_;
+                            const Order* leaf_;  ///< \brief Лист текущей позиции.
+
+                            void skip() noexcept;
+                        public:
+                            explicit Iterator(const State*, const uint64_t&) noexcept;
+
+                            Iterator& operator ++ () noexcept;
+                            Iterator operator ++ (int) noexcept;
+                            bool operator != (const Iterator&) const noexcept;
+                            std::pair<const std::string&, const HashType&>
+                            operator * () const noexcept;
+                    };
+
+                    [[nodiscard]] [[maybe_unused]]
+                    const HashType* find(std::string_view key) const noexcept;
+                    [[nodiscard]] [[maybe_unused]]
+                    const HashType& get(std::string_view key) const;
+                    [[nodiscard]] [[maybe_unused]]
+                    bool contains(std::string_view key) const noexcept;
+                    [[nodiscard]] [[maybe_unused]]
+                    inline size_t length() const noexcept;
+                    [[nodiscard]]
+                    inline Iterator begin() const noexcept;
+                    [[nodiscard]]
+                    inline Iterator end() const noexcept;
+            };
+        private:
+            mutable std::mutex mutex_;  ///< \brief Защищает state_ при публикации
+                                        ///< и взятии снимка.
+            State state_;
+            Hasher hasher_;
+
+            [[nodiscard]]
+            static inline uint32_t bit_of(const uint64_t&, const uint32_t&) noexcept;
+            [[nodiscard]]
+            static inline uint32_t index_of(const uint32_t&, const uint32_t&) noexcept;
+            [[nodiscard]]
+            static const Slot* lookup(const Node*, std::string_view,
+                                      const uint64_t&) noexcept;
+            [[nodiscard]]
+            static NodePtr assoc(const Node*, const uint32_t&, const Slot&);
+            [[nodiscard]]
+            static NodePtr pair_node(const Slot&, const Slot&, const uint32_t&);
+            [[nodiscard]]
+            static NodePtr dissoc(const NodePtr&, const uint32_t&, std::string_view,
+                                  const uint64_t&);
+            [[nodiscard]]
+            static OrderPtr assign(const Order*, const uint32_t&, const uint64_t&,
+                                   const EntryPtr&);
+            [[nodiscard]]
+            static const Order* leaf_at(const State&, const uint64_t&) noexcept;
+            static void append(State&, const EntryPtr&);
+            static void compact(State&);
+            template <class Value>
+            void assign_value(std::string_view, Value&&);
+            void publish(State&) noexcept;
+        public:
+            PersistentOrderedHashTable() = default;
+            PersistentOrderedHashTable(const PersistentOrderedHashTable&);
+            PersistentOrderedHashTable(PersistentOrderedHashTable&&) noexcept;
+            PersistentOrderedHashTable& operator = (const PersistentOrderedHashTable&);
+            PersistentOrderedHashTable& operator = (PersistentOrderedHashTable&&) noexcept;
+
+            [[maybe_unused]]
+            void insert(std::string_view key, const HashType& value);
+            [[maybe_unused]]
+            void insert(std::string_view key, HashType&& value);
+            [[maybe_unused]]
+            bool erase(std::string_view key);
+
+            [[nodiscard]] [[maybe_unused]]
+            const HashType& get(std::string_view key) const;
+            [[nodiscard]] [[maybe_unused]]
+            bool contains(std::string_view key) const noexcept;
+            [[nodiscard]] [[maybe_unused]]
+            inline size_t length() const noexcept;
+            [[nodiscard]] [[maybe_unused]]
+            Snapshot snapshot() const;
+    };
+
+// Определения методов классов.
+/* ================================= Entry ================================= */
+
+    /// \brief Стандартный конструктор экземпляра класса
+    /// PersistentOrderedHashTable::Entry.
+    ///
+    /// \param key Строковый ключ записи.
+    /// \param value Значение записи.
+    /// \param hash Полный хеш ключа.
+    template <class T, class H>
+    template <class Value>
+    PersistentOrderedHashTable<T, H>::Entry::Entry(std::string_view key, Value&& value,
+                                                   const uint64_t& hash) :
+            key_(key), value_(std::forward<Value>(value)), hash_(hash) { }
+
+/* =========================== Snapshot::Iterator =========================== */
+// PRIVATE
+
+    /// \brief Пропускает пустые позиции удаленных записей.
+    template <class T, class H>
+    void PersistentOrderedHashTable<T, H>::Snapshot::Iterator::skip() noexcept {
+        for (; this->position_ < this->state_->end_; this->position_++) {
+            const size_t at{ this->position_ % WIDTH };
+            if (at == 0 || this->leaf_ == nullptr)
+                this->leaf_ = leaf_at(*this->state_, this->position_);
+            if (this->leaf_ != nullptr && at < this->leaf_->entries_.size() &&
+                this->leaf_->entries_[at] != nullptr)
+                return;
+        }
+    }
+
+// PUBLIC
+
+    /// \brief Стандартный конструктор экземпляра класса
+    /// PersistentOrderedHashTable::Snapshot::Iterator.
+    ///
+    /// \param state Версия таблицы.
+    /// \param position Позиция, с которой начинается перебор.
+    template <class T, class H>
+    PersistentOrderedHashTable<T, H>::Snapshot::Iterator::Iterator(
+            const State* state, const uint64_t& position) noexcept :
+            state_(state), position_(position), leaf_(nullptr) {
+        this->skip();
+    }
+
+    /// \brief Перемещает итератор на след. запись.
+    ///
+    /// \return Объект-итератор.
+    template <class T, class H>
+    PersistentOrderedHashTable<T, H>::Snapshot::Iterator&
+    PersistentOrderedHashTable<T, H>::Snapshot::Iterator::operator ++ () noexcept {
+        this->position_++;
+        this->skip();
+        return *this;
+    }
+
+    /// \brief Перемещает итератор на след. запись.
+    ///
+    /// \return Объект-итератор.
+    template <class T, class H>
+    PersistentOrderedHashTable<T, H>::Snapshot::Iterator
+    PersistentOrderedHashTable<T, H>::Snapshot::Iterator::operator ++ (int) noexcept {
+        Iterator iterator = *this;
+        ++*this;
+        return iterator;
+    }
+
+    /// \brief Проверяет, что два объекта итератора не равны.
+    ///
+    /// \param iterator Объект-итератор для сравнения.
+    ///
+    /// \return Булевое значение.
+    template <class T, class H>
+    bool PersistentOrderedHashTable<T, H>::Snapshot::Iterator::operator != (
+            const Iterator& iterator) const noexcept {
+        return this->position_ != iterator.position_;
+    }
+
+    /// \brief Позволяет получить пару, на которую указывает итератор.
+    ///
+    /// \return Пару из ссылок на ключ и значение записи.
+    template <class T, class H>
+    std::pair<const std::string&, const T&>
+    PersistentOrderedHashTable<T, H>::Snapshot::Iterator::operator * () const noexcept {
+        const Entry& entry{ *this->leaf_->entries_[this->position_ % WIDTH] };
+        return { entry.key_, entry.value_ };
+    }
+
+/* ================================ Snapshot ================================ */
+// PRIVATE
+
+    /// \brief Стандартный конструктор экземпляра класса
+    /// PersistentOrderedHashTable::Snapshot.
+    ///
+    /// \param state Версия таблицы.
+    /// \param hasher Функция хеширования таблицы.
+    template <class T, class H>
+    PersistentOrderedHashTable<T, H>::Snapshot::Snapshot(const State& state,
+                                                         const H& hasher) noexcept :
+            state_(state), hasher_(hasher) { }
+
+// PUBLIC
+
+    /// \brief Ищет значение по ключу.
+    ///
+    /// \param key Строковый ключ.
+    ///
+    /// \return Указатель на значение или nullptr, если ключа нет.
+    template <class T, class H>
+    [[nodiscard]] [[maybe_unused]]
+    const T* PersistentOrderedHashTable<T, H>::Snapshot::find(std::string_view key)
+    const noexcept {
+        const Slot* slot{ lookup(this->state_.root_.get(), key, this->hasher_(key)) };
+        return (slot != nullptr) ? &slot->entry_->value_ : nullptr;
+    }
+
+    /// \brief Метод, позволяющий получить значение элемента по ключу.
+    ///
+    /// В случае ненахождения элемента будет возвращено стандартное значение.
+    /// Ссылка действительна, пока жив снимок.
+    ///
+    /// \param key Строковый ключ.
+    ///
+    /// \return Ссылку на найденное значение ключа или на стандартное
+    /// значение.
+    template <class T, class H>
+    [[nodiscard]] [[maybe_unused]]
+    const T& PersistentOrderedHashTable<T, H>::Snapshot::get(std::string_view key) const {
+        static const T DEFAULT_VALUE{};
+        const T* value{ this->find(key) };
+        return (value != nullptr) ? *value : DEFAULT_VALUE;
+    }
+
+    /// \brief Проверяет наличие ключа в снимке.
+    ///
+    /// \param key Строковый ключ.
+    ///
+    /// \return true, если ключ есть.
+    template <class T, class H>
+    [[nodiscard]] [[maybe_unused]]
+    bool PersistentOrderedHashTable<T, H>::Snapshot::contains(std::string_view key)
+    const noexcept {
+        return this->find(key) != nullptr;
+    }
+
+    /// \brief Позволяет получить количество записей снимка.
+    ///
+    /// \return Значение кол-ва записей.
+    template <class T, class H>
+    [[nodiscard]] [[maybe_unused]]
+    inline size_t PersistentOrderedHashTable<T, H>::Snapshot::length() const noexcept {
+        return this->state_.count_;
+    }
+
+    /// \brief Создает итератор от первой добавленной записи.
+    ///
+    /// \return Объект-итератор.
+    template <class T, class H>
+    [[nodiscard]]
+    inline PersistentOrderedHashTable<T, H>::Snapshot::Iterator
+    PersistentOrderedHashTable<T, H>::Snapshot::begin() const noexcept {
+        return Iterator(&this->state_, 0);
+    }
+
+    /// \brief Создает итератор на конец записей.
+    ///
+    /// \return Объект-итератор.
+    template <class T, class H>
+    [[nodiscard]]
+    inline PersistentOrderedHashTable<T, H>::Snapshot::Iterator
+    PersistentOrderedHashTable<T, H>::Snapshot::end() const noexcept {
+        return Iterator(&this->state_, this->state_.end_);
+    }
+
+/* ======================= PersistentOrderedHashTable ======================= */
+// PRIVATE
+
+    /// \brief Вычисляет бит позиции ключа в узле HAMT.
+    ///
+    /// \param hash Полный хеш ключа.
+    /// \param shift Смещение уровня узла в битах хеша.
+    ///
+    /// \return Битовую маску позиции.
+    template <class T, class H>
+    [[nodiscard]]
+    inline uint32_t PersistentOrderedHashTable<T, H>::bit_of(const uint64_t& hash,
+                                                             const uint32_t& shift) noexcept {
+        return 1U << ((hash >> shift) & (WIDTH - 1));
+    }
+
+    /// \brief Вычисляет индекс в плотном массиве узла по битовой карте.
+    ///
+    /// \param map Битовая карта узла.
+    /// \param bit Бит позиции.
+    ///
+    /// \return Количество занятых позиций перед bit.
+    template <class T, class H>
+    [[nodiscard]]
+    inline uint32_t PersistentOrderedHashTable<T, H>::index_of(const uint32_t& map,
+                                                               const uint32_t& bit) noexcept {
+        return static_cast<uint32_t>(std::popcount(map & (bit - 1)));
+    }
+
+    /// \brief Ищет запись по ключу в HAMT.
+    ///
+    /// \param node Корень дерева.
+    /// \param key Строковый ключ.
+    /// \param hash Хеш ключа.
+    ///
+    /// \return Указатель на запись узла или nullptr, если ключа нет.
+    template <class T, class H>
+    [[nodiscard]]
+    const PersistentOrderedHashTable<T, H>::Slot* PersistentOrderedHashTable<T, H>::lookup(
+            const Node* node, std::string_view key, const uint64_t& hash) noexcept {
+        for (uint32_t shift{}; node != nullptr; shift += BITS) {
+            if (shift >= HASH_BITS) {
+                for (const Slot& slot : node->slots_) {
+                    if (slot.entry_->key_ == key)
+                        return &slot;
+                }
+                return nullptr;
+            }
+            const uint32_t bit{ bit_of(hash, shift) };
+            if ((node->entry_map_ & bit) != 0) {
+                const Slot& slot{ node->slots_[index_of(node->entry_map_, bit)] };
+                return (slot.entry_->hash_ == hash && slot.entry_->key_ == key) ?
+                       &slot : nullptr;
+            }
+            if ((node->child_map_ & bit) == 0)
+                return nullptr;
+            node = node->children_[index_of(node->child_map_, bit)].get();
+        }
+        return nullptr;
+    }
+
+    /// \brief Строит копию пути HAMT с добавленной или замененной записью.
+    ///
+    /// \param node Узел или nullptr, если поддерева еще нет.
+    /// \param shift Смещение уровня узла в битах хеша.
+    /// \param slot Запись; запись с тем же ключом заменяется.
+    ///
+    /// \return Новый узел.
+    template <class T, class H>
+    [[nodiscard]]
+    PersistentOrderedHashTable<T, H>::NodePtr PersistentOrderedHashTable<T, H>::assoc(
+            const Node* node, const uint32_t& shift, const Slot& slot) {
+        const uint64_t hash{ slot.entry_->hash_ };
+        auto result{ (node != nullptr) ? std::make_shared<Node>(*node) :
+                                         std::make_shared<Node>() };
+        if (shift >= HASH_BITS) {
+            for (Slot& existing : result->slots_) {
+                if (existing.entry_->key_ == slot.entry_->key_) {
+                    existing = slot;
+                    return result;
+                }
+            }
+            result->slots_.push_back(slot);
+            return result;
+        }
+
+        const uint32_t bit{ bit_of(hash, shift) };
+        if ((result->entry_map_ & bit) != 0) {
+            const uint32_t at{ index_of(result->entry_map_, bit) };
+            const Slot existing{ result->slots_[at] };
+            if (existing.entry_->hash_ == hash &&
+                existing.entry_->key_ == slot.entry_->key_) {
+                result->slots_[at] = slot;
+                return result;
+            }
+            // Позицию занимает другой ключ: обе записи уходят в поддерево.
+            result->entry_map_ &= ~bit;
+            result->slots_.erase(result->slots_.begin() + at);
+            result->child_map_ |= bit;
+            result->children_.insert(
+                    result->children_.begin() + index_of(result->child_map_, bit),
+                    pair_node(existing, slot, shift + BITS));
+        }
+        else if ((result->child_map_ & bit) != 0) {
+            const uint32_t at{ index_of(result->child_map_, bit) };
+            result->children_[at] = assoc(result->children_[at].get(), shift + BITS, slot);
+        }
+        else {
+            result->entry_map_ |= bit;
+            result->slots_.insert(result->slots_.begin() + index_of(result->entry_map_, bit),
+                                  slot);
+        }
+        return result;
+    }
+
+    /// \brief Строит поддерево из двух записей с разными ключами.
+    ///
+    /// \param first Первая запись.
+    /// \param second Вторая запись.
+    /// \param shift Смещение уровня поддерева в битах хеша.
+    ///
+    /// \return Корень поддерева.
+    template <class T, class H>
+    [[nodiscard]]
+    PersistentOrderedHashTable<T, H>::NodePtr PersistentOrderedHashTable<T, H>::pair_node(
+            const Slot& first, const Slot& second, const uint32_t& shift) {
+        auto result{ std::make_shared<Node>() };
+        if (shift >= HASH_BITS) {
+            result->slots_ = { first, second };
+            return result;
+        }
+        const uint32_t first_bit{ bit_of(first.entry_->hash_, shift) };
+        const uint32_t second_bit{ bit_of(second.entry_->hash_, shift) };
+        if (first_bit == second_bit) {
+            result->child_map_ = first_bit;
+            result->children_.push_back(pair_node(first, second, shift + BITS));
+        }
+        else {
+            result->entry_map_ = first_bit | second_bit;
+            if (first_bit < second_bit)
+                result->slots_ = { first, second };
+            else
+                result->slots_ = { second, first };
+        }
+        return result;
+    }
+
+    /// \brief Строит копию пути HAMT без записи с указанным ключом.
+    ///
+    /// Ключ должен быть в дереве. Поддерево, в котором осталась одна
+    /// запись, заменяется этой записью в родителе, поэтому форма дерева
+    /// зависит только от набора ключей.
+    ///
+    /// \param node Узел.
+    /// \param shift Смещение уровня узла в битах хеша.
+    /// \param key Строковый ключ.
+    /// \param hash Хеш ключа.
+    ///
+    /// \return Новый узел или nullptr, если узел опустел.
+    template <class T, class H>
+    [[nodiscard]]
+    PersistentOrderedHashTable<T, H>::NodePtr PersistentOrderedHashTable<T, H>::dissoc(
+            const NodePtr& node, const uint32_t& shift, std::string_view key,
+            const uint64_t& hash) {
+        if (shift >= HASH_BITS) {
+            if (node->slots_.size() == 1)
+                return nullptr;
+            auto result{ std::make_shared<Node>(*node) };
+            std::erase_if(result->slots_, [&key](const Slot& slot) {
+                return slot.entry_->key_ == key;
+            });
+            return result;
+        }
+
+        const uint32_t bit{ bit_of(hash, shift) };
+        if ((node->entry_map_ & bit) != 0) {
+            if (node->slots_.size() == 1 && node->children_.empty())
+                return nullptr;
+            auto result{ std::make_shared<Node>(*node) };
+            result->slots_.erase(result->slots_.begin() +
+                                 index_of(result->entry_map_, bit));
+            result->entry_map_ &= ~bit;
+            return result;
+        }
+
+        const uint32_t at{ index_of(node->child_map_, bit) };
+        const NodePtr child{ dissoc(node->children_[at], shift + BITS, key, hash) };
+        if (child == nullptr && node->slots_.empty() && node->children_.size() == 1)
+            return nullptr;
+        auto result{ std::make_shared<Node>(*node) };
+        if (child != nullptr && (!child->children_.empty() || child->slots_.size() > 1)) {
+            result->children_[at] = child;
+            return result;
+        }
+        result->child_map_ &= ~bit;
+        result->children_.erase(result->children_.begin() + at);
+        if (child != nullptr) {
+            result->entry_map_ |= bit;
+            result->slots_.insert(result->slots_.begin() + index_of(result->entry_map_, bit),
+                                  child->slots_.front());
+        }
+        return result;
+    }
+
+    /// \brief Строит копию пути дерева порядка с записью на позиции.
+    ///
+    /// \param node Узел или nullptr, если поддерева еще нет.
+    /// \param level Уровень узла над листьями.
+    /// \param position Позиция записи.
+    /// \param entry Запись или nullptr для удаленной позиции.
+    ///
+    /// \return Новый узел.
+    template <class T, class H>
+    [[nodiscard]]
+    PersistentOrderedHashTable<T, H>::OrderPtr PersistentOrderedHashTable<T, H>::assign(
+            const Order* node, const uint32_t& level, const uint64_t& position,
+            const EntryPtr& entry) {
+        auto result{ (node != nullptr) ? std::make_shared<Order>(*node) :
+                                         std::make_shared<Order>() };
+        const size_t at{ (position >> (BITS * level)) & (WIDTH - 1) };
+        if (level == 0) {
+            if (at >= result->entries_.size())
+                result->entries_.resize(at + 1);
+            result->entries_[at] = entry;
+        }
+        else {
+            if (at >= result->children_.size())
+                result->children_.resize(at + 1);
+            result->children_[at] = assign(result->children_[at].get(), level - 1,
+                                           position, entry);
+        }
+        return result;
+    }
+
+    /// \brief Ищет лист дерева порядка, содержащий позицию.
+    ///
+    /// \param state Версия таблицы.
+    /// \param position Позиция.
+    ///
+    /// \return Указатель на лист или nullptr.
+    template <class T, class H>
+    [[nodiscard]]
+    const PersistentOrderedHashTable<T, H>::Order*
+    PersistentOrderedHashTable<T, H>::leaf_at(const State& state,
+                                              const uint64_t& position) noexcept {
+        const Order* node{ state.order_.get() };
+        for (uint32_t level{ state.height_ }; level > 0 && node != nullptr; level--) {
+            const size_t at{ (position >> (BITS * level)) & (WIDTH - 1) };
+            node = (at < node->children_.size()) ? node->children_[at].get() : nullptr;
+        }
+        return node;
+    }
+
+    /// \brief Добавляет новую запись в конец порядка добавления версии.
+    ///
+    /// Ключа еще не должно быть в версии. Когда позиции дерева порядка
+    /// кончаются, над корнем надстраивается новый уровень.
+    ///
+    /// \param state Изменяемая версия таблицы.
+    /// \param entry Запись.
+    template <class T, class H>
+    void PersistentOrderedHashTable<T, H>::append(State& state, const EntryPtr& entry) {
+        const uint64_t position{ state.end_ };
+        const uint32_t capacity_bits{ BITS * (state.height_ + 1) };
+        if (state.order_ != nullptr && capacity_bits < HASH_BITS &&
+            (position >> capacity_bits) != 0) {
+            auto root{ std::make_shared<Order>() };
+            root->children_.push_back(std::move(state.order_));
+            state.order_ = std::move(root);
+            state.height_++;
+        }
+        state.order_ = assign(state.order_.get(), state.height_, position, entry);
+        state.root_ = assoc(state.root_.get(), 0, Slot{ entry, position });
+        state.end_++;
+        state.count_++;
+    }
+
+    /// \brief Перестраивает версию без пустых позиций удаленных записей.
+    ///
+    /// Записи не копируются: новые деревья ссылаются на те же Entry.
+    ///
+    /// \param state Изменяемая версия таблицы.
+    template <class T, class H>
+    void PersistentOrderedHashTable<T, H>::compact(State& state) {
+        State result;
+        const Order* leaf{ nullptr };
+        for (uint64_t position{}; position < state.end_; position++) {
+            const size_t at{ position % WIDTH };
+            if (at == 0 || leaf == nullptr)
+                leaf = leaf_at(state, position);
+            if (leaf != nullptr && at < leaf->entries_.size() &&
+                leaf->entries_[at] != nullptr)
+                append(result, leaf->entries_[at]);
+        }
+        state = std::move(result);
+    }
+
+    /// \brief Добавляет запись или заменяет значение существующей.
+    ///
+    /// Замененная запись сохраняет свою позицию в порядке добавления.
+    ///
+    /// \param key Строковый ключ.
+    /// \param value Значение.
+    template <class T, class H>
+    template <class Value>
+    void PersistentOrderedHashTable<T, H>::assign_value(std::string_view key,
+                                                        Value&& value) {
+        State state{ this->state_ };
+        const uint64_t hash{ this->hasher_(key) };
+        auto entry{ std::make_shared<const Entry>(key, std::forward<Value>(value), hash) };
+        const Slot* existing{ lookup(state.root_.get(), key, hash) };
+        if (existing != nullptr) {
+            const uint64_t position{ existing->position_ };
+            state.root_ = assoc(state.root_.get(), 0, Slot{ entry, position });
+            state.order_ = assign(state.order_.get(), state.height_, position, entry);
+        }
+        else
+            append(state, entry);
+        this->publish(state);
+    }
+
+    /// \brief Публикует новую версию таблицы.
+    ///
+    /// Прежняя версия возвращается в state и освобождается вызывающим кодом
+    /// уже без блокировки.
+    ///
+    /// \param state Новая версия; после вызова - прежняя.
+    template <class T, class H>
+    void PersistentOrderedHashTable<T, H>::publish(State& state) noexcept {
+        std::lock_guard lock{ this->mutex_ };
+        std::swap(this->state_, state);
+    }
+
+// PUBLIC
+
+    /// \brief Конструктор копирования экземпляра класса
+    /// PersistentOrderedHashTable.
+    ///
+    /// Копия разделяет с оригиналом все узлы и работает за O(1).
+    ///
+    /// \param other Копируемая хеш-таблица.
+    template <class T, class H>
+    PersistentOrderedHashTable<T, H>::PersistentOrderedHashTable(
+            const PersistentOrderedHashTable& other) :
+            state_(other.snapshot().state_), hasher_(other.hasher_) { }
+
+    /// \brief Конструктор перемещения экземпляра класса
+    /// PersistentOrderedHashTable.
+    ///
+    /// \param other Перемещаемая хеш-таблица, остающаяся пустой.
+    template <class T, class H>
+    PersistentOrderedHashTable<T, H>::PersistentOrderedHashTable(
+            PersistentOrderedHashTable&& other) noexcept : hasher_(other.hasher_) {
+        std::lock_guard lock{ other.mutex_ };
+        this->state_ = std::exchange(other.state_, State{});
+    }
+
+    /// \brief Оператор присваивания копированием.
+    ///
+    /// \param other Копируемая хеш-таблица.
+    ///
+    /// \return Ссылку на текущий экземпляр.
+    template <class T, class H>
+    PersistentOrderedHashTable<T, H>& PersistentOrderedHashTable<T, H>::operator = (
+            const PersistentOrderedHashTable& other) {
+        if (this == &other)
+            return *this;
+        State state{ other.snapshot().state_ };
+        this->hasher_ = other.hasher_;
+        this->publish(state);
+        return *this;
+    }
+
+    /// \brief Оператор присваивания перемещением.
+    ///
+    /// \param other Перемещаемая хеш-таблица, остающаяся пустой.
+    ///
+    /// \return Ссылку на текущий экземпляр.
+    template <class T, class H>
+    PersistentOrderedHashTable<T, H>& PersistentOrderedHashTable<T, H>::operator = (
+            PersistentOrderedHashTable&& other) noexcept {
+        if (this == &other)
+            return *this;
+        State state;
+        {
+            std::lock_guard lock{ other.mutex_ };
+            state = std::exchange(other.state_, State{});
+        }
+        this->hasher_ = other.hasher_;
+        this->publish(state);
+        return *this;
+    }
+
+    /// \brief Метод, добавляющий элемент.
+    ///
+    /// Добавляет в хеш-таблицу новую пару "ключ - значение" или
+    /// заменяет значение по уже существующему ключу. Снимки, взятые
+    /// раньше, продолжают видеть прежнее значение.
+    ///
+    /// \param key Строковый ключ элемента.
+    /// \param value Значение элемента.
+    template <class T, class H>
+    [[maybe_unused]]
+    void PersistentOrderedHashTable<T, H>::insert(std::string_view key, const T& value) {
+        this->assign_value(key, value);
+    }
+
+    /// \brief Метод, добавляющий элемент с перемещением значения.
+    ///
+    /// \param key Строковый ключ элемента.
+    /// \param value Значение элемента.
+    template <class T, class H>
+    [[maybe_unused]]
+    void PersistentOrderedHashTable<T, H>::insert(std::string_view key, T&& value) {
+        this->assign_value(key, std::move(value));
+    }
+
+    /// \brief Метод, удаляющий элемент.
+    ///
+    /// \param key Строковый ключ элемента.
+    ///
+    /// \return true, если ключ был в таблице.
+    template <class T, class H>
+    [[maybe_unused]]
+    bool PersistentOrderedHashTable<T, H>::erase(std::string_view key) {
+        State state{ this->state_ };
+        const uint64_t hash{ this->hasher_(key) };
+        const Slot* existing{ lookup(state.root_.get(), key, hash) };
+        if (existing == nullptr)
+            return false;
+
+        const uint64_t position{ existing->position_ };
+        state.root_ = dissoc(state.root_, 0, key, hash);
+        state.order_ = assign(state.order_.get(), state.height_, position, nullptr);
+        state.count_--;
+        if (state.count_ == 0)
+            state = State{};
+        else if (state.end_ >= WIDTH && state.count_ * 2 < state.end_)
+            compact(state);
+        this->publish(state);
+        return true;
+    }
+
+    /// \brief Метод, позволяющий получить значение элемента по ключу.
+    ///
+    /// В случае ненахождения элемента будет возвращено стандартное значение.
+    /// Метод предназначен для потока, изменяющего таблицу: ссылка
+    /// действительна до следующего изменения. Другим потокам следует
+    /// читать через snapshot().
+    ///
+    /// \param key Строковый ключ.
+    ///
+    /// \return Ссылку на найденное значение ключа или на стандартное
+    /// значение.
+    template <class T, class H>
+    [[nodiscard]] [[maybe_unused]]
+    const T& PersistentOrderedHashTable<T, H>::get(std::string_view key) const {
+        static const T DEFAULT_VALUE{};
+        const Slot* slot{ lookup(this->state_.root_.get(), key, this->hasher_(key)) };
+        return (slot != nullptr) ? slot->entry_->value_ : DEFAULT_VALUE;
+    }
+
+    /// \brief Проверяет наличие ключа в таблице.
+    ///
+    /// \param key Строковый ключ.
+    ///
+    /// \return true, если ключ есть.
+    template <class T, class H>
+    [[nodiscard]] [[maybe_unused]]
+    bool PersistentOrderedHashTable<T, H>::contains(std::string_view key) const noexcept {
+        return lookup(this->state_.root_.get(), key, this->hasher_(key)) != nullptr;
+    }
+
+    /// \brief Позволяет получить количество записей.
+    ///
+    /// \return Значение кол-ва записей.
+    template <class T, class H>
+    [[nodiscard]] [[maybe_unused]]
+    inline size_t PersistentOrderedHashTable<T, H>::length() const noexcept {
+        return this->state_.count_;
+    }
+
+    /// \brief Берет снимок текущей версии таблицы.
+    ///
+    /// Копирует два указателя на корни под кратковременной блокировкой;
+    /// записи и узлы не копируются.
+    ///
+    /// \return Неизменяемый снимок.
+    template <class T, class H>
+    [[nodiscard]] [[maybe_unused]]
+    PersistentOrderedHashTable<T, H>::Snapshot
+    PersistentOrderedHashTable<T, H>::snapshot() const {
+        std::lock_guard lock{ this->mutex_ };
+        return Snapshot(this->state_, this->hasher_);
+    }
+}
+
+#endif
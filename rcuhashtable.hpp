@@ -0,0 +1,842 @@
+/// \file rcuhashtable.hpp.
+/// \author Лошкарев Дмитрий.
+/// \date 14.10.2026.
+///
+/// \brief Содержит упорядоченную хеш-таблицу, оптимизированную для чтения
+/// из многих потоков без блокировок, и механизм отложенного освобождения
+/// памяти по эпохам.
+///
+/// \namespaces
+/// • DataStructures
+/// \classes
+/// • EpochDomain
+/// • RcuOrderedHashTable
+
+#ifndef CPPPROJECT_RCUHASHTABLE_H
+#define CPPPROJECT_RCUHASHTABLE_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "hasher.hpp"
+#include "hashstorage.hpp"
+
+namespace DataStructures {
+// Объявление классов.
+
+    /// \class Класс EpochDomain предоставляет отложенное освобождение
+    /// памяти по эпохам (epoch-based reclamation).
+    ///
+    /// Читатель перед обращением к данным записывает в свою ячейку текущую
+    /// эпоху, а после - сбрасывает ее. Это обычные атомарные записи и
+    /// барьер памяти, без операций чтения-модификации-записи. Писатель
+    /// отправляет исключенные из структуры объекты в список ожидания с
+    /// текущей эпохой и освобождает их, когда все активные читатели
+    /// вошли в более позднюю эпоху. Методы писателя должны вызываться
+    /// под одной внешней блокировкой.
+    ///
+    /// Публичные методы:
+    /// \n • size_t acquire_slot();
+    /// \n • void release_slot(const size_t& slot) noexcept;
+    /// \n • void enter(const size_t& slot) noexcept;
+    /// \n • void leave(const size_t& slot) noexcept;
+    /// \n • void reserve(const size_t& count);
+    /// \n • void retire(T* object);
+    /// \n • void reclaim();
+    /// \n • size_t retired_count() const noexcept.
+    class EpochDomain {
+        public:
+            static inline constexpr size_t MAX_READERS{ 128 };  ///< \brief Максимальное число
+                                                                ///< одновременных читателей.
+        private:
+            static inline constexpr size_t CACHE_LINE_SIZE{ 64 };  ///< \brief Размер кеш-линии.
+            static inline constexpr uint64_t INACTIVE{ 0 };         ///< \brief Эпоха неактивного читателя.
+
+            /// \class Структура Slot описывает ячейку читателя. Ячейки
+            /// выровнены по кеш-линии, чтобы читатели не делили линию.
+            struct alignas(CACHE_LINE_SIZE) Slot {
+                std::atomic<uint64_t> epoch_{ INACTIVE };  ///< \brief Эпоха входа читателя.
+                std::atomic<bool> taken_{ false };         ///< \brief Занята ли ячейка.
+            };
+
+            /// \class Структура Retired описывает объект, ожидающий
+            /// освобождения.
+            struct Retired {
+                void* object_;
+                void (*deleter_)(void*);  ///< \brief Функция освобождения объекта.
+                uint64_t epoch_;          ///< \brief Эпоха исключения объекта.
+            };
+
+            alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> epoch_{ 1 };
+            Slot slots_[MAX_READERS];
+            std::vector<Retired> retired_;
+
+            template <class T>
+            static void destroy(void*) noexcept;
+        public:
+            EpochDomain() = default;
+            EpochDomain(const EpochDomain&) = delete;
+            EpochDomain& operator = (const EpochDomain&) = delete;
+            ~EpochDomain();
+
+            [[nodiscard]]
+            size_t acquire_slot();
+            void release_slot(const size_t&) noexcept;
+            inline void enter(const size_t&) noexcept;
+            inline void leave(const size_t&) noexcept;
+
+            inline void reserve(const size_t&);
+            template <class T>
+            void retire(T*);
+            void reclaim();
+            [[nodiscard]] [[maybe_unused]]
+            inline size_t retired_count() const noexcept;
+    };
+
+    /// \class Класс RcuOrderedHashTable предоставляет упорядоченную
+    /// хеш-таблицу для нагрузки "один загрузчик - много читателей".
+    ///
+    /// Чтение идет через объект Reader без блокировок и без атомарных
+    /// операций чтения-модификации-записи. Опубликованные узлы цепочек и
+    /// записи не изменяются: изменение значения или удаление ключа
+    /// копирует часть цепочки перед измененным узлом и публикует новую
+    /// голову ячейки, а расширение строит новый массив ячеек и публикует
+    /// его одной атомарной записью. Старые узлы, записи и массивы
+    /// освобождаются через EpochDomain, когда их уже не может читать ни
+    /// один поток. Читатели никогда не ждут писателя, в том числе во
+    /// время расширения.
+    ///
+    /// Писатели выполняют insert, erase и reserve под общим мьютексом.
+    /// Порядок добавления хранится в связях между записями, которые
+    /// читают только писатели.
+    ///
+    /// Публичные методы:
+    /// \n • Reader reader();
+    /// \n • void insert(std::string_view key, const HashType& value);
+    /// \n • void insert(std::string_view key, HashType&& value);
+    /// \n • bool erase(std::string_view key);
+    /// \n • void reserve(const size_t& count);
+    /// \n • size_t length() const noexcept;
+    /// \n • std::vector<std::pair<std::string, HashType>> items() const.
+    ///
+    /// \tparam HashType Тип значений хеш-таблицы.
+    /// \tparam Hasher Функция хеширования ключей.
+    template <class HashType, class Hasher = WyHasher>
+    class RcuOrderedHashTable {
+        public:
+            class Reader;
+        private:
+            /// \class Класс Record описывает неизменяемую запись
+            /// хеш-таблицы. Связи порядка добавления изменяются только
+            /// писателями под мьютексом.
+            class Record {
+                private:
+                    const std::string key_;
+                    const HashType value_;
+                    const uint64_t hash_;  ///< \brief Полный хеш ключа.
+                    Record* prev_;         ///< \brief Пред. запись по порядку добавления.
+                    Record* next_;         ///< \brief След. запись по порядку добавления.
+                public:
+                    template <class Value>
+                    explicit Record(std::string_view, Value&&, const uint64_t&);
+
+                friend class RcuOrderedHashTable;
+                friend class Reader;
+            };
+
+            /// \class Структура Node описывает неизменяемый узел цепочки
+            /// ячейки.
+            struct Node {
+                const Record* record_;
+                const Node* next_;
+            };
+
+            /// \class Структура Buckets описывает опубликованный массив ячеек.
+            struct Buckets {
+                const size_t size_;
+                std::atomic<const Node*>* heads_;
+
+                explicit Buckets(const size_t&);
+                Buckets(const Buckets&) = delete;
+                Buckets& operator = (const Buckets&) = delete;
+                ~Buckets();
+
+                void delete_nodes() noexcept;
+            };
+
+            // Статические константы класса.
+            static inline constexpr size_t MIN_TABLE_SIZE{ 64 };     ///< \brief Минимальный размер хеш-таблицы.
+            static inline constexpr uint32_t GROWTH_RATE{ 2 };        ///< \brief Коэффициент расширения.
+            static inline constexpr double MAX_UTIL_PERCENT{ 0.5 };   ///< \brief Коэффициент заполнения.
+            static inline constexpr size_t RECLAIM_THRESHOLD{ 256 };  ///< \brief Размер списка ожидания,
+                                                                      ///< после которого писатель
+                                                                      ///< освобождает память.
+
+            mutable std::mutex writer_mutex_;
+            EpochDomain domain_;
+            std::atomic<Buckets*> buckets_;
+            Hasher hasher_;
+            size_t record_count_;
+            Record *head_, *tail_;  ///< \brief Первая и последняя записи в порядке добавления.
+
+            [[nodiscard]]
+            const Record* find(const Buckets*, std::string_view,
+                               const uint64_t&) const noexcept;
+            template <class Value>
+            void assign(std::string_view, Value&&);
+            void replace_chain(const Buckets*, const size_t&, const Node*,
+                               const Node*);
+            void link(Record*, Record*, Record*) noexcept;
+            void unlink(Record*) noexcept;
+            void rehash(const size_t&);
+            void collect();
+        public:
+            /// \class Класс Reader предоставляет доступ к хеш-таблице для
+            /// одного потока-читателя.
+            ///
+            /// Ячейка читателя занимается при создании объекта и
+            /// освобождается при его уничтожении; каждый поток должен
+            /// использовать собственный Reader.
+            ///
+            /// Публичные методы:
+            /// \n • HashType get(std::string_view key) const;
+            /// \n • bool contains(std::string_view key) const;
+            /// \n • bool visit(std::string_view key, Function&& function) const.
+            class Reader {
+                private:
+                    const RcuOrderedHashTable* table_;
+                    size_t slot_;
+                public:
+                    explicit Reader(const RcuOrderedHashTable*);
+                    Reader(const Reader&) = delete;
+                    Reader& operator = (const Reader&) = delete;
+                    ~Reader();
+
+                    [[nodiscard]] [[maybe_unused]]
+                    HashType get(std::string_view key) const;
+                    [[nodiscard]] [[maybe_unused]]
+                    bool contains(std::string_view key) const;
+                    template <class Function>
+                    [[maybe_unused]]
+                    bool visit(std::string_view key, Function&& function) const;
+            };
+
+            explicit RcuOrderedHashTable();
+            RcuOrderedHashTable(const RcuOrderedHashTable&) = delete;
+            RcuOrderedHashTable& operator = (const RcuOrderedHashTable&) = delete;
+            ~RcuOrderedHashTable();
+
+            [[nodiscard]] [[maybe_unused]]
+            Reader reader() const;
+
+            [[maybe_unused]]
+            void insert(std::string_view key, const HashType& value);
+            [[maybe_unused]]
+            void insert(std::string_view key, HashType&& value);
+            [[maybe_unused]]
+            bool erase(std::string_view key);
+            [[maybe_unused]]
+            void reserve(const size_t& count);
+
+            [[nodiscard]] [[maybe_unused]]
+            size_t length() const noexcept;
+            [[nodiscard]] [[maybe_unused]]
+            std::vector<std::pair<std::string, HashType>> items() const;
+    };
+
+// Определения методов классов.
+/* =============================== EpochDomain =============================== */
+// PRIVATE
+
+    /// \brief Освобождает объект указанного типа.
+    ///
+    /// \param object Указатель на объект.
+    template <class T>
+    void EpochDomain::destroy(void* object) noexcept {
+        delete static_cast<T*>(object);
+    }
+
+// PUBLIC
+
+    // Стандартный деструктор экземпляра. К этому моменту читателей быть не
+    // должно, поэтому освобождаются все ожидающие объекты.
+    inline EpochDomain::~EpochDomain() {
+        for (const Retired& retired : this->retired_)
+            retired.deleter_(retired.object_);
+    }
+
+    /// \brief Занимает свободную ячейку читателя.
+    ///
+    /// Единственная операция чтения-модификации-записи читателя:
+    /// выполняется один раз при его регистрации.
+    ///
+    /// \return Индекс ячейки.
+    ///
+    /// \throw std::length_error Исключение возбуждается, если все
+    /// MAX_READERS ячеек заняты.
+    [[nodiscard]]
+    inline size_t EpochDomain::acquire_slot() {
+        for (size_t slot{}; slot < MAX_READERS; slot++) {
+            bool expected{ false };
+            if (this->slots_[slot].taken_.compare_exchange_strong(
+                    expected, true, std::memory_order_acquire))
+                return slot;
+        }
+        throw std::length_error("Too many concurrent readers.");
+    }
+
+    /// \brief Освобождает ячейку читателя.
+    ///
+    /// \param slot Индекс ячейки.
+    inline void EpochDomain::release_slot(const size_t& slot) noexcept {
+        this->slots_[slot].epoch_.store(INACTIVE, std::memory_order_release);
+        this->slots_[slot].taken_.store(false, std::memory_order_release);
+    }
+
+    /// \brief Отмечает начало чтения.
+    ///
+    /// Барьер гарантирует, что писатель либо увидит эпоху читателя, либо
+    /// читатель увидит структуру уже без исключенных объектов.
+    ///
+    /// \param slot Индекс ячейки читателя.
+    inline void EpochDomain::enter(const size_t& slot) noexcept {
+        this->slots_[slot].epoch_.store(
+                this->epoch_.load(std::memory_order_acquire),
+                std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+    }
+
+    /// \brief Отмечает конец чтения.
+    ///
+    /// \param slot Индекс ячейки читателя.
+    inline void EpochDomain::leave(const size_t& slot) noexcept {
+        this->slots_[slot].epoch_.store(INACTIVE, std::memory_order_release);
+    }
+
+    /// \brief Заранее выделяет место в списке ожидания, чтобы следующие
+    /// count вызовов retire не возбуждали исключений.
+    ///
+    /// \param count Количество объектов.
+    inline void EpochDomain::reserve(const size_t& count) {
+        const size_t required{ this->retired_.size() + count };
+        if (required > this->retired_.capacity())
+            this->retired_.reserve(std::max(required, this->retired_.capacity() * 2));
+    }
+
+    /// \brief Отправляет исключенный из структуры объект в список
+    /// ожидания.
+    ///
+    /// \param object Указатель на объект, созданный через new.
+    template <class T>
+    void EpochDomain::retire(T* object) {
+        this->retired_.push_back({ object, &destroy<T>,
+                                   this->epoch_.load(std::memory_order_relaxed) });
+    }
+
+    /// \brief Освобождает объекты, которые уже не может читать ни один
+    /// читатель, и начинает новую эпоху.
+    inline void EpochDomain::reclaim() {
+        this->epoch_.fetch_add(1, std::memory_order_seq_cst);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        uint64_t min_epoch{ UINT64_MAX };
+        for (const Slot& slot : this->slots_) {
+            uint64_t epoch{ slot.epoch_.load(std::memory_order_acquire) };
+            if (epoch != INACTIVE && epoch < min_epoch)
+                min_epoch = epoch;
+        }
+
+        size_t kept{};
+        for (const Retired& retired : this->retired_) {
+            if (retired.epoch_ < min_epoch)
+                retired.deleter_(retired.object_);
+            else
+                this->retired_[kept++] = retired;
+        }
+        this->retired_.resize(kept);
+    }
+
+    /// \brief Предоставляет доступ к количеству ожидающих объектов.
+    ///
+    /// \return Значение кол-ва объектов.
+    [[nodiscard]] [[maybe_unused]]
+    inline size_t EpochDomain::retired_count() const noexcept {
+        return this->retired_.size();
+    }
+
+/* ================================= Record ================================= */
+
+    /// \brief Стандартный конструктор экземпляра класса
+    /// RcuOrderedHashTable::Record.
+    ///
+    /// \param key Строковый ключ записи.
+    /// \param value Значение записи.
+    /// \param hash Полный хеш ключа.
+    template <class T, class H>
+    template <class Value>
+    RcuOrderedHashTable<T, H>::Record::Record(std::string_view key,
+                                              Value&& value,
+                                              const uint64_t& hash) :
+            key_(key), value_(std::forward<Value>(value)), hash_(hash),
+            prev_(nullptr), next_(nullptr) { }
+
+/* ================================ Buckets ================================ */
+
+    /// \brief Стандартный конструктор экземпляра класса
+    /// RcuOrderedHashTable::Buckets.
+    ///
+    /// \param size Количество ячеек.
+    template <class T, class H>
+    RcuOrderedHashTable<T, H>::Buckets::Buckets(const size_t& size) :
+            size_(size), heads_(new std::atomic<const Node*>[size]) {
+        for (size_t item{}; item < this->size_; item++)
+            this->heads_[item].store(nullptr, std::memory_order_relaxed);
+    }
+
+    // Стандартный деструктор экземпляра. Узлы освобождаются отдельно.
+    template <class T, class H>
+    RcuOrderedHashTable<T, H>::Buckets::~Buckets() {
+        delete[] this->heads_;
+    }
+
+    /// \brief Освобождает все узлы массива. Массив не должен быть
+    /// опубликован или должен быть уже недоступен читателям.
+    template <class T, class H>
+    void RcuOrderedHashTable<T, H>::Buckets::delete_nodes() noexcept {
+        for (size_t item{}; item < this->size_; item++) {
+            const Node* node{ this->heads_[item].load(std::memory_order_relaxed) };
+            while (node != nullptr) {
+                const Node* next_node{ node->next_ };
+                delete node;
+                node = next_node;
+            }
+            this->heads_[item].store(nullptr, std::memory_order_relaxed);
+        }
+    }
+
+/* ================================= Reader ================================= */
+
+    /// \brief Стандартный конструктор экземпляра класса
+    /// RcuOrderedHashTable::Reader.
+    ///
+    /// \param table Хеш-таблица, из которой предстоит читать.
+    template <class T, class H>
+    RcuOrderedHashTable<T, H>::Reader::Reader(const RcuOrderedHashTable* table) :
+            table_(table),
+            slot_(const_cast<EpochDomain&>(table->domain_).acquire_slot()) { }
+
+    // Стандартный деструктор экземпляра.
+    template <class T, class H>
+    RcuOrderedHashTable<T, H>::Reader::~Reader() {
+        const_cast<EpochDomain&>(this->table_->domain_).release_slot(this->slot_);
+    }
+
+    /// \brief Метод, позволяющий получить копию значения элемента по ключу.
+    ///
+    /// В случае ненахождения элемента будет возвращено стандартное значение.
+    ///
+    /// \param key Строковый ключ, значение по которому нужно найти.
+    ///
+    /// \return Найденное значение ключа или стандартное значение.
+    template <class T, class H>
+    [[nodiscard]] [[maybe_unused]]
+    T RcuOrderedHashTable<T, H>::Reader::get(std::string_view key) const {
+        T value{};
+        static_cast<void>(this->visit(key, [&value](const T& found) {
+            value = found;
+        }));
+        return value;
+    }
+
+    /// \brief Проверяет, есть ли в хеш-таблице элемент с указанным ключом.
+    ///
+    /// \param key Строковый ключ элемента.
+    ///
+    /// \return Булевое значение.
+    template <class T, class H>
+    [[nodiscard]] [[maybe_unused]]
+    bool RcuOrderedHashTable<T, H>::Reader::contains(std::string_view key) const {
+        return this->visit(key, [](const T&) { });
+    }
+
+    /// \brief Передает значение элемента функции без копирования.
+    ///
+    /// Функция вызывается внутри эпохи читателя: пока она работает,
+    /// запись не будет освобождена, даже если писатель ее заменит.
+    ///
+    /// \param key Строковый ключ элемента.
+    /// \param function Функция, принимающая const HashType&.
+    ///
+    /// \return true, если элемент найден и функция вызвана.
+    template <class T, class H>
+    template <class Function>
+    [[maybe_unused]]
+    bool RcuOrderedHashTable<T, H>::Reader::visit(std::string_view key,
+                                                  Function&& function) const {
+        auto& domain{ const_cast<EpochDomain&>(this->table_->domain_) };
+        uint64_t hash{ this->table_->hasher_(key) };
+
+        domain.enter(this->slot_);
+        const Record* record{ this->table_->find(
+                this->table_->buckets_.load(std::memory_order_acquire), key,
+                hash) };
+        if (record != nullptr)
+            std::forward<Function>(function)(record->value_);
+        domain.leave(this->slot_);
+        return record != nullptr;
+    }
+
+/* ========================== RcuOrderedHashTable ========================== */
+// PRIVATE
+
+    /// \brief Ищет запись с указанным ключом в массиве ячеек.
+    ///
+    /// \param buckets Опубликованный массив ячеек.
+    /// \param key Строковый ключ записи.
+    /// \param hash Хеш ключа.
+    ///
+    /// \return Указатель на запись или nullptr, если ее нет.
+    template <class T, class H>
+    [[nodiscard]]
+    const RcuOrderedHashTable<T, H>::Record* RcuOrderedHashTable<T, H>::find(
+            const Buckets* buckets, std::string_view key,
+            const uint64_t& hash) const noexcept {
+        const Node* node{ buckets->heads_[bucket_index(hash, buckets->size_)]
+                                  .load(std::memory_order_acquire) };
+        for (; node != nullptr; node = node->next_) {
+            if (node->record_->hash_ == hash && node->record_->key_ == key)
+                return node->record_;
+        }
+        return nullptr;
+    }
+
+    /// \brief Публикует новую голову ячейки вместо начала цепочки до узла
+    /// target включительно.
+    ///
+    /// Узлы перед target копируются, к копиям присоединяется replacement
+    /// (или остаток цепочки после target, если replacement - nullptr), а
+    /// старые узлы отправляются в список ожидания. Все выделения памяти
+    /// происходят до публикации: если они прерваны исключением, копии
+    /// освобождаются, ячейка не меняется, а replacement остается у
+    /// вызывающего. Место в списке ожидания резервируется и под запись
+    /// target, которую вызывающий отправляет туда после публикации.
+    ///
+    /// \param buckets Текущий массив ячеек.
+    /// \param index Индекс ячейки.
+    /// \param target Заменяемый узел.
+    /// \param replacement Новый узел или nullptr для удаления.
+    template <class T, class H>
+    void RcuOrderedHashTable<T, H>::replace_chain(const Buckets* buckets,
+                                                  const size_t& index,
+                                                  const Node* target,
+                                                  const Node* replacement) {
+        const Node* head{ buckets->heads_[index].load(std::memory_order_relaxed) };
+        const Node* new_head{ (replacement != nullptr) ? replacement
+                                                       : target->next_ };
+
+        // Копирование узлов перед target с конца к началу цепочки.
+        std::vector<const Node*> prefix;
+        for (const Node* node{ head }; node != target; node = node->next_)
+            prefix.push_back(node);
+        this->domain_.reserve(prefix.size() + 2);
+        const Node* const tail{ new_head };
+        try {
+            for (size_t item{ prefix.size() }; item > 0; item--)
+                new_head = new Node{ prefix[item - 1]->record_, new_head };
+        }
+        catch (...) {
+            while (new_head != tail) {
+                const Node* next_node{ new_head->next_ };
+                delete new_head;
+                new_head = next_node;
+            }
+            throw;
+        }
+
+        buckets->heads_[index].store(new_head, std::memory_order_release);
+        for (const Node* node : prefix)
+            this->domain_.retire(const_cast<Node*>(node));
+        this->domain_.retire(const_cast<Node*>(target));
+    }
+
+    /// \brief Добавляет элемент или заменяет значение по существующему
+    /// ключу.
+    ///
+    /// Новая запись принадлежит std::unique_ptr, пока не опубликована:
+    /// при std::bad_alloc таблица остается прежней и ничего не утекает.
+    /// Неудачное расширение после добавления не отменяет вставку: запись
+    /// сохраняется, а таблица остается прежнего размера.
+    ///
+    /// \param key Строковый ключ элемента.
+    /// \param value Значение элемента; rvalue перемещается.
+    template <class T, class H>
+    template <class Value>
+    void RcuOrderedHashTable<T, H>::assign(std::string_view key, Value&& value) {
+        std::lock_guard lock{ this->writer_mutex_ };
+        uint64_t hash{ this->hasher_(key) };
+        Buckets* buckets{ this->buckets_.load(std::memory_order_relaxed) };
+        size_t index{ bucket_index(hash, buckets->size_) };
+
+        std::unique_ptr<Record> new_record{ new Record(key, std::forward<Value>(value),
+                                                       hash) };
+        const Node* head{ buckets->heads_[index].load(std::memory_order_relaxed) };
+        const Node* target{ head };
+        while (target != nullptr && !(target->record_->hash_ == hash &&
+                                      target->record_->key_ == key))
+            target = target->next_;
+
+        if (target != nullptr) {
+            // Замена значения: новая запись встает на место старой и в
+            // цепочке, и в порядке добавления. Порядок меняется только
+            // после публикации, которая может прерваться исключением.
+            auto* old_record{ const_cast<Record*>(target->record_) };
+            std::unique_ptr<Node> node{ new Node{ new_record.get(), target->next_ } };
+            this->replace_chain(buckets, index, target, node.get());
+            static_cast<void>(node.release());
+            this->link(new_record.release(), old_record->prev_, old_record->next_);
+            this->domain_.retire(old_record);
+            this->collect();
+            return;
+        }
+
+        const Node* node{ new Node{ new_record.get(), head } };
+        buckets->heads_[index].store(node, std::memory_order_release);
+        this->link(new_record.release(), this->tail_, nullptr);
+        this->record_count_++;
+        if ((this->record_count_ / static_cast<double>(buckets->size_)) >=
+            MAX_UTIL_PERCENT) {
+            // Запись уже опубликована: если памяти на расширение не
+            // хватило, таблица остается прежнего размера и попробует
+            // расшириться при следующей вставке.
+            try {
+                this->rehash(buckets->size_ * GROWTH_RATE);
+            }
+            catch (const std::bad_alloc&) { }
+        }
+    }
+
+    /// \brief Ставит запись между двумя соседями в порядке добавления.
+    ///
+    /// \param record Указатель на запись.
+    /// \param prev Предыдущая запись или nullptr.
+    /// \param next Следующая запись или nullptr.
+    template <class T, class H>
+    void RcuOrderedHashTable<T, H>::link(Record* record, Record* prev,
+                                         Record* next) noexcept {
+        record->prev_ = prev;
+        record->next_ = next;
+        if (prev != nullptr)
+            prev->next_ = record;
+        else
+            this->head_ = record;
+        if (next != nullptr)
+            next->prev_ = record;
+        else
+            this->tail_ = record;
+    }
+
+    /// \brief Исключает запись из порядка добавления.
+    ///
+    /// \param record Указатель на исключаемую запись.
+    template <class T, class H>
+    void RcuOrderedHashTable<T, H>::unlink(Record* record) noexcept {
+        if (record->prev_ != nullptr)
+            record->prev_->next_ = record->next_;
+        else
+            this->head_ = record->next_;
+        if (record->next_ != nullptr)
+            record->next_->prev_ = record->prev_;
+        else
+            this->tail_ = record->prev_;
+    }
+
+    /// \brief Строит и публикует новый массив ячеек указанного размера.
+    ///
+    /// Записи не копируются: новые узлы ссылаются на те же записи. Старый
+    /// массив и его узлы освобождаются, когда их дочитают все читатели.
+    /// Вся память выделяется до публикации: при исключении новый массив
+    /// и его узлы освобождаются, и таблица остается прежней.
+    ///
+    /// \param new_size Новый размер массива ячеек.
+    template <class T, class H>
+    void RcuOrderedHashTable<T, H>::rehash(const size_t& new_size) {
+        Buckets* old_buckets{ this->buckets_.load(std::memory_order_relaxed) };
+        std::unique_ptr<Buckets> new_buckets{ new Buckets(new_size) };
+        try {
+            for (const Record* record{ this->head_ }; record != nullptr;
+                    record = record->next_) {
+                auto& head{ new_buckets->heads_[bucket_index(record->hash_, new_size)] };
+                head.store(new Node{ record, head.load(std::memory_order_relaxed) },
+                           std::memory_order_relaxed);
+            }
+            // Место под старые узлы (по одному на запись) и старый массив.
+            this->domain_.reserve(this->record_count_ + 1);
+        }
+        catch (...) {
+            new_buckets->delete_nodes();
+            throw;
+        }
+        this->buckets_.store(new_buckets.release(), std::memory_order_release);
+
+        for (size_t item{}; item < old_buckets->size_; item++) {
+            const Node* node{ old_buckets->heads_[item].load(
+                    std::memory_order_relaxed) };
+            while (node != nullptr) {
+                const Node* next_node{ node->next_ };
+                this->domain_.retire(const_cast<Node*>(node));
+                node = next_node;
+            }
+        }
+        this->domain_.retire(old_buckets);
+        this->domain_.reclaim();
+    }
+
+    /// \brief Освобождает память, если список ожидания разросся.
+    template <class T, class H>
+    void RcuOrderedHashTable<T, H>::collect() {
+        if (this->domain_.retired_count() >= RECLAIM_THRESHOLD)
+            this->domain_.reclaim();
+    }
+
+// PUBLIC
+
+    /// \brief Стандартный конструктор экземпляра класса
+    /// RcuOrderedHashTable.
+    template <class T, class H>
+    RcuOrderedHashTable<T, H>::RcuOrderedHashTable() :
+            buckets_(new Buckets(MIN_TABLE_SIZE)), hasher_(),
+            record_count_(0), head_(nullptr), tail_(nullptr) { }
+
+    // Стандартный деструктор экземпляра. Читателей к этому моменту быть не
+    // должно.
+    template <class T, class H>
+    RcuOrderedHashTable<T, H>::~RcuOrderedHashTable() {
+        Buckets* buckets{ this->buckets_.load(std::memory_order_relaxed) };
+        buckets->delete_nodes();
+        delete buckets;
+
+        Record* record{ this->head_ };
+        while (record != nullptr) {
+            Record* next_record{ record->next_ };
+            delete record;
+            record = next_record;
+        }
+    }
+
+    /// \brief Создает читателя хеш-таблицы для текущего потока.
+    ///
+    /// \return Объект-читатель.
+    template <class T, class H>
+    [[nodiscard]] [[maybe_unused]]
+    RcuOrderedHashTable<T, H>::Reader RcuOrderedHashTable<T, H>::reader() const {
+        return Reader(this);
+    }
+
+    /// \brief Метод, добавляющий элемент.
+    ///
+    /// Добавляет в хеш-таблицу новую пару "ключ - значение" или заменяет
+    /// значение по уже существующему ключу.
+    ///
+    /// \param key Строковый ключ элемента для вставки/изменения.
+    /// \param value Значение элемента для вставки/изменения.
+    template <class T, class H>
+    [[maybe_unused]]
+    void RcuOrderedHashTable<T, H>::insert(std::string_view key, const T& value) {
+        this->assign(key, value);
+    }
+
+    /// \brief Метод, добавляющий элемент с перемещением значения.
+    ///
+    /// \param key Строковый ключ элемента для вставки/изменения.
+    /// \param value Значение элемента для вставки/изменения.
+    template <class T, class H>
+    [[maybe_unused]]
+    void RcuOrderedHashTable<T, H>::insert(std::string_view key, T&& value) {
+        this->assign(key, std::move(value));
+    }
+
+    /// \brief Метод, стирающий из хеш-таблицы элемент с указанным ключом.
+    ///
+    /// \param key Строковый ключ элемента, который требуется удалить.
+    ///
+    /// \return true, если элемент был удален.
+    template <class T, class H>
+    [[maybe_unused]]
+    bool RcuOrderedHashTable<T, H>::erase(std::string_view key) {
+        std::lock_guard lock{ this->writer_mutex_ };
+        uint64_t hash{ this->hasher_(key) };
+        Buckets* buckets{ this->buckets_.load(std::memory_order_relaxed) };
+        size_t index{ bucket_index(hash, buckets->size_) };
+
+        const Node* target{ buckets->heads_[index].load(std::memory_order_relaxed) };
+        while (target != nullptr && !(target->record_->hash_ == hash &&
+                                      target->record_->key_ == key))
+            target = target->next_;
+        if (target == nullptr)
+            return false;
+
+        auto* record{ const_cast<Record*>(target->record_) };
+        this->replace_chain(buckets, index, target, nullptr);
+        this->unlink(record);
+        this->domain_.retire(record);
+        this->record_count_--;
+        this->collect();
+        return true;
+    }
+
+    /// \brief Заранее расширяет хеш-таблицу под указанное количество
+    /// элементов.
+    ///
+    /// \param count Ожидаемое количество элементов.
+    template <class T, class H>
+    [[maybe_unused]]
+    void RcuOrderedHashTable<T, H>::reserve(const size_t& count) {
+        std::lock_guard lock{ this->writer_mutex_ };
+        size_t size{ this->buckets_.load(std::memory_order_relaxed)->size_ };
+        size_t new_size{ size };
+        while ((count / static_cast<double>(new_size)) >= MAX_UTIL_PERCENT)
+            new_size *= GROWTH_RATE;
+        if (new_size != size)
+            this->rehash(new_size);
+    }
+
+    /// \brief Предоставляет доступ к количеству элементов таблицы.
+    ///
+    /// Значение читается без синхронизации и предназначено для писателя.
+    ///
+    /// \return Значение кол-ва элементов.
+    template <class T, class H>
+    [[nodiscard]] [[maybe_unused]]
+    size_t RcuOrderedHashTable<T, H>::length() const noexcept {
+        return this->record_count_;
+    }
+
+    /// \brief Возвращает снимок всех элементов в порядке добавления.
+    ///
+    /// Снимок делается под мьютексом писателей.
+    ///
+    /// \return Пары "ключ - значение".
+    template <class T, class H>
+    [[nodiscard]] [[maybe_unused]]
+    std::vector<std::pair<std::string, T>> RcuOrderedHashTable<T, H>::items() const {
+        std::lock_guard lock{ this->writer_mutex_ };
+        std::vector<std::pair<std::string, T>> result;
+        result.reserve(this->record_count_);
+        for (const Record* record{ this->head_ }; record != nullptr;
+                record = record->next_)
+            result.emplace_back(record->key_, record->value_);
+        return result;
+    }
+}
+
+#endif
@@ -0,0 +1,831 @@
+/// \file scanengine.hpp.
+/// \author Лошкарев Дмитрий.
+/// \date 14.10.2026.
+///
+/// \brief Содержит движок запросов вида "count/sum/min/max поля X, где
+/// поле Y удовлетворяет условию", обходящий столбцы значений векторными
+/// ядрами AVX2 или NEON.
+///
+/// \namespaces
+/// • DataStructures
+/// \classes
+/// • ScanPredicate
+/// • ScanResult
+/// • ScanEngine
+
+#ifndef CPPPROJECT_SCANENGINE_H
+#define CPPPROJECT_SCANENGINE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    #include <immintrin.h>
+    #define SCANENGINE_HAS_AVX2
+#elif defined(__aarch64__)
+    #include <arm_neon.h>
+    #define SCANENGINE_HAS_NEON
+#endif
+
+#include "columnartable.hpp"
+#include "threadpool.hpp"
+
+namespace DataStructures {
+// Объявление перечислений.
+
+    /// \enum Перечисление Compare описывает условие на значение поля.
+    ///
+    /// \n • ANY - условию удовлетворяет любое значение;
+    /// \n • LESS, LESS_EQUAL, GREATER, GREATER_EQUAL, EQUAL, NOT_EQUAL -
+    /// сравнение с value_;
+    /// \n • BETWEEN - value_ <= x <= high_.
+    enum class Compare : uint8_t {
+        ANY,
+        LESS,
+        LESS_EQUAL,
+        GREATER,
+        GREATER_EQUAL,
+        EQUAL,
+        NOT_EQUAL,
+        BETWEEN
+    };
+
+    /// \enum Перечисление SimdLevel описывает набор векторных инструкций,
+    /// которым выполняется обход.
+    ///
+    /// \n • SCALAR - обычный цикл;
+    /// \n • AVX2 - ядра AVX2 (x86-64), выбираются по CPUID при запуске;
+    /// \n • NEON - ядра NEON (AArch64, доступны всегда).
+    enum class SimdLevel : uint8_t {
+        SCALAR,
+        AVX2,
+        NEON
+    };
+
+// Объявление классов.
+
+    /// \class Структура ScanPredicate описывает условие отбора строк.
+    ///
+    /// Значения NaN не удовлетворяют ни одному условию, кроме ANY и
+    /// NOT_EQUAL.
+    ///
+    /// Публичные методы:
+    /// \n • bool test(const ValueType& value) const noexcept.
+    ///
+    /// \tparam ValueType Тип значений поля.
+    template <class ValueType>
+    struct ScanPredicate {
+        Compare op_{ Compare::ANY };
+        ValueType value_{};   ///< \brief Значение для сравнения или нижняя
+                              ///< граница BETWEEN.
+        ValueType high_{};    ///< \brief Верхняя граница BETWEEN.
+
+        [[nodiscard]]
+        inline bool test(const ValueType&) const noexcept;
+    };
+
+    /// \class Структура ScanResult описывает агрегаты отобранных строк.
+    ///
+    /// Если ни одна строка не отобрана, min_ и max_ остаются равны
+    /// наибольшему и наименьшему значениям типа. Значения NaN входят в
+    /// сумму, но не в min_ и max_.
+    ///
+    /// Публичные методы:
+    /// \n • void add(const ValueType& value) noexcept;
+    /// \n • void merge(const ScanResult& other) noexcept;
+    /// \n • double average() const noexcept.
+    ///
+    /// \tparam ValueType Тип значений поля.
+    template <class ValueType>
+    struct ScanResult {
+        /// \brief Тип суммы: double для дробных, 64-битное целое для целых.
+        using SumType = std::conditional_t<std::is_floating_point_v<ValueType>, double,
+                        std::conditional_t<std::is_signed_v<ValueType>, int64_t,
+                                           uint64_t>>;
+
+        uint64_t count_{};   ///< \brief Количество отобранных строк.
+        SumType sum_{};
+        ValueType min_{ std::numeric_limits<ValueType>::max() };
+        ValueType max_{ std::numeric_limits<ValueType>::lowest() };
+
+        inline void add(const ValueType&) noexcept;
+        inline void merge(const ScanResult&) noexcept;
+        [[nodiscard]] [[maybe_unused]]
+        inline double average() const noexcept;
+    };
+
+    /// \class Класс ScanEngine предоставляет обход столбцов значений с
+    /// отбором строк по условию на один столбец и агрегированием другого.
+    ///
+    /// Столбцы читаются подряд, в порядке хранения, без поиска по ключам.
+    /// Для int32_t и double используются векторные ядра: AVX2 выбирается
+    /// во время работы, если процессор его поддерживает, на AArch64 всегда
+    /// доступен NEON; остальные типы и процессоры без AVX2 обходятся
+    /// обычным циклом. Векторная сумма double складывает значения в другом
+    /// порядке и может отличаться от скалярной в последних разрядах.
+    ///
+    /// Тип значений выводится только из первого столбца, поэтому фильтр и
+    /// условие могут быть std::span<T> и списком инициализации, а столбцы
+    /// ColumnarTable::column() передаются без std::as_const.
+    ///
+    /// Если задан пул потоков, столбцы от PARALLEL_MIN_ROWS строк делятся
+    /// на части, которые обходятся параллельно, а их агрегаты
+    /// объединяются.
+    ///
+    /// Публичные методы:
+    /// \n • static SimdLevel detect() noexcept;
+    /// \n • SimdLevel level() const noexcept;
+    /// \n • ScanResult<T> scan(std::span<const T> values,
+    /// std::span<const T> filter, const ScanPredicate<T>& predicate) const;
+    /// \n • ScanResult<T> scan(std::span<const T> values,
+    /// const ScanPredicate<T>& predicate) const;
+    /// \n • ScanResult<T> scan(std::span<T> values,
+    /// std::span<const T> filter, const ScanPredicate<T>& predicate) const;
+    /// \n • ScanResult<T> scan(std::span<T> values,
+    /// const ScanPredicate<T>& predicate) const;
+    /// \n • ScanResult<T> query(const ColumnarTable<T, S, H>& table,
+    /// std::string_view field, std::string_view filter_field,
+    /// const ScanPredicate<T>& predicate) const.
+    class ScanEngine {
+        private:
+            static inline constexpr size_t PARALLEL_MIN_ROWS{ 1 << 16 };  ///< \brief Количество строк, начиная
+                                                                          ///< с которого обход делится
+                                                                          ///< между потоками.
+            static inline constexpr size_t TASKS_PER_THREAD{ 4 };         ///< \brief Количество задач на поток.
+
+            SimdLevel level_;
+            ThreadPool* pool_;   ///< \brief Пул потоков или nullptr.
+
+            template <class T>
+            [[nodiscard]]
+            static ScanResult<T> scan_scalar(const T*, const T*, const size_t&,
+                                             const ScanPredicate<T>&) noexcept;
+#if defined(SCANENGINE_HAS_AVX2)
+            [[nodiscard]] __attribute__((target("avx2")))
+            static inline __m256i match_avx2(const __m256i&, const Compare&,
+                                             const __m256i&, const __m256i&) noexcept;
+            [[nodiscard]] __attribute__((target("avx2")))
+            static inline __m256d match_avx2(const __m256d&, const Compare&,
+                                             const __m256d&, const __m256d&) noexcept;
+            [[nodiscard]] __attribute__((target("avx2")))
+            static ScanResult<int32_t> scan_avx2(const int32_t*, const int32_t*,
+                                                 const size_t&,
+                                                 const ScanPredicate<int32_t>&) noexcept;
+            [[nodiscard]] __attribute__((target("avx2")))
+            static ScanResult<double> scan_avx2(const double*, const double*,
+                                                const size_t&,
+                                                const ScanPredicate<double>&) noexcept;
+#elif defined(SCANENGINE_HAS_NEON)
+            [[nodiscard]]
+            static inline uint32x4_t match_neon(const int32x4_t&, const Compare&,
+                                                const int32x4_t&,
+                                                const int32x4_t&) noexcept;
+            [[nodiscard]]
+            static inline uint64x2_t match_neon(const float64x2_t&, const Compare&,
+                                                const float64x2_t&,
+                                                const float64x2_t&) noexcept;
+            [[nodiscard]]
+            static ScanResult<int32_t> scan_neon(const int32_t*, const int32_t*,
+                                                 const size_t&,
+                                                 const ScanPredicate<int32_t>&) noexcept;
+            [[nodiscard]]
+            static ScanResult<double> scan_neon(const double*, const double*,
+                                                const size_t&,
+                                                const ScanPredicate<double>&) noexcept;
+#endif
+            template <class T>
+            [[nodiscard]]
+            ScanResult<T> scan_range(const T*, const T*, const size_t&,
+                                     const ScanPredicate<T>&) const noexcept;
+        public:
+            explicit ScanEngine(ThreadPool* = nullptr) noexcept;
+            [[maybe_unused]]
+            explicit ScanEngine(const SimdLevel&, ThreadPool* = nullptr) noexcept;
+
+            [[nodiscard]]
+            static SimdLevel detect() noexcept;
+            [[nodiscard]] [[maybe_unused]]
+            inline SimdLevel level() const noexcept;
+
+            template <class T>
+            [[nodiscard]]
+            ScanResult<T> scan(std::span<const T> values,
+                               std::span<const std::type_identity_t<T>> filter,
+                               const ScanPredicate<std::type_identity_t<T>>& predicate) const;
+            template <class T>
+            [[nodiscard]] [[maybe_unused]]
+            ScanResult<T> scan(std::span<const T> values,
+                               const ScanPredicate<std::type_identity_t<T>>& predicate = {})
+                               const;
+            template <class T>
+            requires (!std::is_const_v<T>)
+            [[nodiscard]] [[maybe_unused]]
+            ScanResult<T> scan(std::span<T> values,
+                               std::span<const std::type_identity_t<T>> filter,
+                               const ScanPredicate<std::type_identity_t<T>>& predicate) const;
+            template <class T>
+            requires (!std::is_const_v<T>)
+            [[nodiscard]] [[maybe_unused]]
+            ScanResult<T> scan(std::span<T> values,
+                               const ScanPredicate<std::type_identity_t<T>>& predicate = {})
+                               const;
+            template <class T, class S, class H>
+            [[nodiscard]] [[maybe_unused]]
+            ScanResult<T> query(const ColumnarTable<T, S, H>& table,
+                                std::string_view field, std::string_view filter_field,
+                                const ScanPredicate<T>& predicate = {}) const;
+    };
+
+// Определения методов классов.
+/* ============================= ScanPredicate ============================= */
+
+    /// \brief Проверяет значение на соответствие условию.
+    ///
+    /// \param value Проверяемое значение.
+    ///
+    /// \return true, если значение удовлетворяет условию.
+    template <class T>
+    [[nodiscard]]
+    inline bool ScanPredicate<T>::test(const T& value) const noexcept {
+        switch (this->op_) {
+            case Compare::LESS:
+                return value < this->value_;
+            case Compare::LESS_EQUAL:
+                return value <= this->value_;
+            case Compare::GREATER:
+                return value > this->value_;
+            case Compare::GREATER_EQUAL:
+                return value >= this->value_;
+            case Compare::EQUAL:
+                return value == this->value_;
+            case Compare::NOT_EQUAL:
+                return value != this->value_;
+            case Compare::BETWEEN:
+                return this->value_ <= value && value <= this->high_;
+            default:
+                return true;
+        }
+    }
+
+/* ============================== ScanResult ============================== */
+
+    /// \brief Учитывает отобранное значение.
+    ///
+    /// \param value Значение агрегируемого поля.
+    template <class T>
+    inline void ScanResult<T>::add(const T& value) noexcept {
+        this->count_++;
+        this->sum_ += static_cast<SumType>(value);
+        if (value < this->min_)
+            this->min_ = value;
+        if (value > this->max_)
+            this->max_ = value;
+    }
+
+    /// \brief Объединяет агрегаты двух частей обхода.
+    ///
+    /// \param other Агрегаты другой части.
+    template <class T>
+    inline void ScanResult<T>::merge(const ScanResult& other) noexcept {
+        this->count_ += other.count_;
+        this->sum_ += other.sum_;
+        if (other.min_ < this->min_)
+            this->min_ = other.min_;
+        if (other.max_ > this->max_)
+            this->max_ = other.max_;
+    }
+
+    /// \brief Вычисляет среднее отобранных значений.
+    ///
+    /// \return Среднее значение или 0, если строк не отобрано.
+    template <class T>
+    [[nodiscard]] [[maybe_unused]]
+    inline double ScanResult<T>::average() const noexcept {
+        return (this->count_ == 0) ? 0.0 : static_cast<double>(this->sum_) /
+                                           static_cast<double>(this->count_);
+    }
+
+/* ============================== ScanEngine ============================== */
+// PRIVATE
+
+    /// \brief Обходит столбцы обычным циклом.
+    ///
+    /// \param values Значения агрегируемого поля.
+    /// \param filter Значения поля, на которое наложено условие.
+    /// \param count Количество строк.
+    /// \param predicate Условие отбора.
+    ///
+    /// \return Агрегаты отобранных строк.
+    template <class T>
+    [[nodiscard]]
+    ScanResult<T> ScanEngine::scan_scalar(const T* values, const T* filter,
+                                          const size_t& count,
+                                          const ScanPredicate<T>& predicate) noexcept {
+        ScanResult<T> result;
+        for (size_t row{}; row < count; row++) {
+            if (predicate.test(filter[row]))
+                result.add(values[row]);
+        }
+        return result;
+    }
+
+#if defined(SCANENGINE_HAS_AVX2)
+    /// \brief Проверяет условие для восьми значений int32_t.
+    ///
+    /// \param x Значения поля.
+    /// \param op Вид условия.
+    /// \param value Значение для сравнения во всех дорожках.
+    /// \param high Верхняя граница BETWEEN во всех дорожках.
+    ///
+    /// \return Маску: все биты дорожки выставлены, если значение отобрано.
+    [[nodiscard]] __attribute__((target("avx2")))
+    inline __m256i ScanEngine::match_avx2(const __m256i& x, const Compare& op,
+                                          const __m256i& value,
+                                          const __m256i& high) noexcept {
+        const __m256i ones{ _mm256_set1_epi32(-1) };
+        switch (op) {
+            case Compare::LESS:
+                return _mm256_cmpgt_epi32(value, x);
+            case Compare::LESS_EQUAL:
+                return _mm256_andnot_si256(_mm256_cmpgt_epi32(x, value), ones);
+            case Compare::GREATER:
+                return _mm256_cmpgt_epi32(x, value);
+            case Compare::GREATER_EQUAL:
+                return _mm256_andnot_si256(_mm256_cmpgt_epi32(value, x), ones);
+            case Compare::EQUAL:
+                return _mm256_cmpeq_epi32(x, value);
+            case Compare::NOT_EQUAL:
+                return _mm256_andnot_si256(_mm256_cmpeq_epi32(x, value), ones);
+            case Compare::BETWEEN:
+                return _mm256_andnot_si256(
+                        _mm256_or_si256(_mm256_cmpgt_epi32(value, x),
+                                        _mm256_cmpgt_epi32(x, high)), ones);
+            default:
+                return ones;
+        }
+    }
+
+    /// \brief Проверяет условие для четырех значений double.
+    ///
+    /// Сравнения упорядоченные: NaN не проходит ни одно условие, кроме
+    /// NOT_EQUAL, как и в скалярном ScanPredicate::test().
+    ///
+    /// \param x Значения поля.
+    /// \param op Вид условия.
+    /// \param value Значение для сравнения во всех дорожках.
+    /// \param high Верхняя граница BETWEEN во всех дорожках.
+    ///
+    /// \return Маску: все биты дорожки выставлены, если значение отобрано.
+    [[nodiscard]] __attribute__((target("avx2")))
+    inline __m256d ScanEngine::match_avx2(const __m256d& x, const Compare& op,
+                                          const __m256d& value,
+                                          const __m256d& high) noexcept {
+        switch (op) {
+            case Compare::LESS:
+                return _mm256_cmp_pd(x, value, _CMP_LT_OQ);
+            case Compare::LESS_EQUAL:
+                return _mm256_cmp_pd(x, value, _CMP_LE_OQ);
+            case Compare::GREATER:
+                return _mm256_cmp_pd(x, value, _CMP_GT_OQ);
+            case Compare::GREATER_EQUAL:
+                return _mm256_cmp_pd(x, value, _CMP_GE_OQ);
+            case Compare::EQUAL:
+                return _mm256_cmp_pd(x, value, _CMP_EQ_OQ);
+            case Compare::NOT_EQUAL:
+                return _mm256_cmp_pd(x, value, _CMP_NEQ_UQ);
+            case Compare::BETWEEN:
+                return _mm256_and_pd(_mm256_cmp_pd(x, value, _CMP_GE_OQ),
+                                     _mm256_cmp_pd(x, high, _CMP_LE_OQ));
+            default:
+                return _mm256_castsi256_pd(_mm256_set1_epi32(-1));
+        }
+    }
+
+    /// \brief Обходит столбцы int32_t ядром AVX2 по восемь строк.
+    ///
+    /// Сумма накапливается в 64-битных дорожках, min и max - по маске
+    /// отобранных строк. Остаток короче восьми строк обходится обычным
+    /// циклом.
+    ///
+    /// \param values Значения агрегируемого поля.
+    /// \param filter Значения поля, на которое наложено условие.
+    /// \param count Количество строк.
+    /// \param predicate Условие отбора.
+    ///
+    /// \return Агрегаты отобранных строк.
+    [[nodiscard]] __attribute__((target("avx2")))
+    inline ScanResult<int32_t> ScanEngine::scan_avx2(
+            const int32_t* values, const int32_t* filter, const size_t& count,
+            const ScanPredicate<int32_t>& predicate) noexcept {
+        const __m256i value{ _mm256_set1_epi32(predicate.value_) };
+        const __m256i high{ _mm256_set1_epi32(predicate.high_) };
+        const __m256i min_fill{ _mm256_set1_epi32(std::numeric_limits<int32_t>::max()) };
+        const __m256i max_fill{ _mm256_set1_epi32(std::numeric_limits<int32_t>::lowest()) };
+        __m256i sum{ _mm256_setzero_si256() };
+        __m256i min{ min_fill }, max{ max_fill };
+        uint64_t matched{};
+
+        size_t row{};
+        for (; row + 8 <= count; row += 8) {
+            const __m256i x{ _mm256_loadu_si256(
+                    reinterpret_cast<const __m256i*>(filter + row)) };
+            const __m256i v{ _mm256_loadu_si256(
+                    reinterpret_cast<const __m256i*>(values + row)) };
+            const __m256i mask{ match_avx2(x, predicate.op_, value, high) };
+            matched += static_cast<uint64_t>(__builtin_popcount(
+                    static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(mask)))));
+            const __m256i selected{ _mm256_and_si256(v, mask) };
+            sum = _mm256_add_epi64(sum, _mm256_cvtepi32_epi64(
+                    _mm256_castsi256_si128(selected)));
+            sum = _mm256_add_epi64(sum, _mm256_cvtepi32_epi64(
+                    _mm256_extracti128_si256(selected, 1)));
+            min = _mm256_min_epi32(min, _mm256_blendv_epi8(min_fill, v, mask));
+            max = _mm256_max_epi32(max, _mm256_blendv_epi8(max_fill, v, mask));
+        }
+
+        alignas(32) int64_t sums[4];
+        alignas(32) int32_t mins[8], maxs[8];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(sums), sum);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(mins), min);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(maxs), max);
+        ScanResult<int32_t> result;
+        result.count_ = matched;
+        result.sum_ = sums[0] + sums[1] + sums[2] + sums[3];
+        result.min_ = *std::min_element(mins, mins + 8);
+        result.max_ = *std::max_element(maxs, maxs + 8);
+        result.merge(scan_scalar(values + row, filter + row, count - row, predicate));
+        return result;
+    }
+
+    /// \brief Обходит столбцы double ядром AVX2 по четыре строки.
+    ///
+    /// \param values Значения агрегируемого поля.
+    /// \param filter Значения поля, на которое наложено условие.
+    /// \param count Количество строк.
+    /// \param predicate Условие отбора.
+    ///
+    /// \return Агрегаты отобранных строк.
+    [[nodiscard]] __attribute__((target("avx2")))
+    inline ScanResult<double> ScanEngine::scan_avx2(
+            const double* values, const double* filter, const size_t& count,
+            const ScanPredicate<double>& predicate) noexcept {
+        const __m256d value{ _mm256_set1_pd(predicate.value_) };
+        const __m256d high{ _mm256_set1_pd(predicate.high_) };
+        const __m256d min_fill{ _mm256_set1_pd(std::numeric_limits<double>::max()) };
+        const __m256d max_fill{ _mm256_set1_pd(std::numeric_limits<double>::lowest()) };
+        __m256d sum{ _mm256_setzero_pd() };
+        __m256d min{ min_fill }, max{ max_fill };
+        uint64_t matched{};
+
+        size_t row{};
+        for (; row + 4 <= count; row += 4) {
+            const __m256d x{ _mm256_loadu_pd(filter + row) };
+            const __m256d v{ _mm256_loadu_pd(values + row) };
+            const __m256d mask{ match_avx2(x, predicate.op_, value, high) };
+            matched += static_cast<uint64_t>(__builtin_popcount(
+                    static_cast<unsigned>(_mm256_movemask_pd(mask))));
+            sum = _mm256_add_pd(sum, _mm256_and_pd(v, mask));
+            // При NaN в одном из операндов min/max возвращают второй -
+            // накопленное значение, поэтому NaN в них не попадает.
+            min = _mm256_min_pd(_mm256_blendv_pd(min_fill, v, mask), min);
+            max = _mm256_max_pd(_mm256_blendv_pd(max_fill, v, mask), max);
+        }
+
+        alignas(32) double sums[4], mins[4], maxs[4];
+        _mm256_store_pd(sums, sum);
+        _mm256_store_pd(mins, min);
+        _mm256_store_pd(maxs, max);
+        ScanResult<double> result;
+        result.count_ = matched;
+        result.sum_ = (sums[0] + sums[1]) + (sums[2] + sums[3]);
+        result.min_ = std::min({ mins[0], mins[1], mins[2], mins[3] });
+        result.max_ = std::max({ maxs[0], maxs[1], maxs[2], maxs[3] });
+        result.merge(scan_scalar(values + row, filter + row, count - row, predicate));
+        return result;
+    }
+#elif defined(SCANENGINE_HAS_NEON)
+    /// \brief Проверяет условие для четырех значений int32_t.
+    ///
+    /// \param x Значения поля.
+    /// \param op Вид условия.
+    /// \param value Значение для сравнения во всех дорожках.
+    /// \param high Верхняя граница BETWEEN во всех дорожках.
+    ///
+    /// \return Маску: все биты дорожки выставлены, если значение отобрано.
+    [[nodiscard]]
+    inline uint32x4_t ScanEngine::match_neon(const int32x4_t& x, const Compare& op,
+                                             const int32x4_t& value,
+                                             const int32x4_t& high) noexcept {
+        switch (op) {
+            case Compare::LESS:
+                return vcltq_s32(x, value);
+            case Compare::LESS_EQUAL:
+                return vcleq_s32(x, value);
+            case Compare::GREATER:
+                return vcgtq_s32(x, value);
+            case Compare::GREATER_EQUAL:
+                return vcgeq_s32(x, value);
+            case Compare::EQUAL:
+                return vceqq_s32(x, value);
+            case Compare::NOT_EQUAL:
+                return vmvnq_u32(vceqq_s32(x, value));
+            case Compare::BETWEEN:
+                return vandq_u32(vcgeq_s32(x, value), vcleq_s32(x, high));
+            default:
+                return vdupq_n_u32(~0U);
+        }
+    }
+
+    /// \brief Проверяет условие для двух значений double.
+    ///
+    /// \param x Значения поля.
+    /// \param op Вид условия.
+    /// \param value Значение для сравнения во всех дорожках.
+    /// \param high Верхняя граница BETWEEN во всех дорожках.
+    ///
+    /// \return Маску: все биты дорожки выставлены, если значение отобрано.
+    [[nodiscard]]
+    inline uint64x2_t ScanEngine::match_neon(const float64x2_t& x, const Compare& op,
+                                             const float64x2_t& value,
+                                             const float64x2_t& high) noexcept {
+        switch (op) {
+            case Compare::LESS:
+                return vcltq_f64(x, value);
+            case Compare::LESS_EQUAL:
+                return vcleq_f64(x, value);
+            case Compare::GREATER:
+                return vcgtq_f64(x, value);
+            case Compare::GREATER_EQUAL:
+                return vcgeq_f64(x, value);
+            case Compare::EQUAL:
+                return vceqq_f64(x, value);
+            case Compare::NOT_EQUAL:
+                return veorq_u64(vceqq_f64(x, value), vdupq_n_u64(~0ULL));
+            case Compare::BETWEEN:
+                return vandq_u64(vcgeq_f64(x, value), vcleq_f64(x, high));
+            default:
+                return vdupq_n_u64(~0ULL);
+        }
+    }
+
+    /// \brief Обходит столбцы int32_t ядром NEON по четыре строки.
+    ///
+    /// \param values Значения агрегируемого поля.
+    /// \param filter Значения поля, на которое наложено условие.
+    /// \param count Количество строк.
+    /// \param predicate Условие отбора.
+    ///
+    /// \return Агрегаты отобранных строк.
+    [[nodiscard]]
+    inline ScanResult<int32_t> ScanEngine::scan_neon(
+            const int32_t* values, const int32_t* filter, const size_t& count,
+            const ScanPredicate<int32_t>& predicate) noexcept {
+        const int32x4_t value{ vdupq_n_s32(predicate.value_) };
+        const int32x4_t high{ vdupq_n_s32(predicate.high_) };
+        const int32x4_t min_fill{ vdupq_n_s32(std::numeric_limits<int32_t>::max()) };
+        const int32x4_t max_fill{ vdupq_n_s32(std::numeric_limits<int32_t>::lowest()) };
+        int64x2_t sum{ vdupq_n_s64(0) };
+        int32x4_t min{ min_fill }, max{ max_fill };
+        uint64_t matched{};
+
+        size_t row{};
+        for (; row + 4 <= count; row += 4) {
+            const int32x4_t x{ vld1q_s32(filter + row) };
+            const int32x4_t v{ vld1q_s32(values + row) };
+            const uint32x4_t mask{ match_neon(x, predicate.op_, value, high) };
+            matched += vaddvq_u32(vshrq_n_u32(mask, 31));
+            sum = vpadalq_s32(sum, vandq_s32(v, vreinterpretq_s32_u32(mask)));
+            min = vminq_s32(min, vbslq_s32(mask, v, min_fill));
+            max = vmaxq_s32(max, vbslq_s32(mask, v, max_fill));
+        }
+
+        ScanResult<int32_t> result;
+        result.count_ = matched;
+        result.sum_ = vaddvq_s64(sum);
+        result.min_ = vminvq_s32(min);
+        result.max_ = vmaxvq_s32(max);
+        result.merge(scan_scalar(values + row, filter + row, count - row, predicate));
+        return result;
+    }
+
+    /// \brief Обходит столбцы double ядром NEON по две строки.
+    ///
+    /// \param values Значения агрегируемого поля.
+    /// \param filter Значения поля, на которое наложено условие.
+    /// \param count Количество строк.
+    /// \param predicate Условие отбора.
+    ///
+    /// \return Агрегаты отобранных строк.
+    [[nodiscard]]
+    inline ScanResult<double> ScanEngine::scan_neon(
+            const double* values, const double* filter, const size_t& count,
+            const ScanPredicate<double>& predicate) noexcept {
+        const float64x2_t value{ vdupq_n_f64(predicate.value_) };
+        const float64x2_t high{ vdupq_n_f64(predicate.high_) };
+        const float64x2_t min_fill{ vdupq_n_f64(std::numeric_limits<double>::max()) };
+        const float64x2_t max_fill{ vdupq_n_f64(std::numeric_limits<double>::lowest()) };
+        float64x2_t sum{ vdupq_n_f64(0.0) };
+        float64x2_t min{ min_fill }, max{ max_fill };
+        uint64_t matched{};
+
+        size_t row{};
+        for (; row + 2 <= count; row += 2) {
+            const float64x2_t x{ vld1q_f64(filter + row) };
+            const float64x2_t v{ vld1q_f64(values + row) };
+            const uint64x2_t mask{ match_neon(x, predicate.op_, value, high) };
+            matched += vaddvq_u64(vshrq_n_u64(mask, 63));
+            sum = vaddq_f64(sum, vbslq_f64(mask, v, vdupq_n_f64(0.0)));
+            // vminnm/vmaxnm возвращают число, если второй операнд NaN.
+            min = vminnmq_f64(min, vbslq_f64(mask, v, min_fill));
+            max = vmaxnmq_f64(max, vbslq_f64(mask, v, max_fill));
+        }
+
+        ScanResult<double> result;
+        result.count_ = matched;
+        result.sum_ = vaddvq_f64(sum);
+        result.min_ = vminnmvq_f64(min);
+        result.max_ = vmaxnmvq_f64(max);
+        result.merge(scan_scalar(values + row, filter + row, count - row, predicate));
+        return result;
+    }
+#endif
+
+    /// \brief Обходит часть столбцов ядром выбранного набора инструкций.
+    ///
+    /// \param values Значения агрегируемого поля.
+    /// \param filter Значения поля, на которое наложено условие.
+    /// \param count Количество строк.
+    /// \param predicate Условие отбора.
+    ///
+    /// \return Агрегаты отобранных строк.
+    template <class T>
+    [[nodiscard]]
+    ScanResult<T> ScanEngine::scan_range(const T* values, const T* filter,
+                                         const size_t& count,
+                                         const ScanPredicate<T>& predicate)
+    const noexcept {
+        if constexpr (std::is_same_v<T, int32_t> || std::is_same_v<T, double>) {
+#if defined(SCANENGINE_HAS_AVX2)
+            if (this->level_ == SimdLevel::AVX2)
+                return scan_avx2(values, filter, count, predicate);
+#elif defined(SCANENGINE_HAS_NEON)
+            if (this->level_ == SimdLevel::NEON)
+                return scan_neon(values, filter, count, predicate);
+#endif
+        }
+        return scan_scalar(values, filter, count, predicate);
+    }
+
+// PUBLIC
+
+    /// \brief Стандартный конструктор экземпляра класса ScanEngine.
+    ///
+    /// Набор инструкций определяется detect().
+    ///
+    /// \param pool Пул потоков для обхода больших столбцов или nullptr.
+    inline ScanEngine::ScanEngine(ThreadPool* pool) noexcept :
+            level_(detect()), pool_(pool) { }
+
+    /// \brief Конструктор экземпляра класса с выбором набора инструкций.
+    ///
+    /// Набор, который процессор не поддерживает, заменяется обычным
+    /// циклом.
+    ///
+    /// \param level Желаемый набор инструкций.
+    /// \param pool Пул потоков для обхода больших столбцов или nullptr.
+    [[maybe_unused]]
+    inline ScanEngine::ScanEngine(const SimdLevel& level, ThreadPool* pool) noexcept :
+            level_((level == detect()) ? level : SimdLevel::SCALAR), pool_(pool) { }
+
+    /// \brief Определяет лучший набор инструкций, доступный процессору.
+    ///
+    /// \return Набор инструкций.
+    [[nodiscard]]
+    inline SimdLevel ScanEngine::detect() noexcept {
+#if defined(SCANENGINE_HAS_AVX2)
+        return __builtin_cpu_supports("avx2") ? SimdLevel::AVX2 : SimdLevel::SCALAR;
+#elif defined(SCANENGINE_HAS_NEON)
+        return SimdLevel::NEON;
+#else
+        return SimdLevel::SCALAR;
+#endif
+    }
+
+    /// \brief Предоставляет доступ к используемому набору инструкций.
+    ///
+    /// \return Набор инструкций.
+    [[nodiscard]] [[maybe_unused]]
+    inline SimdLevel ScanEngine::level() const noexcept {
+        return this->level_;
+    }
+
+    /// \brief Агрегирует значения строк, отобранных условием на другой
+    /// столбец.
+    ///
+    /// \param values Значения агрегируемого поля.
+    /// \param filter Значения поля, на которое наложено условие, той же
+    /// длины.
+    /// \param predicate Условие отбора.
+    ///
+    /// \return Агрегаты отобранных строк.
+    ///
+    /// \throw std::invalid_argument Исключение возбуждается, если столбцы
+    /// разной длины.
+    template <class T>
+    [[nodiscard]]
+    ScanResult<T> ScanEngine::scan(std::span<const T> values,
+                                   std::span<const std::type_identity_t<T>> filter,
+                                   const ScanPredicate<std::type_identity_t<T>>& predicate)
+                                   const {
+        static_assert(std::is_arithmetic_v<T>, "Scan columns must be numeric.");
+        if (values.size() != filter.size())
+            throw std::invalid_argument("Scanned columns differ in length.");
+
+        const size_t count{ values.size() };
+        if (this->pool_ == nullptr || count < PARALLEL_MIN_ROWS)
+            return this->scan_range(values.data(), filter.data(), count, predicate);
+
+        const size_t task_count{ this->pool_->size() * TASKS_PER_THREAD };
+        std::vector<ScanResult<T>> partial(task_count);
+        this->pool_->run(task_count, [&](size_t task) {
+            const size_t from{ count * task / task_count };
+            const size_t to{ count * (task + 1) / task_count };
+            partial[task] = this->scan_range(values.data() + from, filter.data() + from,
+                                             to - from, predicate);
+        });
+        ScanResult<T> result;
+        for (const auto& part : partial)
+            result.merge(part);
+        return result;
+    }
+
+    /// \brief Агрегирует значения столбца, отобранные условием на него же.
+    ///
+    /// \param values Значения поля.
+    /// \param predicate Условие отбора; по умолчанию отбираются все строки.
+    ///
+    /// \return Агрегаты отобранных строк.
+    template <class T>
+    [[nodiscard]] [[maybe_unused]]
+    ScanResult<T> ScanEngine::scan(std::span<const T> values,
+                                   const ScanPredicate<std::type_identity_t<T>>& predicate)
+                                   const {
+        return this->scan(values, values, predicate);
+    }
+
+    /// \brief Агрегирует значения изменяемого столбца, например
+    /// ColumnarTable::column(), отобранные условием на другой столбец
+    /// (см. scan(std::span<const T>, std::span<const T>,
+    /// const ScanPredicate<T>&)).
+    template <class T>
+    requires (!std::is_const_v<T>)
+    [[nodiscard]] [[maybe_unused]]
+    ScanResult<T> ScanEngine::scan(std::span<T> values,
+                                   std::span<const std::type_identity_t<T>> filter,
+                                   const ScanPredicate<std::type_identity_t<T>>& predicate)
+                                   const {
+        return this->scan(std::span<const T>(values), filter, predicate);
+    }
+
+    /// \brief Агрегирует значения изменяемого столбца, отобранные
+    /// условием на него же (см. scan(std::span<const T>,
+    /// const ScanPredicate<T>&)).
+    template <class T>
+    requires (!std::is_const_v<T>)
+    [[nodiscard]] [[maybe_unused]]
+    ScanResult<T> ScanEngine::scan(std::span<T> values,
+                                   const ScanPredicate<std::type_identity_t<T>>& predicate)
+                                   const {
+        return this->scan(std::span<const T>(values), predicate);
+    }
+
+    /// \brief Выполняет запрос к таблице ColumnarTable: агрегаты поля field
+    /// по строкам, в которых поле filter_field удовлетворяет условию.
+    ///
+    /// \param table Таблица.
+    /// \param field Имя агрегируемого поля.
+    /// \param filter_field Имя поля, на которое наложено условие.
+    /// \param predicate Условие отбора; по умолчанию отбираются все строки.
+    ///
+    /// \return Агрегаты отобранных строк.
+    ///
+    /// \throw std::out_of_range Исключение возбуждается, если поля нет в
+    /// схеме таблицы.
+    template <class T, class S, class H>
+    [[nodiscard]] [[maybe_unused]]
+    ScanResult<T> ScanEngine::query(const ColumnarTable<T, S, H>& table,
+                                    std::string_view field,
+                                    std::string_view filter_field,
+                                    const ScanPredicate<T>& predicate) const {
+        return this->scan(table.column(field), table.column(filter_field), predicate);
+    }
+}
+
+#endif
@@ -0,0 +1,827 @@
+/// \file snapshot.hpp.
+/// \author Лошкарев Дмитрий.
+/// \date 14.10.2026.
+///
+/// \brief Содержит двоичный формат снимка хеш-таблицы и таблицу, читающую
+/// снимок прямо из отображенного в память файла.
+///
+/// \namespaces
+/// • DataStructures
+/// \classes
+/// • MappedFile
+/// • MappedOrderedHashTable
+
+#ifndef CPPPROJECT_SNAPSHOT_H
+#define CPPPROJECT_SNAPSHOT_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#ifdef _WIN32
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+#include "orderhashtable.hpp"
+
+namespace DataStructures {
+// Вспомогательные функции.
+
+    /// \brief Сбрасывает содержимое файла на диск (fsync).
+    ///
+    /// \param path Путь к файлу.
+    ///
+    /// \throw std::runtime_error Исключение возбуждается, если файл не
+    /// удалось открыть или сбросить.
+    inline void flush_to_disk(const std::filesystem::path& path) {
+        bool synced;
+#ifdef _WIN32
+        HANDLE file{ CreateFileW(path.c_str(), GENERIC_WRITE, FILE_SHARE_READ |
+                                 FILE_SHARE_WRITE, nullptr, OPEN_EXISTING,
+                                 FILE_ATTRIBUTE_NORMAL, nullptr) };
+        synced = file != INVALID_HANDLE_VALUE && FlushFileBuffers(file);
+        if (file != INVALID_HANDLE_VALUE)
+            CloseHandle(file);
+#else
+        int descriptor{ open(path.c_str(), O_WRONLY) };
+        synced = descriptor >= 0 && fsync(descriptor) == 0;
+        if (descriptor >= 0)
+            synced = close(descriptor) == 0 && synced;
+#endif
+        if (!synced)
+            throw std::runtime_error("Cannot flush \"" + path.string() + "\" to disk.");
+    }
+
+    /// \brief Сбрасывает на диск каталог, чтобы созданные, переименованные
+    /// и удаленные в нем файлы пережили сбой.
+    ///
+    /// В Windows изменения каталога записываются журналом файловой системы,
+    /// и функция ничего не делает.
+    ///
+    /// \param path Путь к каталогу; пустой путь означает текущий каталог.
+    ///
+    /// \throw std::runtime_error Исключение возбуждается, если каталог не
+    /// удалось открыть или сбросить.
+    inline void flush_directory(const std::filesystem::path& path) {
+#ifndef _WIN32
+        const std::filesystem::path directory{ path.empty() ? "." : path };
+        int descriptor{ open(directory.c_str(), O_RDONLY | O_DIRECTORY) };
+        bool synced{ descriptor >= 0 && fsync(descriptor) == 0 };
+        if (descriptor >= 0)
+            synced = close(descriptor) == 0 && synced;
+        if (!synced)
+            throw std::runtime_error("Cannot flush directory \"" + directory.string() +
+                                     "\" to disk.");
+#else
+        static_cast<void>(path);
+#endif
+    }
+
+// Объявление классов.
+
+    /// \class Класс MappedFile предоставляет файл, отображенный в память
+    /// только для чтения.
+    ///
+    /// Страницы файла подгружаются операционной системой при первом
+    /// обращении, поэтому открытие не зависит от размера файла.
+    ///
+    /// Публичные методы:
+    /// \n • const std::byte* data() const noexcept
+    /// \n • size_t size() const noexcept
+    class MappedFile {
+        private:
+            const std::byte* data_;
+            size_t size_;
+#ifdef _WIN32
+            HANDLE file_;
+            HANDLE mapping_;
+#endif
+
+            void release() noexcept;
+        public:
+            explicit MappedFile(const std::filesystem::path&);
+            MappedFile(const MappedFile&) = delete;
+            MappedFile(MappedFile&&) noexcept;
+            MappedFile& operator = (const MappedFile&) = delete;
+            MappedFile& operator = (MappedFile&&) noexcept;
+            ~MappedFile();
+
+            [[nodiscard]]
+            inline const std::byte* data() const noexcept;
+            [[nodiscard]]
+            inline size_t size() const noexcept;
+    };
+
+    /// \class Класс MappedOrderedHashTable предоставляет доступ только
+    /// для чтения к снимку хеш-таблицы OrderedHashTable, записанному
+    /// методом save.
+    ///
+    /// Снимок устроен так, чтобы по нему можно было искать прямо в
+    /// отображенном файле, без разбора записей и выделения памяти:
+    /// \n • заголовок с версией формата и параметрами типов;
+    /// \n • плоский индекс открытой адресации: ячейки из номера записи и
+    /// младших 32 бит хеша, линейное пробирование;
+    /// \n • массив записей в порядке добавления: полный хеш, ссылка на ключ
+    /// и значение (trivially copyable значение хранится на месте, строка -
+    /// ссылкой в кучу);
+    /// \n • куча строк с байтами ключей и строковых значений.
+    ///
+    /// Открытие проверяет только заголовок и границы разделов, поэтому
+    /// занимает постоянное время; границы ссылок в кучу проверяются при
+    /// обращении к ним. Снимок записывается во временный файл, который
+    /// затем переименовывается, так что прерванная запись не портит
+    /// прежний снимок. Числа записываются в порядке байтов машины, снимок с
+    /// другим порядком байтов не открывается.
+    ///
+    /// Публичные методы:
+    /// \n • static void save(const OrderedHashTable<HashType, StoragePolicy,
+    /// Hasher, Allocator>& table, const std::filesystem::path& path);
+    /// \n • static MappedOrderedHashTable open_mapped(
+    /// const std::filesystem::path& path);
+    /// \n • ValueView get(std::string_view key) const;
+    /// \n • bool contains(std::string_view key) const;
+    /// \n • size_t length() const noexcept;
+    /// \n • Iterator begin() const noexcept
+    /// \n • Iterator end() const noexcept
+    ///
+    /// \tparam HashType Тип значений: trivially copyable тип или
+    /// std::string.
+    /// \tparam Hasher Функция хеширования ключей, с которой была записана
+    /// таблица.
+    template <class HashType, class Hasher = WyHasher>
+    class MappedOrderedHashTable {
+        private:
+            static inline constexpr bool IS_STRING_VALUE{
+                    std::is_same_v<HashType, std::string> };
+
+            static_assert(IS_STRING_VALUE || std::is_trivially_copyable_v<HashType>,
+                          "Snapshot values must be trivially copyable or std::string.");
+
+            static inline constexpr char MAGIC[8]{ 'O', 'H', 'T', 'S', 'N', 'A', 'P', '\0' };
+            static inline constexpr uint32_t VERSION{ 1 };                   ///< \brief Версия формата снимка.
+            static inline constexpr uint32_t BYTE_ORDER_MARK{ 0x01020304 };  ///< \brief Метка порядка байтов.
+            static inline constexpr size_t MIN_SLOT_COUNT{ 16 };             ///< \brief Минимальное число ячеек индекса.
+            static inline constexpr size_t MAX_RECORD_COUNT{
+                    std::numeric_limits<uint32_t>::max() };  ///< \brief Наибольшее число записей:
+                                                             ///< номер записи + 1 хранится в
+                                                             ///< 32-битном поле ячейки.
+            static inline constexpr std::string_view HASHER_PROBE{ "snapshot" };  ///< \brief Ключ для проверки
+                                                                                  ///< функции хеширования.
+
+            /// \class Структура StringRef описывает строку в куче снимка.
+            struct StringRef {
+                uint64_t offset_;
+                uint64_t length_;
+            };
+
+            using StoredValue = std::conditional_t<IS_STRING_VALUE, StringRef, HashType>;
+
+            /// \class Структура Header описывает заголовок снимка.
+            struct Header {
+                char magic_[8];
+                uint32_t version_;
+                uint32_t byte_order_;
+                uint64_t value_size_;     ///< \brief sizeof значения или 0 для строк.
+                uint64_t hasher_check_;   ///< \brief Хеш HASHER_PROBE.
+                uint64_t record_count_;
+                uint64_t slot_count_;
+                uint64_t records_offset_;
+                uint64_t heap_offset_;
+                uint64_t heap_size_;
+            };
+
+            /// \class Структура Slot описывает ячейку индекса.
+            struct Slot {
+                uint32_t record_;  ///< \brief Номер записи + 1 или 0 для пустой ячейки.
+                uint32_t tag_;     ///< \brief Младшие 32 бита хеша ключа.
+            };
+
+            /// \class Структура Entry описывает запись снимка.
+            struct Entry {
+                uint64_t hash_;
+                StringRef key_;
+                StoredValue value_;
+            };
+
+            MappedFile file_;
+            const Header* header_;
+            const Slot* slots_;
+            const Entry* entries_;
+            const char* heap_;
+            Hasher hasher_;
+
+            explicit MappedOrderedHashTable(MappedFile&&);
+
+            [[nodiscard]]
+            static inline size_t align_up(const size_t&, const size_t&) noexcept;
+            static void check_header(const Header&, const uint64_t&);
+            template <class StoragePolicy, class Allocator>
+            static void build_index(const OrderedHashTable<HashType, StoragePolicy,
+                                                           Hasher, Allocator>&,
+                                    Header&, std::vector<Slot>&, std::vector<Entry>&);
+            [[nodiscard]]
+            std::string_view string_at(const StringRef&) const;
+            [[nodiscard]]
+            const Entry* find(std::string_view) const;
+
+            template <class, class>
+            friend class AsyncSnapshot;
+        public:
+            using ValueView = std::conditional_t<IS_STRING_VALUE, std::string_view,
+                                                 const HashType&>;
+
+            /// \class Класс Iterator предоставляет объект-итератор по парам
+            /// "ключ - значение" снимка в порядке добавления.
+            ///
+            /// Публичные методы:
+            /// \n • Iterator& operator ++ () noexcept
+            /// \n • Iterator operator ++ (int) noexcept
+            /// \n • bool operator != (const Iterator& iterator) noexcept
+            /// \n • std::pair<std::string_view, ValueView> operator * () const
+            class Iterator {
+                private:
+                    const MappedOrderedHashTable* table_;
+                    const Entry* entry_;
+                public:
+                    Iterator(const MappedOrderedHashTable*, const Entry*) noexcept;
+
+                    Iterator& operator ++ () noexcept;
+                    Iterator operator ++ (int) noexcept;
+                    bool operator != (const Iterator&) noexcept;
+                    std::pair<std::string_view, ValueView> operator * () const;
+            };
+
+            template <class StoragePolicy, class Allocator>
+            [[maybe_unused]]
+            static void save(const OrderedHashTable<HashType, StoragePolicy,
+                                                    Hasher, Allocator>& table,
+                             const std::filesystem::path& path);
+            [[nodiscard]] [[maybe_unused]]
+            static MappedOrderedHashTable open_mapped(const std::filesystem::path& path);
+
+            [[nodiscard]]
+            ValueView get(std::string_view key) const;
+            [[nodiscard]] [[maybe_unused]]
+            bool contains(std::string_view key) const;
+            [[nodiscard]] [[maybe_unused]]
+            inline size_t length() const noexcept;
+            inline Iterator begin() const noexcept;
+            inline Iterator end() const noexcept;
+    };
+
+// Определения методов классов.
+/* =============================== MappedFile =============================== */
+// PRIVATE
+
+    // Снимает отображение и закрывает файл.
+    inline void MappedFile::release() noexcept {
+#ifdef _WIN32
+        if (this->data_ != nullptr)
+            UnmapViewOfFile(this->data_);
+        if (this->mapping_ != nullptr)
+            CloseHandle(this->mapping_);
+        if (this->file_ != INVALID_HANDLE_VALUE)
+            CloseHandle(this->file_);
+        this->mapping_ = nullptr;
+        this->file_ = INVALID_HANDLE_VALUE;
+#else
+        if (this->data_ != nullptr)
+            munmap(const_cast<std::byte*>(this->data_), this->size_);
+#endif
+        this->data_ = nullptr;
+        this->size_ = 0;
+    }
+
+// PUBLIC
+
+    /// \brief Стандартный конструктор экземпляра класса MappedFile.
+    ///
+    /// \param path Путь к файлу.
+    ///
+    /// \throw std::runtime_error Исключение возбуждается, если файл не
+    /// удалось открыть или отобразить в память.
+    inline MappedFile::MappedFile(const std::filesystem::path& path) :
+            data_(nullptr), size_(0)
+#ifdef _WIN32
+            , file_(INVALID_HANDLE_VALUE), mapping_(nullptr)
+#endif
+    {
+        const std::string error{ "Cannot map file \"" + path.string() + "\"." };
+#ifdef _WIN32
+        this->file_ = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ,
+                                  nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL,
+                                  nullptr);
+        LARGE_INTEGER size;
+        if (this->file_ == INVALID_HANDLE_VALUE || !GetFileSizeEx(this->file_, &size)) {
+            this->release();
+            throw std::runtime_error(error);
+        }
+        this->size_ = static_cast<size_t>(size.QuadPart);
+        if (this->size_ == 0)
+            return;
+        this->mapping_ = CreateFileMappingW(this->file_, nullptr, PAGE_READONLY,
+                                            0, 0, nullptr);
+        if (this->mapping_ != nullptr)
+            this->data_ = static_cast<const std::byte*>(
+                    MapViewOfFile(this->mapping_, FILE_MAP_READ, 0, 0, 0));
+        if (this->data_ == nullptr) {
+            this->release();
+            throw std::runtime_error(error);
+        }
+#else
+        int descriptor{ open(path.c_str(), O_RDONLY) };
+        if (descriptor < 0)
+            throw std::runtime_error(error);
+        struct stat status{};
+        if (fstat(descriptor, &status) != 0) {
+            close(descriptor);
+            throw std::runtime_error(error);
+        }
+        size_t size{ static_cast<size_t>(status.st_size) };
+        if (size != 0) {
+            void* data{ mmap(nullptr, size, PROT_READ, MAP_PRIVATE, descriptor, 0) };
+            if (data == MAP_FAILED) {
+                close(descriptor);
+                throw std::runtime_error(error);
+            }
+            // Поиск по индексу обращается к страницам вразнобой.
+            static_cast<void>(madvise(data, size, MADV_RANDOM));
+            this->data_ = static_cast<const std::byte*>(data);
+            this->size_ = size;
+        }
+        // Отображение остается действительным и после закрытия файла.
+        close(descriptor);
+#endif
+    }
+
+    /// \brief Конструктор перемещения экземпляра класса MappedFile.
+    ///
+    /// \param other Перемещаемое отображение.
+    inline MappedFile::MappedFile(MappedFile&& other) noexcept :
+            data_(std::exchange(other.data_, nullptr)),
+            size_(std::exchange(other.size_, 0))
+#ifdef _WIN32
+            , file_(std::exchange(other.file_, INVALID_HANDLE_VALUE)),
+            mapping_(std::exchange(other.mapping_, nullptr))
+#endif
+    { }
+
+    /// \brief Оператор присваивания перемещением.
+    ///
+    /// \param other Перемещаемое отображение.
+    ///
+    /// \return Ссылку на текущий экземпляр.
+    inline MappedFile& MappedFile::operator = (MappedFile&& other) noexcept {
+        if (this == &other)
+            return *this;
+        this->release();
+        this->data_ = std::exchange(other.data_, nullptr);
+        this->size_ = std::exchange(other.size_, 0);
+#ifdef _WIN32
+        this->file_ = std::exchange(other.file_, INVALID_HANDLE_VALUE);
+        this->mapping_ = std::exchange(other.mapping_, nullptr);
+#endif
+        return *this;
+    }
+
+    // Стандартный деструктор экземпляра.
+    inline MappedFile::~MappedFile() {
+        this->release();
+    }
+
+    /// \brief Предоставляет доступ к содержимому файла.
+    ///
+    /// \return Указатель на первый байт или nullptr для пустого файла.
+    [[nodiscard]]
+    inline const std::byte* MappedFile::data() const noexcept {
+        return this->data_;
+    }
+
+    /// \brief Предоставляет доступ к размеру файла.
+    ///
+    /// \return Размер в байтах.
+    [[nodiscard]]
+    inline size_t MappedFile::size() const noexcept {
+        return this->size_;
+    }
+
+/* ======================== MappedOrderedHashTable ======================== */
+// PRIVATE
+
+    /// \brief Конструктор экземпляра класса по отображенному файлу снимка.
+    ///
+    /// \param file Отображенный файл.
+    ///
+    /// \throw std::runtime_error Исключение возбуждается, если файл не
+    /// является снимком таблицы с такими же типами.
+    template <class T, class H>
+    MappedOrderedHashTable<T, H>::MappedOrderedHashTable(MappedFile&& file) :
+            file_(std::move(file)), header_(nullptr), slots_(nullptr),
+            entries_(nullptr), heap_(nullptr), hasher_() {
+        const std::byte* data{ this->file_.data() };
+        const size_t size{ this->file_.size() };
+        if (size < sizeof(Header))
+            throw std::runtime_error("Snapshot file is truncated.");
+
+        this->header_ = reinterpret_cast<const Header*>(data);
+        const Header& header{ *this->header_ };
+        check_header(header, size);
+
+        this->slots_ = reinterpret_cast<const Slot*>(data + sizeof(Header));
+        this->entries_ = reinterpret_cast<const Entry*>(data + header.records_offset_);
+        this->heap_ = reinterpret_cast<const char*>(data + header.heap_offset_);
+    }
+
+    /// \brief Округляет смещение вверх до кратного выравниванию.
+    ///
+    /// \param offset Смещение.
+    /// \param alignment Выравнивание.
+    ///
+    /// \return Выровненное смещение.
+    template <class T, class H>
+    [[nodiscard]]
+    inline size_t MappedOrderedHashTable<T, H>::align_up(const size_t& offset,
+                                                         const size_t& alignment)
+    noexcept {
+        return (offset + alignment - 1) / alignment * alignment;
+    }
+
+    /// \brief Проверяет заголовок снимка и границы его разделов.
+    ///
+    /// \param header Заголовок снимка.
+    /// \param size Размер файла снимка в байтах.
+    ///
+    /// \throw std::runtime_error Исключение возбуждается, если файл не
+    /// является снимком таблицы с такими же типами или обрезан.
+    template <class T, class H>
+    void MappedOrderedHashTable<T, H>::check_header(const Header& header,
+                                                    const uint64_t& size) {
+        if (std::memcmp(header.magic_, MAGIC, sizeof(MAGIC)) != 0)
+            throw std::runtime_error("File is not a table snapshot.");
+        if (header.version_ != VERSION || header.byte_order_ != BYTE_ORDER_MARK)
+            throw std::runtime_error("Snapshot format version or byte order is "
+                                     "not supported.");
+        if (header.value_size_ != (IS_STRING_VALUE ? 0 : sizeof(T)))
+            throw std::runtime_error("Snapshot was written for another value type.");
+        if (header.hasher_check_ != H()(HASHER_PROBE))
+            throw std::runtime_error("Snapshot was written with another hasher.");
+
+        // Разделы должны идти по порядку и умещаться в файл.
+        bool valid{ header.slot_count_ > header.record_count_ &&
+                    header.slot_count_ <= (size - sizeof(Header)) / sizeof(Slot) &&
+                    header.records_offset_ % alignof(Entry) == 0 &&
+                    header.records_offset_ >= sizeof(Header) +
+                                              header.slot_count_ * sizeof(Slot) &&
+                    header.records_offset_ <= size &&
+                    header.record_count_ <= (size - header.records_offset_) /
+                                             sizeof(Entry) &&
+                    header.heap_offset_ >= header.records_offset_ +
+                                           header.record_count_ * sizeof(Entry) &&
+                    header.heap_offset_ <= size &&
+                    header.heap_size_ <= size - header.heap_offset_ };
+        if (!valid)
+            throw std::runtime_error("Snapshot file is truncated or corrupted.");
+    }
+
+    /// \brief Позволяет получить строку из кучи снимка.
+    ///
+    /// \param ref Ссылка на строку.
+    ///
+    /// \return Срез строки в отображенном файле.
+    ///
+    /// \throw std::runtime_error Исключение возбуждается, если ссылка
+    /// выходит за пределы кучи.
+    template <class T, class H>
+    [[nodiscard]]
+    std::string_view MappedOrderedHashTable<T, H>::string_at(const StringRef& ref) const {
+        if (ref.offset_ > this->header_->heap_size_ ||
+            ref.length_ > this->header_->heap_size_ - ref.offset_)
+            throw std::runtime_error("Snapshot file is corrupted.");
+        return { this->heap_ + ref.offset_, static_cast<size_t>(ref.length_) };
+    }
+
+    /// \brief Заполняет заголовок, индекс и массив записей снимка таблицы.
+    ///
+    /// Используются сохраненные в записях хеши, ключи повторно не
+    /// хешируются. Куча строк не собирается: ее байты - ключи (и строковые
+    /// значения) записей подряд в порядке добавления.
+    ///
+    /// \param table Хеш-таблица.
+    /// \param header Заполняемый заголовок.
+    /// \param slots Заполняемый индекс.
+    /// \param entries Заполняемый массив записей.
+    ///
+    /// \throw std::runtime_error Исключение возбуждается, если записей
+    /// больше MAX_RECORD_COUNT.
+    template <class T, class H>
+    template <class S, class A>
+    void MappedOrderedHashTable<T, H>::build_index(const OrderedHashTable<T, S, H, A>& table,
+                                                   Header& header, std::vector<Slot>& slots,
+                                                   std::vector<Entry>& entries) {
+        const size_t record_count{ table.record_count_ };
+        const size_t slot_count{ std::max(MIN_SLOT_COUNT, record_count * 2) };
+
+        std::memcpy(header.magic_, MAGIC, sizeof(MAGIC));
+        header.version_ = VERSION;
+        header.byte_order_ = BYTE_ORDER_MARK;
+        header.value_size_ = IS_STRING_VALUE ? 0 : sizeof(T);
+        header.hasher_check_ = table.hasher_(HASHER_PROBE);
+        header.record_count_ = record_count;
+        header.slot_count_ = slot_count;
+        header.records_offset_ = align_up(sizeof(Header) + slot_count * sizeof(Slot),
+                                          alignof(Entry));
+        header.heap_offset_ = header.records_offset_ + record_count * sizeof(Entry);
+
+        // Индекс и записи собираются в памяти, куча пишется потоком.
+        slots.assign(slot_count, Slot{ 0, 0 });
+        entries.clear();
+        entries.reserve(record_count);
+        uint64_t heap_size{};
+        for (auto* record : table.order_) {
+            if (record == nullptr)
+                continue;
+            if (entries.size() == MAX_RECORD_COUNT)
+                throw std::runtime_error("Snapshot cannot hold more than 2^32 - 1 "
+                                         "records.");
+            // Entry пишется в файл целиком, поэтому выравнивание между
+            // полями (например, после 4-байтового значения) обнуляется:
+            // иначе в снимок попадало бы содержимое кучи, и снимки одной
+            // таблицы различались бы.
+            Entry entry;
+            std::memset(&entry, 0, sizeof(entry));
+            entry.hash_ = record->hash_;
+            entry.key_ = StringRef{ heap_size, record->key_.size() };
+            heap_size += entry.key_.length_;
+            if constexpr (IS_STRING_VALUE) {
+                entry.value_ = StringRef{ heap_size, record->value_.size() };
+                heap_size += record->value_.size();
+            }
+            else
+                entry.value_ = record->value_;
+            entries.push_back(entry);
+
+            size_t slot{ bucket_index(record->hash_, slot_count) };
+            while (slots[slot].record_ != 0)
+                slot = (slot + 1 == slot_count) ? 0 : slot + 1;
+            slots[slot] = { static_cast<uint32_t>(entries.size()),
+                            static_cast<uint32_t>(record->hash_) };
+        }
+        header.heap_size_ = heap_size;
+    }
+
+    /// \brief Ищет запись с указанным ключом по индексу снимка.
+    ///
+    /// \param key Строковый ключ записи.
+    ///
+    /// \return Указатель на запись или nullptr, если ее нет.
+    ///
+    /// \throw std::runtime_error Исключение возбуждается, если индекс
+    /// снимка поврежден.
+    template <class T, class H>
+    [[nodiscard]]
+    const MappedOrderedHashTable<T, H>::Entry* MappedOrderedHashTable<T, H>::find(
+            std::string_view key) const {
+        const uint64_t hash{ this->hasher_(key) };
+        const auto tag{ static_cast<uint32_t>(hash) };
+        const size_t slot_count{ static_cast<size_t>(this->header_->slot_count_) };
+        size_t slot{ bucket_index(hash, slot_count) };
+
+        // В целом снимке хотя бы одна ячейка пуста, но заголовок этого не
+        // гарантирует: поврежденный индекс без пустых ячеек зациклил бы
+        // поиск, поэтому пробирование ограничено числом ячеек.
+        for (size_t probe{}; this->slots_[slot].record_ != 0; probe++) {
+            if (probe == slot_count)
+                throw std::runtime_error("Snapshot file is corrupted.");
+            if (this->slots_[slot].tag_ == tag) {
+                size_t record{ this->slots_[slot].record_ - size_t{ 1 } };
+                if (record >= this->header_->record_count_)
+                    throw std::runtime_error("Snapshot file is corrupted.");
+                const Entry* entry{ this->entries_ + record };
+                if (entry->hash_ == hash && this->string_at(entry->key_) == key)
+                    return entry;
+            }
+            slot = (slot + 1 == slot_count) ? 0 : slot + 1;
+        }
+        return nullptr;
+    }
+
+// PUBLIC
+
+    /// \brief Записывает снимок хеш-таблицы в файл.
+    ///
+    /// Файл сначала пишется рядом с расширением ".tmp", сбрасывается на
+    /// диск и только затем заменяет прежний; после переименования
+    /// сбрасывается и каталог. Когда метод вернул управление, снимок
+    /// переживет сбой питания.
+    ///
+    /// \param table Хеш-таблица.
+    /// \param path Путь к файлу снимка.
+    ///
+    /// \throw std::runtime_error Исключение возбуждается при ошибке записи
+    /// или если записей больше, чем вмещает формат.
+    template <class T, class H>
+    template <class S, class A>
+    [[maybe_unused]]
+    void MappedOrderedHashTable<T, H>::save(const OrderedHashTable<T, S, H, A>& table,
+                                            const std::filesystem::path& path) {
+        Header header{};
+        std::vector<Slot> slots;
+        std::vector<Entry> entries;
+        build_index(table, header, slots, entries);
+        const size_t record_count{ entries.size() };
+        const size_t slot_count{ slots.size() };
+
+        std::filesystem::path temp_path{ path };
+        temp_path += ".tmp";
+        {
+            std::ofstream out{ temp_path, std::ios::binary | std::ios::trunc };
+            if (!out)
+                throw std::runtime_error("Cannot write snapshot \"" +
+                                         temp_path.string() + "\".");
+            out.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+            out.write(reinterpret_cast<const char*>(slots.data()),
+                      static_cast<std::streamsize>(slot_count * sizeof(Slot)));
+            const size_t padding{ header.records_offset_ - sizeof(Header) -
+                                  slot_count * sizeof(Slot) };
+            const char zeros[alignof(Entry)]{};
+            out.write(zeros, static_cast<std::streamsize>(padding));
+            out.write(reinterpret_cast<const char*>(entries.data()),
+                      static_cast<std::streamsize>(record_count * sizeof(Entry)));
+            for (auto* record : table.order_) {
+                if (record == nullptr)
+                    continue;
+                out.write(record->key_.data(),
+                          static_cast<std::streamsize>(record->key_.size()));
+                if constexpr (IS_STRING_VALUE)
+                    out.write(record->value_.data(),
+                              static_cast<std::streamsize>(record->value_.size()));
+            }
+            out.close();
+            if (!out)
+                throw std::runtime_error("Cannot write snapshot \"" +
+                                         temp_path.string() + "\".");
+        }
+        flush_to_disk(temp_path);
+        std::filesystem::rename(temp_path, path);
+        flush_directory(path.parent_path());
+    }
+
+    /// \brief Открывает снимок, отображая файл в память.
+    ///
+    /// \param path Путь к файлу снимка.
+    ///
+    /// \return Таблицу, читающую данные прямо из файла.
+    ///
+    /// \throw std::runtime_error Исключение возбуждается, если файл не
+    /// удалось открыть или он не является снимком таблицы с такими же
+    /// типами.
+    template <class T, class H>
+    [[nodiscard]] [[maybe_unused]]
+    MappedOrderedHashTable<T, H> MappedOrderedHashTable<T, H>::open_mapped(
+            const std::filesystem::path& path) {
+        return MappedOrderedHashTable(MappedFile(path));
+    }
+
+    /// \brief Метод, позволяющий получить значение элемента по ключу.
+    ///
+    /// В случае ненахождения элемента будет возвращено стандартное значение.
+    /// Значение не копируется: оно читается прямо из файла и действительно,
+    /// пока снимок открыт.
+    ///
+    /// \param key Строковый ключ, значение по которому нужно найти.
+    ///
+    /// \return Значение ключа (срез строки для строковых значений) или
+    /// стандартное значение.
+    template <class T, class H>
+    [[nodiscard]]
+    MappedOrderedHashTable<T, H>::ValueView MappedOrderedHashTable<T, H>::get(
+            std::string_view key) const {
+        const Entry* entry{ this->find(key) };
+        if constexpr (IS_STRING_VALUE)
+            return (entry != nullptr) ? this->string_at(entry->value_)
+                                      : std::string_view{};
+        else {
+            // Дефолтное значение.
+            static const T DEFAULT_VALUE{};
+            return (entry != nullptr) ? entry->value_ : DEFAULT_VALUE;
+        }
+    }
+
+    /// \brief Проверяет, есть ли в снимке элемент с указанным ключом.
+    ///
+    /// \param key Строковый ключ.
+    ///
+    /// \return Булевое значение.
+    template <class T, class H>
+    [[nodiscard]] [[maybe_unused]]
+    bool MappedOrderedHashTable<T, H>::contains(std::string_view key) const {
+        return this->find(key) != nullptr;
+    }
+
+    /// \brief Предоставляет доступ к количеству элементов снимка.
+    ///
+    /// \return Значение кол-ва элементов.
+    template <class T, class H>
+    [[nodiscard]] [[maybe_unused]]
+    inline size_t MappedOrderedHashTable<T, H>::length() const noexcept {
+        return static_cast<size_t>(this->header_->record_count_);
+    }
+
+    /// \brief Создает итератор от первого добавленного элемента.
+    ///
+    /// \return Объект-итератор.
+    template <class T, class H>
+    inline MappedOrderedHashTable<T, H>::Iterator MappedOrderedHashTable<T, H>::begin()
+    const noexcept {
+        return Iterator(this, this->entries_);
+    }
+
+    /// \brief Создает итератор за последним добавленным элементом.
+    ///
+    /// \return Объект-итератор.
+    template <class T, class H>
+    inline MappedOrderedHashTable<T, H>::Iterator MappedOrderedHashTable<T, H>::end()
+    const noexcept {
+        return Iterator(this, this->entries_ + this->header_->record_count_);
+    }
+
+/* ================================ Iterator ================================ */
+
+    /// \brief Стандартный конструктор экземпляра класса
+    /// MappedOrderedHashTable::Iterator.
+    ///
+    /// \param table Снимок.
+    /// \param entry Указатель на запись снимка.
+    template <class T, class H>
+    MappedOrderedHashTable<T, H>::Iterator::Iterator(const MappedOrderedHashTable* table,
+                                                     const Entry* entry) noexcept :
+            table_(table), entry_(entry) { }
+
+    /// \brief Перемещает итератор на след. элемент.
+    ///
+    /// \return Объект-итератор.
+    template <class T, class H>
+    MappedOrderedHashTable<T, H>::Iterator&
+    MappedOrderedHashTable<T, H>::Iterator::operator ++ () noexcept {
+        this->entry_++;
+        return *this;
+    }
+
+    /// \brief Перемещает итератор на след. элемент.
+    ///
+    /// \return Объект-итератор.
+    template <class T, class H>
+    MappedOrderedHashTable<T, H>::Iterator
+    MappedOrderedHashTable<T, H>::Iterator::operator ++ (int) noexcept {
+        Iterator iterator = *this;
+        ++*this;
+        return iterator;
+    }
+
+    /// \brief Проверяет, что два объекта итератора не равны.
+    ///
+    /// \param iterator Объект-итератор для сравнения.
+    ///
+    /// \return Булевое значение.
+    template <class T, class H>
+    bool MappedOrderedHashTable<T, H>::Iterator::operator != (const Iterator& iterator)
+    noexcept {
+        return this->entry_ != iterator.entry_;
+    }
+
+    /// \brief Позволяет получить пару, на которую указывает итератор.
+    ///
+    /// \return Пару из ключа и значения элемента.
+    template <class T, class H>
+    std::pair<std::string_view, typename MappedOrderedHashTable<T, H>::ValueView>
+    MappedOrderedHashTable<T, H>::Iterator::operator * () const {
+        if constexpr (IS_STRING_VALUE)
+            return { this->table_->string_at(this->entry_->key_),
+                     this->table_->string_at(this->entry_->value_) };
+        else
+            return { this->table_->string_at(this->entry_->key_), this->entry_->value_ };
+    }
+}
+
+#endif
@@ -0,0 +1,802 @@
+/// \file sortedindex.hpp.
+/// \author Лошкарев Дмитрий.
+/// \date 14.10.2026.
+///
+/// \brief Содержит упорядоченный индекс записей (B+-дерево) для запросов
+/// по диапазону и префиксу ключей.
+///
+/// \namespaces
+/// • DataStructures
+/// \classes
+/// • SortedIndex
+
+#ifndef CPPPROJECT_SORTEDINDEX_H
+#define CPPPROJECT_SORTEDINDEX_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace DataStructures {
+// Объявление классов.
+
+    /// \class Класс SortedIndex предоставляет B+-дерево указателей на
+    /// записи, упорядоченных по ключу.
+    ///
+    /// Индекс не владеет записями и не копирует ключи: листья хранят
+    /// указатели на записи, а разделители внутренних узлов - указатели на
+    /// первые записи правых поддеревьев. Поэтому при удалении записи,
+    /// служащей разделителем, он заменяется на новую первую запись
+    /// поддерева, а само удаление не выделяет память и не возбуждает
+    /// исключений. Листья связаны в список, так что перебор диапазона
+    /// после спуска по дереву идет по соседним листьям.
+    ///
+    /// Публичные методы:
+    /// \n • void insert(RecordType* record);
+    /// \n • bool remove(KeyArgument key) noexcept;
+    /// \n • void clear() noexcept;
+    /// \n • size_t length() const noexcept;
+    /// \n • Iterator lower_bound(KeyArgument key) const noexcept;
+    /// \n • Range range(KeyArgument low, KeyArgument high) const;
+    /// \n • Range prefix(std::string_view prefix) const;
+    /// \n • Iterator begin() const noexcept
+    /// \n • Iterator end() const noexcept
+    ///
+    /// \tparam RecordType Тип записей. Метод key() записи должен
+    /// возвращать ключ, приводимый к RecordType::KeyArgument и
+    /// сравнимый оператором <; ключи записей индекса не должны
+    /// повторяться. prefix доступен только для строковых ключей.
+    /// \tparam Allocator Аллокатор узлов дерева.
+    template <class RecordType, class Allocator = std::allocator<RecordType>>
+    class SortedIndex {
+        private:
+            static inline constexpr uint32_t LEAF_CAPACITY{ 32 };   ///< \brief Максимум записей листа.
+            static inline constexpr uint32_t INNER_CAPACITY{ 32 };  ///< \brief Максимум разделителей
+                                                                    ///< внутреннего узла.
+
+            using KeyArgument = typename RecordType::KeyArgument;
+
+            /// \class Структура Node описывает общий заголовок узла дерева.
+            struct Node {
+                bool leaf_;
+                uint32_t count_;  ///< \brief Записей листа или разделителей узла.
+            };
+
+            /// \class Структура Leaf описывает лист дерева.
+            struct Leaf : Node {
+                Leaf* prev_;
+                Leaf* next_;
+                RecordType* records_[LEAF_CAPACITY];
+            };
+
+            /// \class Структура Inner описывает внутренний узел дерева:
+            /// поддерево children_[i] содержит ключи из
+            /// [keys_[i - 1], keys_[i]).
+            struct Inner : Node {
+                RecordType* keys_[INNER_CAPACITY];
+                Node* children_[INNER_CAPACITY + 1];
+            };
+
+            using LeafAllocator = typename std::allocator_traits<Allocator>::
+                    template rebind_alloc<Leaf>;
+            using LeafTraits = std::allocator_traits<LeafAllocator>;
+            using InnerAllocator = typename std::allocator_traits<Allocator>::
+                    template rebind_alloc<Inner>;
+            using InnerTraits = std::allocator_traits<InnerAllocator>;
+
+            Node* root_;   ///< \brief Корень дерева или nullptr до первой вставки.
+            Leaf* first_;  ///< \brief Самый левый лист.
+            size_t length_;
+            [[no_unique_address]] Allocator allocator_;
+
+            [[nodiscard]]
+            static inline KeyArgument key_of(const RecordType*) noexcept;
+            [[nodiscard]]
+            static size_t child_index(const Inner*, KeyArgument) noexcept;
+            [[nodiscard]]
+            static size_t leaf_position(const Leaf*, KeyArgument) noexcept;
+            [[nodiscard]]
+            static RecordType* leftmost(const Node*) noexcept;
+            [[nodiscard]]
+            static inline uint32_t min_count(const Node*) noexcept;
+            [[nodiscard]]
+            Leaf* create_leaf();
+            [[nodiscard]]
+            Inner* create_inner();
+            void destroy_node(Node*) noexcept;
+            void destroy_tree(Node*) noexcept;
+            Node* insert_into(Node*, RecordType*, RecordType*&);
+            RecordType* remove_from(Node*, KeyArgument) noexcept;
+            void rebalance(Inner*, const size_t&) noexcept;
+            void merge(Inner*, const size_t&) noexcept;
+        public:
+            /// \class Класс Iterator предоставляет объект-итератор по
+            /// записям индекса в порядке возрастания ключей.
+            ///
+            /// Публичные методы:
+            /// \n • Iterator& operator ++ () noexcept
+            /// \n • Iterator operator ++ (int) noexcept
+            /// \n • bool operator != (const Iterator& iterator) noexcept
+            /// \n • RecordType* operator * () const noexcept
+            class Iterator {
+                private:
+                    const Leaf* leaf_;
+                    size_t position_;
+                public:
+                    explicit Iterator(const Leaf*, const size_t&) noexcept;
+
+                    Iterator& operator ++ () noexcept;
+                    Iterator operator ++ (int) noexcept;
+                    bool operator != (const Iterator&) const noexcept;
+                    RecordType* operator * () const noexcept;
+            };
+
+            /// \class Класс Range описывает полуинтервал записей индекса.
+            ///
+            /// Публичные методы:
+            /// \n • Iterator begin() const noexcept
+            /// \n • Iterator end() const noexcept
+            class Range {
+                private:
+                    Iterator begin_, end_;
+                public:
+                    Range(const Iterator&, const Iterator&) noexcept;
+
+                    inline Iterator begin() const noexcept;
+                    inline Iterator end() const noexcept;
+            };
+
+            explicit SortedIndex(const Allocator& = Allocator()) noexcept;
+            SortedIndex(const SortedIndex&) = delete;
+            SortedIndex& operator = (const SortedIndex&) = delete;
+            ~SortedIndex();
+
+            void insert(RecordType*);
+            bool remove(KeyArgument) noexcept;
+            void clear() noexcept;
+
+            [[nodiscard]] [[maybe_unused]]
+            inline size_t length() const noexcept;
+            [[nodiscard]]
+            Iterator lower_bound(KeyArgument) const noexcept;
+            [[nodiscard]] [[maybe_unused]]
+            Range range(KeyArgument, KeyArgument) const;
+            [[nodiscard]] [[maybe_unused]]
+            Range prefix(std::string_view) const;
+            inline Iterator begin() const noexcept;
+            inline Iterator end() const noexcept;
+    };
+
+// Определения методов классов.
+/* ================================ Iterator ================================ */
+
+    /// \brief Стандартный конструктор экземпляра класса
+    /// SortedIndex::Iterator.
+    ///
+    /// \param leaf Лист или nullptr для конца индекса.
+    /// \param position Позиция записи в листе.
+    template <class R, class A>
+    SortedIndex<R, A>::Iterator::Iterator(const Leaf* leaf,
+                                          const size_t& position) noexcept :
+            leaf_(leaf), position_(position) { }
+
+    /// \brief Перемещает итератор на след. запись.
+    ///
+    /// \return Объект-итератор.
+    template <class R, class A>
+    SortedIndex<R, A>::Iterator& SortedIndex<R, A>::Iterator::operator ++ () noexcept {
+        if (this->leaf_ != nullptr && ++this->position_ == this->leaf_->count_) {
+            this->leaf_ = this->leaf_->next_;
+            this->position_ = 0;
+        }
+        return *this;
+    }
+
+    /// \brief Перемещает итератор на след. запись.
+    ///
+    /// \return Объект-итератор.
+    template <class R, class A>
+    SortedIndex<R, A>::Iterator SortedIndex<R, A>::Iterator::operator ++ (int) noexcept {
+        Iterator iterator = *this;
+        ++*this;
+        return iterator;
+    }
+
+    /// \brief Проверяет, что два объекта итератора не равны.
+    ///
+    /// \param iterator Объект-итератор для сравнения.
+    ///
+    /// \return Булевое значение.
+    template <class R, class A>
+    bool SortedIndex<R, A>::Iterator::operator != (const Iterator& iterator)
+    const noexcept {
+        return this->leaf_ != iterator.leaf_ ||
+               this->position_ != iterator.position_;
+    }
+
+    /// \brief Позволяет получить запись, на которую указывает итератор.
+    ///
+    /// \return Указатель на запись.
+    template <class R, class A>
+    R* SortedIndex<R, A>::Iterator::operator * () const noexcept {
+        return this->leaf_->records_[this->position_];
+    }
+
+/* ================================= Range ================================= */
+
+    /// \brief Стандартный конструктор экземпляра класса SortedIndex::Range.
+    ///
+    /// \param begin Итератор на первую запись диапазона.
+    /// \param end Итератор за последней записью диапазона.
+    template <class R, class A>
+    SortedIndex<R, A>::Range::Range(const Iterator& begin,
+                                    const Iterator& end) noexcept :
+            begin_(begin), end_(end) { }
+
+    /// \brief Создает итератор от первой записи диапазона.
+    ///
+    /// \return Объект-итератор.
+    template <class R, class A>
+    inline SortedIndex<R, A>::Iterator SortedIndex<R, A>::Range::begin() const noexcept {
+        return this->begin_;
+    }
+
+    /// \brief Создает итератор за последней записью диапазона.
+    ///
+    /// \return Объект-итератор.
+    template <class R, class A>
+    inline SortedIndex<R, A>::Iterator SortedIndex<R, A>::Range::end() const noexcept {
+        return this->end_;
+    }
+
+/* =============================== SortedIndex =============================== */
+// PRIVATE
+
+    /// \brief Позволяет получить ключ записи.
+    ///
+    /// \param record Указатель на запись.
+    ///
+    /// \return Ключ записи (для строк - срез).
+    template <class R, class A>
+    [[nodiscard]]
+    inline SortedIndex<R, A>::KeyArgument SortedIndex<R, A>::key_of(const R* record) noexcept {
+        return record->key();
+    }
+
+    /// \brief Выбирает поддерево внутреннего узла, в котором может лежать
+    /// ключ.
+    ///
+    /// \param inner Внутренний узел.
+    /// \param key Ключ.
+    ///
+    /// \return Номер первого разделителя, большего key.
+    template <class R, class A>
+    [[nodiscard]]
+    size_t SortedIndex<R, A>::child_index(const Inner* inner,
+                                          KeyArgument key) noexcept {
+        return static_cast<size_t>(std::upper_bound(
+                inner->keys_, inner->keys_ + inner->count_, key,
+                [](const KeyArgument& lhs, const R* rhs) {
+                    return lhs < key_of(rhs);
+                }) - inner->keys_);
+    }
+
+    /// \brief Находит в листе позицию первой записи с ключом не меньше key.
+    ///
+    /// \param leaf Лист.
+    /// \param key Ключ.
+    ///
+    /// \return Позицию в листе в пределах [0, count_].
+    template <class R, class A>
+    [[nodiscard]]
+    size_t SortedIndex<R, A>::leaf_position(const Leaf* leaf,
+                                            KeyArgument key) noexcept {
+        return static_cast<size_t>(std::lower_bound(
+                leaf->records_, leaf->records_ + leaf->count_, key,
+                [](const R* lhs, const KeyArgument& rhs) {
+                    return key_of(lhs) < rhs;
+                }) - leaf->records_);
+    }
+
+    /// \brief Находит первую запись поддерева.
+    ///
+    /// \param node Корень непустого поддерева.
+    ///
+    /// \return Указатель на запись с наименьшим ключом.
+    template <class R, class A>
+    [[nodiscard]]
+    R* SortedIndex<R, A>::leftmost(const Node* node) noexcept {
+        while (!node->leaf_)
+            node = static_cast<const Inner*>(node)->children_[0];
+        return static_cast<const Leaf*>(node)->records_[0];
+    }
+
+    /// \brief Позволяет получить наименьшее допустимое заполнение узла,
+    /// не являющегося корнем.
+    ///
+    /// \param node Узел дерева.
+    ///
+    /// \return Наименьшее число записей или разделителей.
+    template <class R, class A>
+    [[nodiscard]]
+    inline uint32_t SortedIndex<R, A>::min_count(const Node* node) noexcept {
+        return node->leaf_ ? LEAF_CAPACITY / 2 : INNER_CAPACITY / 2;
+    }
+
+    /// \brief Создает пустой лист.
+    ///
+    /// \return Указатель на лист.
+    template <class R, class A>
+    [[nodiscard]]
+    SortedIndex<R, A>::Leaf* SortedIndex<R, A>::create_leaf() {
+        LeafAllocator leaf_allocator(this->allocator_);
+        Leaf* leaf{ LeafTraits::allocate(leaf_allocator, 1) };
+        leaf->leaf_ = true;
+        leaf->count_ = 0;
+        leaf->prev_ = leaf->next_ = nullptr;
+        return leaf;
+    }
+
+    /// \brief Создает пустой внутренний узел.
+    ///
+    /// \return Указатель на узел.
+    template <class R, class A>
+    [[nodiscard]]
+    SortedIndex<R, A>::Inner* SortedIndex<R, A>::create_inner() {
+        InnerAllocator inner_allocator(this->allocator_);
+        Inner* inner{ InnerTraits::allocate(inner_allocator, 1) };
+        inner->leaf_ = false;
+        inner->count_ = 0;
+        return inner;
+    }
+
+    /// \brief Возвращает память узла аллокатору (без поддеревьев).
+    ///
+    /// \param node Указатель на узел.
+    template <class R, class A>
+    void SortedIndex<R, A>::destroy_node(Node* node) noexcept {
+        if (node->leaf_) {
+            LeafAllocator leaf_allocator(this->allocator_);
+            LeafTraits::deallocate(leaf_allocator, static_cast<Leaf*>(node), 1);
+        }
+        else {
+            InnerAllocator inner_allocator(this->allocator_);
+            InnerTraits::deallocate(inner_allocator, static_cast<Inner*>(node), 1);
+        }
+    }
+
+    /// \brief Удаляет поддерево.
+    ///
+    /// \param node Корень поддерева.
+    template <class R, class A>
+    void SortedIndex<R, A>::destroy_tree(Node* node) noexcept {
+        if (!node->leaf_) {
+            auto* inner{ static_cast<Inner*>(node) };
+            for (uint32_t child{}; child <= inner->count_; child++)
+                this->destroy_tree(inner->children_[child]);
+        }
+        this->destroy_node(node);
+    }
+
+    /// \brief Добавляет запись в поддерево.
+    ///
+    /// Узлы, которые понадобятся при разделении, создаются до изменения
+    /// дерева, так что при нехватке памяти дерево остается прежним.
+    ///
+    /// \param node Корень поддерева.
+    /// \param record Указатель на добавляемую запись.
+    /// \param separator Первая запись нового правого узла, если узел
+    /// разделился.
+    ///
+    /// \return Новый правый узел или nullptr, если разделения не было.
+    template <class R, class A>
+    SortedIndex<R, A>::Node* SortedIndex<R, A>::insert_into(Node* node, R* record,
+                                                            R*& separator) {
+        KeyArgument key{ key_of(record) };
+        if (node->leaf_) {
+            auto* leaf{ static_cast<Leaf*>(node) };
+            size_t position{ leaf_position(leaf, key) };
+            if (leaf->count_ < LEAF_CAPACITY) {
+                std::copy_backward(leaf->records_ + position,
+                                   leaf->records_ + leaf->count_,
+                                   leaf->records_ + leaf->count_ + 1);
+                leaf->records_[position] = record;
+                leaf->count_++;
+                return nullptr;
+            }
+
+            // Полный лист делится пополам.
+            Leaf* right{ this->create_leaf() };
+            R* merged[LEAF_CAPACITY + 1];
+            std::copy(leaf->records_, leaf->records_ + position, merged);
+            merged[position] = record;
+            std::copy(leaf->records_ + position, leaf->records_ + LEAF_CAPACITY,
+                      merged + position + 1);
+            constexpr uint32_t LEFT_COUNT{ (LEAF_CAPACITY + 1) / 2 };
+            std::copy(merged, merged + LEFT_COUNT, leaf->records_);
+            std::copy(merged + LEFT_COUNT, merged + LEAF_CAPACITY + 1,
+                      right->records_);
+            leaf->count_ = LEFT_COUNT;
+            right->count_ = LEAF_CAPACITY + 1 - LEFT_COUNT;
+
+            right->next_ = leaf->next_;
+            if (right->next_ != nullptr)
+                right->next_->prev_ = right;
+            right->prev_ = leaf;
+            leaf->next_ = right;
+            separator = right->records_[0];
+            return right;
+        }
+
+        auto* inner{ static_cast<Inner*>(node) };
+        Inner* spare{ (inner->count_ == INNER_CAPACITY) ? this->create_inner()
+                                                        : nullptr };
+        size_t child{ child_index(inner, key) };
+        R* child_separator;
+        Node* child_right;
+        try {
+            child_right = this->insert_into(inner->children_[child], record,
+                                            child_separator);
+        }
+        catch (...) {
+            if (spare != nullptr)
+                this->destroy_node(spare);
+            throw;
+        }
+        if (child_right == nullptr) {
+            if (spare != nullptr)
+                this->destroy_node(spare);
+            return nullptr;
+        }
+
+        if (spare == nullptr) {
+            std::copy_backward(inner->keys_ + child, inner->keys_ + inner->count_,
+                               inner->keys_ + inner->count_ + 1);
+            std::copy_backward(inner->children_ + child + 1,
+                               inner->children_ + inner->count_ + 1,
+                               inner->children_ + inner->count_ + 2);
+            inner->keys_[child] = child_separator;
+            inner->children_[child + 1] = child_right;
+            inner->count_++;
+            return nullptr;
+        }
+
+        // Полный узел делится: средний разделитель поднимается к родителю.
+        R* keys[INNER_CAPACITY + 1];
+        Node* children[INNER_CAPACITY + 2];
+        std::copy(inner->keys_, inner->keys_ + child, keys);
+        keys[child] = child_separator;
+        std::copy(inner->keys_ + child, inner->keys_ + INNER_CAPACITY,
+                  keys + child + 1);
+        std::copy(inner->children_, inner->children_ + child + 1, children);
+        children[child + 1] = child_right;
+        std::copy(inner->children_ + child + 1,
+                  inner->children_ + INNER_CAPACITY + 1, children + child + 2);
+
+        constexpr uint32_t LEFT_COUNT{ (INNER_CAPACITY + 1) / 2 };
+        std::copy(keys, keys + LEFT_COUNT, inner->keys_);
+        std::copy(children, children + LEFT_COUNT + 1, inner->children_);
+        inner->count_ = LEFT_COUNT;
+        std::copy(keys + LEFT_COUNT + 1, keys + INNER_CAPACITY + 1, spare->keys_);
+        std::copy(children + LEFT_COUNT + 1, children + INNER_CAPACITY + 2,
+                  spare->children_);
+        spare->count_ = INNER_CAPACITY - LEFT_COUNT;
+        separator = keys[LEFT_COUNT];
+        return spare;
+    }
+
+    /// \brief Удаляет запись с указанным ключом из поддерева.
+    ///
+    /// После удаления из дочернего узла разделитель, указывавший на
+    /// удаленную запись, заменяется новой первой записью поддерева, а
+    /// недозаполненный дочерний узел пополняется от соседа или сливается
+    /// с ним.
+    ///
+    /// \param node Корень поддерева.
+    /// \param key Ключ записи.
+    ///
+    /// \return Указатель на удаленную запись или nullptr, если ее нет.
+    template <class R, class A>
+    R* SortedIndex<R, A>::remove_from(Node* node, KeyArgument key) noexcept {
+        if (node->leaf_) {
+            auto* leaf{ static_cast<Leaf*>(node) };
+            size_t position{ leaf_position(leaf, key) };
+            if (position == leaf->count_ || key_of(leaf->records_[position]) != key)
+                return nullptr;
+            R* removed{ leaf->records_[position] };
+            std::copy(leaf->records_ + position + 1, leaf->records_ + leaf->count_,
+                      leaf->records_ + position);
+            leaf->count_--;
+            return removed;
+        }
+
+        auto* inner{ static_cast<Inner*>(node) };
+        size_t child{ child_index(inner, key) };
+        R* removed{ this->remove_from(inner->children_[child], key) };
+        if (removed == nullptr)
+            return nullptr;
+        // Разделитель - всегда первая запись своего правого поддерева.
+        if (child > 0 && inner->keys_[child - 1] == removed)
+            inner->keys_[child - 1] = leftmost(inner->children_[child]);
+        if (inner->children_[child]->count_ < min_count(inner->children_[child]))
+            this->rebalance(inner, child);
+        return removed;
+    }
+
+    /// \brief Восстанавливает заполнение дочернего узла.
+    ///
+    /// Если у соседа есть лишние элементы, один из них переходит в
+    /// дочерний узел через разделитель родителя, иначе узлы сливаются.
+    ///
+    /// \param inner Родительский узел.
+    /// \param child Номер недозаполненного дочернего узла.
+    template <class R, class A>
+    void SortedIndex<R, A>::rebalance(Inner* inner, const size_t& child) noexcept {
+        Node* node{ inner->children_[child] };
+        Node* left{ (child > 0) ? inner->children_[child - 1] : nullptr };
+        Node* right{ (child < inner->count_) ? inner->children_[child + 1] : nullptr };
+
+        if (left != nullptr && left->count_ > min_count(left)) {
+            if (node->leaf_) {
+                auto* leaf{ static_cast<Leaf*>(node) };
+                auto* donor{ static_cast<Leaf*>(left) };
+                std::copy_backward(leaf->records_, leaf->records_ + leaf->count_,
+                                   leaf->records_ + leaf->count_ + 1);
+                leaf->records_[0] = donor->records_[--donor->count_];
+                leaf->count_++;
+                inner->keys_[child - 1] = leaf->records_[0];
+            }
+            else {
+                auto* receiver{ static_cast<Inner*>(node) };
+                auto* donor{ static_cast<Inner*>(left) };
+                std::copy_backward(receiver->keys_, receiver->keys_ + receiver->count_,
+                                   receiver->keys_ + receiver->count_ + 1);
+                std::copy_backward(receiver->children_,
+                                   receiver->children_ + receiver->count_ + 1,
+                                   receiver->children_ + receiver->count_ + 2);
+                receiver->keys_[0] = inner->keys_[child - 1];
+                receiver->children_[0] = donor->children_[donor->count_];
+                receiver->count_++;
+                inner->keys_[child - 1] = donor->keys_[--donor->count_];
+            }
+        }
+        else if (right != nullptr && right->count_ > min_count(right)) {
+            if (node->leaf_) {
+                auto* leaf{ static_cast<Leaf*>(node) };
+                auto* donor{ static_cast<Leaf*>(right) };
+                leaf->records_[leaf->count_++] = donor->records_[0];
+                std::copy(donor->records_ + 1, donor->records_ + donor->count_,
+                          donor->records_);
+                donor->count_--;
+                inner->keys_[child] = donor->records_[0];
+            }
+            else {
+                auto* receiver{ static_cast<Inner*>(node) };
+                auto* donor{ static_cast<Inner*>(right) };
+                receiver->keys_[receiver->count_] = inner->keys_[child];
+                receiver->children_[receiver->count_ + 1] = donor->children_[0];
+                receiver->count_++;
+                inner->keys_[child] = donor->keys_[0];
+                std::copy(donor->keys_ + 1, donor->keys_ + donor->count_,
+                          donor->keys_);
+                std::copy(donor->children_ + 1, donor->children_ + donor->count_ + 1,
+                          donor->children_);
+                donor->count_--;
+            }
+        }
+        else if (left != nullptr)
+            this->merge(inner, child - 1);
+        else
+            this->merge(inner, child);
+    }
+
+    /// \brief Сливает два соседних дочерних узла в левый.
+    ///
+    /// \param inner Родительский узел.
+    /// \param child Номер левого из сливаемых узлов.
+    template <class R, class A>
+    void SortedIndex<R, A>::merge(Inner* inner, const size_t& child) noexcept {
+        Node* left{ inner->children_[child] };
+        Node* right{ inner->children_[child + 1] };
+        if (left->leaf_) {
+            auto* receiver{ static_cast<Leaf*>(left) };
+            auto* donor{ static_cast<Leaf*>(right) };
+            std::copy(donor->records_, donor->records_ + donor->count_,
+                      receiver->records_ + receiver->count_);
+            receiver->count_ += donor->count_;
+            receiver->next_ = donor->next_;
+            if (receiver->next_ != nullptr)
+                receiver->next_->prev_ = receiver;
+        }
+        else {
+            auto* receiver{ static_cast<Inner*>(left) };
+            auto* donor{ static_cast<Inner*>(right) };
+            receiver->keys_[receiver->count_] = inner->keys_[child];
+            std::copy(donor->keys_, donor->keys_ + donor->count_,
+                      receiver->keys_ + receiver->count_ + 1);
+            std::copy(donor->children_, donor->children_ + donor->count_ + 1,
+                      receiver->children_ + receiver->count_ + 1);
+            receiver->count_ += donor->count_ + 1;
+        }
+
+        std::copy(inner->keys_ + child + 1, inner->keys_ + inner->count_,
+                  inner->keys_ + child);
+        std::copy(inner->children_ + child + 2, inner->children_ + inner->count_ + 1,
+                  inner->children_ + child + 1);
+        inner->count_--;
+        this->destroy_node(right);
+    }
+
+// PUBLIC
+
+    /// \brief Стандартный конструктор экземпляра класса SortedIndex.
+    ///
+    /// Узлы создаются при первой вставке.
+    ///
+    /// \param allocator Аллокатор, из которого берутся узлы дерева.
+    template <class R, class A>
+    SortedIndex<R, A>::SortedIndex(const A& allocator) noexcept :
+            root_(nullptr), first_(nullptr), length_(0), allocator_(allocator) { }
+
+    // Стандартный деструктор экземпляра.
+    template <class R, class A>
+    SortedIndex<R, A>::~SortedIndex() {
+        this->clear();
+    }
+
+    /// \brief Добавляет запись в индекс за O(log n).
+    ///
+    /// \param record Указатель на запись, ключа которой еще нет в индексе.
+    template <class R, class A>
+    void SortedIndex<R, A>::insert(R* record) {
+        if (this->root_ == nullptr)
+            this->root_ = this->first_ = this->create_leaf();
+
+        // Новый корень создается заранее, если старый может разделиться.
+        uint32_t capacity{ this->root_->leaf_ ? LEAF_CAPACITY : INNER_CAPACITY };
+        Inner* new_root{ (this->root_->count_ == capacity) ? this->create_inner()
+                                                           : nullptr };
+        R* separator;
+        Node* right;
+        try {
+            right = this->insert_into(this->root_, record, separator);
+        }
+        catch (...) {
+            if (new_root != nullptr)
+                this->destroy_node(new_root);
+            throw;
+        }
+
+        if (right != nullptr) {
+            new_root->keys_[0] = separator;
+            new_root->children_[0] = this->root_;
+            new_root->children_[1] = right;
+            new_root->count_ = 1;
+            this->root_ = new_root;
+        }
+        else if (new_root != nullptr)
+            this->destroy_node(new_root);
+        this->length_++;
+    }
+
+    /// \brief Удаляет запись с указанным ключом из индекса за O(log n).
+    ///
+    /// \param key Ключ записи.
+    ///
+    /// \return true, если запись была в индексе.
+    template <class R, class A>
+    bool SortedIndex<R, A>::remove(KeyArgument key) noexcept {
+        if (this->root_ == nullptr || this->remove_from(this->root_, key) == nullptr)
+            return false;
+        if (!this->root_->leaf_ && this->root_->count_ == 0) {
+            Node* old_root{ this->root_ };
+            this->root_ = static_cast<Inner*>(old_root)->children_[0];
+            this->destroy_node(old_root);
+        }
+        this->length_--;
+        return true;
+    }
+
+    // Удаляет все узлы индекса. Записи при этом не затрагиваются.
+    template <class R, class A>
+    void SortedIndex<R, A>::clear() noexcept {
+        if (this->root_ != nullptr)
+            this->destroy_tree(this->root_);
+        this->root_ = nullptr;
+        this->first_ = nullptr;
+        this->length_ = 0;
+    }
+
+    /// \brief Позволяет получить количество записей индекса.
+    ///
+    /// \return Значение кол-ва записей.
+    template <class R, class A>
+    [[nodiscard]] [[maybe_unused]]
+    inline size_t SortedIndex<R, A>::length() const noexcept {
+        return this->length_;
+    }
+
+    /// \brief Находит первую запись с ключом не меньше указанного.
+    ///
+    /// \param key Ключ.
+    ///
+    /// \return Итератор на запись или end(), если таких записей нет.
+    template <class R, class A>
+    [[nodiscard]]
+    SortedIndex<R, A>::Iterator SortedIndex<R, A>::lower_bound(KeyArgument key)
+    const noexcept {
+        if (this->root_ == nullptr)
+            return this->end();
+        const Node* node{ this->root_ };
+        while (!node->leaf_) {
+            auto* inner{ static_cast<const Inner*>(node) };
+            node = inner->children_[child_index(inner, key)];
+        }
+        auto* leaf{ static_cast<const Leaf*>(node) };
+        size_t position{ leaf_position(leaf, key) };
+        // Все ключи листа меньше key: ответ - первая запись след. листа.
+        if (position == leaf->count_)
+            return Iterator(leaf->next_, 0);
+        return Iterator(leaf, position);
+    }
+
+    /// \brief Позволяет перебрать записи с ключами из [low, high).
+    ///
+    /// \param low Нижняя граница ключей (включительно).
+    /// \param high Верхняя граница ключей (не включительно).
+    ///
+    /// \return Диапазон записей в порядке возрастания ключей.
+    template <class R, class A>
+    [[nodiscard]] [[maybe_unused]]
+    SortedIndex<R, A>::Range SortedIndex<R, A>::range(KeyArgument low,
+                                                      KeyArgument high) const {
+        if (!(low < high))
+            return Range(this->end(), this->end());
+        return Range(this->lower_bound(low), this->lower_bound(high));
+    }
+
+    /// \brief Позволяет перебрать записи, ключи которых начинаются с
+    /// указанного префикса.
+    ///
+    /// Верхней границей служит наименьшая строка, большая всех строк с
+    /// префиксом: у префикса отбрасываются завершающие байты 0xFF, а
+    /// последний оставшийся байт увеличивается на 1.
+    ///
+    /// \param prefix Префикс ключей.
+    ///
+    /// \return Диапазон записей в порядке возрастания ключей.
+    template <class R, class A>
+    [[nodiscard]] [[maybe_unused]]
+    SortedIndex<R, A>::Range SortedIndex<R, A>::prefix(std::string_view prefix) const {
+        std::string high(prefix);
+        while (!high.empty() && static_cast<unsigned char>(high.back()) == 0xFF)
+            high.pop_back();
+        if (high.empty())
+            return Range(this->lower_bound(prefix), this->end());
+        high.back() = static_cast<char>(static_cast<unsigned char>(high.back()) + 1);
+        return Range(this->lower_bound(prefix), this->lower_bound(high));
+    }
+
+    /// \brief Создает итератор от записи с наименьшим ключом.
+    ///
+    /// \return Объект-итератор.
+    template <class R, class A>
+    inline SortedIndex<R, A>::Iterator SortedIndex<R, A>::begin() const noexcept {
+        if (this->first_ == nullptr || this->first_->count_ == 0)
+            return this->end();
+        return Iterator(this->first_, 0);
+    }
+
+    /// \brief Создает итератор на конец индекса.
+    ///
+    /// \return Объект-итератор.
+    template <class R, class A>
+    inline SortedIndex<R, A>::Iterator SortedIndex<R, A>::end() const noexcept {
+        return Iterator(nullptr, 0);
+    }
+}
+
+#endif
@@ -0,0 +1,140 @@
+/// \file rehash_allocation_test.cpp.
+/// \author Лошкарев Дмитрий.
+/// \date 15.10.2026.
+///
+/// \brief Проверяет, что расширение хеш-таблицы перевешивает существующие
+/// записи, а не выделяет их заново: вставка, вызывающая перехеширование,
+/// делает ровно EXPAND_ALLOCATIONS выделений памяти сверх обычной вставки
+/// независимо от числа записей.
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <string_view>
+
+#include "orderhashtable.hpp"
+
+using DataStructures::ChainedStorage;
+using DataStructures::KeyedOrderedHashTable;
+using DataStructures::OpenAddressingStorage;
+using DataStructures::WyHasher;
+
+namespace {
+    // Расширение выделяет только новое хранилище и его массив ячеек.
+    constexpr size_t EXPAND_ALLOCATIONS{ 2 };
+    constexpr int64_t RECORD_COUNT{ 100000 };
+
+    size_t allocation_count{};
+
+    // Освобождение вынесено из операторов delete: иначе GCC, встроив
+    // std::free рядом с new-выражением, выдает ложное предупреждение
+    // -Wmismatched-new-delete.
+    [[gnu::noinline]] void release(void* memory) noexcept {
+        std::free(memory);
+    }
+}
+
+// Глобальные операторы new считают все выделения памяти в программе.
+void* operator new(std::size_t size) {
+    allocation_count++;
+    if (void* memory{ std::malloc(size ? size : 1) })
+        return memory;
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) {
+    return ::operator new(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t align) {
+    allocation_count++;
+    const auto alignment{ static_cast<std::size_t>(align) };
+    if (void* memory{ std::aligned_alloc(alignment, (size + alignment - 1) / alignment *
+                                                    alignment) })
+        return memory;
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size, std::align_val_t align) {
+    return ::operator new(size, align);
+}
+
+void operator delete(void* memory) noexcept { release(memory); }
+void operator delete[](void* memory) noexcept { release(memory); }
+void operator delete(void* memory, std::size_t) noexcept { release(memory); }
+void operator delete[](void* memory, std::size_t) noexcept { release(memory); }
+void operator delete(void* memory, std::align_val_t) noexcept { release(memory); }
+void operator delete[](void* memory, std::align_val_t) noexcept { release(memory); }
+void operator delete(void* memory, std::size_t, std::align_val_t) noexcept {
+    release(memory);
+}
+void operator delete[](void* memory, std::size_t, std::align_val_t) noexcept {
+    release(memory);
+}
+
+namespace {
+    // std::allocator направляет все выделения таблицы в глобальный new,
+    // в отличие от пула по умолчанию, который выделяет память блоками.
+    template <class Storage>
+    using Table = KeyedOrderedHashTable<int64_t, int64_t, Storage, WyHasher,
+                                        std::allocator<std::byte>>;
+
+    // Вставляет RECORD_COUNT записей и сверяет число выделений памяти
+    // каждой вставки с ожидаемым: record_allocations на запись (запись и,
+    // для цепочек, узел списка), одно при росте массива порядка
+    // добавления и EXPAND_ALLOCATIONS при расширении. По умолчанию
+    // RehashMode::BLOCKING, так что расширяющая вставка переносит все
+    // записи сразу. В конце проверяется, что ни одна запись не потеряна.
+    template <class Storage>
+    bool check(const std::string_view& name, const size_t& record_allocations) {
+        Table<Storage> table;
+        const auto& policy{ table.growth_policy() };
+        // Таблица начинает с min_size_ ячеек. Массив порядка выделяется на
+        // min_size_ записей при первой вставке и растет вдвое, когда
+        // заполнен (OrderedHashTable::reserve_order).
+        size_t size{ policy.min_size_ };
+        size_t order_capacity{};
+        size_t expand_count{};
+        for (int64_t key{}; key < RECORD_COUNT; key++) {
+            size_t expected{ record_allocations };
+            if (static_cast<size_t>(key) == order_capacity) {
+                expected++;
+                order_capacity = std::max(order_capacity * 2, policy.min_size_);
+            }
+            if ((static_cast<double>(key + 1) / static_cast<double>(size)) >=
+                policy.max_load_factor_) {
+                expected += EXPAND_ALLOCATIONS;
+                size = policy.grow(size);
+                expand_count++;
+            }
+
+            const size_t before{ allocation_count };
+            table.insert(key, key);
+            const size_t actual{ allocation_count - before };
+            if (actual != expected) {
+                std::cerr << name << ": insert of key " << key << " made " << actual
+                          << " allocations, expected " << expected << ".\n";
+                return false;
+            }
+        }
+
+        for (int64_t key{}; key < RECORD_COUNT; key++) {
+            if (table.get(key) != key) {
+                std::cerr << name << ": key " << key << " lost during rehash.\n";
+                return false;
+            }
+        }
+        std::cout << name << ": " << expand_count << " expansions, each with "
+                  << EXPAND_ALLOCATIONS << " extra allocations.\n";
+        return true;
+    }
+}
+
+int main() {
+    const bool chained{ check<ChainedStorage>("ChainedStorage", 2) };
+    const bool open_addressing{ check<OpenAddressingStorage>("OpenAddressingStorage", 1) };
+    return (chained && open_addressing) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
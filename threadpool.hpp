@@ -0,0 +1,186 @@
+/// \file threadpool.hpp.
+/// \author Лошкарев Дмитрий.
+/// \date 14.10.2026.
+///
+/// \brief Содержит пул потоков для параллельного построения и
+/// перехеширования хеш-таблиц.
+///
+/// \namespaces
+/// • DataStructures
+/// \classes
+/// • ThreadPool
+
+#ifndef CPPPROJECT_THREADPOOL_H
+#define CPPPROJECT_THREADPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace DataStructures {
+// Объявление классов.
+
+    /// \class Класс ThreadPool предоставляет фиксированный набор потоков,
+    /// выполняющих пронумерованные задачи одного задания.
+    ///
+    /// Задание запускается методом run и выполняется рабочими потоками
+    /// вместе с вызывающим потоком; run возвращает управление, когда все
+    /// задачи выполнены. Задачи разбираются по одной через атомарный
+    /// счетчик, поэтому неравные по объему задачи распределяются сами.
+    /// Задания из разных потоков выполняются по очереди; запуск задания
+    /// изнутри задачи не поддерживается.
+    ///
+    /// Публичные методы:
+    /// \n • void run(const size_t& task_count, Function&& function);
+    /// \n • size_t size() const noexcept.
+    class ThreadPool {
+        private:
+            std::vector<std::thread> workers_;
+            std::mutex run_mutex_;            ///< \brief Очередь заданий из разных потоков.
+            std::mutex mutex_;
+            std::condition_variable wake_;    ///< \brief Уведомляет рабочих о новом задании.
+            std::condition_variable done_;    ///< \brief Уведомляет о завершении задания.
+            void (*invoke_)(const void*, size_t);  ///< \brief Вызов функции задания
+                                                   ///< для задачи.
+            const void* function_;            ///< \brief Функция текущего задания.
+            size_t task_count_;
+            std::atomic<size_t> next_task_;   ///< \brief Первая еще не взятая задача.
+            size_t active_;                   ///< \brief Число рабочих, занятых заданием.
+            uint64_t generation_;             ///< \brief Номер текущего задания.
+            bool stopping_;
+            std::exception_ptr error_;        ///< \brief Первое исключение задания.
+
+            void work();
+            void drain() noexcept;
+        public:
+            explicit ThreadPool(const size_t& thread_count =
+                    std::thread::hardware_concurrency());
+            ThreadPool(const ThreadPool&) = delete;
+            ThreadPool& operator = (const ThreadPool&) = delete;
+            ~ThreadPool();
+
+            template <class Function>
+            void run(const size_t& task_count, Function&& function);
+            [[nodiscard]] [[maybe_unused]]
+            inline size_t size() const noexcept;
+    };
+
+// Определения методов классов.
+/* =============================== ThreadPool =============================== */
+// PRIVATE
+
+    // Цикл рабочего потока: ожидание задания, разбор задач, отчет.
+    inline void ThreadPool::work() {
+        uint64_t seen_generation{};
+        while (true) {
+            {
+                std::unique_lock lock{ this->mutex_ };
+                this->wake_.wait(lock, [this, &seen_generation] {
+                    return this->stopping_ ||
+                           this->generation_ != seen_generation;
+                });
+                if (this->stopping_)
+                    return;
+                seen_generation = this->generation_;
+            }
+            this->drain();
+
+            std::lock_guard lock{ this->mutex_ };
+            if (--this->active_ == 0)
+                this->done_.notify_one();
+        }
+    }
+
+    /// \brief Выполняет задачи текущего задания, пока они не кончатся.
+    ///
+    /// Исключение задачи сохраняется и не прерывает остальные задачи.
+    inline void ThreadPool::drain() noexcept {
+        for (size_t task{ this->next_task_.fetch_add(1) };
+                task < this->task_count_;
+                task = this->next_task_.fetch_add(1)) {
+            try {
+                this->invoke_(this->function_, task);
+            }
+            catch (...) {
+                std::lock_guard lock{ this->mutex_ };
+                if (!this->error_)
+                    this->error_ = std::current_exception();
+            }
+        }
+    }
+
+// PUBLIC
+
+    /// \brief Стандартный конструктор экземпляра класса ThreadPool.
+    ///
+    /// \param thread_count Общее число потоков, выполняющих задания,
+    /// включая вызывающий run. Для 0 или 1 рабочие потоки не создаются.
+    inline ThreadPool::ThreadPool(const size_t& thread_count) :
+            invoke_(nullptr), function_(nullptr), task_count_(0),
+            next_task_(0), active_(0), generation_(0), stopping_(false) {
+        for (size_t worker{ 1 }; worker < thread_count; worker++)
+            this->workers_.emplace_back(&ThreadPool::work, this);
+    }
+
+    // Стандартный деструктор экземпляра.
+    inline ThreadPool::~ThreadPool() {
+        {
+            std::lock_guard lock{ this->mutex_ };
+            this->stopping_ = true;
+        }
+        this->wake_.notify_all();
+        for (std::thread& worker : this->workers_)
+            worker.join();
+    }
+
+    /// \brief Выполняет задачи 0 .. task_count - 1 и ждет их завершения.
+    ///
+    /// \param task_count Количество задач.
+    /// \param function Функция, принимающая номер задачи (size_t).
+    ///
+    /// \throw Первое исключение, возбужденное задачами, после завершения
+    /// всех задач.
+    template <class Function>
+    void ThreadPool::run(const size_t& task_count, Function&& function) {
+        if (task_count == 0)
+            return;
+        std::lock_guard run_lock{ this->run_mutex_ };
+        {
+            std::lock_guard lock{ this->mutex_ };
+            this->invoke_ = [](const void* context, size_t task) {
+                (*static_cast<std::remove_reference_t<Function>*>(
+                        const_cast<void*>(context)))(task);
+            };
+            this->function_ = &function;
+            this->task_count_ = task_count;
+            this->next_task_.store(0);
+            this->active_ = this->workers_.size();
+            this->error_ = nullptr;
+            this->generation_++;
+        }
+        this->wake_.notify_all();
+        this->drain();
+
+        std::unique_lock lock{ this->mutex_ };
+        this->done_.wait(lock, [this] { return this->active_ == 0; });
+        if (this->error_)
+            std::rethrow_exception(std::exchange(this->error_, nullptr));
+    }
+
+    /// \brief Предоставляет доступ к числу потоков, выполняющих задания.
+    ///
+    /// \return Число рабочих потоков вместе с вызывающим.
+    [[nodiscard]] [[maybe_unused]]
+    inline size_t ThreadPool::size() const noexcept {
+        return this->workers_.size() + 1;
+    }
+}
+
+#endif
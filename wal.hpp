@@ -0,0 +1,929 @@
+/// \file wal.hpp.
+/// \author Лошкарев Дмитрий.
+/// \date 14.10.2026.
+///
+/// \brief Содержит хеш-таблицу с журналом упреждающей записи (WAL) и
+/// групповой фиксацией изменений.
+///
+/// \namespaces
+/// • DataStructures
+/// \classes
+/// • WalOptions
+/// • CommitLatencyHistogram
+/// • DurableOrderedHashTable
+
+#ifndef CPPPROJECT_WAL_H
+#define CPPPROJECT_WAL_H
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <charconv>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#ifdef _WIN32
+    #include <io.h>
+#else
+    #include <unistd.h>
+#endif
+
+#include "orderhashtable.hpp"
+#include "snapshot.hpp"
+
+namespace DataStructures {
+// Объявление классов.
+
+    /// \class Структура WalOptions описывает политику сброса и сжатия
+    /// журнала.
+    struct WalOptions {
+        std::chrono::microseconds flush_interval_{ 2000 };  ///< \brief Наибольшая задержка сброса.
+        size_t flush_bytes_{ 1 << 20 };                     ///< \brief Объем накопленных записей,
+                                                            ///< при котором журнал сбрасывается сразу.
+        size_t compact_bytes_{ 64 << 20 };                  ///< \brief Объем журнала, после которого
+                                                            ///< в фоне пишется снимок.
+        bool wait_durable_{ true };                         ///< \brief Ждать ли в insert/erase, пока
+                                                            ///< изменение не попадет на диск.
+    };
+
+    /// \class Класс CommitLatencyHistogram описывает распределение
+    /// задержек фиксации: время от добавления изменения в журнал до
+    /// завершения fsync, в который оно попало.
+    ///
+    /// Корзина i считает задержки из [2^i, 2^(i + 1)) мкс, корзина 0 -
+    /// также задержки меньше 1 мкс.
+    ///
+    /// Публичные методы:
+    /// \n • uint64_t count() const noexcept;
+    /// \n • uint64_t percentile(double fraction) const noexcept.
+    class CommitLatencyHistogram {
+        public:
+            static inline constexpr size_t BUCKET_COUNT{ 32 };  ///< \brief Количество корзин.
+
+            std::array<uint64_t, BUCKET_COUNT> buckets_{};  ///< \brief Счетчики корзин.
+            uint64_t max_microseconds_{};                   ///< \brief Наибольшая задержка.
+
+            [[nodiscard]] [[maybe_unused]]
+            inline uint64_t count() const noexcept;
+            [[nodiscard]] [[maybe_unused]]
+            inline uint64_t percentile(const double& fraction) const noexcept;
+    };
+
+    /// \class Класс DurableOrderedHashTable предоставляет хеш-таблицу
+    /// OrderedHashTable, изменения которой сохраняются в журнал
+    /// упреждающей записи.
+    ///
+    /// Изменение сначала применяется к таблице и кодируется в буфер
+    /// журнала, а фоновый поток записывает накопленный буфер одним
+    /// write и одним fsync - когда буфер достигает flush_bytes_ или
+    /// проходит flush_interval_. Так один fsync фиксирует изменения всех
+    /// потоков, пришедшие за это время. Если задан wait_durable_, insert и
+    /// erase возвращают управление только после фиксации своего изменения.
+    ///
+    /// Каталог таблицы содержит снимок snapshot.<N> (формат
+    /// MappedOrderedHashTable) и журналы wal.<M>.log с M >= N. При открытии
+    /// загружается последний снимок и поверх него по порядку проигрываются
+    /// журналы; оборванная или поврежденная (по CRC-32) запись в конце
+    /// журнала отбрасывается. Когда журнал превышает compact_bytes_, в фоне
+    /// начинается новый журнал, пишется снимок копии таблицы, а старые
+    /// снимок и журналы удаляются.
+    ///
+    /// Методы можно вызывать из разных потоков: таблица защищена
+    /// мьютексом, поэтому get возвращает копию значения.
+    ///
+    /// Публичные методы:
+    /// \n • void insert(std::string_view key, const HashType& value);
+    /// \n • bool erase(std::string_view key);
+    /// \n • HashType pop();
+    /// \n • HashType get(std::string_view key) const;
+    /// \n • bool contains(std::string_view key) const;
+    /// \n • size_t length() const;
+    /// \n • void sync();
+    /// \n • void checkpoint();
+    /// \n • CommitLatencyHistogram commit_latency() const;
+    ///
+    /// \tparam HashType Тип значений: trivially copyable тип или
+    /// std::string.
+    /// \tparam StoragePolicy Политика хранения записей таблицы.
+    /// \tparam Hasher Функция хеширования ключей.
+    template <class HashType, class StoragePolicy = ChainedStorage,
+              class Hasher = WyHasher>
+    class DurableOrderedHashTable {
+        private:
+            using Table = OrderedHashTable<HashType, StoragePolicy, Hasher>;
+            using Snapshot = MappedOrderedHashTable<HashType, Hasher>;
+            using Clock = std::chrono::steady_clock;
+
+            static inline constexpr bool IS_STRING_VALUE{
+                    std::is_same_v<HashType, std::string> };
+
+            static_assert(IS_STRING_VALUE || std::is_trivially_copyable_v<HashType>,
+                          "Logged values must be trivially copyable or std::string.");
+
+            static inline constexpr char MAGIC[8]{ 'O', 'H', 'T', 'W', 'A', 'L', '\0', '\0' };
+            static inline constexpr uint32_t VERSION{ 1 };  ///< \brief Версия формата журнала.
+            static inline constexpr size_t RECORD_HEADER_SIZE{ 8 };  ///< \brief Длина и CRC-32 записи.
+
+            /// \enum Перечисление Operation описывает вид записи журнала.
+            enum class Operation : uint8_t {
+                INSERT = 1,
+                ERASE = 2
+            };
+
+            /// \class Структура FileHeader описывает заголовок журнала.
+            struct FileHeader {
+                char magic_[8];
+                uint32_t version_;
+                uint32_t value_size_;  ///< \brief sizeof значения или 0 для строк.
+            };
+
+            std::filesystem::path directory_;
+            WalOptions options_;
+            Table table_;
+
+            mutable std::mutex mutex_;      ///< \brief Таблица, буфер и номера изменений.
+            std::mutex io_mutex_;           ///< \brief Файл журнала: запись, сброс, смена.
+            std::condition_variable flush_wake_;
+            std::condition_variable durable_;
+            std::vector<char> buffer_;                  ///< \brief Еще не записанные изменения.
+            std::vector<Clock::time_point> pending_;   ///< \brief Время добавления каждого из них.
+            uint64_t next_lsn_;                         ///< \brief Номер след. изменения.
+            uint64_t durable_lsn_;                      ///< \brief Изменения с меньшими номерами
+                                                        ///< зафиксированы.
+            uint64_t generation_;                       ///< \brief Номер текущего журнала.
+            uint64_t log_bytes_;                        ///< \brief Размер текущего журнала.
+            bool sync_requested_;
+            bool stopping_;
+            bool failed_;
+            CommitLatencyHistogram histogram_;
+
+            std::FILE* log_file_;
+            std::thread flusher_;
+            std::thread compactor_;
+            std::atomic<bool> compacting_;
+
+            [[nodiscard]]
+            static uint32_t crc32(const char*, const size_t&) noexcept;
+            [[nodiscard]]
+            static bool parse_generation(const std::string&, std::string_view,
+                                         std::string_view, uint64_t&);
+            [[nodiscard]]
+            inline std::filesystem::path log_path(const uint64_t&) const;
+            [[nodiscard]]
+            inline std::filesystem::path snapshot_path(const uint64_t&) const;
+
+            void recover();
+            void replay(const std::filesystem::path&);
+            void open_log(const uint64_t&);
+            static void sync_file(std::FILE*);
+            void append(Operation, std::string_view, const HashType*);
+            void wait_for(const uint64_t&, std::unique_lock<std::mutex>&);
+            void flush(std::unique_lock<std::mutex>&, const bool& = true);
+            void flusher_loop();
+            void rotate(Table&, uint64_t&);
+            void remove_older(const uint64_t&);
+            void start_compaction();
+        public:
+            explicit DurableOrderedHashTable(std::filesystem::path directory,
+                                             const WalOptions& options = WalOptions());
+            DurableOrderedHashTable(const DurableOrderedHashTable&) = delete;
+            DurableOrderedHashTable& operator = (const DurableOrderedHashTable&) = delete;
+            ~DurableOrderedHashTable();
+
+            [[maybe_unused]]
+            void insert(std::string_view key, const HashType& value);
+            [[maybe_unused]]
+            bool erase(std::string_view key);
+            [[maybe_unused]]
+            HashType pop();
+            [[nodiscard]] [[maybe_unused]]
+            HashType get(std::string_view key) const;
+            [[nodiscard]] [[maybe_unused]]
+            bool contains(std::string_view key) const;
+            [[nodiscard]] [[maybe_unused]]
+            size_t length() const;
+
+            [[maybe_unused]]
+            void sync();
+            [[maybe_unused]]
+            void checkpoint();
+            [[nodiscard]] [[maybe_unused]]
+            CommitLatencyHistogram commit_latency() const;
+    };
+
+// Определения методов классов.
+/* ========================= CommitLatencyHistogram ========================= */
+
+    /// \brief Позволяет получить количество учтенных фиксаций.
+    ///
+    /// \return Сумму счетчиков корзин.
+    [[nodiscard]] [[maybe_unused]]
+    inline uint64_t CommitLatencyHistogram::count() const noexcept {
+        uint64_t total{};
+        for (const uint64_t& bucket : this->buckets_)
+            total += bucket;
+        return total;
+    }
+
+    /// \brief Оценивает квантиль задержки фиксации.
+    ///
+    /// \param fraction Доля в пределах [0, 1], например 0.99.
+    ///
+    /// \return Верхнюю границу корзины квантиля в микросекундах или 0,
+    /// если фиксаций не было.
+    [[nodiscard]] [[maybe_unused]]
+    inline uint64_t CommitLatencyHistogram::percentile(const double& fraction)
+    const noexcept {
+        const uint64_t total{ this->count() };
+        if (total == 0)
+            return 0;
+        const auto rank{ static_cast<uint64_t>(fraction * static_cast<double>(total - 1)) };
+        uint64_t seen{};
+        for (size_t bucket{}; bucket < BUCKET_COUNT; bucket++) {
+            seen += this->buckets_[bucket];
+            if (seen > rank)
+                return std::min(uint64_t{ 2 } << bucket, this->max_microseconds_);
+        }
+        return this->max_microseconds_;
+    }
+
+/* ======================== DurableOrderedHashTable ======================== */
+// PRIVATE
+
+    /// \brief Высчитывает CRC-32 (полином 0xEDB88320).
+    ///
+    /// \param data Указатель на данные.
+    /// \param size Размер данных.
+    ///
+    /// \return Значение контрольной суммы.
+    template <class T, class S, class H>
+    [[nodiscard]]
+    uint32_t DurableOrderedHashTable<T, S, H>::crc32(const char* data,
+                                                     const size_t& size) noexcept {
+        static constexpr auto TABLE{ [] {
+            std::array<uint32_t, 256> table{};
+            for (uint32_t byte{}; byte < 256; byte++) {
+                uint32_t value{ byte };
+                for (int bit{}; bit < 8; bit++)
+                    value = (value & 1) ? (value >> 1) ^ 0xEDB88320 : value >> 1;
+                table[byte] = value;
+            }
+            return table;
+        }() };
+
+        uint32_t crc{ 0xFFFFFFFF };
+        for (size_t i{}; i < size; i++)
+            crc = TABLE[(crc ^ static_cast<unsigned char>(data[i])) & 0xFF] ^ (crc >> 8);
+        return crc ^ 0xFFFFFFFF;
+    }
+
+    /// \brief Разбирает номер из имени файла вида <prefix>N<suffix>.
+    ///
+    /// \param name Имя файла.
+    /// \param prefix Начало имени.
+    /// \param suffix Конец имени.
+    /// \param generation Номер, в который записывается результат.
+    ///
+    /// \return true, если имя подходит.
+    template <class T, class S, class H>
+    [[nodiscard]]
+    bool DurableOrderedHashTable<T, S, H>::parse_generation(const std::string& name,
+                                                            std::string_view prefix,
+                                                            std::string_view suffix,
+                                                            uint64_t& generation) {
+        std::string_view view{ name };
+        if (view.size() <= prefix.size() + suffix.size() || !view.starts_with(prefix) ||
+            !view.ends_with(suffix))
+            return false;
+        view = view.substr(prefix.size(), view.size() - prefix.size() - suffix.size());
+        auto [ptr, error]{ std::from_chars(view.data(), view.data() + view.size(),
+                                           generation) };
+        return error == std::errc() && ptr == view.data() + view.size();
+    }
+
+    /// \brief Позволяет получить путь к журналу.
+    ///
+    /// \param generation Номер журнала.
+    ///
+    /// \return Путь к файлу.
+    template <class T, class S, class H>
+    [[nodiscard]]
+    inline std::filesystem::path DurableOrderedHashTable<T, S, H>::log_path(
+            const uint64_t& generation) const {
+        return this->directory_ / ("wal." + std::to_string(generation) + ".log");
+    }
+
+    /// \brief Позволяет получить путь к снимку.
+    ///
+    /// \param generation Номер первого журнала после снимка.
+    ///
+    /// \return Путь к файлу.
+    template <class T, class S, class H>
+    [[nodiscard]]
+    inline std::filesystem::path DurableOrderedHashTable<T, S, H>::snapshot_path(
+            const uint64_t& generation) const {
+        return this->directory_ / ("snapshot." + std::to_string(generation));
+    }
+
+    /// \brief Восстанавливает таблицу по последнему снимку и журналам.
+    ///
+    /// Недописанные снимки snapshot.<N>.tmp, оставшиеся после сбоя во
+    /// время сохранения, удаляются.
+    ///
+    /// \throw std::runtime_error Исключение возбуждается, если файл снимка
+    /// или заголовок журнала не подходят таблице.
+    template <class T, class S, class H>
+    void DurableOrderedHashTable<T, S, H>::recover() {
+        std::filesystem::create_directories(this->directory_);
+        uint64_t snapshot{};
+        bool has_snapshot{ false };
+        std::vector<uint64_t> logs;
+        std::vector<std::filesystem::path> stale;
+        for (const auto& entry : std::filesystem::directory_iterator(this->directory_)) {
+            const std::string name{ entry.path().filename().string() };
+            uint64_t generation;
+            if (parse_generation(name, "snapshot.", ".tmp", generation))
+                stale.push_back(entry.path());
+            else if (parse_generation(name, "snapshot.", "", generation)) {
+                if (!has_snapshot || generation > snapshot)
+                    snapshot = generation;
+                has_snapshot = true;
+            }
+            else if (parse_generation(name, "wal.", ".log", generation))
+                logs.push_back(generation);
+        }
+        for (const auto& path : stale)
+            std::filesystem::remove(path);
+
+        if (has_snapshot) {
+            auto mapped{ Snapshot::open_mapped(this->snapshot_path(snapshot)) };
+            this->table_.reserve(mapped.length());
+            for (auto [key, value] : mapped)
+                this->table_.insert(key, T(value));
+        }
+        std::sort(logs.begin(), logs.end());
+        this->generation_ = snapshot;
+        for (const uint64_t& generation : logs) {
+            if (generation < snapshot)
+                continue;
+            this->replay(this->log_path(generation));
+            this->generation_ = generation;
+        }
+        this->remove_older(snapshot);
+    }
+
+    /// \brief Проигрывает журнал поверх таблицы.
+    ///
+    /// Проигрывание останавливается на первой оборванной или
+    /// поврежденной записи, и журнал обрезается по последней целой
+    /// записи, чтобы новые записи шли после нее.
+    ///
+    /// \param path Путь к журналу.
+    template <class T, class S, class H>
+    void DurableOrderedHashTable<T, S, H>::replay(const std::filesystem::path& path) {
+        std::vector<char> data;
+        {
+            std::ifstream in{ path, std::ios::binary };
+            data.assign(std::istreambuf_iterator<char>(in),
+                        std::istreambuf_iterator<char>());
+        }
+        // Журнал без заголовка - оборванное создание, его можно дописать.
+        if (data.size() < sizeof(FileHeader)) {
+            std::filesystem::resize_file(path, 0);
+            return;
+        }
+        FileHeader header;
+        std::memcpy(&header, data.data(), sizeof(FileHeader));
+        if (std::memcmp(header.magic_, MAGIC, sizeof(MAGIC)) != 0 ||
+            header.version_ != VERSION ||
+            header.value_size_ != (IS_STRING_VALUE ? 0 : sizeof(T)))
+            throw std::runtime_error("\"" + path.string() + "\" is not a log of "
+                                     "this table.");
+
+        size_t offset{ sizeof(FileHeader) };
+        while (data.size() - offset >= RECORD_HEADER_SIZE) {
+            uint32_t length, crc;
+            std::memcpy(&length, data.data() + offset, sizeof(length));
+            std::memcpy(&crc, data.data() + offset + 4, sizeof(crc));
+            const char* payload{ data.data() + offset + RECORD_HEADER_SIZE };
+            if (length > data.size() - offset - RECORD_HEADER_SIZE ||
+                length < 5 || crc32(payload, length) != crc)
+                break;
+
+            auto operation{ static_cast<Operation>(payload[0]) };
+            uint32_t key_length;
+            std::memcpy(&key_length, payload + 1, sizeof(key_length));
+            if (key_length > length - 5)
+                break;
+            std::string_view key(payload + 5, key_length);
+            const char* value{ payload + 5 + key_length };
+            const size_t value_size{ length - 5 - key_length };
+
+            if (operation == Operation::ERASE)
+                this->table_.erase(key);
+            else if (operation == Operation::INSERT) {
+                if constexpr (IS_STRING_VALUE)
+                    this->table_.insert(key, std::string(value, value_size));
+                else {
+                    if (value_size != sizeof(T))
+                        break;
+                    T parsed;
+                    std::memcpy(&parsed, value, sizeof(T));
+                    this->table_.insert(key, parsed);
+                }
+            }
+            else
+                break;
+            offset += RECORD_HEADER_SIZE + length;
+        }
+        if (offset != data.size())
+            std::filesystem::resize_file(path, offset);
+    }
+
+    /// \brief Открывает журнал для дописывания, создавая его при
+    /// необходимости.
+    ///
+    /// \param generation Номер журнала.
+    ///
+    /// \throw std::runtime_error Исключение возбуждается, если файл не
+    /// удалось открыть.
+    template <class T, class S, class H>
+    void DurableOrderedHashTable<T, S, H>::open_log(const uint64_t& generation) {
+        const std::filesystem::path path{ this->log_path(generation) };
+        std::FILE* file{ std::fopen(path.string().c_str(), "ab") };
+        if (file == nullptr)
+            throw std::runtime_error("Cannot open log \"" + path.string() + "\".");
+        std::fseek(file, 0, SEEK_END);
+        long size{ std::ftell(file) };
+        if (size == 0) {
+            FileHeader header{};
+            std::memcpy(header.magic_, MAGIC, sizeof(MAGIC));
+            header.version_ = VERSION;
+            header.value_size_ = IS_STRING_VALUE ? 0 : sizeof(T);
+            if (std::fwrite(&header, sizeof(FileHeader), 1, file) != 1) {
+                std::fclose(file);
+                throw std::runtime_error("Cannot write log \"" + path.string() + "\".");
+            }
+            // Новый журнал и запись о нем в каталоге должны быть на диске
+            // до того, как в него попадут зафиксированные изменения.
+            try {
+                sync_file(file);
+                flush_directory(this->directory_);
+            }
+            catch (...) {
+                std::fclose(file);
+                throw;
+            }
+            size = sizeof(FileHeader);
+        }
+        if (this->log_file_ != nullptr)
+            std::fclose(this->log_file_);
+        this->log_file_ = file;
+        this->log_bytes_ = static_cast<uint64_t>(size);
+    }
+
+    /// \brief Сбрасывает буферы файла на диск.
+    ///
+    /// \param file Открытый файл.
+    ///
+    /// \throw std::runtime_error Исключение возбуждается при ошибке
+    /// сброса.
+    template <class T, class S, class H>
+    void DurableOrderedHashTable<T, S, H>::sync_file(std::FILE* file) {
+        bool synced{ std::fflush(file) == 0 };
+#ifdef _WIN32
+        synced = synced && _commit(_fileno(file)) == 0;
+#else
+        synced = synced && fsync(fileno(file)) == 0;
+#endif
+        if (!synced)
+            throw std::runtime_error("Cannot flush the log to disk.");
+    }
+
+    /// \brief Кодирует изменение в буфер журнала.
+    ///
+    /// Вызывается под mutex_. Запись: длина и CRC-32 содержимого, затем
+    /// вид изменения, длина ключа, ключ и байты значения.
+    ///
+    /// \param operation Вид изменения.
+    /// \param key Строковый ключ.
+    /// \param value Указатель на значение или nullptr для удаления.
+    template <class T, class S, class H>
+    void DurableOrderedHashTable<T, S, H>::append(Operation operation,
+                                                  std::string_view key,
+                                                  const T* value) {
+        const char* value_bytes{ nullptr };
+        size_t value_size{};
+        if (value != nullptr) {
+            if constexpr (IS_STRING_VALUE) {
+                value_bytes = value->data();
+                value_size = value->size();
+            }
+            else {
+                value_bytes = reinterpret_cast<const char*>(value);
+                value_size = sizeof(T);
+            }
+        }
+        const auto key_length{ static_cast<uint32_t>(key.size()) };
+        const auto length{ static_cast<uint32_t>(5 + key.size() + value_size) };
+
+        const size_t start{ this->buffer_.size() };
+        this->buffer_.resize(start + RECORD_HEADER_SIZE + length);
+        char* record{ this->buffer_.data() + start };
+        char* payload{ record + RECORD_HEADER_SIZE };
+        payload[0] = static_cast<char>(operation);
+        std::memcpy(payload + 1, &key_length, sizeof(key_length));
+        std::memcpy(payload + 5, key.data(), key.size());
+        if (value_size != 0)
+            std::memcpy(payload + 5 + key.size(), value_bytes, value_size);
+        const uint32_t crc{ crc32(payload, length) };
+        std::memcpy(record, &length, sizeof(length));
+        std::memcpy(record + 4, &crc, sizeof(crc));
+
+        this->pending_.push_back(Clock::now());
+        this->next_lsn_++;
+        if (this->buffer_.size() >= this->options_.flush_bytes_)
+            this->flush_wake_.notify_one();
+    }
+
+    /// \brief Ждет фиксации изменений с номерами меньше lsn.
+    ///
+    /// \param lsn Номер, до которого нужно дождаться фиксации.
+    /// \param lock Захваченный mutex_.
+    ///
+    /// \throw std::runtime_error Исключение возбуждается, если журнал не
+    /// удалось записать.
+    template <class T, class S, class H>
+    void DurableOrderedHashTable<T, S, H>::wait_for(const uint64_t& lsn,
+                                                    std::unique_lock<std::mutex>& lock) {
+        this->durable_.wait(lock, [this, &lsn] {
+            return this->failed_ || this->durable_lsn_ >= lsn;
+        });
+        if (this->failed_)
+            throw std::runtime_error("Cannot write the log.");
+    }
+
+    /// \brief Записывает накопленный буфер в журнал одним write и fsync.
+    ///
+    /// Вызывается под io_mutex_ и mutex_; на время записи mutex_ обычно
+    /// отпускается, так что потоки продолжают добавлять изменения в новый
+    /// буфер. io_mutex_ сохраняет порядок записей в файле.
+    ///
+    /// \param lock Захваченный mutex_.
+    /// \param release Отпускать ли mutex_ на время записи.
+    ///
+    /// \throw std::runtime_error Исключение возбуждается, если журнал не
+    /// удалось записать.
+    template <class T, class S, class H>
+    void DurableOrderedHashTable<T, S, H>::flush(std::unique_lock<std::mutex>& lock,
+                                                 const bool& release) {
+        if (this->buffer_.empty())
+            return;
+        std::vector<char> buffer;
+        std::vector<Clock::time_point> pending;
+        buffer.swap(this->buffer_);
+        pending.swap(this->pending_);
+        const uint64_t lsn{ this->next_lsn_ };
+
+        if (release)
+            lock.unlock();
+        bool written{ true };
+        try {
+            written = std::fwrite(buffer.data(), 1, buffer.size(), this->log_file_) ==
+                      buffer.size();
+            if (written)
+                sync_file(this->log_file_);
+        }
+        catch (const std::runtime_error&) {
+            written = false;
+        }
+        const Clock::time_point now{ Clock::now() };
+        if (release)
+            lock.lock();
+
+        if (!written) {
+            this->failed_ = true;
+            this->durable_.notify_all();
+            throw std::runtime_error("Cannot write the log.");
+        }
+        for (const Clock::time_point& added : pending) {
+            auto latency{ static_cast<uint64_t>(std::chrono::duration_cast<
+                    std::chrono::microseconds>(now - added).count()) };
+            size_t bucket{ (latency == 0) ? 0 : static_cast<size_t>(std::bit_width(latency) - 1) };
+            this->histogram_.buckets_[std::min(bucket, CommitLatencyHistogram::BUCKET_COUNT - 1)]++;
+            this->histogram_.max_microseconds_ = std::max(this->histogram_.max_microseconds_,
+                                                          latency);
+        }
+        this->log_bytes_ += buffer.size();
+        this->durable_lsn_ = lsn;
+        this->sync_requested_ = false;
+        this->durable_.notify_all();
+        // Буфер возвращается, чтобы не выделять память под следующий.
+        if (this->buffer_.empty()) {
+            buffer.clear();
+            this->buffer_.swap(buffer);
+        }
+    }
+
+    // Цикл фонового потока: сброс журнала по объему, интервалу или запросу.
+    template <class T, class S, class H>
+    void DurableOrderedHashTable<T, S, H>::flusher_loop() {
+        while (true) {
+            {
+                std::unique_lock lock{ this->mutex_ };
+                this->flush_wake_.wait_for(lock, this->options_.flush_interval_, [this] {
+                    return this->stopping_ || this->sync_requested_ ||
+                           this->buffer_.size() >= this->options_.flush_bytes_;
+                });
+                if (this->buffer_.empty()) {
+                    if (this->stopping_)
+                        return;
+                    continue;
+                }
+            }
+            std::lock_guard io_lock{ this->io_mutex_ };
+            std::unique_lock lock{ this->mutex_ };
+            try {
+                this->flush(lock);
+            }
+            catch (const std::runtime_error&) {
+                return;
+            }
+        }
+    }
+
+    /// \brief Начинает новый журнал и снимает копию таблицы.
+    ///
+    /// Накопленный буфер дописывается в текущий журнал, после чего все
+    /// последующие изменения идут в журнал со следующим номером. Остаток,
+    /// пришедший во время первой записи, дописывается без отпускания
+    /// mutex_, так что копия таблицы точно соответствует границе журналов.
+    ///
+    /// \param copy Таблица, в которую копируется текущая.
+    /// \param generation Номер нового журнала.
+    template <class T, class S, class H>
+    void DurableOrderedHashTable<T, S, H>::rotate(Table& copy, uint64_t& generation) {
+        std::lock_guard io_lock{ this->io_mutex_ };
+        std::unique_lock lock{ this->mutex_ };
+        this->flush(lock);
+        this->flush(lock, false);
+        copy = this->table_;
+        generation = this->generation_ + 1;
+        this->open_log(generation);
+        this->generation_ = generation;
+    }
+
+    /// \brief Удаляет снимки и журналы с номерами меньше указанного.
+    ///
+    /// \param generation Номер последнего снимка.
+    template <class T, class S, class H>
+    void DurableOrderedHashTable<T, S, H>::remove_older(const uint64_t& generation) {
+        std::error_code error;
+        for (const auto& entry : std::filesystem::directory_iterator(this->directory_,
+                                                                     error)) {
+            const std::string name{ entry.path().filename().string() };
+            uint64_t file_generation;
+            if ((parse_generation(name, "snapshot.", "", file_generation) ||
+                 parse_generation(name, "wal.", ".log", file_generation)) &&
+                file_generation < generation)
+                std::filesystem::remove(entry.path(), error);
+        }
+    }
+
+    // Запускает фоновое сжатие журнала, если оно еще не идет.
+    template <class T, class S, class H>
+    void DurableOrderedHashTable<T, S, H>::start_compaction() {
+        if (this->compacting_.exchange(true))
+            return;
+        if (this->compactor_.joinable())
+            this->compactor_.join();
+        this->compactor_ = std::thread([this] {
+            // checkpoint() удаляет старые файлы только после того, как
+            // новый снимок сброшен на диск.
+            try {
+                this->checkpoint();
+            }
+            catch (...) {
+                // Сжатие повторится при следующем превышении объема.
+            }
+            this->compacting_.store(false);
+        });
+    }
+
+// PUBLIC
+
+    /// \brief Стандартный конструктор экземпляра класса
+    /// DurableOrderedHashTable.
+    ///
+    /// Восстанавливает таблицу из каталога и запускает фоновый поток
+    /// сброса журнала.
+    ///
+    /// \param directory Каталог снимков и журналов; создается при
+    /// необходимости.
+    /// \param options Политика сброса и сжатия журнала.
+    ///
+    /// \throw std::runtime_error Исключение возбуждается, если файлы
+    /// каталога не удалось прочитать или они не подходят таблице.
+    template <class T, class S, class H>
+    DurableOrderedHashTable<T, S, H>::DurableOrderedHashTable(
+            std::filesystem::path directory, const WalOptions& options) :
+            directory_(std::move(directory)), options_(options), table_(),
+            next_lsn_(0), durable_lsn_(0), generation_(0), log_bytes_(0),
+            sync_requested_(false), stopping_(false), failed_(false),
+            histogram_(), log_file_(nullptr), compacting_(false) {
+        this->recover();
+        this->open_log(this->generation_);
+        this->flusher_ = std::thread(&DurableOrderedHashTable::flusher_loop, this);
+    }
+
+    /// \brief Стандартный деструктор экземпляра.
+    ///
+    /// Дожидается сжатия журнала и записывает оставшиеся изменения.
+    template <class T, class S, class H>
+    DurableOrderedHashTable<T, S, H>::~DurableOrderedHashTable() {
+        if (this->compactor_.joinable())
+            this->compactor_.join();
+        {
+            std::lock_guard lock{ this->mutex_ };
+            this->stopping_ = true;
+        }
+        this->flush_wake_.notify_one();
+        this->flusher_.join();
+        if (this->log_file_ != nullptr) {
+            std::lock_guard lock{ this->mutex_ };
+            if (!this->buffer_.empty())
+                static_cast<void>(std::fwrite(this->buffer_.data(), 1,
+                                              this->buffer_.size(), this->log_file_));
+            std::fclose(this->log_file_);
+        }
+    }
+
+    /// \brief Метод, добавляющий элемент или изменяющий его значение.
+    ///
+    /// \param key Строковый ключ элемента для вставки/изменения.
+    /// \param value Значение элемента для вставки/изменения.
+    ///
+    /// \throw std::runtime_error Исключение возбуждается, если журнал не
+    /// удалось записать.
+    template <class T, class S, class H>
+    [[maybe_unused]]
+    void DurableOrderedHashTable<T, S, H>::insert(std::string_view key, const T& value) {
+        std::unique_lock lock{ this->mutex_ };
+        if (this->failed_)
+            throw std::runtime_error("Cannot write the log.");
+        this->table_.insert_or_assign(key, value);
+        this->append(Operation::INSERT, key, &value);
+        const uint64_t lsn{ this->next_lsn_ };
+        if (this->log_bytes_ + this->buffer_.size() >= this->options_.compact_bytes_)
+            this->start_compaction();
+        if (this->options_.wait_durable_)
+            this->wait_for(lsn, lock);
+    }
+
+    /// \brief Метод, стирающий из хеш-таблицы элемент с указанным ключом.
+    ///
+    /// \param key Строковый ключ элемента, который требуется удалить.
+    ///
+    /// \return true, если элемент был удален.
+    ///
+    /// \throw std::runtime_error Исключение возбуждается, если журнал не
+    /// удалось записать.
+    template <class T, class S, class H>
+    [[maybe_unused]]
+    bool DurableOrderedHashTable<T, S, H>::erase(std::string_view key) {
+        std::unique_lock lock{ this->mutex_ };
+        if (this->failed_)
+            throw std::runtime_error("Cannot write the log.");
+        const uint32_t length{ this->table_.length() };
+        this->table_.erase(key);
+        if (this->table_.length() == length)
+            return false;
+        this->append(Operation::ERASE, key, nullptr);
+        const uint64_t lsn{ this->next_lsn_ };
+        if (this->options_.wait_durable_)
+            this->wait_for(lsn, lock);
+        return true;
+    }
+
+    /// \brief Удаляет последний добавленный элемент и возвращает его.
+    ///
+    /// \return Значение извлеченного элемента или стандартное значение для
+    /// пустой таблицы.
+    ///
+    /// \throw std::runtime_error Исключение возбуждается, если журнал не
+    /// удалось записать.
+    template <class T, class S, class H>
+    [[maybe_unused]]
+    T DurableOrderedHashTable<T, S, H>::pop() {
+        std::unique_lock lock{ this->mutex_ };
+        if (this->failed_)
+            throw std::runtime_error("Cannot write the log.");
+        if (this->table_.length() == 0)
+            return T{};
+        const std::string key{ this->table_.order_.back()->key_ };
+        T value{ this->table_.pop() };
+        this->append(Operation::ERASE, key, nullptr);
+        const uint64_t lsn{ this->next_lsn_ };
+        if (this->options_.wait_durable_)
+            this->wait_for(lsn, lock);
+        return value;
+    }
+
+    /// \brief Метод, позволяющий получить значение элемента по ключу.
+    ///
+    /// \param key Строковый ключ, значение по которому нужно найти.
+    ///
+    /// \return Копию значения или стандартное значение, если ключа нет.
+    template <class T, class S, class H>
+    [[nodiscard]] [[maybe_unused]]
+    T DurableOrderedHashTable<T, S, H>::get(std::string_view key) const {
+        std::lock_guard lock{ this->mutex_ };
+        auto* record{ this->table_.find(key, this->table_.hash_function(key)) };
+        return (record != nullptr) ? record->value_ : T{};
+    }
+
+    /// \brief Проверяет, есть ли в таблице элемент с указанным ключом.
+    ///
+    /// \param key Строковый ключ.
+    ///
+    /// \return Булевое значение.
+    template <class T, class S, class H>
+    [[nodiscard]] [[maybe_unused]]
+    bool DurableOrderedHashTable<T, S, H>::contains(std::string_view key) const {
+        std::lock_guard lock{ this->mutex_ };
+        return this->table_.find(key, this->table_.hash_function(key)) != nullptr;
+    }
+
+    /// \brief Предоставляет доступ к количеству элементов таблицы.
+    ///
+    /// \return Значение кол-ва элементов.
+    template <class T, class S, class H>
+    [[nodiscard]] [[maybe_unused]]
+    size_t DurableOrderedHashTable<T, S, H>::length() const {
+        std::lock_guard lock{ this->mutex_ };
+        return this->table_.length();
+    }
+
+    /// \brief Дожидается фиксации всех уже сделанных изменений.
+    ///
+    /// \throw std::runtime_error Исключение возбуждается, если журнал не
+    /// удалось записать.
+    template <class T, class S, class H>
+    [[maybe_unused]]
+    void DurableOrderedHashTable<T, S, H>::sync() {
+        std::unique_lock lock{ this->mutex_ };
+        const uint64_t lsn{ this->next_lsn_ };
+        this->sync_requested_ = true;
+        this->flush_wake_.notify_one();
+        this->wait_for(lsn, lock);
+    }
+
+    /// \brief Записывает снимок таблицы и удаляет журналы до него.
+    ///
+    /// Таблица копируется на границе журналов, поэтому запись снимка идет
+    /// без блокировки и не задерживает изменения. Прежние снимок и
+    /// журналы удаляются только после того, как новый снимок сброшен на
+    /// диск и переименован, а каталог сброшен: до этого при сбое
+    /// восстановление идет по ним.
+    ///
+    /// \throw std::runtime_error Исключение возбуждается при ошибке
+    /// записи.
+    template <class T, class S, class H>
+    [[maybe_unused]]
+    void DurableOrderedHashTable<T, S, H>::checkpoint() {
+        Table copy;
+        uint64_t generation;
+        this->rotate(copy, generation);
+        // save() возвращает управление, когда снимок и каталог уже на диске.
+        Snapshot::save(copy, this->snapshot_path(generation));
+        this->remove_older(generation);
+    }
+
+    /// \brief Позволяет получить распределение задержек фиксации.
+    ///
+    /// \return Копию гистограммы.
+    template <class T, class S, class H>
+    [[nodiscard]] [[maybe_unused]]
+    CommitLatencyHistogram DurableOrderedHashTable<T, S, H>::commit_latency() const {
+        std::lock_guard lock{ this->mutex_ };
+        return this->histogram_;
+    }
+}
+
+#endif